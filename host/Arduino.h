@@ -0,0 +1,93 @@
+/*********
+  SEMBox Host Emulator - Arduino core
+  Timing, GPIO, Serial and ESP on a Linux host (see host_emulator.h)
+*********/
+
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <stdarg.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include "WString.h"
+#include "esp_err.h"
+#include "esp_system.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+using std::max;
+using std::min;
+
+#if defined(__GLIBC__) && (__GLIBC__ < 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ < 38))
+// Part of newlib on the ESP32, of glibc only from 2.38
+inline size_t strlcpy(char* destination, const char* source, size_t size) {
+    size_t length = strlen(source);
+    if (size) {
+        size_t copied = length < size - 1 ? length : size - 1;
+        memcpy(destination, source, copied);
+        destination[copied] = 0;
+    }
+    return length;
+}
+#endif
+
+#define IRAM_ATTR
+#define PROGMEM
+
+#define LOW 0
+#define HIGH 1
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+#define RISING 0x01
+#define FALLING 0x02
+#define CHANGE 0x03
+#define LED_BUILTIN 2
+
+unsigned long millis();
+unsigned long micros();
+void delay(uint32_t ms);
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+void attachInterruptArg(uint8_t pin, void (*handler)(void*), void* arg, int mode);
+
+class HardwareSerial {
+public:
+    void begin(unsigned long baud) {}
+    size_t print(const char* text);
+    size_t println(const char* text = "");
+    size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+};
+
+extern HardwareSerial Serial;
+
+class IPAddress {
+public:
+    IPAddress() : _address(0) {}
+    IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d)
+        : _address(a | (b << 8) | (c << 16) | ((uint32_t)d << 24)) {}
+    operator uint32_t() const { return _address; }
+    String toString() const;
+
+private:
+    uint32_t _address;          // First octet in the low byte, as on the ESP32
+};
+
+class EspClass {
+public:
+    uint32_t getHeapSize();
+    uint32_t getFreeHeap();
+    uint32_t getFlashChipSize() { return 4 * 1024 * 1024; }
+    uint32_t getSketchSize();
+};
+
+extern EspClass ESP;
+
+#endif // HOST_ARDUINO_H
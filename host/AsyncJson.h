@@ -0,0 +1,64 @@
+/*********
+  SEMBox Host Emulator - AsyncCallbackJsonWebHandler
+  Collects an application/json body of up to the maximum length, parses
+  it with ArduinoJson and passes the root to the callback. A body that
+  is too long is answered with 413, one that does not parse with 400.
+*********/
+
+#ifndef HOST_ASYNC_JSON_H
+#define HOST_ASYNC_JSON_H
+
+#include <strings.h>
+#include <ArduinoJson.h>
+#include "ESPAsyncWebServer.h"
+
+typedef std::function<void(AsyncWebServerRequest* request, JsonVariant& json)> ArJsonRequestHandlerFunction;
+
+class AsyncCallbackJsonWebHandler : public AsyncWebHandler {
+public:
+    AsyncCallbackJsonWebHandler(const String& uri, ArJsonRequestHandlerFunction onRequest)
+        : _uri(uri), _method(HTTP_POST | HTTP_PUT | HTTP_PATCH), _onRequest(onRequest), _maxContentLength(16384) {}
+
+    void setMethod(WebRequestMethodComposite method) { _method = method; }
+    void setMaxContentLength(size_t maxContentLength) { _maxContentLength = maxContentLength; }
+
+    bool canHandle(AsyncWebServerRequest* request) override {
+        return _onRequest && (_method & request->method())
+            && AsyncCallbackWebHandler::matches(_uri, request->url())
+            && strcasecmp(request->contentType().c_str(), "application/json") == 0;
+    }
+
+    void handleRequest(AsyncWebServerRequest* request) override {
+        if (request->_tempObject) {
+            JsonDocument document;
+            if (!deserializeJson(document, (const char*)request->_tempObject, request->contentLength())) {
+                JsonVariant json = document.as<JsonVariant>();
+                _onRequest(request, json);
+                return;
+            }
+        }
+        request->send(request->contentLength() > _maxContentLength ? 413 : 400);
+    }
+
+    void handleBody(AsyncWebServerRequest* request, uint8_t* data, size_t len, size_t index,
+                    size_t total) override {
+        if (total > _maxContentLength) {
+            return;
+        }
+        if (index == 0) {
+            request->_tempObject = malloc(total + 1);
+        }
+        if (request->_tempObject) {
+            memcpy((uint8_t*)request->_tempObject + index, data, len);
+            ((char*)request->_tempObject)[index + len] = 0;
+        }
+    }
+
+private:
+    String _uri;
+    WebRequestMethodComposite _method;
+    ArJsonRequestHandlerFunction _onRequest;
+    size_t _maxContentLength;
+};
+
+#endif // HOST_ASYNC_JSON_H
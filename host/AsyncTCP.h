@@ -0,0 +1,12 @@
+/*********
+  SEMBox Host Emulator - AsyncTCP
+  The connection handling lives in the server emulation
+  (ESPAsyncWebServer.h); this header only exists for the include.
+*********/
+
+#ifndef HOST_ASYNC_TCP_H
+#define HOST_ASYNC_TCP_H
+
+#include <Arduino.h>
+
+#endif // HOST_ASYNC_TCP_H
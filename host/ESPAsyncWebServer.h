@@ -0,0 +1,280 @@
+/*********
+  SEMBox Host Emulator - AsyncWebServer
+  The ESPAsyncWebServer API on POSIX sockets (host_server.cpp)
+
+  One thread accepts connections, parses requests, runs the handlers and
+  writes the responses, so handlers never overlap, as with AsyncTCP.
+  Handlers are matched like the library does: in registration order, a
+  handler for "/x" also taking "/x/...", and the not-found handler
+  last. Every response closes its connection, as on the device.
+*********/
+
+#ifndef HOST_ESP_ASYNC_WEB_SERVER_H
+#define HOST_ESP_ASYNC_WEB_SERVER_H
+
+#include <Arduino.h>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+typedef enum {
+    HTTP_GET = 0b00000001,
+    HTTP_POST = 0b00000010,
+    HTTP_DELETE = 0b00000100,
+    HTTP_PUT = 0b00001000,
+    HTTP_PATCH = 0b00010000,
+    HTTP_HEAD = 0b00100000,
+    HTTP_OPTIONS = 0b01000000,
+    HTTP_ANY = 0b01111111
+} WebRequestMethod;
+
+typedef uint8_t WebRequestMethodComposite;
+
+// Returned by a chunked response callback that has no data yet
+#define RESPONSE_TRY_AGAIN 0xFFFFFFFF
+
+class AsyncWebServer;
+class AsyncWebServerRequest;
+class HostConnection;
+
+class AsyncWebParameter {
+public:
+    AsyncWebParameter(const String& name, const String& value) : _name(name), _value(value) {}
+    const String& name() const { return _name; }
+    const String& value() const { return _value; }
+    bool isPost() const { return false; }
+    bool isFile() const { return false; }
+
+private:
+    String _name;
+    String _value;
+};
+
+typedef std::function<size_t(uint8_t* buffer, size_t maxLen, size_t index)> AwsResponseFiller;
+typedef std::function<void(void)> ArDisconnectHandler;
+
+class AsyncWebServerResponse {
+public:
+    AsyncWebServerResponse(int code, const String& contentType) : _code(code), _contentType(contentType) {}
+    virtual ~AsyncWebServerResponse() {}
+
+    void setCode(int code) { _code = code; }
+    void addHeader(const String& name, const String& value) { _headers.push_back({ name, value }); }
+
+    // Body length, or -1 if it is sent chunked
+    virtual long contentLength() const = 0;
+
+    // Next part of the body: bytes written, 0 at the end, or RESPONSE_TRY_AGAIN
+    virtual size_t fill(uint8_t* buffer, size_t maxLength, size_t index) = 0;
+
+    std::string head() const;
+
+protected:
+    int _code;
+    String _contentType;
+    std::vector<std::pair<String, String>> _headers;
+};
+
+class AsyncBasicResponse : public AsyncWebServerResponse {
+public:
+    AsyncBasicResponse(int code, const String& contentType, const uint8_t* data, size_t length, bool copy);
+
+    long contentLength() const override { return _length; }
+    size_t fill(uint8_t* buffer, size_t maxLength, size_t index) override;
+
+private:
+    std::string _copy;
+    const uint8_t* _data;       // _copy, or data that stays valid (PROGMEM)
+    size_t _length;
+};
+
+class AsyncChunkedResponse : public AsyncWebServerResponse {
+public:
+    AsyncChunkedResponse(const String& contentType, AwsResponseFiller filler)
+        : AsyncWebServerResponse(200, contentType), _filler(filler) {}
+
+    long contentLength() const override { return -1; }
+    size_t fill(uint8_t* buffer, size_t maxLength, size_t index) override { return _filler(buffer, maxLength, index); }
+
+private:
+    AwsResponseFiller _filler;
+};
+
+class AsyncResponseStream : public AsyncWebServerResponse {
+public:
+    AsyncResponseStream(const String& contentType) : AsyncWebServerResponse(200, contentType) {}
+
+    size_t write(uint8_t data) { _body.push_back((char)data); return 1; }
+    size_t write(const uint8_t* data, size_t length) { _body.append((const char*)data, length); return length; }
+    size_t print(const char* text) { return write((const uint8_t*)text, strlen(text)); }
+
+    long contentLength() const override { return _body.size(); }
+    size_t fill(uint8_t* buffer, size_t maxLength, size_t index) override;
+
+private:
+    std::string _body;
+};
+
+class AsyncWebServerRequest {
+public:
+    AsyncWebServerRequest(AsyncWebServer* server, HostConnection* connection);
+    ~AsyncWebServerRequest();
+
+    void* _tempObject;          // Handler data, freed with the request
+
+    const String& url() const { return _url; }
+    WebRequestMethodComposite method() const { return _method; }
+    const String& contentType() const { return _contentType; }
+    size_t contentLength() const { return _contentLength; }
+
+    bool hasParam(const char* name, bool post = false, bool file = false) const;
+    const AsyncWebParameter* getParam(const char* name, bool post = false, bool file = false) const;
+    size_t params() const { return _params.size(); }
+    const AsyncWebParameter* getParam(size_t index) const;
+
+    bool hasHeader(const char* name) const;
+    String header(const char* name) const;
+
+    // Called once when the connection closes, after the response was sent
+    void onDisconnect(ArDisconnectHandler handler) { _onDisconnect = handler; }
+
+    void send(AsyncWebServerResponse* response);
+    void send(int code, const String& contentType = String(), const String& content = String());
+    void send_P(int code, const String& contentType, const uint8_t* content, size_t length);
+
+    AsyncWebServerResponse* beginResponse(int code, const String& contentType = String(),
+                                          const String& content = String());
+    AsyncWebServerResponse* beginResponse_P(int code, const String& contentType, const uint8_t* content,
+                                            size_t length);
+    AsyncWebServerResponse* beginChunkedResponse(const String& contentType, AwsResponseFiller filler);
+    AsyncResponseStream* beginResponseStream(const String& contentType, size_t bufferSize = 1460);
+
+private:
+    friend class HostConnection;
+
+    bool parseHead(const std::string& head);
+
+    AsyncWebServer* _server;
+    HostConnection* _connection;
+    String _url;
+    WebRequestMethodComposite _method;
+    String _contentType;
+    size_t _contentLength;
+    std::vector<AsyncWebParameter> _params;
+    std::vector<std::pair<String, String>> _requestHeaders;
+    std::unique_ptr<AsyncWebServerResponse> _response;
+    ArDisconnectHandler _onDisconnect;
+};
+
+typedef std::function<void(AsyncWebServerRequest* request)> ArRequestHandlerFunction;
+typedef std::function<void(AsyncWebServerRequest* request, const String& filename, size_t index, uint8_t* data,
+                           size_t len, bool final)> ArUploadHandlerFunction;
+typedef std::function<void(AsyncWebServerRequest* request, uint8_t* data, size_t len, size_t index,
+                           size_t total)> ArBodyHandlerFunction;
+
+class AsyncWebHandler {
+public:
+    virtual ~AsyncWebHandler() {}
+    virtual bool canHandle(AsyncWebServerRequest* request) = 0;
+    virtual void handleRequest(AsyncWebServerRequest* request) = 0;
+    virtual void handleBody(AsyncWebServerRequest* request, uint8_t* data, size_t len, size_t index,
+                            size_t total) {}
+
+    // Keep the connection open for the handler (event streams)
+    virtual bool takesConnection() const { return false; }
+    virtual void attach(AsyncWebServerRequest* request, HostConnection* connection) {}
+};
+
+class AsyncCallbackWebHandler : public AsyncWebHandler {
+public:
+    AsyncCallbackWebHandler(const String& uri, WebRequestMethodComposite method, ArRequestHandlerFunction onRequest,
+                            ArUploadHandlerFunction onUpload, ArBodyHandlerFunction onBody)
+        : _uri(uri), _method(method), _onRequest(onRequest), _onUpload(onUpload), _onBody(onBody) {}
+
+    bool canHandle(AsyncWebServerRequest* request) override;
+    void handleRequest(AsyncWebServerRequest* request) override;
+    void handleBody(AsyncWebServerRequest* request, uint8_t* data, size_t len, size_t index,
+                    size_t total) override;
+
+    static bool matches(const String& uri, const String& url);
+
+private:
+    String _uri;
+    WebRequestMethodComposite _method;
+    ArRequestHandlerFunction _onRequest;
+    ArUploadHandlerFunction _onUpload;
+    ArBodyHandlerFunction _onBody;
+};
+
+class AsyncEventSourceClient {
+public:
+    explicit AsyncEventSourceClient(HostConnection* connection) : _connection(connection) {}
+
+    void send(const char* message, const char* event = nullptr, uint32_t id = 0, uint32_t reconnect = 0);
+    bool connected() const;
+
+private:
+    friend class AsyncEventSource;
+
+    HostConnection* _connection;
+};
+
+typedef std::function<void(AsyncEventSourceClient* client)> ArEventHandlerFunction;
+
+class AsyncEventSource : public AsyncWebHandler {
+public:
+    explicit AsyncEventSource(const String& url) : _url(url) {}
+    ~AsyncEventSource();
+
+    void onConnect(ArEventHandlerFunction callback) { _connect = callback; }
+
+    // Any task; queued on every connected client
+    void send(const char* message, const char* event = nullptr, uint32_t id = 0, uint32_t reconnect = 0);
+    size_t count() const;
+
+    bool canHandle(AsyncWebServerRequest* request) override;
+    void handleRequest(AsyncWebServerRequest* request) override {}
+    bool takesConnection() const override { return true; }
+    void attach(AsyncWebServerRequest* request, HostConnection* connection) override;
+
+    // A client's connection closed (server thread)
+    void detach(HostConnection* connection);
+
+private:
+    String _url;
+    ArEventHandlerFunction _connect;
+    mutable std::mutex _lock;
+    std::vector<std::unique_ptr<AsyncEventSourceClient>> _clients;
+};
+
+class AsyncWebServer {
+public:
+    explicit AsyncWebServer(uint16_t port) : _port(port) {}
+    ~AsyncWebServer();
+
+    void begin();
+    void end();
+
+    AsyncCallbackWebHandler& on(const char* uri, ArRequestHandlerFunction onRequest);
+    AsyncCallbackWebHandler& on(const char* uri, WebRequestMethodComposite method,
+                                ArRequestHandlerFunction onRequest);
+    AsyncCallbackWebHandler& on(const char* uri, WebRequestMethodComposite method,
+                                ArRequestHandlerFunction onRequest, ArUploadHandlerFunction onUpload,
+                                ArBodyHandlerFunction onBody = nullptr);
+    AsyncWebHandler& addHandler(AsyncWebHandler* handler);
+    void onNotFound(ArRequestHandlerFunction handler) { _notFound = handler; }
+
+    // First handler for the request, nullptr for the not-found handler
+    AsyncWebHandler* findHandler(AsyncWebServerRequest* request);
+    void notFound(AsyncWebServerRequest* request);
+
+private:
+    uint16_t _port;
+    std::vector<AsyncWebHandler*> _handlers;
+    std::vector<std::unique_ptr<AsyncWebHandler>> _owned;
+    ArRequestHandlerFunction _notFound;
+};
+
+#endif // HOST_ESP_ASYNC_WEB_SERVER_H
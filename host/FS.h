@@ -0,0 +1,61 @@
+/*********
+  SEMBox Host Emulator - File system API
+  fs::FS on a directory of the host: paths are relative to its root.
+*********/
+
+#ifndef HOST_FS_H
+#define HOST_FS_H
+
+#include <Arduino.h>
+#include <memory>
+#include <string>
+
+#define FILE_READ "r"
+#define FILE_WRITE "w"
+#define FILE_APPEND "a"
+
+namespace fs {
+
+class File {
+public:
+    File() {}
+
+    explicit operator bool() const { return _file != nullptr || _directory != nullptr; }
+
+    size_t write(const uint8_t* buffer, size_t length);
+    size_t read(uint8_t* buffer, size_t length);
+    bool seek(uint32_t position);
+    size_t position() const;
+    size_t size() const;
+    void flush();
+    void close();
+
+    const char* name() const;       // Last path component
+    const char* path() const { return _path.c_str(); }
+    bool isDirectory() const { return _directory != nullptr; }
+    File openNextFile();
+
+private:
+    friend class FS;
+
+    std::shared_ptr<FILE> _file;
+    std::shared_ptr<void> _directory;  // DIR
+    std::string _path;              // As passed to FS::open()
+    std::string _hostPath;
+};
+
+class FS {
+public:
+    File open(const char* path, const char* mode = FILE_READ);
+    bool exists(const char* path);
+    bool mkdir(const char* path);
+    bool remove(const char* path);
+    bool rename(const char* from, const char* to);
+
+protected:
+    std::string _root;              // Host directory, empty until mounted
+};
+
+} // namespace fs
+
+#endif // HOST_FS_H
@@ -0,0 +1,27 @@
+/*********
+  SEMBox Host Emulator - LittleFS
+  A partition's file system is the directory fs/<label>/ of the data
+  directory. The size comes from src/SEMBox/partitions.csv.
+*********/
+
+#ifndef HOST_LITTLEFS_H
+#define HOST_LITTLEFS_H
+
+#include "FS.h"
+
+class LittleFSFS : public fs::FS {
+public:
+    bool begin(bool formatOnFail = false, const char* basePath = "/littlefs", uint8_t maxOpenFiles = 10,
+               const char* partitionLabel = "spiffs");
+    void end();
+    bool format();
+    size_t totalBytes();
+    size_t usedBytes();
+
+private:
+    std::string _label;
+};
+
+extern LittleFSFS LittleFS;
+
+#endif // HOST_LITTLEFS_H
@@ -0,0 +1,48 @@
+/*********
+  SEMBox Host Emulator - Preferences (NVS)
+  One file per key in nvs/<namespace>/ of the data directory. A value
+  is replaced by writing a new file and renaming it, so a key is never
+  left half written.
+*********/
+
+#ifndef HOST_PREFERENCES_H
+#define HOST_PREFERENCES_H
+
+#include <Arduino.h>
+#include <string>
+
+class Preferences {
+public:
+    bool begin(const char* name, bool readOnly = false, const char* partitionLabel = nullptr);
+    void end();
+
+    bool isKey(const char* key);
+    bool remove(const char* key);
+    bool clear();
+
+    size_t putBytes(const char* key, const void* value, size_t length);
+    size_t getBytesLength(const char* key);
+    size_t getBytes(const char* key, void* buffer, size_t maxLength);
+
+    size_t putInt(const char* key, int32_t value) { return putBytes(key, &value, sizeof(value)); }
+    size_t putUInt(const char* key, uint32_t value) { return putBytes(key, &value, sizeof(value)); }
+    size_t putFloat(const char* key, float value) { return putBytes(key, &value, sizeof(value)); }
+    int32_t getInt(const char* key, int32_t defaultValue = 0) { return get(key, defaultValue); }
+    uint32_t getUInt(const char* key, uint32_t defaultValue = 0) { return get(key, defaultValue); }
+    float getFloat(const char* key, float defaultValue = NAN) { return get(key, defaultValue); }
+
+private:
+    template <typename T>
+    T get(const char* key, T defaultValue) {
+        T value;
+        return getBytesLength(key) == sizeof(T) && getBytes(key, &value, sizeof(T)) == sizeof(T)
+            ? value : defaultValue;
+    }
+
+    std::string path(const char* key) const;
+
+    std::string _directory;     // Empty until begin()
+    bool _readOnly = false;
+};
+
+#endif // HOST_PREFERENCES_H
@@ -0,0 +1,78 @@
+/*********
+  SEMBox Host Emulator - String
+  The subset of the Arduino String class used by the firmware, the web
+  server emulation and ArduinoJson (concat() and StringSumHelper)
+*********/
+
+#ifndef HOST_WSTRING_H
+#define HOST_WSTRING_H
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string>
+
+class String {
+public:
+    String() {}
+    String(const char* text) { if (text) _text = text; }
+    String(const char* text, size_t length) : _text(text, length) {}
+    String(const std::string& text) : _text(text) {}
+    explicit String(char c) : _text(1, c) {}
+    explicit String(int value) : _text(std::to_string(value)) {}
+    explicit String(unsigned value) : _text(std::to_string(value)) {}
+    explicit String(long value) : _text(std::to_string(value)) {}
+    explicit String(unsigned long value) : _text(std::to_string(value)) {}
+
+    String& operator=(const char* text) {
+        // ArduinoJson assigns nullptr to reset a string before writing
+        if (text) {
+            _text = text;
+        } else {
+            _text.clear();
+        }
+        return *this;
+    }
+
+    const char* c_str() const { return _text.c_str(); }
+    unsigned int length() const { return _text.length(); }
+    bool isEmpty() const { return _text.empty(); }
+    bool reserve(unsigned int size) { _text.reserve(size); return true; }
+
+    bool concat(const char* text) { if (text) _text += text; return true; }
+    bool concat(const char* text, unsigned int length) { _text.append(text, length); return true; }
+    bool concat(const String& text) { _text += text._text; return true; }
+    bool concat(char c) { _text += c; return true; }
+    String& operator+=(const char* text) { concat(text); return *this; }
+    String& operator+=(const String& text) { concat(text); return *this; }
+    String& operator+=(char c) { concat(c); return *this; }
+
+    int indexOf(char c, unsigned int from = 0) const {
+        size_t found = _text.find(c, from);
+        return found == std::string::npos ? -1 : (int)found;
+    }
+    int indexOf(const char* text, unsigned int from = 0) const {
+        size_t found = _text.find(text, from);
+        return found == std::string::npos ? -1 : (int)found;
+    }
+    int indexOf(const String& text, unsigned int from = 0) const { return indexOf(text.c_str(), from); }
+
+    long toInt() const { return strtol(_text.c_str(), nullptr, 10); }
+    float toFloat() const { return strtof(_text.c_str(), nullptr); }
+
+    bool equals(const String& other) const { return _text == other._text; }
+    bool operator==(const String& other) const { return _text == other._text; }
+    bool operator==(const char* other) const { return other && _text == other; }
+    bool operator!=(const String& other) const { return _text != other._text; }
+    char operator[](unsigned int index) const { return index < _text.size() ? _text[index] : 0; }
+
+private:
+    std::string _text;
+};
+
+class StringSumHelper : public String {
+public:
+    StringSumHelper(const String& text) : String(text) {}
+    StringSumHelper(const char* text) : String(text) {}
+};
+
+#endif // HOST_WSTRING_H
@@ -0,0 +1,28 @@
+/*********
+  SEMBox Host Emulator - WiFi
+  No radio: the access point "runs" on the loopback address.
+*********/
+
+#ifndef HOST_WIFI_H
+#define HOST_WIFI_H
+
+#include <Arduino.h>
+
+typedef enum {
+    WIFI_OFF,
+    WIFI_STA,
+    WIFI_AP,
+    WIFI_AP_STA
+} wifi_mode_t;
+
+class WiFiClass {
+public:
+    bool mode(wifi_mode_t mode) { return true; }
+    bool softAP(const char* ssid, const char* password = nullptr) { return true; }
+    IPAddress softAPIP() { return IPAddress(127, 0, 0, 1); }
+    uint8_t softAPgetStationNum() { return 0; }
+};
+
+extern WiFiClass WiFi;
+
+#endif // HOST_WIFI_H
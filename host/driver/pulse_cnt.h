@@ -0,0 +1,68 @@
+/*********
+  SEMBox Host Emulator - Pulse counter
+  There is no encoder on the host: creating a unit fails, and the
+  firmware runs without position feedback.
+*********/
+
+#ifndef HOST_DRIVER_PULSE_CNT_H
+#define HOST_DRIVER_PULSE_CNT_H
+
+#include <stdint.h>
+#include "esp_err.h"
+
+typedef struct HostPcntUnit* pcnt_unit_handle_t;
+typedef struct HostPcntChannel* pcnt_channel_handle_t;
+
+typedef struct {
+    int low_limit;
+    int high_limit;
+    int intr_priority;
+} pcnt_unit_config_t;
+
+typedef struct {
+    int edge_gpio_num;
+    int level_gpio_num;
+} pcnt_chan_config_t;
+
+typedef struct {
+    uint32_t max_glitch_ns;
+} pcnt_glitch_filter_config_t;
+
+typedef enum {
+    PCNT_CHANNEL_EDGE_ACTION_HOLD,
+    PCNT_CHANNEL_EDGE_ACTION_INCREASE,
+    PCNT_CHANNEL_EDGE_ACTION_DECREASE
+} pcnt_channel_edge_action_t;
+
+typedef enum {
+    PCNT_CHANNEL_LEVEL_ACTION_KEEP,
+    PCNT_CHANNEL_LEVEL_ACTION_INVERSE,
+    PCNT_CHANNEL_LEVEL_ACTION_HOLD
+} pcnt_channel_level_action_t;
+
+inline esp_err_t pcnt_new_unit(const pcnt_unit_config_t* config, pcnt_unit_handle_t* unit) {
+    return ESP_ERR_NOT_SUPPORTED;
+}
+inline esp_err_t pcnt_del_unit(pcnt_unit_handle_t unit) { return ESP_ERR_INVALID_STATE; }
+inline esp_err_t pcnt_unit_set_glitch_filter(pcnt_unit_handle_t unit, const pcnt_glitch_filter_config_t* config) {
+    return ESP_ERR_INVALID_STATE;
+}
+inline esp_err_t pcnt_new_channel(pcnt_unit_handle_t unit, const pcnt_chan_config_t* config,
+                                  pcnt_channel_handle_t* channel) {
+    return ESP_ERR_INVALID_STATE;
+}
+inline esp_err_t pcnt_del_channel(pcnt_channel_handle_t channel) { return ESP_ERR_INVALID_STATE; }
+inline esp_err_t pcnt_channel_set_edge_action(pcnt_channel_handle_t channel, pcnt_channel_edge_action_t rising,
+                                              pcnt_channel_edge_action_t falling) {
+    return ESP_ERR_INVALID_STATE;
+}
+inline esp_err_t pcnt_channel_set_level_action(pcnt_channel_handle_t channel, pcnt_channel_level_action_t high,
+                                               pcnt_channel_level_action_t low) {
+    return ESP_ERR_INVALID_STATE;
+}
+inline esp_err_t pcnt_unit_enable(pcnt_unit_handle_t unit) { return ESP_ERR_INVALID_STATE; }
+inline esp_err_t pcnt_unit_clear_count(pcnt_unit_handle_t unit) { return ESP_ERR_INVALID_STATE; }
+inline esp_err_t pcnt_unit_start(pcnt_unit_handle_t unit) { return ESP_ERR_INVALID_STATE; }
+inline esp_err_t pcnt_unit_get_count(pcnt_unit_handle_t unit, int* value) { return ESP_ERR_INVALID_STATE; }
+
+#endif // HOST_DRIVER_PULSE_CNT_H
@@ -0,0 +1,46 @@
+/*********
+  SEMBox Host Emulator - ESP-IDF heap capabilities
+  An internal heap of the ESP32's size, of which the bytes allocated on
+  the host (mallinfo2) are in use. There is no PSRAM. With
+  CONFIG_HEAP_USE_HOOKS the C allocator calls the allocation hooks.
+*********/
+
+#ifndef HOST_ESP_HEAP_CAPS_H
+#define HOST_ESP_HEAP_CAPS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "sdkconfig.h"
+
+#define MALLOC_CAP_8BIT (1 << 2)
+#define MALLOC_CAP_SPIRAM (1 << 10)
+#define MALLOC_CAP_INTERNAL (1 << 11)
+#define MALLOC_CAP_DEFAULT (1 << 12)
+
+typedef struct {
+    size_t total_free_bytes;
+    size_t total_allocated_bytes;
+    size_t largest_free_block;
+    size_t minimum_free_bytes;
+    size_t allocated_blocks;
+    size_t free_blocks;
+    size_t total_blocks;
+} multi_heap_info_t;
+
+typedef void (*esp_alloc_failed_hook_t)(size_t size, uint32_t caps, const char* functionName);
+
+size_t heap_caps_get_total_size(uint32_t caps);
+size_t heap_caps_get_free_size(uint32_t caps);
+size_t heap_caps_get_minimum_free_size(uint32_t caps);
+size_t heap_caps_get_largest_free_block(uint32_t caps);
+void heap_caps_get_info(multi_heap_info_t* info, uint32_t caps);
+esp_err_t heap_caps_register_failed_alloc_callback(esp_alloc_failed_hook_t callback);
+
+#if CONFIG_HEAP_USE_HOOKS
+// Defined by the application
+extern "C" void esp_heap_trace_alloc_hook(void* ptr, size_t size, uint32_t caps);
+extern "C" void esp_heap_trace_free_hook(void* ptr);
+#endif
+
+#endif // HOST_ESP_HEAP_CAPS_H
@@ -0,0 +1,13 @@
+/*********
+  SEMBox Host Emulator - ROM CRC functions
+*********/
+
+#ifndef HOST_ESP_ROM_CRC_H
+#define HOST_ESP_ROM_CRC_H
+
+#include <stdint.h>
+
+// CRC-32 (IEEE 802.3, reflected), chained like the ROM function
+uint32_t esp_rom_crc32_le(uint32_t crc, const uint8_t* buffer, uint32_t length);
+
+#endif // HOST_ESP_ROM_CRC_H
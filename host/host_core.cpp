@@ -0,0 +1,577 @@
+/*********
+  SEMBox Host Emulator - Core
+  Time, Serial, GPIO, tasks, timers and heap figures
+*********/
+
+#include "host_emulator.h"
+#include <Arduino.h>
+#include <WiFi.h>
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "esp_rom_crc.h"
+#include "soc/gpio_reg.h"
+#include "driver/gptimer.h"
+#include <stdarg.h>
+#include <malloc.h>
+#include <sys/stat.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#if defined(__SANITIZE_ADDRESS__) || defined(__SANITIZE_THREAD__)
+// Sanitizer runtime (allocator_interface.h, not shipped with every GCC)
+extern "C" size_t __sanitizer_get_current_allocated_bytes(void);
+#endif
+
+using HostClock = std::chrono::steady_clock;
+
+static const HostClock::time_point bootTime = HostClock::now();
+
+HostConfig hostConfig = { "sembox-host-data", 8080 };
+HardwareSerial Serial;
+EspClass ESP;
+WiFiClass WiFi;
+
+std::string hostPath(const std::string& relative) {
+    std::string path = hostConfig.dataDir + "/" + relative;
+    for (size_t slash = path.find('/', 1); slash != std::string::npos; slash = path.find('/', slash + 1)) {
+        ::mkdir(path.substr(0, slash).c_str(), 0755);
+    }
+    return path;
+}
+
+// ===========================================
+// Time
+// ===========================================
+
+int64_t esp_timer_get_time() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(HostClock::now() - bootTime).count();
+}
+
+unsigned long millis() {
+    return (unsigned long)(esp_timer_get_time() / 1000);
+}
+
+unsigned long micros() {
+    return (unsigned long)esp_timer_get_time();
+}
+
+void delay(uint32_t ms) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+// Thread wake-ups are late by tens of microseconds: the last stretch
+// before a deadline is spun
+static const std::chrono::microseconds SPIN_TIME(100);
+
+static void spinUntil(HostClock::time_point deadline) {
+    while (HostClock::now() < deadline) {
+        std::this_thread::yield();
+    }
+}
+
+static void sleepUntil(HostClock::time_point deadline) {
+    std::this_thread::sleep_until(deadline - SPIN_TIME);
+    spinUntil(deadline);
+}
+
+// ===========================================
+// Serial
+// ===========================================
+
+static std::mutex serialLock;
+
+size_t HardwareSerial::print(const char* text) {
+    std::lock_guard<std::mutex> guard(serialLock);
+    size_t length = fputs(text, stdout) >= 0 ? strlen(text) : 0;
+    fflush(stdout);
+    return length;
+}
+
+size_t HardwareSerial::println(const char* text) {
+    std::lock_guard<std::mutex> guard(serialLock);
+    size_t length = fprintf(stdout, "%s\n", text);
+    fflush(stdout);
+    return length;
+}
+
+size_t HardwareSerial::printf(const char* format, ...) {
+    std::lock_guard<std::mutex> guard(serialLock);
+    va_list args;
+    va_start(args, format);
+    int length = vfprintf(stdout, format, args);
+    va_end(args);
+    fflush(stdout);
+    return length > 0 ? length : 0;
+}
+
+String IPAddress::toString() const {
+    char text[16];
+    snprintf(text, sizeof(text), "%u.%u.%u.%u", (unsigned)(_address & 0xFF), (unsigned)((_address >> 8) & 0xFF),
+             (unsigned)((_address >> 16) & 0xFF), (unsigned)(_address >> 24));
+    return String(text);
+}
+
+// ===========================================
+// GPIO
+// ===========================================
+
+static const uint8_t PIN_COUNT = 40;
+
+struct PinInterrupt {
+    void (*handler)(void*);
+    void* arg;
+    int mode;
+};
+
+static std::atomic<uint32_t> pinLevels[2];     // GPIO 0-31, 32-39
+static uint8_t pinModes[PIN_COUNT];
+static PinInterrupt pinInterrupts[PIN_COUNT];
+static std::mutex interruptLock;                // One "interrupt" at a time
+
+static void setLevel(uint8_t pin, bool high) {
+    uint32_t bit = 1UL << (pin & 31);
+    if (high) {
+        pinLevels[pin >> 5].fetch_or(bit, std::memory_order_relaxed);
+    } else {
+        pinLevels[pin >> 5].fetch_and(~bit, std::memory_order_relaxed);
+    }
+}
+
+void pinMode(uint8_t pin, uint8_t mode) {
+    if (pin >= PIN_COUNT) {
+        return;
+    }
+    pinModes[pin] = mode;
+    if (mode == INPUT_PULLUP) {
+        setLevel(pin, true);
+    }
+}
+
+void digitalWrite(uint8_t pin, uint8_t value) {
+    if (pin < PIN_COUNT) {
+        setLevel(pin, value != LOW);
+    }
+}
+
+int digitalRead(uint8_t pin) {
+    return pin < PIN_COUNT && ((pinLevels[pin >> 5].load(std::memory_order_relaxed) >> (pin & 31)) & 1);
+}
+
+void attachInterruptArg(uint8_t pin, void (*handler)(void*), void* arg, int mode) {
+    if (pin < PIN_COUNT) {
+        std::lock_guard<std::mutex> guard(interruptLock);
+        pinInterrupts[pin] = { handler, arg, mode };
+    }
+}
+
+void hostSetInput(uint8_t pin, bool level) {
+    if (pin >= PIN_COUNT || digitalRead(pin) == level) {
+        return;
+    }
+    setLevel(pin, level);
+
+    std::lock_guard<std::mutex> guard(interruptLock);
+    const PinInterrupt& interrupt = pinInterrupts[pin];
+    bool edge = interrupt.mode == CHANGE || (interrupt.mode == RISING && level) || (interrupt.mode == FALLING && !level);
+    if (interrupt.handler && edge) {
+        interrupt.handler(interrupt.arg);
+    }
+}
+
+uint32_t hostRegRead(uint32_t reg) {
+    switch (reg) {
+        case GPIO_IN_REG:
+            return pinLevels[0].load(std::memory_order_relaxed);
+        case GPIO_IN1_REG:
+            return pinLevels[1].load(std::memory_order_relaxed);
+        default:
+            return 0;
+    }
+}
+
+void hostRegWrite(uint32_t reg, uint32_t value) {
+    switch (reg) {
+        case GPIO_OUT_W1TS_REG:
+            pinLevels[0].fetch_or(value, std::memory_order_relaxed);
+            break;
+        case GPIO_OUT_W1TC_REG:
+            pinLevels[0].fetch_and(~value, std::memory_order_relaxed);
+            break;
+        case GPIO_OUT1_W1TS_REG:
+            pinLevels[1].fetch_or(value, std::memory_order_relaxed);
+            break;
+        case GPIO_OUT1_W1TC_REG:
+            pinLevels[1].fetch_and(~value, std::memory_order_relaxed);
+            break;
+    }
+}
+
+// ===========================================
+// Tasks
+// ===========================================
+
+struct HostTask {
+    TaskFunction_t function;
+    void* parameter;
+    std::mutex lock;
+    std::condition_variable wake;
+    uint32_t notifications = 0;
+};
+
+static thread_local HostTask* currentTask = nullptr;
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t function, const char* name, uint32_t stackDepth,
+                                   void* parameter, UBaseType_t priority, TaskHandle_t* handle,
+                                   BaseType_t core) {
+    HostTask* task = new HostTask();     // Tasks run until the process ends
+    task->function = function;
+    task->parameter = parameter;
+    if (handle) {
+        *handle = task;
+    }
+    std::thread([task]() {
+        currentTask = task;
+        task->function(task->parameter);
+    }).detach();
+    return pdPASS;
+}
+
+// The main thread (setup() and loop()) gets its task on first use
+TaskHandle_t xTaskGetCurrentTaskHandle() {
+    if (!currentTask) {
+        currentTask = new HostTask();
+    }
+    return currentTask;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task) {
+    {
+        std::lock_guard<std::mutex> guard(task->lock);
+        task->notifications++;
+    }
+    task->wake.notify_one();
+    return pdPASS;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticksToWait) {
+    HostTask* task = currentTask;
+    if (!task) {
+        return 0;
+    }
+    std::unique_lock<std::mutex> guard(task->lock);
+    auto pending = [task]() { return task->notifications > 0; };
+    if (ticksToWait == portMAX_DELAY) {
+        task->wake.wait(guard, pending);
+    } else if (!task->wake.wait_for(guard, std::chrono::milliseconds(ticksToWait), pending)) {
+        return 0;
+    }
+    uint32_t count = task->notifications;
+    task->notifications = clearOnExit ? 0 : count - 1;
+    return count;
+}
+
+void vTaskDelay(TickType_t ticks) {
+    delay(ticks * portTICK_PERIOD_MS);
+}
+
+// ===========================================
+// esp_timer
+// ===========================================
+
+struct HostTimer {
+    esp_timer_cb_t callback;
+    void* arg;
+    std::atomic<bool> running{ false };
+};
+
+esp_err_t esp_timer_create(const esp_timer_create_args_t* args, esp_timer_handle_t* handle) {
+    if (!args || !args->callback || !handle) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    HostTimer* timer = new HostTimer();
+    timer->callback = args->callback;
+    timer->arg = args->arg;
+    *handle = timer;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_start_periodic(esp_timer_handle_t timer, uint64_t periodUs) {
+    if (timer->running.exchange(true)) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    std::thread([timer, periodUs]() {
+        // Absolute schedule: a late callback does not shift the later ones
+        auto period = std::chrono::microseconds(periodUs);
+        HostClock::time_point next = HostClock::now() + period;
+        while (timer->running.load()) {
+            sleepUntil(next);
+            timer->callback(timer->arg);
+            next += period;
+        }
+    }).detach();
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_stop(esp_timer_handle_t timer) {
+    return timer->running.exchange(false) ? ESP_OK : ESP_ERR_INVALID_STATE;
+}
+
+// ===========================================
+// GPTimer
+// ===========================================
+
+struct HostGptimer {
+    uint32_t resolution;
+    gptimer_alarm_cb_t onAlarm = nullptr;
+    void* context = nullptr;
+    std::mutex lock;
+    std::condition_variable changed;
+    bool enabled = false;
+    bool running = false;
+    bool armed = false;
+    uint64_t alarm = 0;
+    uint32_t generation = 0;    // Bumped on every change of the alarm
+
+    uint64_t count() const {
+        auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(HostClock::now() - bootTime).count();
+        return (uint64_t)((unsigned __int128)elapsed * resolution / 1000000000);
+    }
+
+    HostClock::time_point timeOf(uint64_t ticks) const {
+        return bootTime + std::chrono::nanoseconds((int64_t)((unsigned __int128)ticks * 1000000000 / resolution));
+    }
+
+    void run() {
+        std::unique_lock<std::mutex> guard(lock);
+        for (;;) {
+            changed.wait(guard, [this]() { return running && armed; });
+            uint32_t seen = generation;
+            uint64_t target = alarm;
+            auto rearmed = [this, seen]() { return generation != seen; };
+            if (changed.wait_until(guard, timeOf(target) - SPIN_TIME, rearmed)) {
+                continue;   // Re-armed or stopped meanwhile
+            }
+            guard.unlock();
+            spinUntil(timeOf(target));
+            guard.lock();
+            if (rearmed()) {
+                continue;
+            }
+
+            // The "interrupt": the alarm fires once, the callback may re-arm it
+            armed = false;
+            gptimer_alarm_event_data_t event = { count(), target };
+            guard.unlock();
+            onAlarm(this, &event, context);
+            guard.lock();
+        }
+    }
+};
+
+esp_err_t gptimer_new_timer(const gptimer_config_t* config, gptimer_handle_t* timer) {
+    if (!config || config->resolution_hz == 0 || config->direction != GPTIMER_COUNT_UP) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    HostGptimer* created = new HostGptimer();
+    created->resolution = config->resolution_hz;
+    *timer = created;
+    std::thread([created]() { created->run(); }).detach();
+    return ESP_OK;
+}
+
+esp_err_t gptimer_register_event_callbacks(gptimer_handle_t timer, const gptimer_event_callbacks_t* callbacks,
+                                           void* ctx) {
+    std::lock_guard<std::mutex> guard(timer->lock);
+    if (timer->enabled) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    timer->onAlarm = callbacks->on_alarm;
+    timer->context = ctx;
+    return ESP_OK;
+}
+
+esp_err_t gptimer_enable(gptimer_handle_t timer) {
+    std::lock_guard<std::mutex> guard(timer->lock);
+    if (timer->enabled) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    timer->enabled = true;
+    return ESP_OK;
+}
+
+esp_err_t gptimer_start(gptimer_handle_t timer) {
+    {
+        std::lock_guard<std::mutex> guard(timer->lock);
+        if (!timer->enabled || timer->running) {
+            return ESP_ERR_INVALID_STATE;
+        }
+        timer->running = true;
+        timer->generation++;
+    }
+    timer->changed.notify_one();
+    return ESP_OK;
+}
+
+esp_err_t gptimer_stop(gptimer_handle_t timer) {
+    std::lock_guard<std::mutex> guard(timer->lock);
+    if (!timer->running) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    timer->running = false;
+    timer->generation++;
+    return ESP_OK;
+}
+
+esp_err_t gptimer_get_raw_count(gptimer_handle_t timer, uint64_t* value) {
+    *value = timer->count();
+    return ESP_OK;
+}
+
+esp_err_t gptimer_set_alarm_action(gptimer_handle_t timer, const gptimer_alarm_config_t* config) {
+    {
+        std::lock_guard<std::mutex> guard(timer->lock);
+        timer->armed = config != nullptr;
+        timer->alarm = config ? config->alarm_count : 0;
+        timer->generation++;
+    }
+    timer->changed.notify_one();
+    return ESP_OK;
+}
+
+// ===========================================
+// Heap
+// ===========================================
+
+static const size_t HEAP_SIZE = 320 * 1024;    // Internal RAM of an ESP32 with WiFi running
+
+static size_t hostAllocated() {
+#if defined(__SANITIZE_ADDRESS__) || defined(__SANITIZE_THREAD__)
+    return __sanitizer_get_current_allocated_bytes();
+#else
+    struct mallinfo2 info = mallinfo2();
+    return info.uordblks + info.hblkhd;
+#endif
+}
+
+// What the host runtime allocated before the firmware started
+static const size_t baseAllocated = hostAllocated();
+static std::atomic<size_t> minimumFree{ HEAP_SIZE };
+
+static size_t freeHeap() {
+    size_t used = hostAllocated();
+    used = used > baseAllocated ? used - baseAllocated : 0;
+    size_t free = used < HEAP_SIZE ? HEAP_SIZE - used : 0;
+    size_t minimum = minimumFree.load(std::memory_order_relaxed);
+    while (free < minimum && !minimumFree.compare_exchange_weak(minimum, free)) {
+    }
+    return free;
+}
+
+uint32_t esp_get_free_heap_size() {
+    return freeHeap();
+}
+
+uint32_t EspClass::getHeapSize() {
+    return HEAP_SIZE;
+}
+
+uint32_t EspClass::getFreeHeap() {
+    return freeHeap();
+}
+
+uint32_t EspClass::getSketchSize() {
+    struct stat info;
+    return ::stat("/proc/self/exe", &info) == 0 ? info.st_size : 0;
+}
+
+size_t heap_caps_get_total_size(uint32_t caps) {
+    return caps & MALLOC_CAP_SPIRAM ? 0 : HEAP_SIZE;
+}
+
+size_t heap_caps_get_free_size(uint32_t caps) {
+    return caps & MALLOC_CAP_SPIRAM ? 0 : freeHeap();
+}
+
+size_t heap_caps_get_minimum_free_size(uint32_t caps) {
+    if (caps & MALLOC_CAP_SPIRAM) {
+        return 0;
+    }
+    freeHeap();
+    return minimumFree.load(std::memory_order_relaxed);
+}
+
+size_t heap_caps_get_largest_free_block(uint32_t caps) {
+    return heap_caps_get_free_size(caps);   // No fragmentation model
+}
+
+void heap_caps_get_info(multi_heap_info_t* info, uint32_t caps) {
+    memset(info, 0, sizeof(*info));
+    info->total_free_bytes = heap_caps_get_free_size(caps);
+    info->total_allocated_bytes = heap_caps_get_total_size(caps) - info->total_free_bytes;
+    info->largest_free_block = info->total_free_bytes;
+    info->minimum_free_bytes = heap_caps_get_minimum_free_size(caps);
+}
+
+esp_err_t heap_caps_register_failed_alloc_callback(esp_alloc_failed_hook_t callback) {
+    return ESP_OK;      // Host allocations do not fail
+}
+
+#if CONFIG_HEAP_USE_HOOKS
+// The C allocator (and so operator new) wrapped around glibc's own, to
+// call the hooks like the ESP-IDF heap does. Aligned allocations are
+// not wrapped.
+extern "C" {
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t count, size_t size);
+void* __libc_realloc(void* ptr, size_t size);
+void __libc_free(void* ptr);
+
+void* malloc(size_t size) {
+    void* ptr = __libc_malloc(size);
+    if (ptr) {
+        esp_heap_trace_alloc_hook(ptr, size, MALLOC_CAP_DEFAULT);
+    }
+    return ptr;
+}
+
+void* calloc(size_t count, size_t size) {
+    void* ptr = __libc_calloc(count, size);
+    if (ptr) {
+        esp_heap_trace_alloc_hook(ptr, count * size, MALLOC_CAP_DEFAULT);
+    }
+    return ptr;
+}
+
+void* realloc(void* ptr, size_t size) {
+    void* moved = __libc_realloc(ptr, size);
+    if (moved) {
+        esp_heap_trace_alloc_hook(moved, size, MALLOC_CAP_DEFAULT);
+    }
+    return moved;
+}
+
+void free(void* ptr) {
+    if (ptr) {
+        esp_heap_trace_free_hook(ptr);
+    }
+    __libc_free(ptr);
+}
+}
+#endif
+
+// ===========================================
+// CRC
+// ===========================================
+
+uint32_t esp_rom_crc32_le(uint32_t crc, const uint8_t* buffer, uint32_t length) {
+    crc = ~crc;
+    for (uint32_t i = 0; i < length; i++) {
+        crc ^= buffer[i];
+        for (uint8_t bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+        }
+    }
+    return ~crc;
+}
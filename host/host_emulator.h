@@ -0,0 +1,43 @@
+/*********
+  SEMBox Host Emulator
+  Runs SEMBox.ino unchanged as a Linux process, for load, latency and
+  sanitizer testing without flashing a board (tools/build_host.py)
+
+  The headers in this directory stand in for the Arduino core, the
+  ESP-IDF drivers and the web server libraries the firmware uses:
+  - Tasks and timers are threads; the control task keeps its 1 kHz
+    tick and the step timer its alarm interrupt.
+  - GPIO is a set of emulated pins. Inputs can be driven from stdin
+    ("pin <gpio> <0|1>"), which runs their edge interrupts.
+  - NVS (Preferences), the journal partition and LittleFS are files in
+    the data directory, so settings, programs, the position journal and
+    the event log survive a restart.
+  - AsyncWebServer is a single-threaded HTTP/1.1 server on POSIX
+    sockets: like AsyncTCP, every handler runs on one thread.
+  - There is no encoder (PCNT) and no WiFi; the access point address
+    is the loopback address.
+*********/
+
+#ifndef HOST_EMULATOR_H
+#define HOST_EMULATOR_H
+
+#include <stdint.h>
+#include <string>
+
+struct HostConfig {
+    std::string dataDir;        // Persistent state (NVS, partitions, file system)
+    uint16_t port;              // Listening port, replaces the firmware's port 80
+};
+
+extern HostConfig hostConfig;
+
+// Path below the data directory; missing parent directories are created
+std::string hostPath(const std::string& relative);
+
+// Drive an input pin; an edge runs its interrupt handler
+void hostSetInput(uint8_t pin, bool level);
+
+// Stop accepting connections and end the server thread
+void hostServerStop();
+
+#endif // HOST_EMULATOR_H
@@ -0,0 +1,82 @@
+/*********
+  SEMBox Host Emulator - Entry point
+  Runs setup() and loop() like the Arduino core, until SIGINT, SIGTERM
+  or "quit" on stdin.
+
+    sembox-host [--port N] [--data DIR]
+*********/
+
+#include "host_emulator.h"
+#include <Arduino.h>
+#include <signal.h>
+#include <unistd.h>
+#include <atomic>
+#include <iostream>
+#include <thread>
+
+#if defined(__SANITIZE_ADDRESS__)
+#include <sanitizer/lsan_interface.h>
+#endif
+
+void setup();
+void loop();
+
+static std::atomic<bool> running{ true };
+
+static void onSignal(int) {
+    running = false;
+}
+
+// Commands on stdin: "pin <gpio> <0|1>" and "quit"
+static void readCommands() {
+    std::string line;
+    while (running.load() && std::getline(std::cin, line)) {
+        unsigned pin;
+        unsigned level;
+        if (sscanf(line.c_str(), "pin %u %u", &pin, &level) == 2) {
+            hostSetInput(pin, level != 0);
+        } else if (line == "quit") {
+            running = false;
+        } else if (!line.empty()) {
+            Serial.printf("[Host] Unknown command: %s\n", line.c_str());
+        }
+    }
+}
+
+static void usage(const char* program) {
+    fprintf(stderr, "usage: %s [--port N] [--data DIR]\n", program);
+    exit(2);
+}
+
+int main(int argc, char** argv) {
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--port") == 0 && i + 1 < argc) {
+            hostConfig.port = (uint16_t)atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--data") == 0 && i + 1 < argc) {
+            hostConfig.dataDir = argv[++i];
+        } else {
+            usage(argv[0]);
+        }
+    }
+
+    signal(SIGINT, onSignal);
+    signal(SIGTERM, onSignal);
+    signal(SIGPIPE, SIG_IGN);
+    Serial.printf("[Host] Data directory %s\n", hostConfig.dataDir.c_str());
+
+    setup();
+    std::thread(readCommands).detach();
+    while (running.load()) {
+        loop();
+    }
+
+    // Firmware tasks never end: stop the server and leave without
+    // running static destructors under their feet
+    hostServerStop();
+    Serial.printf("[Host] Stopped\n");
+    fflush(stdout);
+#if defined(__SANITIZE_ADDRESS__)
+    __lsan_do_leak_check();
+#endif
+    _exit(0);
+}
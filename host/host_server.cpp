@@ -0,0 +1,731 @@
+/*********
+  SEMBox Host Emulator - Web server
+  The AsyncWebServer emulation: one thread polls the listening socket
+  and every connection, parses requests, runs the handlers and streams
+  the responses. Event stream messages may be queued from any thread.
+*********/
+
+#include "host_emulator.h"
+#include <ESPAsyncWebServer.h>
+#include <esp_timer.h>
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <strings.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <atomic>
+#include <list>
+#include <thread>
+
+static const size_t HEAD_MAX = 8192;            // Larger request heads are refused
+static const size_t OUTPUT_BATCH = 16384;       // Body bytes staged per write
+static const size_t EVENTS_MAX_QUEUED = 65536;  // Event bytes kept for a slow client
+static const int64_t IDLE_TIMEOUT_US = 30000000;
+
+static const char* reasonPhrase(int code) {
+    switch (code) {
+        case 200: return "OK";
+        case 204: return "No Content";
+        case 304: return "Not Modified";
+        case 400: return "Bad Request";
+        case 404: return "Not Found";
+        case 405: return "Method Not Allowed";
+        case 413: return "Payload Too Large";
+        case 431: return "Request Header Fields Too Large";
+        case 500: return "Internal Server Error";
+        case 501: return "Not Implemented";
+        case 503: return "Service Unavailable";
+        default: return "";
+    }
+}
+
+static std::string urlDecode(const std::string& text, bool plusIsSpace) {
+    std::string decoded;
+    decoded.reserve(text.size());
+    for (size_t i = 0; i < text.size(); i++) {
+        char c = text[i];
+        if (c == '%' && i + 2 < text.size() && isxdigit((unsigned char)text[i + 1]) &&
+            isxdigit((unsigned char)text[i + 2])) {
+            decoded += (char)strtol(text.substr(i + 1, 2).c_str(), nullptr, 16);
+            i += 2;
+        } else {
+            decoded += plusIsSpace && c == '+' ? ' ' : c;
+        }
+    }
+    return decoded;
+}
+
+// ===========================================
+// Connection
+// ===========================================
+
+class HostConnection {
+public:
+    HostConnection(int fd, AsyncWebServer* server)
+        : fd(fd), server(server), handler(nullptr), headParsed(false), bodyReceived(0), responding(false),
+          bodyIndex(0), bodyDone(false), retry(false), source(nullptr), closing(false),
+          lastActivity(esp_timer_get_time()) {}
+
+    int fd;
+    AsyncWebServer* server;
+    std::string input;
+    std::unique_ptr<AsyncWebServerRequest> request;
+    AsyncWebHandler* handler;           // nullptr: the not-found handler
+    bool headParsed;
+    size_t bodyReceived;
+
+    std::string output;
+    bool responding;
+    size_t bodyIndex;
+    bool bodyDone;
+    bool retry;                         // Chunked filler asked to be called again
+
+    AsyncEventSource* source;           // Set for an event stream
+    std::mutex eventLock;
+    std::string events;                 // Queued by any thread
+
+    bool closing;
+    int64_t lastActivity;
+
+    void receive();
+    void dispatch();
+    void fill();
+    void transmit();
+    void queueEvent(const std::string& event);
+    bool wantsWrite();
+};
+
+static int wakeFds[2] = { -1, -1 };
+static std::atomic<bool> serverRunning{ false };
+static std::thread serverThread;
+
+static void wakeServer() {
+    char byte = 1;
+    if (wakeFds[1] >= 0 && write(wakeFds[1], &byte, 1) < 0) {
+        // Pipe full: the server is awake anyway
+    }
+}
+
+void HostConnection::receive() {
+    char buffer[4096];
+    ssize_t length = recv(fd, buffer, sizeof(buffer), 0);
+    if (length <= 0) {
+        if (length == 0 || (errno != EAGAIN && errno != EWOULDBLOCK)) {
+            closing = true;
+        }
+        return;
+    }
+    lastActivity = esp_timer_get_time();
+    if (responding || source) {
+        return;     // One request per connection
+    }
+    input.append(buffer, length);
+
+    if (!headParsed) {
+        size_t end = input.find("\r\n\r\n");
+        if (end == std::string::npos) {
+            if (input.size() > HEAD_MAX) {
+                output = "HTTP/1.1 431 Request Header Fields Too Large\r\nContent-Length: 0\r\nConnection: close\r\n\r\n";
+                responding = bodyDone = true;
+            }
+            return;
+        }
+        request.reset(new AsyncWebServerRequest(server, this));
+        if (!request->parseHead(input.substr(0, end + 2))) {
+            output = "HTTP/1.1 400 Bad Request\r\nContent-Length: 0\r\nConnection: close\r\n\r\n";
+            responding = bodyDone = true;
+            return;
+        }
+        input.erase(0, end + 4);
+        headParsed = true;
+        handler = server->findHandler(request.get());
+    }
+
+    // Body parts go to the handler as they arrive, like with AsyncTCP
+    size_t total = request->contentLength();
+    size_t part = input.size() < total - bodyReceived ? input.size() : total - bodyReceived;
+    if (part > 0) {
+        if (handler) {
+            handler->handleBody(request.get(), (uint8_t*)&input[0], part, bodyReceived, total);
+        }
+        bodyReceived += part;
+        input.erase(0, part);
+    }
+    if (bodyReceived == total) {
+        dispatch();
+    }
+}
+
+void HostConnection::dispatch() {
+    if (handler && handler->takesConnection()) {
+        handler->attach(request.get(), this);
+        return;
+    }
+    if (handler) {
+        handler->handleRequest(request.get());
+    } else {
+        server->notFound(request.get());
+    }
+
+    if (!request->_response) {
+        Serial.printf("[Host] %s: no response sent\n", request->url().c_str());
+        closing = true;
+        return;
+    }
+    output = request->_response->head();
+    responding = true;
+    bodyDone = request->method() == HTTP_HEAD;
+    fill();
+    transmit();     // Small responses leave at once, as from the handler
+}
+
+void HostConnection::fill() {
+    AsyncWebServerResponse* response = request ? request->_response.get() : nullptr;
+    bool chunked = response && response->contentLength() < 0;
+    retry = false;
+    while (!bodyDone && output.size() < OUTPUT_BATCH) {
+        uint8_t buffer[4096];
+        size_t room = chunked ? sizeof(buffer) - 16 : sizeof(buffer);
+        if (!chunked && (long)(response->contentLength() - bodyIndex) < (long)room) {
+            room = response->contentLength() - bodyIndex;
+        }
+        size_t length = room > 0 ? response->fill(buffer, room, bodyIndex) : 0;
+        if (length == RESPONSE_TRY_AGAIN) {
+            retry = true;
+            break;
+        }
+        if (length > room) {
+            length = room;
+        }
+        if (chunked) {
+            char size[16];
+            snprintf(size, sizeof(size), "%zx\r\n", length);
+            output += size;
+            output.append((const char*)buffer, length);
+            output += "\r\n";
+        } else {
+            output.append((const char*)buffer, length);
+        }
+        bodyIndex += length;
+        bodyDone = length == 0 || (!chunked && (long)bodyIndex >= response->contentLength());
+    }
+}
+
+void HostConnection::transmit() {
+    if (source) {
+        std::lock_guard<std::mutex> guard(eventLock);
+        output += events;
+        events.clear();
+    }
+    while (!output.empty()) {
+        ssize_t sent = send(fd, output.data(), output.size(), MSG_NOSIGNAL);
+        if (sent <= 0) {
+            if (sent < 0 && errno != EAGAIN && errno != EWOULDBLOCK) {
+                closing = true;
+            }
+            return;
+        }
+        output.erase(0, sent);
+        lastActivity = esp_timer_get_time();
+        if (output.empty() && responding && !bodyDone) {
+            fill();
+        }
+    }
+    if (responding && bodyDone) {
+        closing = true;     // Connection: close
+    }
+}
+
+void HostConnection::queueEvent(const std::string& event) {
+    std::lock_guard<std::mutex> guard(eventLock);
+    if (events.size() + event.size() <= EVENTS_MAX_QUEUED) {
+        events += event;
+    }
+}
+
+bool HostConnection::wantsWrite() {
+    if (!output.empty() || (responding && !bodyDone)) {
+        return true;
+    }
+    std::lock_guard<std::mutex> guard(eventLock);
+    return !events.empty();
+}
+
+// ===========================================
+// Server thread
+// ===========================================
+
+static void serve(AsyncWebServer* server, int listener) {
+    std::list<std::unique_ptr<HostConnection>> connections;
+    std::vector<struct pollfd> polled;
+
+    while (serverRunning.load()) {
+        polled.clear();
+        polled.push_back({ listener, POLLIN, 0 });
+        polled.push_back({ wakeFds[0], POLLIN, 0 });
+        bool retry = false;
+        for (auto& connection : connections) {
+            short events = POLLIN;
+            if (connection->wantsWrite()) {
+                events |= POLLOUT;
+            }
+            retry = retry || connection->retry;
+            polled.push_back({ connection->fd, events, 0 });
+        }
+        if (poll(polled.data(), polled.size(), retry ? 1 : 100) < 0 && errno != EINTR) {
+            break;
+        }
+
+        if (polled[1].revents & POLLIN) {
+            char drain[64];
+            while (read(wakeFds[0], drain, sizeof(drain)) > 0) {
+            }
+        }
+        if (polled[0].revents & POLLIN) {
+            for (int fd = accept(listener, nullptr, nullptr); fd >= 0; fd = accept(listener, nullptr, nullptr)) {
+                int on = 1;
+                setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+                fcntl(fd, F_SETFL, O_NONBLOCK);
+                connections.emplace_back(new HostConnection(fd, server));
+            }
+        }
+
+        int64_t now = esp_timer_get_time();
+        size_t index = 2;
+        for (auto it = connections.begin(); it != connections.end(); index++) {
+            HostConnection* connection = it->get();
+            short revents = index < polled.size() && polled[index].fd == connection->fd ? polled[index].revents : 0;
+            if (revents & (POLLIN | POLLHUP | POLLERR)) {
+                connection->receive();
+            }
+            if (!connection->closing && (revents & POLLOUT || connection->retry || connection->source)) {
+                if (connection->retry) {
+                    connection->fill();
+                }
+                connection->transmit();
+            }
+            if (!connection->source && now - connection->lastActivity > IDLE_TIMEOUT_US) {
+                connection->closing = true;
+            }
+            if (connection->closing) {
+                if (connection->source) {
+                    connection->source->detach(connection);
+                }
+                shutdown(connection->fd, SHUT_WR);
+                close(connection->fd);
+                it = connections.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    for (auto& connection : connections) {
+        if (connection->source) {
+            connection->source->detach(connection.get());
+        }
+        close(connection->fd);
+    }
+    close(listener);
+}
+
+void hostServerStop() {
+    if (serverRunning.exchange(false)) {
+        wakeServer();
+        serverThread.join();
+    }
+}
+
+// ===========================================
+// AsyncWebServer
+// ===========================================
+
+AsyncWebServer::~AsyncWebServer() {
+    end();
+}
+
+void AsyncWebServer::begin() {
+    int listener = socket(AF_INET, SOCK_STREAM, 0);
+    int on = 1;
+    setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+    struct sockaddr_in address = {};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_ANY);
+    address.sin_port = htons(hostConfig.port);
+    if (listener < 0 || bind(listener, (struct sockaddr*)&address, sizeof(address)) != 0 ||
+        listen(listener, 64) != 0 || pipe(wakeFds) != 0) {
+        Serial.printf("[Host] Cannot listen on port %u: %s\n", (unsigned)hostConfig.port, strerror(errno));
+        exit(1);
+    }
+    fcntl(listener, F_SETFL, O_NONBLOCK);
+    fcntl(wakeFds[0], F_SETFL, O_NONBLOCK);
+    fcntl(wakeFds[1], F_SETFL, O_NONBLOCK);
+
+    Serial.printf("[Host] Port %u served on http://127.0.0.1:%u\n", (unsigned)_port, (unsigned)hostConfig.port);
+    serverRunning = true;
+    serverThread = std::thread(serve, this, listener);
+}
+
+void AsyncWebServer::end() {
+    hostServerStop();
+}
+
+AsyncCallbackWebHandler& AsyncWebServer::on(const char* uri, ArRequestHandlerFunction onRequest) {
+    return on(uri, HTTP_ANY, onRequest, nullptr, nullptr);
+}
+
+AsyncCallbackWebHandler& AsyncWebServer::on(const char* uri, WebRequestMethodComposite method,
+                                            ArRequestHandlerFunction onRequest) {
+    return on(uri, method, onRequest, nullptr, nullptr);
+}
+
+AsyncCallbackWebHandler& AsyncWebServer::on(const char* uri, WebRequestMethodComposite method,
+                                            ArRequestHandlerFunction onRequest, ArUploadHandlerFunction onUpload,
+                                            ArBodyHandlerFunction onBody) {
+    AsyncCallbackWebHandler* handler = new AsyncCallbackWebHandler(uri, method, onRequest, onUpload, onBody);
+    _owned.emplace_back(handler);
+    _handlers.push_back(handler);
+    return *handler;
+}
+
+AsyncWebHandler& AsyncWebServer::addHandler(AsyncWebHandler* handler) {
+    _handlers.push_back(handler);
+    return *handler;
+}
+
+AsyncWebHandler* AsyncWebServer::findHandler(AsyncWebServerRequest* request) {
+    for (AsyncWebHandler* handler : _handlers) {
+        if (handler->canHandle(request)) {
+            return handler;
+        }
+    }
+    return nullptr;
+}
+
+void AsyncWebServer::notFound(AsyncWebServerRequest* request) {
+    if (_notFound) {
+        _notFound(request);
+    } else {
+        request->send(404);
+    }
+}
+
+bool AsyncCallbackWebHandler::matches(const String& uri, const String& url) {
+    if (uri.length() == 0 || uri == url) {
+        return true;
+    }
+    std::string pattern = uri.c_str();
+    if (pattern.back() == '*') {
+        return strncmp(url.c_str(), pattern.c_str(), pattern.size() - 1) == 0;
+    }
+    pattern += '/';
+    return strncmp(url.c_str(), pattern.c_str(), pattern.size()) == 0;
+}
+
+bool AsyncCallbackWebHandler::canHandle(AsyncWebServerRequest* request) {
+    return _onRequest && (_method & request->method()) && matches(_uri, request->url());
+}
+
+void AsyncCallbackWebHandler::handleRequest(AsyncWebServerRequest* request) {
+    _onRequest(request);
+}
+
+void AsyncCallbackWebHandler::handleBody(AsyncWebServerRequest* request, uint8_t* data, size_t len, size_t index,
+                                         size_t total) {
+    if (_onBody) {
+        _onBody(request, data, len, index, total);
+    }
+}
+
+// ===========================================
+// Requests and responses
+// ===========================================
+
+AsyncWebServerRequest::AsyncWebServerRequest(AsyncWebServer* server, HostConnection* connection)
+    : _tempObject(nullptr), _server(server), _connection(connection), _method(0), _contentLength(0) {}
+
+AsyncWebServerRequest::~AsyncWebServerRequest() {
+    if (_onDisconnect) {
+        _onDisconnect();
+    }
+    free(_tempObject);
+}
+
+bool AsyncWebServerRequest::parseHead(const std::string& head) {
+    size_t lineEnd = head.find("\r\n");
+    std::string line = head.substr(0, lineEnd);
+    size_t first = line.find(' ');
+    size_t second = line.find(' ', first + 1);
+    if (first == std::string::npos || second == std::string::npos) {
+        return false;
+    }
+
+    static const struct { const char* name; WebRequestMethod method; } methods[] = {
+        { "GET", HTTP_GET }, { "POST", HTTP_POST }, { "DELETE", HTTP_DELETE }, { "PUT", HTTP_PUT },
+        { "PATCH", HTTP_PATCH }, { "HEAD", HTTP_HEAD }, { "OPTIONS", HTTP_OPTIONS }
+    };
+    std::string method = line.substr(0, first);
+    for (const auto& known : methods) {
+        if (method == known.name) {
+            _method = known.method;
+        }
+    }
+    if (_method == 0) {
+        return false;
+    }
+
+    std::string target = line.substr(first + 1, second - first - 1);
+    size_t query = target.find('?');
+    _url = urlDecode(target.substr(0, query), false);
+    if (query != std::string::npos) {
+        std::string parameters = target.substr(query + 1);
+        for (size_t start = 0; start <= parameters.size();) {
+            size_t end = parameters.find('&', start);
+            if (end == std::string::npos) {
+                end = parameters.size();
+            }
+            std::string pair = parameters.substr(start, end - start);
+            if (!pair.empty()) {
+                size_t equals = pair.find('=');
+                _params.emplace_back(String(urlDecode(pair.substr(0, equals), true)),
+                                     String(equals == std::string::npos ? std::string()
+                                                                        : urlDecode(pair.substr(equals + 1), true)));
+            }
+            start = end + 1;
+        }
+    }
+
+    for (size_t start = lineEnd + 2; start < head.size();) {
+        size_t end = head.find("\r\n", start);
+        std::string header = head.substr(start, end - start);
+        start = end + 2;
+        size_t colon = header.find(':');
+        if (colon == std::string::npos) {
+            continue;
+        }
+        std::string value = header.substr(colon + 1);
+        value.erase(0, value.find_first_not_of(" \t"));
+        std::string name = header.substr(0, colon);
+        _requestHeaders.emplace_back(String(name), String(value));
+
+        if (strcasecmp(name.c_str(), "Content-Length") == 0) {
+            _contentLength = strtoul(value.c_str(), nullptr, 10);
+        } else if (strcasecmp(name.c_str(), "Content-Type") == 0) {
+            std::string type = value.substr(0, value.find(';'));
+            type.erase(type.find_last_not_of(" \t") + 1);
+            _contentType = String(type);
+        }
+    }
+    return true;
+}
+
+bool AsyncWebServerRequest::hasParam(const char* name, bool post, bool file) const {
+    return getParam(name, post, file) != nullptr;
+}
+
+const AsyncWebParameter* AsyncWebServerRequest::getParam(const char* name, bool post, bool file) const {
+    if (post || file) {
+        return nullptr;     // Only query parameters are parsed
+    }
+    for (const AsyncWebParameter& parameter : _params) {
+        if (parameter.name() == name) {
+            return &parameter;
+        }
+    }
+    return nullptr;
+}
+
+const AsyncWebParameter* AsyncWebServerRequest::getParam(size_t index) const {
+    return index < _params.size() ? &_params[index] : nullptr;
+}
+
+bool AsyncWebServerRequest::hasHeader(const char* name) const {
+    for (const auto& header : _requestHeaders) {
+        if (strcasecmp(header.first.c_str(), name) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+String AsyncWebServerRequest::header(const char* name) const {
+    for (const auto& header : _requestHeaders) {
+        if (strcasecmp(header.first.c_str(), name) == 0) {
+            return header.second;
+        }
+    }
+    return String();
+}
+
+void AsyncWebServerRequest::send(AsyncWebServerResponse* response) {
+    if (_response) {
+        delete response;    // Only the first response is sent
+        return;
+    }
+    _response.reset(response);
+}
+
+void AsyncWebServerRequest::send(int code, const String& contentType, const String& content) {
+    send(beginResponse(code, contentType, content));
+}
+
+void AsyncWebServerRequest::send_P(int code, const String& contentType, const uint8_t* content, size_t length) {
+    send(beginResponse_P(code, contentType, content, length));
+}
+
+AsyncWebServerResponse* AsyncWebServerRequest::beginResponse(int code, const String& contentType,
+                                                             const String& content) {
+    return new AsyncBasicResponse(code, contentType, (const uint8_t*)content.c_str(), content.length(), true);
+}
+
+AsyncWebServerResponse* AsyncWebServerRequest::beginResponse_P(int code, const String& contentType,
+                                                               const uint8_t* content, size_t length) {
+    // Not copied: like on the device, the data must stay valid until sent
+    return new AsyncBasicResponse(code, contentType, content, length, false);
+}
+
+AsyncWebServerResponse* AsyncWebServerRequest::beginChunkedResponse(const String& contentType,
+                                                                    AwsResponseFiller filler) {
+    return new AsyncChunkedResponse(contentType, filler);
+}
+
+AsyncResponseStream* AsyncWebServerRequest::beginResponseStream(const String& contentType, size_t bufferSize) {
+    return new AsyncResponseStream(contentType);
+}
+
+std::string AsyncWebServerResponse::head() const {
+    char line[96];
+    snprintf(line, sizeof(line), "HTTP/1.1 %d %s\r\n", _code, reasonPhrase(_code));
+    std::string head = line;
+    long length = contentLength();
+    if (length >= 0) {
+        snprintf(line, sizeof(line), "Content-Length: %ld\r\n", length);
+        head += line;
+    } else {
+        head += "Transfer-Encoding: chunked\r\n";
+    }
+    if (_contentType.length()) {
+        head += std::string("Content-Type: ") + _contentType.c_str() + "\r\n";
+    }
+    for (const auto& header : _headers) {
+        head += std::string(header.first.c_str()) + ": " + header.second.c_str() + "\r\n";
+    }
+    head += "Connection: close\r\n\r\n";
+    return head;
+}
+
+AsyncBasicResponse::AsyncBasicResponse(int code, const String& contentType, const uint8_t* data, size_t length,
+                                       bool copy)
+    : AsyncWebServerResponse(code, contentType), _data(data), _length(length) {
+    if (copy) {
+        _copy.assign((const char*)data, length);
+        _data = (const uint8_t*)_copy.data();
+    }
+}
+
+size_t AsyncBasicResponse::fill(uint8_t* buffer, size_t maxLength, size_t index) {
+    size_t length = _length - index < maxLength ? _length - index : maxLength;
+    memcpy(buffer, _data + index, length);
+    return length;
+}
+
+size_t AsyncResponseStream::fill(uint8_t* buffer, size_t maxLength, size_t index) {
+    size_t length = _body.size() - index < maxLength ? _body.size() - index : maxLength;
+    memcpy(buffer, _body.data() + index, length);
+    return length;
+}
+
+// ===========================================
+// Event source
+// ===========================================
+
+static std::string formatEvent(const char* message, const char* event, uint32_t id, uint32_t reconnect) {
+    std::string text;
+    char line[48];
+    if (reconnect) {
+        snprintf(line, sizeof(line), "retry: %u\r\n", (unsigned)reconnect);
+        text += line;
+    }
+    if (id) {
+        snprintf(line, sizeof(line), "id: %u\r\n", (unsigned)id);
+        text += line;
+    }
+    if (event) {
+        text += std::string("event: ") + event + "\r\n";
+    }
+    if (message) {
+        for (const char* start = message;;) {
+            const char* end = strchr(start, '\n');
+            text += "data: ";
+            text.append(start, end ? end - start : strlen(start));
+            text += "\r\n";
+            if (!end) {
+                break;
+            }
+            start = end + 1;
+        }
+    }
+    text += "\r\n";
+    return text;
+}
+
+void AsyncEventSourceClient::send(const char* message, const char* event, uint32_t id, uint32_t reconnect) {
+    _connection->queueEvent(formatEvent(message, event, id, reconnect));
+    wakeServer();
+}
+
+bool AsyncEventSourceClient::connected() const {
+    return _connection != nullptr;
+}
+
+AsyncEventSource::~AsyncEventSource() {
+    std::lock_guard<std::mutex> guard(_lock);
+    _clients.clear();
+}
+
+bool AsyncEventSource::canHandle(AsyncWebServerRequest* request) {
+    return request->method() == HTTP_GET && request->url() == _url;
+}
+
+void AsyncEventSource::attach(AsyncWebServerRequest* request, HostConnection* connection) {
+    connection->source = this;
+    connection->output = "HTTP/1.1 200 OK\r\nContent-Type: text/event-stream\r\nCache-Control: no-cache\r\n"
+                         "Connection: keep-alive\r\n\r\n";
+    AsyncEventSourceClient* client = new AsyncEventSourceClient(connection);
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        _clients.emplace_back(client);
+    }
+    if (_connect) {
+        _connect(client);
+    }
+}
+
+void AsyncEventSource::detach(HostConnection* connection) {
+    std::lock_guard<std::mutex> guard(_lock);
+    for (auto it = _clients.begin(); it != _clients.end(); ++it) {
+        if ((*it)->_connection == connection) {
+            _clients.erase(it);
+            return;
+        }
+    }
+}
+
+void AsyncEventSource::send(const char* message, const char* event, uint32_t id, uint32_t reconnect) {
+    std::string text = formatEvent(message, event, id, reconnect);
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        for (auto& client : _clients) {
+            client->_connection->queueEvent(text);
+        }
+    }
+    wakeServer();
+}
+
+size_t AsyncEventSource::count() const {
+    std::lock_guard<std::mutex> guard(_lock);
+    return _clients.size();
+}
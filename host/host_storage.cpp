@@ -0,0 +1,421 @@
+/*********
+  SEMBox Host Emulator - Storage
+  NVS, flash partitions and LittleFS as files of the data directory
+*********/
+
+#include "host_emulator.h"
+#include <Preferences.h>
+#include <LittleFS.h>
+#include "esp_partition.h"
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <mutex>
+#include <vector>
+
+// Set by tools/build_host.py
+#ifndef HOST_PARTITION_TABLE
+#define HOST_PARTITION_TABLE "src/SEMBox/partitions.csv"
+#endif
+
+LittleFSFS LittleFS;
+
+static const size_t NVS_KEY_MAX = 15;     // NVS key and namespace length limit
+
+static bool writeFile(const std::string& path, const void* data, size_t length) {
+    // Written aside and renamed, so a key is either old or new
+    std::string temporary = path + ".tmp";
+    FILE* file = fopen(temporary.c_str(), "wb");
+    if (!file) {
+        return false;
+    }
+    bool written = fwrite(data, 1, length, file) == length;
+    written = fclose(file) == 0 && written;
+    return written && rename(temporary.c_str(), path.c_str()) == 0;
+}
+
+// ===========================================
+// Preferences
+// ===========================================
+
+bool Preferences::begin(const char* name, bool readOnly, const char* partitionLabel) {
+    if (!name || strlen(name) > NVS_KEY_MAX) {
+        return false;
+    }
+    _directory = hostPath(std::string("nvs/") + name + "/");
+    _readOnly = readOnly;
+    return true;
+}
+
+void Preferences::end() {
+    _directory.clear();
+}
+
+std::string Preferences::path(const char* key) const {
+    return _directory + key;
+}
+
+bool Preferences::isKey(const char* key) {
+    struct stat info;
+    return !_directory.empty() && key && ::stat(path(key).c_str(), &info) == 0;
+}
+
+bool Preferences::remove(const char* key) {
+    return !_directory.empty() && !_readOnly && key && unlink(path(key).c_str()) == 0;
+}
+
+bool Preferences::clear() {
+    if (_directory.empty() || _readOnly) {
+        return false;
+    }
+    DIR* directory = opendir(_directory.c_str());
+    if (!directory) {
+        return false;
+    }
+    for (struct dirent* entry = readdir(directory); entry; entry = readdir(directory)) {
+        if (entry->d_name[0] != '.') {
+            unlink(path(entry->d_name).c_str());
+        }
+    }
+    closedir(directory);
+    return true;
+}
+
+size_t Preferences::putBytes(const char* key, const void* value, size_t length) {
+    if (_directory.empty() || _readOnly || !key || strlen(key) > NVS_KEY_MAX || !value || length == 0) {
+        return 0;
+    }
+    return writeFile(path(key), value, length) ? length : 0;
+}
+
+size_t Preferences::getBytesLength(const char* key) {
+    struct stat info;
+    return isKey(key) && ::stat(path(key).c_str(), &info) == 0 ? info.st_size : 0;
+}
+
+size_t Preferences::getBytes(const char* key, void* buffer, size_t maxLength) {
+    size_t length = getBytesLength(key);
+    if (length == 0 || length > maxLength) {
+        return 0;   // NVS does not return part of a value
+    }
+    FILE* file = fopen(path(key).c_str(), "rb");
+    if (!file) {
+        return 0;
+    }
+    size_t read = fread(buffer, 1, length, file);
+    fclose(file);
+    return read == length ? length : 0;
+}
+
+// ===========================================
+// Partitions
+// ===========================================
+
+struct HostPartition {
+    esp_partition_t partition;
+    int fd;
+    std::mutex lock;
+};
+
+static std::mutex partitionLock;
+static std::vector<HostPartition*> partitions;     // Opened so far, kept open
+
+/**
+ * Read a data partition's row from the partition table; false if the
+ * table has no such partition
+ */
+static bool findPartition(const char* label, esp_partition_t* partition) {
+    FILE* table = fopen(HOST_PARTITION_TABLE, "r");
+    if (!table) {
+        Serial.printf("[Host] Partition table %s not found\n", HOST_PARTITION_TABLE);
+        return false;
+    }
+    char line[160];
+    bool found = false;
+    while (!found && fgets(line, sizeof(line), table)) {
+        char name[17], type[16], subtype[16];
+        unsigned long offset, size;
+        if (line[0] == '#' ||
+            sscanf(line, " %16[^, ] , %15[^, ] , %15[^, ] , %li , %li", name, type, subtype, &offset, &size) != 5) {
+            continue;
+        }
+        if (strcmp(name, label) == 0 && strcmp(type, "data") == 0) {
+            memset(partition, 0, sizeof(*partition));
+            partition->type = ESP_PARTITION_TYPE_DATA;
+            partition->subtype = (uint8_t)strtoul(subtype, nullptr, 0);
+            partition->address = offset;
+            partition->size = size;
+            partition->erase_size = 4096;
+            snprintf(partition->label, sizeof(partition->label), "%s", name);
+            found = true;
+        }
+    }
+    fclose(table);
+    return found;
+}
+
+const esp_partition_t* esp_partition_find_first(esp_partition_type_t type, esp_partition_subtype_t subtype,
+                                                const char* label) {
+    std::lock_guard<std::mutex> guard(partitionLock);
+    for (HostPartition* opened : partitions) {
+        if (strcmp(opened->partition.label, label) == 0) {
+            return &opened->partition;
+        }
+    }
+
+    esp_partition_t partition;
+    if (type != ESP_PARTITION_TYPE_DATA || !label || !findPartition(label, &partition)) {
+        return nullptr;
+    }
+
+    // A new image is erased flash
+    std::string path = hostPath(std::string("partitions/") + label + ".bin");
+    int fd = open(path.c_str(), O_RDWR | O_CREAT, 0644);
+    struct stat info;
+    if (fd < 0 || fstat(fd, &info) != 0) {
+        return nullptr;
+    }
+    if ((size_t)info.st_size != partition.size) {
+        std::vector<uint8_t> erased(partition.size, 0xFF);
+        if (ftruncate(fd, 0) != 0 || pwrite(fd, erased.data(), erased.size(), 0) != (ssize_t)erased.size()) {
+            close(fd);
+            return nullptr;
+        }
+    }
+
+    HostPartition* opened = new HostPartition();
+    opened->partition = partition;
+    opened->fd = fd;
+    partitions.push_back(opened);
+    return &opened->partition;
+}
+
+static HostPartition* hostPartition(const esp_partition_t* partition) {
+    std::lock_guard<std::mutex> guard(partitionLock);
+    for (HostPartition* opened : partitions) {
+        if (&opened->partition == partition) {
+            return opened;
+        }
+    }
+    abort();    // Not from esp_partition_find_first()
+}
+
+esp_err_t esp_partition_read(const esp_partition_t* partition, size_t offset, void* dst, size_t size) {
+    if (offset + size > partition->size) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    HostPartition* host = hostPartition(partition);
+    std::lock_guard<std::mutex> guard(host->lock);
+    return pread(host->fd, dst, size, offset) == (ssize_t)size ? ESP_OK : ESP_FAIL;
+}
+
+esp_err_t esp_partition_write(const esp_partition_t* partition, size_t offset, const void* src, size_t size) {
+    if (offset + size > partition->size) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    HostPartition* host = hostPartition(partition);
+    std::lock_guard<std::mutex> guard(host->lock);
+    std::vector<uint8_t> data(size);
+    if (pread(host->fd, data.data(), size, offset) != (ssize_t)size) {
+        return ESP_FAIL;
+    }
+    // Programming only clears bits; writing over data needs an erase first
+    for (size_t i = 0; i < size; i++) {
+        data[i] &= ((const uint8_t*)src)[i];
+    }
+    return pwrite(host->fd, data.data(), size, offset) == (ssize_t)size ? ESP_OK : ESP_FAIL;
+}
+
+esp_err_t esp_partition_erase_range(const esp_partition_t* partition, size_t offset, size_t size) {
+    if (offset % partition->erase_size != 0 || size % partition->erase_size != 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (offset + size > partition->size) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    HostPartition* host = hostPartition(partition);
+    std::lock_guard<std::mutex> guard(host->lock);
+    std::vector<uint8_t> erased(size, 0xFF);
+    return pwrite(host->fd, erased.data(), size, offset) == (ssize_t)size ? ESP_OK : ESP_FAIL;
+}
+
+// ===========================================
+// File system
+// ===========================================
+
+namespace fs {
+
+size_t File::write(const uint8_t* buffer, size_t length) {
+    return _file ? fwrite(buffer, 1, length, _file.get()) : 0;
+}
+
+size_t File::read(uint8_t* buffer, size_t length) {
+    return _file ? fread(buffer, 1, length, _file.get()) : 0;
+}
+
+bool File::seek(uint32_t position) {
+    return _file && fseek(_file.get(), position, SEEK_SET) == 0;
+}
+
+size_t File::position() const {
+    return _file ? ftell(_file.get()) : 0;
+}
+
+size_t File::size() const {
+    struct stat info;
+    if (!_file) {
+        return 0;
+    }
+    fflush(_file.get());
+    return fstat(fileno(_file.get()), &info) == 0 ? info.st_size : 0;
+}
+
+void File::flush() {
+    if (_file) {
+        fflush(_file.get());
+    }
+}
+
+void File::close() {
+    _file.reset();
+    _directory.reset();
+}
+
+const char* File::name() const {
+    size_t slash = _path.rfind('/');
+    return slash == std::string::npos ? _path.c_str() : _path.c_str() + slash + 1;
+}
+
+File File::openNextFile() {
+    File next;
+    if (!_directory) {
+        return next;
+    }
+    for (struct dirent* entry = readdir((DIR*)_directory.get()); entry; entry = readdir((DIR*)_directory.get())) {
+        if (entry->d_name[0] == '.') {
+            continue;
+        }
+        std::string path = (_path == "/" ? "" : _path) + "/" + entry->d_name;
+        std::string hostPath = _hostPath + "/" + entry->d_name;
+        struct stat info;
+        if (::stat(hostPath.c_str(), &info) != 0) {
+            continue;
+        }
+        if (S_ISDIR(info.st_mode)) {
+            DIR* directory = opendir(hostPath.c_str());
+            next._directory = std::shared_ptr<void>(directory, [](void* d) { if (d) closedir((DIR*)d); });
+        } else {
+            next._file = std::shared_ptr<FILE>(fopen(hostPath.c_str(), "rb"), [](FILE* f) { if (f) fclose(f); });
+        }
+        next._path = path;
+        next._hostPath = hostPath;
+        return next;
+    }
+    return next;
+}
+
+File FS::open(const char* path, const char* mode) {
+    File file;
+    if (_root.empty() || !path || path[0] != '/') {
+        return file;
+    }
+    std::string hostPath = _root + path;
+    struct stat info;
+    if (::stat(hostPath.c_str(), &info) == 0 && S_ISDIR(info.st_mode)) {
+        DIR* directory = opendir(hostPath.c_str());
+        if (directory) {
+            file._directory = std::shared_ptr<void>(directory, [](void* d) { closedir((DIR*)d); });
+        }
+    } else {
+        std::string hostMode = std::string(mode) + "b";
+        FILE* opened = fopen(hostPath.c_str(), hostMode.c_str());
+        if (opened) {
+            file._file = std::shared_ptr<FILE>(opened, [](FILE* f) { fclose(f); });
+        }
+    }
+    file._path = path;
+    file._hostPath = hostPath;
+    return file;
+}
+
+bool FS::exists(const char* path) {
+    struct stat info;
+    return !_root.empty() && ::stat((_root + path).c_str(), &info) == 0;
+}
+
+bool FS::mkdir(const char* path) {
+    return !_root.empty() && ::mkdir((_root + path).c_str(), 0755) == 0;
+}
+
+bool FS::remove(const char* path) {
+    return !_root.empty() && unlink((_root + path).c_str()) == 0;
+}
+
+bool FS::rename(const char* from, const char* to) {
+    return !_root.empty() && ::rename((_root + from).c_str(), (_root + to).c_str()) == 0;
+}
+
+} // namespace fs
+
+bool LittleFSFS::begin(bool formatOnFail, const char* basePath, uint8_t maxOpenFiles, const char* partitionLabel) {
+    esp_partition_t partition;
+    if (!findPartition(partitionLabel, &partition)) {
+        return false;
+    }
+    _label = partitionLabel;
+    _root = hostPath("fs/" + _label + "/");
+    _root.pop_back();   // Paths start with '/'
+    return true;
+}
+
+void LittleFSFS::end() {
+    _root.clear();
+}
+
+static bool removeTree(const std::string& path) {
+    DIR* directory = opendir(path.c_str());
+    if (!directory) {
+        return false;
+    }
+    bool removed = true;
+    for (struct dirent* entry = readdir(directory); entry; entry = readdir(directory)) {
+        if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0) {
+            continue;
+        }
+        std::string child = path + "/" + entry->d_name;
+        struct stat info;
+        if (::stat(child.c_str(), &info) == 0 && S_ISDIR(info.st_mode)) {
+            removed = removeTree(child) && rmdir(child.c_str()) == 0 && removed;
+        } else {
+            removed = unlink(child.c_str()) == 0 && removed;
+        }
+    }
+    closedir(directory);
+    return removed;
+}
+
+bool LittleFSFS::format() {
+    return !_root.empty() && removeTree(_root);
+}
+
+size_t LittleFSFS::totalBytes() {
+    esp_partition_t partition;
+    return !_label.empty() && findPartition(_label.c_str(), &partition) ? partition.size : 0;
+}
+
+size_t LittleFSFS::usedBytes() {
+    // Files of the root and one level of directories (the log uses /log)
+    size_t used = 0;
+    fs::File root = open("/");
+    for (fs::File entry = root.openNextFile(); entry; entry = root.openNextFile()) {
+        if (entry.isDirectory()) {
+            for (fs::File file = entry.openNextFile(); file; file = entry.openNextFile()) {
+                used += file.size();
+            }
+        } else {
+            used += entry.size();
+        }
+    }
+    return used;
+}
@@ -0,0 +1,15 @@
+/*********
+  SEMBox Host Emulator - ESP-IDF build configuration
+  The options the firmware tests for, as the host provides them
+*********/
+
+#ifndef HOST_SDKCONFIG_H
+#define HOST_SDKCONFIG_H
+
+// Allocation hooks (esp_heap_caps.h); the sanitizers bring their own
+// allocator, which the host cannot wrap
+#if !defined(__SANITIZE_ADDRESS__) && !defined(__SANITIZE_THREAD__)
+#define CONFIG_HEAP_USE_HOOKS 1
+#endif
+
+#endif // HOST_SDKCONFIG_H
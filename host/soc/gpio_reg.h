@@ -0,0 +1,25 @@
+/*********
+  SEMBox Host Emulator - GPIO registers
+  Register accesses go to the emulated pins (host_emulator.h). Outputs
+  read back their level; inputs idle at their pull level.
+*********/
+
+#ifndef HOST_SOC_GPIO_REG_H
+#define HOST_SOC_GPIO_REG_H
+
+#include <stdint.h>
+
+#define GPIO_OUT_W1TS_REG 0x3FF44008
+#define GPIO_OUT_W1TC_REG 0x3FF4400C
+#define GPIO_OUT1_W1TS_REG 0x3FF44014
+#define GPIO_OUT1_W1TC_REG 0x3FF44018
+#define GPIO_IN_REG 0x3FF4403C
+#define GPIO_IN1_REG 0x3FF44040
+
+uint32_t hostRegRead(uint32_t reg);
+void hostRegWrite(uint32_t reg, uint32_t value);
+
+#define REG_READ(reg) hostRegRead(reg)
+#define REG_WRITE(reg, value) hostRegWrite(reg, value)
+
+#endif // HOST_SOC_GPIO_REG_H
@@ -0,0 +1,144 @@
+/*********
+  SEMBox Host - Command Check Test
+  Batches are rejected before their first operation or run to the end
+
+  checkBatch() must find every failure executeBatch() could meet while
+  running the operations: a following error fault or a move too long
+  for the step counter behind an output switch, a goto beyond a division
+  count changed earlier in the same batch, a second move while the first
+  one owns the table, or a running program. It works on a copy of the
+  state, so a rejected batch leaves nothing changed.
+*********/
+
+#include <stdint.h>
+#include <string.h>
+#include "host_test.h"
+#include "command_check.h"
+
+static const uint32_t MOTOR_STEPS_PER_REV = 3200;     // As in SEMBox.ino
+
+static TableState idleTable() {
+    TableState state;
+    state.busy = false;
+    state.programRunning = false;
+    state.encoderFault = false;
+    state.homed = true;
+    state.position = 0;
+    state.index = 0;
+    state.origin = 0;
+    state.motorStepsPerRev = MOTOR_STEPS_PER_REV;
+    state.math.configure(24, 90000, MOTOR_STEPS_PER_REV);
+    return state;
+}
+
+static Command outputs(uint16_t set, uint16_t clear) {
+    Command command;
+    memset(&command, 0, sizeof(command));
+    command.type = CMD_OUTPUTS;
+    command.outputs.set = set;
+    command.outputs.clear = clear;
+    return command;
+}
+
+static Command move(CommandType type, int32_t value) {
+    Command command;
+    memset(&command, 0, sizeof(command));
+    command.type = type;
+    command.move.value = value;
+    return command;
+}
+
+static Command table(int32_t division, uint32_t ratioMilli) {
+    Command command;
+    memset(&command, 0, sizeof(command));
+    command.type = CMD_PARAMS;
+    command.params.hasTable = true;
+    command.params.division = division;
+    command.params.ratioMilli = ratioMilli;
+    return command;
+}
+
+// Expect the batch to fail at failedOp with error, or pass if error is nullptr
+static void expect(const char* label, const Command* ops, uint8_t count, const TableState& state,
+                   const char* error, uint8_t failedOp) {
+    uint8_t failed = 0xFF;
+    const char* result = checkBatch(ops, count, state, &failed);
+    if (!error) {
+        CHECK(result == nullptr, "%s: rejected at op %u: %s", label, failed, result);
+        return;
+    }
+    CHECK(result && strcmp(result, error) == 0, "%s: got \"%s\", expected \"%s\"", label,
+          result ? result : "accepted", error);
+    CHECK(failed == failedOp, "%s: failed at op %u, expected %u", label, failed, failedOp);
+}
+
+static void checkPartialFailures() {
+    TableState state = idleTable();
+
+    // Unclamp, then index: a following error fault must stop the batch before the unclamp
+    TableState fault = state;
+    fault.encoderFault = true;
+    const Command unclampAndIndex[] = { outputs(0, 0x2), move(CMD_TABLE_INDEX, 1) };
+    expect("fault", unclampAndIndex, 2, fault, "Following error, home the table", 1);
+    expect("no fault", unclampAndIndex, 2, state, nullptr, 0);
+
+    // The move is too long only with the parameters set earlier in the batch
+    const Command longMove[] = { outputs(0x2, 0), table(1, 9999000), move(CMD_TABLE_INDEX, 100) };
+    expect("move too long", longMove, 3, state, "Move too long", 2);
+    const Command shortMove[] = { outputs(0x2, 0), table(1, 9999000), move(CMD_TABLE_INDEX, 10) };
+    expect("long but valid move", shortMove, 3, state, nullptr, 0);
+
+    // Goto range follows the division set in the batch
+    const Command gotoAfterParams[] = { table(12, 90000), move(CMD_TABLE_GOTO, 12) };
+    expect("goto beyond new division", gotoAfterParams, 2, state, "Invalid division", 1);
+    const Command gotoWithinParams[] = { table(36, 90000), move(CMD_TABLE_GOTO, 30) };
+    expect("goto within new division", gotoWithinParams, 2, state, nullptr, 0);
+
+    // One move per batch, even a goto to where the table already is
+    const Command twoMoves[] = { move(CMD_TABLE_GOTO, 0), outputs(0x1, 0), move(CMD_TABLE_INDEX, 1) };
+    expect("second move", twoMoves, 3, state, "Table busy", 2);
+    const Command homeThenParams[] = { move(CMD_TABLE_HOME, 0), table(24, 90000) };
+    expect("params while homing", homeThenParams, 2, state, "Table busy", 1);
+
+    // A moving table or a running program still allows outputs, nothing else
+    TableState moving = state;
+    moving.busy = true;
+    const Command outputsOnly[] = { outputs(0x1, 0), outputs(0, 0x1) };
+    expect("outputs while moving", outputsOnly, 2, moving, nullptr, 0);
+    expect("index while moving", unclampAndIndex, 2, moving, "Table busy", 1);
+    TableState program = state;
+    program.programRunning = true;
+    expect("index while a program runs", unclampAndIndex, 2, program, "Program running", 1);
+    expect("outputs while a program runs", outputsOnly, 2, program, nullptr, 0);
+}
+
+static void checkIndexing() {
+    // checkIndexMove agrees with the index math
+    TableState state = idleTable();
+    state.position = 1234;
+    state.origin = 34;
+    state.index = 3;
+    int64_t steps = 0;
+    CHECK(checkIndexMove(state, 2, &steps) == nullptr, "index move rejected");
+    CHECK(steps == 34 + state.math.stepsAt(5) - 1234, "index move of %lld steps", (long long)steps);
+
+    // Not homed: the current position becomes division 0
+    state.homed = false;
+    CHECK(reindexTable(state, 12, 45000), "reindex failed");
+    CHECK(state.origin == 1234 && state.index == 0, "unhomed reindex: origin %lld index %lld",
+          (long long)state.origin, (long long)state.index);
+
+    // Homed: home stays division 0 and the index is the nearest division
+    state.homed = true;
+    state.position = state.math.stepsAt(7) + 3;
+    CHECK(reindexTable(state, 12, 45000), "reindex failed");
+    CHECK(state.origin == 0 && state.index == 7, "homed reindex: origin %lld index %lld",
+          (long long)state.origin, (long long)state.index);
+    CHECK(!reindexTable(state, 0, 45000), "division 0 accepted");
+}
+
+int main() {
+    checkPartialFailures();
+    checkIndexing();
+    return hostTestResult("command_check_test");
+}
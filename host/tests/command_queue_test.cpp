@@ -0,0 +1,127 @@
+/*********
+  SEMBox Host - Command Queue Test
+  Two-thread stress of SpscQueue running near full
+
+  A producer thread pushes numbered Commands as fast as it can and
+  retries when the queue is full, as a web handler would report "queue
+  full" and the client retry. The consumer thread pops them, stalling
+  now and then so the queue spends much of the run full. Every command
+  must arrive exactly once, in order, with the payload it was pushed
+  with: a lost, repeated, reordered or torn record fails the test. Run it
+  with --sanitize thread as well to check the memory ordering. Both
+  sides spin a little, then sleep, so the test also progresses on a
+  single-core host where yielding does not hand over the CPU.
+*********/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include "host_test.h"
+#include "command_queue.h"
+
+static const int SPINS_BEFORE_SLEEP = 64;
+
+// Spin first, then give the other thread the CPU
+static void backoff(int& spins) {
+    if (++spins < SPINS_BEFORE_SLEEP) {
+        std::this_thread::yield();
+    } else {
+        std::this_thread::sleep_for(std::chrono::microseconds(20));
+        spins = 0;
+    }
+}
+
+// Payload derived from the id, so a torn or stale copy is detected
+static void fill(Command& command, uint32_t id) {
+    memset(&command, 0, sizeof(command));
+    command.id = id;
+    command.type = CMD_PARAMS;
+    command.params.hasTable = (id & 1) != 0;
+    command.params.division = (int32_t)(id * 2654435761u);
+    command.params.ratioMilli = ~id;
+    command.params.followingLimit = id ^ 0xA5A5A5A5u;
+}
+
+static bool intact(const Command& command, uint32_t id) {
+    Command expected;
+    fill(expected, id);
+    return command.type == expected.type &&
+           command.params.hasTable == expected.params.hasTable &&
+           command.params.division == expected.params.division &&
+           command.params.ratioMilli == expected.params.ratioMilli &&
+           command.params.followingLimit == expected.params.followingLimit;
+}
+
+template <size_t Capacity>
+static void stress(const char* label, uint32_t commands) {
+    SpscQueue<Command, Capacity> queue;
+    std::atomic<bool> done(false);
+    uint64_t fullPushes = 0;
+
+    std::thread producer([&] {
+        Command command;
+        int spins = 0;
+        for (uint32_t id = 1; id <= commands; id++) {
+            fill(command, id);
+            while (!queue.push(command)) {
+                fullPushes++;
+                backoff(spins);
+            }
+        }
+        done.store(true);
+    });
+
+    uint32_t expected = 1;
+    uint32_t errors = 0;
+    uint64_t fullPops = 0;
+    size_t maxSize = 0;
+    int spins = 0;
+    Command command;
+    while (expected <= commands) {
+        // Stall every 64 commands so the producer catches up and fills the queue
+        if ((expected & 63) == 0 && spins == 0) {
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+        }
+        size_t size = queue.size();
+        if (!queue.pop(command)) {
+            if (done.load() && queue.size() == 0) {
+                break;
+            }
+            backoff(spins);
+            continue;
+        }
+        spins = 0;
+        fullPops += size == queue.capacity();
+        if (size > maxSize) {
+            maxSize = size;
+        }
+
+        if (command.id != expected || !intact(command, expected)) {
+            if (errors++ < 5) {
+                CHECK(false, "%s: got command %u (%s), expected %u", label, command.id,
+                      intact(command, command.id) ? "intact" : "torn", expected);
+            }
+            expected = command.id;
+        }
+        expected++;
+    }
+    producer.join();
+
+    Command extra;
+    CHECK(expected == commands + 1, "%s: %u of %u commands arrived", label, expected - 1, commands);
+    CHECK(!queue.pop(extra), "%s: command left in the queue", label);
+    CHECK(errors == 0, "%s: %u ordering errors", label, errors);
+    CHECK(maxSize <= queue.capacity(), "%s: size %zu above capacity", label, maxSize);
+    CHECK(fullPushes > 0, "%s: the queue never ran full", label);
+    printf("  %s: %u commands in order, queue full at %.0f%% of pops, %llu pushes found it full\n",
+           label, commands, 100.0 * fullPops / commands, (unsigned long long)fullPushes);
+}
+
+int main() {
+    stress<16>("capacity 16 (as commandQueue)", 2000000);
+    stress<2>("capacity 2 (one slot)", 200000);
+    return hostTestResult("command_queue_test");
+}
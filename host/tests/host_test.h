@@ -0,0 +1,40 @@
+/*********
+  SEMBox Host - Test Support
+  Minimal checks for the module tests in host/tests
+
+  Each test is a plain executable that links the sketch modules it
+  needs, prints what it measured and returns non-zero if a CHECK
+  failed. tools/build_host.py --test builds and runs them all.
+*********/
+
+#ifndef HOST_TEST_H
+#define HOST_TEST_H
+
+#include <stdio.h>
+
+static int hostTestFailures = 0;
+
+// Report a failed condition with a printf-style message; counts the failure
+#define CHECK(condition, ...)                                               \
+    do {                                                                    \
+        if (!(condition)) {                                                 \
+            if (hostTestFailures++ < 20) {                                  \
+                fprintf(stderr, "%s:%d: CHECK(%s) failed: ", __FILE__,      \
+                        __LINE__, #condition);                              \
+                fprintf(stderr, __VA_ARGS__);                               \
+                fputc('\n', stderr);                                        \
+            }                                                               \
+        }                                                                   \
+    } while (0)
+
+// Print the verdict and return the process exit code
+static inline int hostTestResult(const char* name) {
+    if (hostTestFailures) {
+        printf("%s: FAILED (%d checks)\n", name, hostTestFailures);
+        return 1;
+    }
+    printf("%s: OK\n", name);
+    return 0;
+}
+
+#endif // HOST_TEST_H
@@ -0,0 +1,184 @@
+/*********
+  SEMBox Host - Index Math Test
+  Cumulative drift of IndexMath over millions of index moves
+
+  Every division the firmware accepts (1..9999) is combined with whole,
+  fractional and near-limit ratios. For each setup a random walk of
+  index moves is replayed the way startIndexMove() does it: the move is
+  the step difference to the absolute target, added to a running motor
+  position. After every move the position is compared with the exact
+  rational target k * stepsPerRev * ratio / (division * 1000) in 128-bit
+  integers: it must stay within half a step, so no error accumulates.
+  Whole revolutions must land on exactly whole revolutions of steps, and
+  indexNear() must invert stepsAt() whenever a division is at least one
+  step wide. The step pattern must repeat exactly after periodIndexes().
+
+  The long runs go through checkIndexMove() and rebaseTable() with the
+  int32 step position of the step engine, as jobMotion() does at rest,
+  and must stay exact long after the raw position would have overflowed.
+*********/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <random>
+#include "host_test.h"
+#include "command_check.h"
+#include "index_math.h"
+
+static const uint32_t MOTOR_STEPS_PER_REV = 3200;  // As in SEMBox.ino
+static const uint32_t MAX_DIVISION = 9999;         // Limits of /params/save
+static const uint32_t MIN_RATIO_MILLI = 1000;
+static const uint32_t MAX_RATIO_MILLI = 9999000;
+static const int MOVES_PER_SETUP = 256;
+
+// Ratios tried with every division: whole, fractional, prime and extremes
+static const uint32_t RATIOS_MILLI[] = {
+    MIN_RATIO_MILLI, 1001, 1333, 36000, 40000, 72000, 90000, 90001,
+    97531, 120000, 359999, 1234567, MAX_RATIO_MILLI - 1, MAX_RATIO_MILLI
+};
+
+static uint64_t moves = 0;
+static uint64_t revolutions = 0;
+static double maxError = 0;         // Steps
+
+static void noteError(__int128 doubled, __int128 modulus) {
+    double error = (double)(doubled < 0 ? -doubled : doubled) / (double)(2 * modulus);
+    if (error > maxError) {
+        maxError = error;
+    }
+}
+
+/**
+ * Twice the error of `steps` against the exact target of index k, in
+ * units of 1 / (division * RATIO_SCALE) steps
+ */
+static __int128 doubledError(int64_t steps, int64_t k, uint32_t division, uint32_t ratioMilli) {
+    __int128 modulus = (__int128)division * IndexMath::RATIO_SCALE;
+    __int128 exact = (__int128)k * MOTOR_STEPS_PER_REV * ratioMilli;
+    return 2 * ((__int128)steps * modulus - exact);
+}
+
+static void checkSetup(uint32_t division, uint32_t ratioMilli, std::mt19937_64& random) {
+    IndexMath math;
+    CHECK(math.configure(division, ratioMilli, MOTOR_STEPS_PER_REV), "configure(%u, %u)", division, ratioMilli);
+
+    __int128 modulus = (__int128)division * IndexMath::RATIO_SCALE;
+    __int128 perDivision = (__int128)MOTOR_STEPS_PER_REV * ratioMilli;  // Steps per division * modulus
+    bool invertible = perDivision >= modulus;
+    bool wholeRevolution = ((int64_t)MOTOR_STEPS_PER_REV * ratioMilli) % IndexMath::RATIO_SCALE == 0;
+    int64_t revolutionSteps = (int64_t)MOTOR_STEPS_PER_REV * ratioMilli / IndexMath::RATIO_SCALE;
+
+    // Moves of one division, up to a few revolutions, in both directions;
+    // the motor position stays well inside the int32 move limit
+    std::uniform_int_distribution<int64_t> count(-3 * (int64_t)division, 3 * (int64_t)division);
+    int64_t index = 0;
+    int64_t position = 0;
+    for (int i = 0; i < MOVES_PER_SETUP; i++) {
+        int64_t step = (i % 4 == 0) ? count(random) : (i % 2 ? 1 : -1);
+        int64_t target = index + step;
+        int64_t move = math.stepsAt(target) - position;
+        CHECK(move >= INT32_MIN && move <= INT32_MAX, "move of %lld steps", (long long)move);
+        position += (int32_t)move;
+        index = target;
+        moves++;
+
+        __int128 error = doubledError(position, index, division, ratioMilli);
+        if (error <= -modulus || error > modulus) {
+            CHECK(false, "division %u ratio %u index %lld: position %lld off by more than half a step",
+                  division, ratioMilli, (long long)index, (long long)position);
+            return;
+        }
+        noteError(error, modulus);
+        if (index % division == 0) {
+            revolutions++;
+            if (wholeRevolution) {
+                CHECK(position == index / division * revolutionSteps,
+                      "division %u ratio %u: %lld revolutions at step %lld",
+                      division, ratioMilli, (long long)(index / division), (long long)position);
+            }
+        }
+        if (invertible) {
+            CHECK(math.indexNear(position) == index, "division %u ratio %u: indexNear(%lld) = %lld, expected %lld",
+                  division, ratioMilli, (long long)position, (long long)math.indexNear(position), (long long)index);
+        }
+        CHECK(math.stepsAt(index + math.periodIndexes()) == position + math.periodSteps(),
+              "division %u ratio %u: pattern does not repeat after %lld divisions",
+              division, ratioMilli, (long long)math.periodIndexes());
+    }
+    CHECK(math.periodIndexes() % division == 0 && math.periodIndexes() <= 5 * (int64_t)division,
+          "division %u ratio %u: period of %lld divisions", division, ratioMilli, (long long)math.periodIndexes());
+}
+
+/**
+ * Ten million consecutive single-division moves on typical setups, as a
+ * long indexing job would issue them, through the firmware's int32 path
+ */
+static void checkLongRun(uint32_t division, uint32_t ratioMilli, int64_t direction) {
+    static const int64_t LONG_RUN_MOVES = 10000000;
+    TableState state = {};
+    state.homed = true;
+    state.motorStepsPerRev = MOTOR_STEPS_PER_REV;
+    CHECK(reindexTable(state, division, ratioMilli), "configure(%u, %u)", division, ratioMilli);
+    __int128 modulus = (__int128)division * IndexMath::RATIO_SCALE;
+
+    int32_t position = 0;               // StepPlanner::_position
+    int64_t shifted = 0;                // Steps taken off by rebasing
+    int64_t periods = 0;                // Indexes taken off by rebasing
+    for (int64_t i = 1; i <= LONG_RUN_MOVES; i++) {
+        state.position = position;
+        int64_t steps;
+        const char* error = checkIndexMove(state, direction, &steps);
+        if (error != nullptr) {
+            CHECK(false, "long run division %u ratio %u: %s at move %lld", division, ratioMilli, error, (long long)i);
+            return;
+        }
+        position += (int32_t)steps;
+        state.index += direction;
+        moves++;
+
+        state.position = position;
+        int64_t shift = rebaseTable(state);
+        position = (int32_t)state.position;
+        shifted += shift;
+        if (shift != 0) {
+            periods += shift / state.math.periodSteps() * state.math.periodIndexes();
+        }
+
+        // Against the index the table has really reached
+        __int128 drift = doubledError(position + shifted, state.index + periods, division, ratioMilli);
+        if (drift <= -modulus || drift > modulus) {
+            CHECK(false, "long run division %u ratio %u: drift at move %lld", division, ratioMilli, (long long)i);
+            return;
+        }
+        noteError(drift, modulus);
+    }
+    CHECK(state.index + periods == direction * LONG_RUN_MOVES, "long run division %u ratio %u: lost an index",
+          division, ratioMilli);
+    printf("  %u divisions, ratio %u.%03u: %lld moves, %lld steps, position %ld after rebasing\n",
+           division, ratioMilli / 1000, ratioMilli % 1000, (long long)LONG_RUN_MOVES,
+           (long long)(position + shifted), (long)position);
+}
+
+int main() {
+    std::mt19937_64 random(20260101);
+    for (uint32_t division = 1; division <= MAX_DIVISION; division++) {
+        for (uint32_t ratioMilli : RATIOS_MILLI) {
+            checkSetup(division, ratioMilli, random);
+        }
+    }
+
+    // Random ratios across the whole range
+    std::uniform_int_distribution<uint32_t> division(1, MAX_DIVISION);
+    std::uniform_int_distribution<uint32_t> ratio(MIN_RATIO_MILLI, MAX_RATIO_MILLI);
+    for (int i = 0; i < 20000; i++) {
+        checkSetup(division(random), ratio(random), random);
+    }
+
+    checkLongRun(24, 90000, 1);
+    checkLongRun(7, 90001, -1);
+    checkLongRun(9999, 1333, 1);
+
+    printf("  %llu index moves, %llu whole revolutions, max error %.4f step\n",
+           (unsigned long long)moves, (unsigned long long)revolutions, maxError);
+    return hostTestResult("index_math_test");
+}
@@ -0,0 +1,260 @@
+/*********
+  SEMBox Host - Program Engine Test
+  Bytecode written by ProgramWriter and run by ProgramEngine
+
+  The engine runs on a simulated microsecond clock, serviced once per
+  1 ms control tick with some lateness. Moves keep the table busy for a
+  few ticks. Nested loops must run their bodies the right number of
+  times, dwells must chain from their deadlines so a long loop does not
+  drift, an input wait must time out, stop() must end a program that
+  would run forever, and corrupt bytecode must fail the program rather
+  than run past its end.
+*********/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <random>
+#include "host_test.h"
+#include "program_engine.h"
+
+static const int64_t TICK_US = 1000;
+static const int64_t MOVE_US = 3500;
+
+static int64_t nowUs = 0;
+static int64_t busyUntilUs = 0;
+static uint16_t inputMask = 0;
+static int indexMoves = 0;
+static int outputSwitches = 0;
+static int64_t outputTimes[2048];
+
+static int64_t clockUs() { return nowUs; }
+static bool tableBusy() { return nowUs < busyUntilUs; }
+static uint16_t inputs() { return inputMask; }
+
+static const char* execute(const Command& command) {
+    switch (command.type) {
+        case CMD_TABLE_INDEX:
+        case CMD_TABLE_GOTO:
+        case CMD_TABLE_HOME:
+            indexMoves++;
+            busyUntilUs = nowUs + MOVE_US;
+            return nullptr;
+        case CMD_OUTPUTS:
+            if (outputSwitches < (int)(sizeof(outputTimes) / sizeof(outputTimes[0]))) {
+                outputTimes[outputSwitches] = nowUs;
+            }
+            outputSwitches++;
+            return nullptr;
+        default:
+            return "Unexpected command";
+    }
+}
+
+static ProgramEngine engine(clockUs, execute, tableBusy, inputs);
+
+/**
+ * Start a program and service it every tick (late by up to `jitterUs`)
+ * until it ends or `maxUs` passes. Returns the final state.
+ */
+static ProgramState run(const uint8_t* code, uint16_t length, int64_t maxUs, int64_t jitterUs = 0,
+                        int64_t stopAtUs = -1) {
+    static std::mt19937 random(17);
+    std::uniform_int_distribution<int64_t> late(0, jitterUs);
+    indexMoves = 0;
+    outputSwitches = 0;
+    busyUntilUs = 0;
+
+    CHECK(engine.stage("test", code, length), "stage refused");
+    const char* error = engine.start();
+    CHECK(error == nullptr, "start: %s", error);
+    int64_t begin = nowUs;
+    int64_t tick = nowUs;
+    while (engine.running() && nowUs - begin < maxUs) {
+        tick += TICK_US;
+        nowUs = tick + late(random);
+        if (stopAtUs >= 0 && nowUs - begin >= stopAtUs) {
+            engine.stop();
+        }
+        engine.service();
+    }
+    return engine.state();
+}
+
+static void checkNestedLoops() {
+    uint8_t code[PROGRAM_MAX_CODE];
+    ProgramWriter writer(code, sizeof(code));
+    writer.loop(3);
+    writer.index(1);
+    writer.loop(4);
+    writer.outputs(1, 0);
+    writer.loop(2);
+    writer.outputs(0, 1);
+    writer.next();
+    writer.next();
+    writer.next();
+    const char* error = writer.end();
+    CHECK(error == nullptr, "writer: %s", error);
+
+    CHECK(run(code, writer.length(), 1000000) == PROGRAM_DONE, "nested loops: state %d error %s",
+          engine.state(), engine.status().error);
+    CHECK(indexMoves == 3, "nested loops: %d moves, expected 3", indexMoves);
+    CHECK(outputSwitches == 3 * 4 * 3, "nested loops: %d output switches, expected 36", outputSwitches);
+}
+
+static void checkDwellChaining() {
+    // A 1.5 ms cycle on a 1 ms tick that is late by up to 0.4 ms: every
+    // cycle must start within one tick of its exact time, however long
+    // the program has run
+    static const int CYCLES = 2000;
+    static const uint32_t CYCLE_US = 1500;
+    uint8_t code[PROGRAM_MAX_CODE];
+    ProgramWriter writer(code, sizeof(code));
+    writer.loop(CYCLES);
+    writer.outputs(1, 0);
+    writer.dwell(CYCLE_US);
+    writer.next();
+    writer.end();
+
+    int64_t start = nowUs;
+    CHECK(run(code, writer.length(), (int64_t)CYCLES * CYCLE_US + 10 * TICK_US, 400) == PROGRAM_DONE,
+          "dwell: state %d", engine.state());
+    CHECK(outputSwitches == CYCLES, "dwell: %d cycles, expected %d", outputSwitches, CYCLES);
+
+    int64_t worst = 0;
+    for (int k = 1; k < outputSwitches && k < CYCLES; k++) {
+        int64_t lag = outputTimes[k] - (start + (int64_t)k * CYCLE_US);
+        CHECK(lag >= 0 && lag < TICK_US + 400, "dwell: cycle %d late by %lld us", k, (long long)lag);
+        if (lag > worst) {
+            worst = lag;
+        }
+    }
+    printf("  %d dwell cycles of %u us: worst start %lld us late, no drift\n",
+           CYCLES, (unsigned)CYCLE_US, (long long)worst);
+}
+
+static void checkWait() {
+    uint8_t code[PROGRAM_MAX_CODE];
+    ProgramWriter writer(code, sizeof(code));
+    writer.wait(3, true, 50);
+    writer.outputs(1, 0);
+    writer.end();
+
+    inputMask = 0;
+    int64_t start = nowUs;
+    CHECK(run(code, writer.length(), 1000000) == PROGRAM_FAILED, "wait: state %d", engine.state());
+    ProgramStatus status = engine.status();
+    CHECK(status.error && strcmp(status.error, "Input timeout") == 0, "wait: error %s", status.error);
+    CHECK(status.op == OP_WAIT && outputSwitches == 0, "wait: failed at op %d after %d switches",
+          status.op, outputSwitches);
+    CHECK(nowUs - start >= 50000 && nowUs - start <= 52000, "wait: timed out after %lld us",
+          (long long)(nowUs - start));
+
+    // The level already present satisfies the wait
+    inputMask = 1 << 3;
+    CHECK(run(code, writer.length(), 1000000) == PROGRAM_DONE && outputSwitches == 1,
+          "wait: state %d with the input active", engine.state());
+    inputMask = 0;
+}
+
+static void checkStop() {
+    uint8_t code[PROGRAM_MAX_CODE];
+    ProgramWriter writer(code, sizeof(code));
+    writer.loop(0);
+    writer.index(1);
+    writer.dwell(2000);
+    writer.next();
+    writer.end();
+
+    CHECK(run(code, writer.length(), 1000000, 0, 100000) == PROGRAM_STOPPED,
+          "stop: state %d", engine.state());
+    CHECK(indexMoves > 10 && engine.status().endedUs != 0, "stop: %d moves before stopping", indexMoves);
+}
+
+static void checkCorrupt() {
+    const struct {
+        const char* what;
+        uint8_t code[8];
+        uint16_t length;
+    } programs[] = {
+        { "truncated operand", { OP_INDEX, 1 }, 2 },
+        { "truncated dwell", { OP_DWELL, 0x10, 0x27 }, 3 },
+        { "unknown opcode", { 0x7F, OP_END }, 2 },
+        { "next without loop", { OP_NEXT, OP_END }, 2 },
+        { "wait channel 16", { OP_WAIT, 16, 1, 0, 0, 0, 0, OP_END }, 8 },
+        { "no end", { OP_OUTPUTS, 1, 0, 0, 0 }, 5 },
+        { "empty", { 0 }, 0 },
+    };
+    for (const auto& program : programs) {
+        CHECK(run(program.code, program.length, 100000) == PROGRAM_FAILED, "%s: state %d",
+              program.what, engine.state());
+        const char* error = engine.status().error;
+        CHECK(error && strcmp(error, "Corrupt program") == 0, "%s: error %s", program.what, error);
+    }
+
+    // Loops nested deeper than the engine tracks
+    uint8_t deep[PROGRAM_MAX_CODE];
+    uint16_t length = 0;
+    for (uint8_t i = 0; i <= PROGRAM_MAX_LOOP_DEPTH; i++) {
+        deep[length++] = OP_LOOP;
+        deep[length++] = 1;
+        deep[length++] = 0;
+    }
+    deep[length++] = OP_END;
+    CHECK(run(deep, length, 100000) == PROGRAM_FAILED, "deep loops: state %d", engine.state());
+}
+
+static void checkWriter() {
+    uint8_t code[PROGRAM_MAX_CODE];
+    {
+        ProgramWriter writer(code, sizeof(code));
+        writer.loop(2);
+        const char* error = writer.end();
+        CHECK(error && strcmp(error, "loop without next") == 0, "unclosed loop: %s", error);
+    }
+    {
+        ProgramWriter writer(code, sizeof(code));
+        const char* error = writer.next();
+        CHECK(error && strcmp(error, "next without loop") == 0, "stray next: %s", error);
+    }
+    {
+        ProgramWriter writer(code, sizeof(code));
+        const char* error = nullptr;
+        for (uint8_t i = 0; i <= PROGRAM_MAX_LOOP_DEPTH; i++) {
+            error = writer.loop(1);
+        }
+        CHECK(error && strcmp(error, "Loops nested too deep") == 0, "deep loops: %s", error);
+    }
+    {
+        ProgramWriter writer(code, sizeof(code));
+        CHECK(writer.index(0) != nullptr && writer.home() != nullptr, "index 0 accepted, or error not sticky");
+    }
+    {
+        ProgramWriter writer(code, sizeof(code));
+        CHECK(writer.gotoDivision(-1) != nullptr, "goto -1 accepted");
+    }
+    {
+        ProgramWriter writer(code, sizeof(code));
+        CHECK(writer.wait(16, true, 0) != nullptr, "wait on channel 16 accepted");
+    }
+    {
+        ProgramWriter writer(code, sizeof(code));
+        const char* error = nullptr;
+        for (int i = 0; i < PROGRAM_MAX_CODE / 5 + 1 && !error; i++) {
+            error = writer.dwell(1000);
+        }
+        CHECK(error && strcmp(error, "Program too long") == 0, "overlong program: %s", error);
+        CHECK(writer.length() <= PROGRAM_MAX_CODE, "wrote %u bytes", writer.length());
+    }
+}
+
+int main() {
+    nowUs = 1000000;
+    checkNestedLoops();
+    checkDwellChaining();
+    checkWait();
+    checkStop();
+    checkCorrupt();
+    checkWriter();
+    return hostTestResult("program_engine_test");
+}
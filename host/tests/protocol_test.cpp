@@ -0,0 +1,78 @@
+/*********
+  SEMBox Host - Protocol Test
+  Decoding of /command.bin records by wire opcode
+
+  Gateways written against the first /command.bin keep sending opcode 0
+  with flags bit 0 for the LED; it must still switch the LED channel.
+  Every opcode decodes into the command it names, and unassigned opcodes
+  (4 in particular, which used to be the batch command) are rejected.
+*********/
+
+#include <stdint.h>
+#include <string.h>
+#include "host_test.h"
+#include "protocol.h"
+
+static WireCommand record(uint8_t type, uint8_t flags, int32_t value) {
+    WireCommand wire;
+    memset(&wire, 0, sizeof(wire));
+    wire.type = type;
+    wire.flags = flags;
+    wire.value = value;
+    return wire;
+}
+
+static void checkLed() {
+    const uint32_t led = 1u << WIRE_LED_CHANNEL;
+    Command command;
+    CHECK(decodeCommand(record(WIRE_LED, WIRE_LED_ON, 0), command), "LED on rejected");
+    CHECK(command.type == CMD_OUTPUTS && command.outputs.set == led && command.outputs.clear == 0,
+          "LED on: set %x clear %x", command.outputs.set, command.outputs.clear);
+
+    // Only flags bit 0 counts; value was ignored by the LED command
+    CHECK(decodeCommand(record(WIRE_LED, 0, 0x7FFF7FFF), command), "LED off rejected");
+    CHECK(command.type == CMD_OUTPUTS && command.outputs.set == 0 && command.outputs.clear == led,
+          "LED off: set %x clear %x", command.outputs.set, command.outputs.clear);
+}
+
+static void checkOpcodes() {
+    Command command;
+    CHECK(decodeCommand(record(WIRE_OUTPUTS, 0, 0x00060009), command), "outputs rejected");
+    CHECK(command.type == CMD_OUTPUTS && command.outputs.set == 0x9 && command.outputs.clear == 0x6,
+          "outputs: set %x clear %x", command.outputs.set, command.outputs.clear);
+
+    WireCommand params = record(WIRE_PARAMS, WIRE_PARAMS_TABLE | WIRE_PARAMS_LIMITS, 24);
+    params.ratioMilli = 90000;
+    params.maxVelocity = 20000;
+    params.acceleration = 80000;
+    params.jerk = 400000;
+    CHECK(decodeCommand(params, command), "params rejected");
+    CHECK(command.type == CMD_PARAMS && command.params.hasTable && command.params.hasLimits &&
+          !command.params.hasFollowing && command.params.division == 24 &&
+          command.params.ratioMilli == 90000 && command.params.limits.maxVelocity == 20000 &&
+          command.params.limits.acceleration == 80000 && command.params.limits.jerk == 400000,
+          "params decoded wrongly");
+
+    const struct { uint8_t opcode; CommandType type; } moves[] = {
+        { WIRE_TABLE_INDEX, CMD_TABLE_INDEX },
+        { WIRE_TABLE_GOTO, CMD_TABLE_GOTO },
+        { WIRE_TABLE_HOME, CMD_TABLE_HOME },
+    };
+    for (const auto& move : moves) {
+        CHECK(decodeCommand(record(move.opcode, 0, -3), command), "opcode %u rejected", move.opcode);
+        CHECK(command.type == move.type && command.move.value == -3, "opcode %u: type %d value %d",
+              move.opcode, command.type, command.move.value);
+    }
+
+    for (unsigned opcode = 0; opcode < 256; opcode++) {
+        bool assigned = opcode <= WIRE_TABLE_GOTO || opcode == WIRE_TABLE_HOME || opcode == WIRE_OUTPUTS;
+        CHECK(decodeCommand(record((uint8_t)opcode, 0, 1), command) == assigned,
+              "opcode %u %s", opcode, assigned ? "rejected" : "accepted");
+    }
+}
+
+int main() {
+    checkLed();
+    checkOpcodes();
+    return hostTestResult("protocol_test");
+}
@@ -0,0 +1,126 @@
+/*********
+  SEMBox Host - Query Fields Test
+  Strict parsing of query parameters by QueryFields
+
+  A number must be the whole value: "12abc", "", "+5", "1e3", a sign on
+  an unsigned field or a value outside the type's range are invalid,
+  and an invalid value leaves the variable as it was. QUERY_INT64 takes
+  up to 18 digits. Of repeated names the first counts, even when it
+  was invalid, and unknown names are ignored.
+*********/
+
+#include <stdint.h>
+#include <string.h>
+#include "host_test.h"
+#include "query_fields.h"
+
+static const int32_t UNTOUCHED = 0x5A5A;
+
+static bool parseInt(const char* text, int32_t* value) {
+    *value = UNTOUCHED;
+    const QueryField spec[] = { { "n", QUERY_INT, value } };
+    QueryFields fields(spec, 1);
+    bool valid = fields.set("n", text);
+    CHECK(valid == fields.has(0), "\"%s\": set() and has() disagree", text);
+    CHECK(valid || *value == UNTOUCHED, "\"%s\": invalid value written", text);
+    return valid;
+}
+
+static bool parseUint(const char* text, uint32_t* value) {
+    *value = UNTOUCHED;
+    const QueryField spec[] = { { "n", QUERY_UINT, value } };
+    QueryFields fields(spec, 1);
+    bool valid = fields.set("n", text);
+    CHECK(valid || *value == UNTOUCHED, "\"%s\": invalid value written", text);
+    return valid;
+}
+
+static bool parseInt64(const char* text, int64_t* value) {
+    *value = UNTOUCHED;
+    const QueryField spec[] = { { "n", QUERY_INT64, value } };
+    QueryFields fields(spec, 1);
+    bool valid = fields.set("n", text);
+    CHECK(valid || *value == UNTOUCHED, "\"%s\": invalid value written", text);
+    return valid;
+}
+
+static void checkNumbers() {
+    const char* garbage[] = { "12abc", "", "+5", "1e3", " 5", "5 ", "-", "--5", "0x10", "1.5" };
+    int32_t value;
+    uint32_t unsignedValue;
+    int64_t wide;
+    for (const char* text : garbage) {
+        CHECK(!parseInt(text, &value), "int \"%s\" accepted as %d", text, value);
+        CHECK(!parseUint(text, &unsignedValue), "uint \"%s\" accepted as %u", text, unsignedValue);
+        CHECK(!parseInt64(text, &wide), "int64 \"%s\" accepted as %lld", text, (long long)wide);
+    }
+
+    CHECK(parseInt("12", &value) && value == 12, "int 12 read as %d", value);
+    CHECK(parseInt("-12", &value) && value == -12, "int -12 read as %d", value);
+    CHECK(parseInt("0", &value) && value == 0, "int 0 read as %d", value);
+    CHECK(parseInt("2147483647", &value) && value == INT32_MAX, "int max read as %d", value);
+    CHECK(parseInt("-2147483648", &value) && value == INT32_MIN, "int min read as %d", value);
+    CHECK(!parseInt("2147483648", &value), "int max + 1 accepted");
+    CHECK(!parseInt("-2147483649", &value), "int min - 1 accepted");
+    CHECK(!parseInt("99999999999", &value), "11-digit int accepted");
+
+    CHECK(parseUint("4294967295", &unsignedValue) && unsignedValue == UINT32_MAX, "uint max read as %u",
+          unsignedValue);
+    CHECK(!parseUint("4294967296", &unsignedValue), "uint max + 1 accepted");
+    CHECK(!parseUint("-5", &unsignedValue), "uint -5 accepted");
+    CHECK(!parseUint("-0", &unsignedValue), "uint -0 accepted");
+
+    CHECK(parseInt64("999999999999999999", &wide) && wide == 999999999999999999LL, "18-digit int64 read as %lld",
+          (long long)wide);
+    CHECK(parseInt64("-999999999999999999", &wide) && wide == -999999999999999999LL,
+          "-18-digit int64 read as %lld", (long long)wide);
+    CHECK(parseInt64("-5000000000", &wide) && wide == -5000000000LL, "int64 -5e9 read as %lld", (long long)wide);
+    CHECK(!parseInt64("1000000000000000000", &wide), "19-digit int64 accepted");
+}
+
+static void checkOtherTypes() {
+    uint32_t ratio = UNTOUCHED;
+    const char* text = nullptr;
+    const QueryField spec[] = { { "ratio", QUERY_RATIO, &ratio }, { "name", QUERY_TEXT, &text } };
+
+    QueryFields fields(spec, 2);
+    const char* name = "cycle";
+    CHECK(fields.set("ratio", "1234.567") && ratio == 1234567, "ratio 1234.567 read as %u", ratio);
+    CHECK(fields.set("name", name) && text == name, "text not passed through in place");
+
+    const char* badRatios[] = { "1.2345", "1..2", "-1", "abc", "" };
+    for (const char* bad : badRatios) {
+        QueryFields again(spec, 2);
+        ratio = UNTOUCHED;
+        CHECK(!again.set("ratio", bad) && ratio == UNTOUCHED, "ratio \"%s\" accepted as %u", bad, ratio);
+    }
+}
+
+static void checkRepeatsAndUnknowns() {
+    int32_t count = UNTOUCHED;
+    uint32_t velocity = UNTOUCHED;
+    const QueryField spec[] = { { "count", QUERY_INT, &count }, { "velocity", QUERY_UINT, &velocity } };
+
+    // The first of a repeated name counts
+    QueryFields fields(spec, 2);
+    CHECK(fields.set("count", "5") && fields.set("count", "7") && count == 5, "repeated count read as %d", count);
+    CHECK(fields.set("count", "junk") && fields.invalid() == nullptr, "a later repeat was parsed");
+    CHECK(fields.set("unknown", "junk") && fields.set("", "junk"), "unknown names not ignored");
+    CHECK(fields.has(0) && !fields.has(1), "present fields wrong");
+
+    // ... even when it is invalid: a valid repeat does not rescue it
+    QueryFields invalid(spec, 2);
+    count = UNTOUCHED;
+    CHECK(!invalid.set("count", "5x"), "count 5x accepted");
+    CHECK(invalid.set("count", "5") && count == UNTOUCHED && !invalid.has(0), "a valid repeat replaced an invalid one");
+    CHECK(!invalid.set("velocity", "-1"), "velocity -1 accepted");
+    CHECK(invalid.invalid() && strcmp(invalid.invalid(), "count") == 0, "first invalid field is %s",
+          invalid.invalid() ? invalid.invalid() : "none");
+}
+
+int main() {
+    checkNumbers();
+    checkOtherTypes();
+    checkRepeatsAndUnknowns();
+    return hostTestResult("query_fields_test");
+}
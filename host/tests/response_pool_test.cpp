@@ -0,0 +1,100 @@
+/*********
+  SEMBox Host - Response Pool Test
+  Lock-free slab acquire/release of ResponsePool
+
+  Single-threaded, every slab can be taken once, the next acquire()
+  fails and counts a miss, and a released slab is handed out again.
+  Then several threads acquire, fill, check and release slabs as
+  request handlers and connection closes do, more threads than slabs:
+  no slab may ever be held by two threads at once, and the pool must be
+  empty when they are done.
+*********/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "host_test.h"
+#include "response_pool.h"
+
+static void checkSingle() {
+    ResponsePool pool;
+    char* slabs[ResponsePool::SLABS];
+    for (uint8_t i = 0; i < ResponsePool::SLABS; i++) {
+        slabs[i] = pool.acquire();
+        CHECK(slabs[i] != nullptr, "slab %u not handed out", i);
+        for (uint8_t j = 0; j < i; j++) {
+            CHECK(slabs[i] != slabs[j], "slab %u handed out twice", j);
+        }
+    }
+    CHECK(pool.inUse() == ResponsePool::SLABS && pool.peak() == ResponsePool::SLABS, "in use %u, peak %u",
+          pool.inUse(), pool.peak());
+    CHECK(pool.acquire() == nullptr && pool.misses() == 1, "acquire from a full pool: %u misses", pool.misses());
+
+    pool.release(slabs[3]);
+    CHECK(pool.acquire() == slabs[3], "released slab not handed out again");
+    for (uint8_t i = 0; i < ResponsePool::SLABS; i++) {
+        pool.release(slabs[i]);
+    }
+    CHECK(pool.inUse() == 0, "%u slabs in use after releasing all", pool.inUse());
+
+    // A pointer that is not a slab is ignored
+    char outside[ResponsePool::SLAB_SIZE];
+    char* slab = pool.acquire();
+    pool.release(outside);
+    CHECK(pool.inUse() == 1, "release of a foreign pointer freed a slab");
+    pool.release(slab);
+}
+
+static void checkConcurrent() {
+    static const int THREADS = 12;              // More than SLABS
+    static const uint32_t ROUNDS = 20000;
+    ResponsePool pool;
+    std::atomic<uint32_t> overlaps(0);
+    std::atomic<uint32_t> served(0);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS; t++) {
+        threads.emplace_back([&, t] {
+            char mark = (char)('A' + t);
+            for (uint32_t i = 0; i < ROUNDS; i++) {
+                char* slab = pool.acquire();
+                if (!slab) {
+                    std::this_thread::yield();  // Falls back to a copying send
+                    continue;
+                }
+                memset(slab, mark, ResponsePool::SLAB_SIZE);
+                if (i % 8 == 0) {
+                    std::this_thread::yield();  // Response still being sent
+                }
+                for (uint16_t j = 0; j < ResponsePool::SLAB_SIZE; j++) {
+                    if (slab[j] != mark) {
+                        overlaps.fetch_add(1);
+                        break;
+                    }
+                }
+                served.fetch_add(1);
+                pool.release(slab);
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    CHECK(overlaps.load() == 0, "%u slabs written by two threads at once", overlaps.load());
+    CHECK(pool.inUse() == 0, "%u slabs still in use", pool.inUse());
+    CHECK(pool.peak() <= ResponsePool::SLABS, "peak %u", pool.peak());
+    CHECK(served.load() + pool.misses() == THREADS * ROUNDS, "%u served + %u misses of %u",
+          served.load(), pool.misses(), THREADS * ROUNDS);
+    printf("  %d threads: %u replies from slabs, %u misses, peak %u of %u slabs\n",
+           THREADS, served.load(), pool.misses(), pool.peak(), ResponsePool::SLABS);
+}
+
+int main() {
+    checkSingle();
+    checkConcurrent();
+    return hostTestResult("response_pool_test");
+}
@@ -0,0 +1,184 @@
+/*********
+  SEMBox Host - Route Table Test
+  Pattern compilation and URL matching of RouteTable
+
+  A literal segment wins over a parameter at the same place, but the
+  parameter must still be tried when nothing below the literal matches.
+  A trailing slash is ignored and an empty segment never matches.
+  {n:u32} takes decimal numbers up to 2^32-1 only, {a|b} yields the
+  index of the word, and routes that differ only in method are told
+  apart. Malformed patterns must make begin() fail and name the route.
+*********/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "host_test.h"
+#include "route_table.h"
+
+static const uint8_t GET = 1 << 0;      // As WebRequestMethod
+static const uint8_t POST = 1 << 1;
+
+static void handler(AsyncWebServerRequest*) {}
+static void paramHandler(AsyncWebServerRequest*, const RouteParams&) {}
+
+static const int CONTEXT = 42;
+
+static const Route ROUTES[] = {
+    { GET, "/", handler },                                  // 0
+    { GET, "/io/list", handler },                           // 1
+    { GET, "/io/{ch}", paramHandler },                      // 2
+    { GET, "/io/{ch}/{on|off|toggle}", paramHandler },      // 3
+    { GET, "/table/goto/{n:u32}", paramHandler, &CONTEXT }, // 4
+    { GET, "/a/b/c", handler },                             // 5
+    { GET, "/a/{x}/d", paramHandler },                      // 6
+    { GET, "/batch", handler },                             // 7
+    { POST, "/batch", handler },                            // 8
+};
+
+static RouteTable table;
+
+static int match(uint8_t method, const char* path, RouteParams* params) {
+    return table.match(method, path, params);
+}
+
+static void checkLiterals() {
+    RouteParams params;
+    CHECK(match(GET, "/", &params) == 0, "/ not the root route");
+    CHECK(match(GET, "/io/list", &params) == 1 && params.count == 0, "/io/list not the literal route");
+    CHECK(match(GET, "/nothing", &params) == -1, "/nothing matched");
+    CHECK(match(GET, "io/list", &params) == -1, "path without a leading slash matched");
+    CHECK(match(GET, "/io/list/extra/more", &params) == -1, "longer path matched");
+
+    // Trailing slash ignored; empty segments never match
+    CHECK(match(GET, "/io/list/", &params) == 1, "/io/list/ not the literal route");
+    CHECK(match(GET, "/io//list", &params) == -1, "empty segment matched");
+    CHECK(match(GET, "//", &params) == -1, "// matched");
+
+    // Same pattern, told apart by method
+    CHECK(match(GET, "/batch", &params) == 7, "GET /batch");
+    CHECK(match(POST, "/batch", &params) == 8, "POST /batch");
+    CHECK(match(POST, "/io/list", &params) == -1, "POST matched a GET route");
+}
+
+static void checkFallback() {
+    RouteParams params;
+
+    // Nothing below the literal "list" takes "on": back off to {ch}
+    int route = match(GET, "/io/list/on", &params);
+    CHECK(route == 3 && params.count == 2, "/io/list/on: route %d with %u params", route, params.count);
+    char name[8];
+    CHECK(params.copy(0, name, sizeof(name)) && strcmp(name, "list") == 0, "/io/list/on: channel %s", name);
+    CHECK(params.items[1].value == 0, "/io/list/on: choice %u", params.items[1].value);
+
+    route = match(GET, "/io/led", &params);
+    CHECK(route == 2 && params.count == 1 && params.items[0].length == 3, "/io/led: route %d", route);
+
+    // Backing off two levels deep keeps only the parameters of the match
+    route = match(GET, "/a/b/d", &params);
+    CHECK(route == 6 && params.count == 1 && params.items[0].length == 1 && params.items[0].text[0] == 'b',
+          "/a/b/d: route %d with %u params", route, params.count);
+    CHECK(match(GET, "/a/b/c", &params) == 5 && params.count == 0, "/a/b/c not the literal route");
+    CHECK(match(GET, "/a/b/e", &params) == -1, "/a/b/e matched");
+
+    // A copy that does not fit is refused rather than cut
+    match(GET, "/io/list/on", &params);
+    CHECK(!params.copy(0, name, 4), "copy of 4 characters into 4 bytes");
+    CHECK(!params.copy(2, name, sizeof(name)), "copy of a parameter that does not exist");
+}
+
+static void checkNumbers() {
+    const struct {
+        const char* path;
+        bool matches;
+        uint32_t value;
+    } cases[] = {
+        { "/table/goto/0", true, 0 },
+        { "/table/goto/007", true, 7 },
+        { "/table/goto/4294967295", true, UINT32_MAX },
+        { "/table/goto/4294967295/", true, UINT32_MAX },
+        { "/table/goto/4294967296", false, 0 },
+        { "/table/goto/9999999999", false, 0 },
+        { "/table/goto/00000000001", false, 0 },      // 11 digits
+        { "/table/goto/-1", false, 0 },
+        { "/table/goto/+1", false, 0 },
+        { "/table/goto/12a", false, 0 },
+        { "/table/goto/", false, 0 },
+    };
+    for (const auto& test : cases) {
+        RouteParams params;
+        int route = match(GET, test.path, &params);
+        if (test.matches) {
+            CHECK(route == 4 && params.count == 1 && params.items[0].value == test.value &&
+                  params.context == &CONTEXT, "%s: route %d value %u", test.path, route, params.items[0].value);
+        } else {
+            CHECK(route == -1, "%s matched route %d", test.path, route);
+        }
+    }
+}
+
+static void checkChoices() {
+    const char* words[] = { "on", "off", "toggle" };
+    for (uint32_t i = 0; i < 3; i++) {
+        char path[32];
+        snprintf(path, sizeof(path), "/io/led/%s", words[i]);
+        RouteParams params;
+        CHECK(match(GET, path, &params) == 3 && params.items[1].value == i,
+              "%s: choice %u", path, params.items[1].value);
+    }
+    const char* wrong[] = { "/io/led/o", "/io/led/onn", "/io/led/ON", "/io/led/on|off", "/io/led/toggl" };
+    for (const char* path : wrong) {
+        RouteParams params;
+        CHECK(match(GET, path, &params) == -1, "%s matched", path);
+    }
+}
+
+static void checkMalformed() {
+    const char* patterns[] = {
+        "no/leading/slash",
+        "/a//b",
+        "/a/{}",
+        "/a/{x",
+        "/a/x}",
+        "/a/x{y}",
+        "/a/{|b}",
+        "/a/{a|}",
+        "/a/{a||b}",
+        "/a/{n:i32}",
+        "/a/{n:u3}",
+        "/a/{n:u32|x}",
+        "/{a}/{b}/{c}/{d}/{e}",
+    };
+    for (const char* pattern : patterns) {
+        const Route routes[] = { { GET, "/ok", handler }, { GET, pattern, handler } };
+        RouteTable compiled;
+        CHECK(!compiled.begin(routes, 2), "%s accepted", pattern);
+        CHECK(compiled.error() && strcmp(compiled.error(), pattern) == 0, "%s: error names %s",
+              pattern, compiled.error());
+    }
+
+    // Two kinds of parameter, or two different choices, at the same place
+    const Route mixed[] = { { GET, "/a/{x}", handler }, { GET, "/a/{n:u32}", handler } };
+    const Route choices[] = { { GET, "/a/{on|off}", handler }, { GET, "/a/{up|down}", handler } };
+    const Route noHandler[] = { { GET, "/a", (RouteHandler)nullptr } };
+    const Route noPattern[] = { { GET, nullptr, handler } };
+    RouteTable compiled;
+    CHECK(!compiled.begin(mixed, 2) && strcmp(compiled.error(), "/a/{n:u32}") == 0, "mixed parameters accepted");
+    CHECK(!compiled.begin(choices, 2) && strcmp(compiled.error(), "/a/{up|down}") == 0, "mixed choices accepted");
+    CHECK(!compiled.begin(noHandler, 1), "route without a handler accepted");
+    CHECK(!compiled.begin(noPattern, 1) && strcmp(compiled.error(), "null pattern") == 0, "null pattern accepted");
+
+    // The same parameter in several routes is fine
+    const Route shared[] = { { GET, "/a/{x}", handler }, { GET, "/a/{y}/b", handler } };
+    CHECK(compiled.begin(shared, 2), "shared parameter rejected: %s", compiled.error());
+}
+
+int main() {
+    CHECK(table.begin(ROUTES, sizeof(ROUTES) / sizeof(ROUTES[0])), "route table rejected: %s", table.error());
+    checkLiterals();
+    checkFallback();
+    checkNumbers();
+    checkChoices();
+    checkMalformed();
+    return hostTestResult("route_table_test");
+}
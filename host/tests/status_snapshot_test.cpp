@@ -0,0 +1,315 @@
+/*********
+  SEMBox Host - Status Snapshot Test
+  Pinned snapshot reads, and /status cost against the ArduinoJson path
+
+  A writer thread refreshes a StatusSnapshot as fast as it may while a
+  reader thread takes the document and "sends" it slowly in chunks, as
+  the server does after the handler returned. Every document must come
+  out as it was written. The same run with unpinned front() reads shows
+  the tearing the pinning prevents. A reader that stalls with a pinned
+  buffer must not hold up refreshes.
+
+  The benchmark then compares one /status request on the snapshot path
+  (pin, send_P, release) with the former handler, which built a
+  JsonDocument, serialized it into a String and let the response copy
+  that String. Allocations are counted by wrapping malloc, as the host
+  emulator does; sanitizer builds skip the count.
+*********/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <ArduinoJson.h>
+#include "host_test.h"
+#include "protocol.h"
+#include "sdkconfig.h"
+#include "status_snapshot.h"
+
+// ===========================================
+// Allocation counting
+// ===========================================
+
+static thread_local uint32_t allocations = 0;
+
+#if CONFIG_HEAP_USE_HOOKS
+extern "C" {
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t count, size_t size);
+void* __libc_realloc(void* ptr, size_t size);
+
+void* malloc(size_t size) {
+    allocations++;
+    return __libc_malloc(size);
+}
+
+void* calloc(size_t count, size_t size) {
+    allocations++;
+    return __libc_calloc(count, size);
+}
+
+void* realloc(void* ptr, size_t size) {
+    allocations++;
+    return __libc_realloc(ptr, size);
+}
+}
+#endif
+
+// ===========================================
+// Tearing
+// ===========================================
+
+static const uint32_t READS = 20000;
+static const size_t SEND_CHUNK = 64;    // Bytes "sent" per step
+
+typedef StatusSnapshot<512> TestSnapshot;
+
+// Document: its length (low byte), then one fill byte repeated
+static size_t writeDocument(char* buffer, uint32_t sequence) {
+    size_t length = 64 + sequence % 400;
+    memset(buffer, 'a' + sequence % 26, length);
+    buffer[0] = (char)(length & 0xFF);
+    return length;
+}
+
+static bool intact(const char* copy, size_t length) {
+    if ((uint8_t)copy[0] != (length & 0xFF)) {
+        return false;
+    }
+    for (size_t i = 2; i < length; i++) {
+        if (copy[i] != copy[1]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Reader sends READS documents in chunks while the writer refreshes;
+ * returns the number of torn documents
+ */
+static uint32_t readConcurrently(bool pinned, uint32_t* refreshes, uint32_t* deferred) {
+    TestSnapshot snapshot;
+    snapshot.commit(writeDocument(snapshot.back(), 0));
+    std::atomic<bool> done(false);
+    *refreshes = 0;
+    *deferred = 0;
+
+    std::thread writer([&] {
+        uint32_t sequence = 1;
+        while (!done.load()) {
+            if (!snapshot.writable()) {
+                (*deferred)++;
+            } else {
+                snapshot.commit(writeDocument(snapshot.back(), sequence++));
+                (*refreshes)++;
+            }
+            std::this_thread::yield();
+        }
+    });
+
+    uint32_t torn = 0;
+    char copy[TestSnapshot::CAPACITY];
+    for (uint32_t i = 0; i < READS; i++) {
+        size_t length;
+        uint8_t slot = 0;
+        const char* body = pinned ? snapshot.acquire(&length, &slot) : snapshot.front(&length);
+        for (size_t sent = 0; sent < length; sent += SEND_CHUNK) {
+            size_t chunk = length - sent < SEND_CHUNK ? length - sent : SEND_CHUNK;
+            memcpy(copy + sent, body + sent, chunk);
+            std::this_thread::yield();
+        }
+        if (pinned) {
+            snapshot.release(slot);
+        }
+        torn += !intact(copy, length);
+    }
+    done.store(true);
+    writer.join();
+    return torn;
+}
+
+static void checkPinning() {
+    // Single thread: a stalled reader never stops refreshes, and they
+    // never reuse its buffer
+    TestSnapshot snapshot;
+    snapshot.commit(writeDocument(snapshot.back(), 1));
+    size_t length;
+    uint8_t slot;
+    const char* stalled = snapshot.acquire(&length, &slot);
+    for (uint32_t sequence = 2; sequence < 1000; sequence++) {
+        if (!snapshot.writable()) {
+            CHECK(false, "refresh %u deferred by one pinned buffer", sequence);
+            break;
+        }
+        CHECK(snapshot.back() != stalled, "refresh %u into the pinned buffer", sequence);
+        snapshot.commit(writeDocument(snapshot.back(), sequence));
+    }
+    CHECK(intact(stalled, length) && (uint8_t)stalled[1] == 'a' + 1, "pinned document changed");
+
+    // Readers pinning both older buffers defer the refresh until one leaves
+    size_t secondLength;
+    uint8_t second;
+    const char* pinned = snapshot.acquire(&secondLength, &second);
+    CHECK(snapshot.writable(), "the third buffer is free");
+    snapshot.commit(writeDocument(snapshot.back(), 1000));
+    CHECK(!snapshot.writable(), "refresh allowed over two pinned buffers");
+    snapshot.release(slot);
+    CHECK(snapshot.writable(), "buffer still pinned after release");
+    CHECK(intact(pinned, secondLength), "pinned document changed");
+    snapshot.release(second);
+
+    uint32_t refreshes, deferred;
+    uint32_t torn = readConcurrently(true, &refreshes, &deferred);
+    CHECK(torn == 0, "%u of %u pinned reads torn", torn, READS);
+    printf("  pinned: %u reads, %u torn, %u refreshes, %u deferred while pinned\n",
+           READS, torn, refreshes, deferred);
+
+#if !defined(__SANITIZE_THREAD__)
+    // The race the pinning removes, so not under the thread sanitizer
+    torn = readConcurrently(false, &refreshes, &deferred);
+    printf("  unpinned (former front() path): %u reads, %u torn, %u refreshes\n", READS, torn, refreshes);
+#endif
+}
+
+// ===========================================
+// Benchmark
+// ===========================================
+
+static const uint32_t REQUESTS = 200000;
+
+static StatusRecord sampleStatus() {
+    StatusRecord status;
+    memset(&status, 0, sizeof(status));
+    status.schema = STATUS_SCHEMA_VERSION;
+    status.size = sizeof(status);
+    status.uptime = 86400;
+    status.clients = 2;
+    status.freeHeap = 214312;
+    status.totalHeap = 327680;
+    status.flashSize = 4194304;
+    status.sketchSize = 1048576;
+    status.division = 24;
+    status.ratio = 90000;
+    status.ip = 0x0104A8C0;
+    status.position = 123456;
+    status.index = 3;
+    status.stepJitterUs = 21;
+    status.cmdId = 4711;
+    status.cmdOp = -1;
+    status.heapMinFree = 198000;
+    status.heapLargest = 110592;
+    status.heapFrag = 120;
+    status.inputEdges = 99;
+    status.homed = 1;
+    return status;
+}
+
+// The former handler: every field into a JsonDocument, as getStatus() did
+template <typename T>
+static void addField(JsonDocument& doc, const char* key, T value, StatusFormat format) {
+    switch (format) {
+        case FMT_ONOFF:
+            doc[key] = value ? "on" : "off";
+            break;
+        case FMT_BOOL:
+            doc[key] = (bool)value;
+            break;
+        case FMT_MILLI:
+            doc[key] = value / 1000.0;
+            break;
+        case FMT_TENTHS:
+            doc[key] = value / 10.0;
+            break;
+        case FMT_IPV4: {
+            char ip[16];
+            uint32_t address = (uint32_t)value;
+            snprintf(ip, sizeof(ip), "%u.%u.%u.%u", (unsigned)(address & 0xFF), (unsigned)((address >> 8) & 0xFF),
+                     (unsigned)((address >> 16) & 0xFF), (unsigned)(address >> 24));
+            doc[key] = String(ip);
+            break;
+        }
+        default:
+            doc[key] = value;
+            break;
+    }
+}
+
+static size_t legacyRequest(const StatusRecord& status) {
+    JsonDocument doc;
+#define STATUS_JSON(name, type, format) addField(doc, #name, status.name, format);
+    STATUS_FIELDS(STATUS_JSON)
+#undef STATUS_JSON
+    String output;
+    serializeJson(doc, output);
+    String body = output;       // request->send(200, type, String) copies it
+    return body.length();
+}
+
+static size_t refresh(StatusSnapshot<>& snapshot, const StatusRecord& status) {
+    size_t length = 0;
+    if (!snapshot.writable()) {
+        return 0;
+    }
+    char* buffer = snapshot.back();
+    if (!formatStatusFields(status, buffer, snapshot.capacity(), &length)) {
+        return 0;
+    }
+    length += snprintf(buffer + length, snapshot.capacity() - length, "\"cmdError\":null,\"jobs\":[]}");
+    snapshot.commit(length);
+    return length;
+}
+
+static size_t snapshotRequest(StatusSnapshot<>& snapshot) {
+    size_t length;
+    uint8_t slot;
+    const char* body = snapshot.acquire(&length, &slot);
+    // send_P keeps the pointer; release runs when the connection closes
+    volatile char first = body[0];
+    (void)first;
+    snapshot.release(slot);
+    return length;
+}
+
+template <typename Request>
+static void measure(const char* label, Request request) {
+    size_t bytes = request();    // Warm up
+    uint32_t before = allocations;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < REQUESTS; i++) {
+        bytes = request();
+    }
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    uint32_t counted = allocations - before;
+#if CONFIG_HEAP_USE_HOOKS
+    printf("  %-28s %8.0f ns, %5.2f allocations per request, %zu bytes\n",
+           label, ns / REQUESTS, (double)counted / REQUESTS, bytes);
+#else
+    printf("  %-28s %8.0f ns per request, %zu bytes (allocations not counted)\n", label, ns / REQUESTS, bytes);
+#endif
+}
+
+static void benchmark() {
+    StatusRecord status = sampleStatus();
+    StatusSnapshot<> snapshot;     // As statusSnapshot
+    CHECK(refresh(snapshot, status) > 0, "status does not fit the snapshot");
+
+    measure("ArduinoJson + String copy:", [&] { return legacyRequest(status); });
+    measure("snapshot pin + send_P:", [&] { return snapshotRequest(snapshot); });
+    measure("snapshot refresh (writer):", [&] { return refresh(snapshot, status); });
+
+#if CONFIG_HEAP_USE_HOOKS
+    uint32_t before = allocations;
+    snapshotRequest(snapshot);
+    refresh(snapshot, status);
+    CHECK(allocations == before, "snapshot path allocated %u times", allocations - before);
+#endif
+}
+
+int main() {
+    checkPinning();
+    benchmark();
+    return hostTestResult("status_snapshot_test");
+}
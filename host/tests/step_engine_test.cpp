@@ -0,0 +1,299 @@
+/*********
+  SEMBox Host - Step Engine Test
+  Step rate and edge jitter of StepEngine on a simulated timer
+
+  The step engine and planner are linked unchanged against a GPTimer of
+  this file that runs on virtual time: an alarm "interrupt" enters its
+  handler after a modelled latency, and the handler occupies the CPU
+  for a fixed time, so a late edge delays the next interrupt. STEP
+  edges are time-stamped where the engine writes the GPIO register.
+  Constant-rate moves are swept up to and past the MIN_PERIOD_TICKS cap,
+  and a ramped move checks the peak rate. For each latency model the
+  test reports the highest step rate that was actually sustained, the
+  edge jitter and the narrowest STEP pulse, all measured from the edges
+  rather than derived from the constants.
+*********/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <random>
+#include <vector>
+#include "host_test.h"
+#include "step_engine.h"
+#include "soc/gpio_reg.h"
+
+static const uint8_t STEP_PIN = 25;
+static const uint8_t DIR_PIN = 26;
+static const int32_t STEPS_PER_MOVE = 20000;
+
+// Interrupt timing, in timer ticks (0.1 us)
+struct LatencyModel {
+    const char* name;
+    uint32_t minLatency;        // Alarm to first handler instruction
+    uint32_t maxLatency;
+    uint32_t handlerTicks;      // Handler run time, the CPU is busy meanwhile
+};
+
+static const LatencyModel MODELS[] = {
+    { "ideal timer", 0, 0, 0 },
+    { "IRAM ISR, 1-2 us latency", 10, 20, 10 },
+    { "contended, 2-8 us latency", 20, 80, 10 },
+};
+
+static const uint32_t RATES_HZ[] = { 1000, 5000, 10000, 20000, 25000, 40000, 50000, 60000 };
+
+// ===========================================
+// Simulated GPTimer and GPIO
+// ===========================================
+
+struct HostGptimer {
+    uint32_t resolution = 0;
+    gptimer_alarm_cb_t onAlarm = nullptr;
+    void* context = nullptr;
+    bool enabled = false;
+    bool running = false;
+    bool armed = false;
+    uint64_t alarm = 0;
+};
+
+static uint64_t now = 0;                // Virtual timer count
+static uint64_t cpuFree = 0;            // End of the last handler
+static uint32_t maxEntryLatency = 0;    // Alarm to handler entry, as simulated
+static HostGptimer simTimer;
+static const LatencyModel* model = nullptr;
+static std::mt19937 rng(4);
+static std::vector<uint64_t> rising;
+static std::vector<uint64_t> falling;
+
+esp_err_t gptimer_new_timer(const gptimer_config_t* config, gptimer_handle_t* timer) {
+    simTimer = HostGptimer();
+    simTimer.resolution = config->resolution_hz;
+    *timer = &simTimer;
+    return ESP_OK;
+}
+
+esp_err_t gptimer_register_event_callbacks(gptimer_handle_t timer, const gptimer_event_callbacks_t* callbacks,
+                                           void* ctx) {
+    timer->onAlarm = callbacks->on_alarm;
+    timer->context = ctx;
+    return ESP_OK;
+}
+
+esp_err_t gptimer_enable(gptimer_handle_t timer) {
+    timer->enabled = true;
+    return ESP_OK;
+}
+
+esp_err_t gptimer_start(gptimer_handle_t timer) {
+    timer->running = true;
+    return ESP_OK;
+}
+
+esp_err_t gptimer_stop(gptimer_handle_t timer) {
+    timer->running = false;
+    return ESP_OK;
+}
+
+esp_err_t gptimer_get_raw_count(gptimer_handle_t timer, uint64_t* value) {
+    *value = now;
+    return ESP_OK;
+}
+
+esp_err_t gptimer_set_alarm_action(gptimer_handle_t timer, const gptimer_alarm_config_t* config) {
+    timer->armed = true;
+    timer->alarm = config->alarm_count;
+    return ESP_OK;
+}
+
+uint32_t hostRegRead(uint32_t reg) {
+    return 0;
+}
+
+void hostRegWrite(uint32_t reg, uint32_t value) {
+    if (value != 1UL << STEP_PIN) {
+        return;
+    }
+    if (reg == GPIO_OUT_W1TS_REG) {
+        rising.push_back(now);
+    } else if (reg == GPIO_OUT_W1TC_REG) {
+        falling.push_back(now);
+    }
+}
+
+void pinMode(uint8_t pin, uint8_t mode) {}
+void digitalWrite(uint8_t pin, uint8_t value) {}
+
+/**
+ * Fire alarms until the engine stops the timer: each interrupt enters
+ * once its alarm is due and the previous handler has returned
+ */
+static void runTimer() {
+    std::uniform_int_distribution<uint32_t> latency(model->minLatency, model->maxLatency);
+    while (simTimer.running && simTimer.armed) {
+        uint64_t due = simTimer.alarm > cpuFree ? simTimer.alarm : cpuFree;
+        now = due + latency(rng);
+        if (now - simTimer.alarm > maxEntryLatency) {
+            maxEntryLatency = (uint32_t)(now - simTimer.alarm);
+        }
+        simTimer.armed = false;
+        gptimer_alarm_event_data_t event = { now, simTimer.alarm };
+        simTimer.onAlarm(&simTimer, &event, simTimer.context);
+        now += model->handlerTicks;
+        cpuFree = now;
+    }
+}
+
+// ===========================================
+// Measurements
+// ===========================================
+
+struct EdgeStats {
+    double rateHz;              // Achieved, first to last rising edge
+    uint32_t maxLagTicks;       // Rising edge behind its ideal grid time
+    uint32_t maxIntervalError;  // |edge interval - period|
+    uint32_t minPulseTicks;
+    uint32_t minWindowTicks;    // Shortest span of RATE_WINDOW steps
+};
+
+static const size_t RATE_WINDOW = 100;  // Steps averaged for the peak rate
+
+static EdgeStats measure(uint64_t firstIdeal, uint32_t period) {
+    EdgeStats stats = { 0, 0, 0, UINT32_MAX, UINT32_MAX };
+    size_t count = rising.size();
+    if (count > 1) {
+        stats.rateHz = (double)(count - 1) * StepEngine::TIMER_HZ / (double)(rising[count - 1] - rising[0]);
+    }
+    for (size_t i = 0; i < count; i++) {
+        if (period) {
+            uint64_t ideal = firstIdeal + (uint64_t)i * period;
+            uint32_t lag = (uint32_t)(rising[i] - ideal);
+            stats.maxLagTicks = lag > stats.maxLagTicks ? lag : stats.maxLagTicks;
+        }
+        if (i < falling.size()) {
+            uint32_t pulse = (uint32_t)(falling[i] - rising[i]);
+            stats.minPulseTicks = pulse < stats.minPulseTicks ? pulse : stats.minPulseTicks;
+        }
+        if (i > 0) {
+            uint32_t interval = (uint32_t)(rising[i] - rising[i - 1]);
+            uint32_t error = interval > period ? interval - period : period - interval;
+            stats.maxIntervalError = error > stats.maxIntervalError ? error : stats.maxIntervalError;
+        }
+        if (i >= RATE_WINDOW) {
+            uint32_t window = (uint32_t)(rising[i] - rising[i - RATE_WINDOW]);
+            stats.minWindowTicks = window < stats.minWindowTicks ? window : stats.minWindowTicks;
+        }
+    }
+    return stats;
+}
+
+static double toMicros(uint32_t ticks) {
+    return ticks * 1000000.0 / StepEngine::TIMER_HZ;
+}
+
+// Start a move, run it to the end and check the steps and the position
+static bool runMove(StepEngine& engine, int32_t steps, uint32_t rateHz, const RampTable* ramp, uint64_t* start) {
+    rising.clear();
+    falling.clear();
+    int32_t position = engine.position();
+    now = cpuFree + 1000;
+    *start = now;
+    bool started = ramp ? engine.move(steps, ramp) : engine.move(steps, rateHz);
+    CHECK(started, "move(%d) did not start", steps);
+    runTimer();
+    CHECK(!engine.busy(), "move still running");
+    CHECK(engine.position() == position + steps, "position %d after %d steps from %d",
+          engine.position(), steps, position);
+    CHECK(rising.size() == (size_t)(steps < 0 ? -steps : steps) && falling.size() == rising.size(),
+          "%zu rising and %zu falling edges for %d steps", rising.size(), falling.size(), steps);
+    return started;
+}
+
+/**
+ * Sweep the constant rates under one latency model; returns the highest
+ * rate sustained on its grid
+ */
+static uint32_t sweep(StepEngine& engine) {
+    uint32_t sustained = 0;
+    uint32_t worstLag = 0;
+    uint32_t narrowest = UINT32_MAX;
+    int32_t direction = 1;
+
+    printf("  %s:\n", model->name);
+    for (uint32_t rate : RATES_HZ) {
+        uint32_t before = engine.stats().overruns;
+        uint64_t start;
+        if (!runMove(engine, direction * STEPS_PER_MOVE, rate, nullptr, &start)) {
+            continue;
+        }
+        direction = -direction;
+
+        uint32_t period = StepEngine::TIMER_HZ / rate;
+        uint32_t clamped = period < StepEngine::MIN_PERIOD_TICKS ? StepEngine::MIN_PERIOD_TICKS : period;
+        EdgeStats edges = measure(start + StepEngine::DIR_SETUP_TICKS, clamped);
+        uint32_t overruns = engine.stats().overruns - before;
+
+        // Sustained: the requested rate on average and no edge a period behind
+        bool kept = edges.rateHz >= rate * 0.999 && edges.maxLagTicks < clamped;
+        if (kept) {
+            sustained = rate;
+            worstLag = edges.maxLagTicks > worstLag ? edges.maxLagTicks : worstLag;
+            narrowest = edges.minPulseTicks < narrowest ? edges.minPulseTicks : narrowest;
+        }
+        printf("    %5u Hz: measured %8.1f Hz, lag max %5.1f us, interval error %5.1f us, "
+               "pulse min %4.1f us, %u overruns%s\n",
+               rate, edges.rateHz, toMicros(edges.maxLagTicks), toMicros(edges.maxIntervalError),
+               toMicros(edges.minPulseTicks), overruns, kept ? "" : "  (not sustained)");
+    }
+    printf("    max sustained %u Hz, jitter %.1f us, narrowest pulse %.1f us\n",
+           sustained, toMicros(worstLag), sustained ? toMicros(narrowest) : 0.0);
+    return sustained;
+}
+
+// A ramped move must reach the cruise rate and no more
+static void checkRamp(StepEngine& engine) {
+    MotionLimits limits = { 40000, 1000000, 0 };
+    MotionProfile profile;
+    profile.configure(limits, StepEngine::TIMER_HZ);
+    profile.buildAll();
+
+    uint64_t start;
+    runMove(engine, STEPS_PER_MOVE, 0, profile.active(), &start);
+    EdgeStats edges = measure(start, 0);
+    double peak = (double)RATE_WINDOW * StepEngine::TIMER_HZ / edges.minWindowTicks;
+    printf("    ramp to %u steps/s: measured peak %.1f Hz (%zu-step average) over %d steps\n",
+           (unsigned)limits.maxVelocity, peak, RATE_WINDOW, STEPS_PER_MOVE);
+    CHECK(peak <= limits.maxVelocity * 1.01 + 1, "ramp peak %.1f Hz above %u", peak, (unsigned)limits.maxVelocity);
+    if (model->maxLatency == 0) {
+        CHECK(peak >= limits.maxVelocity * 0.99, "ramp peak %.1f Hz below %u", peak, (unsigned)limits.maxVelocity);
+    }
+}
+
+int main() {
+    for (const LatencyModel& current : MODELS) {
+        model = &current;
+        maxEntryLatency = 0;
+        StepEngine engine;
+        CHECK(engine.begin(STEP_PIN, DIR_PIN, -1), "begin()");
+
+        uint32_t sustained = sweep(engine);
+        checkRamp(engine);
+
+        // The engine's own latency statistic, reported as stepJitterUs
+        uint32_t reported = engine.stats().maxLatencyTicks;
+        CHECK(reported == maxEntryLatency, "%s: engine reports %u ticks latency, simulated %u",
+              model->name, reported, maxEntryLatency);
+        printf("    stepJitterUs would read %.1f us\n", toMicros(reported));
+
+        // While both interrupts of a step fit in the shortest period, the
+        // timer cap is the limit and late pulse ends never slip the grid
+        if (2 * (model->maxLatency + model->handlerTicks) < StepEngine::MIN_PERIOD_TICKS) {
+            CHECK(sustained == StepEngine::TIMER_HZ / StepEngine::MIN_PERIOD_TICKS,
+                  "%s: sustained %u Hz below the %u Hz cap", model->name, sustained,
+                  StepEngine::TIMER_HZ / StepEngine::MIN_PERIOD_TICKS);
+        }
+        if (model->maxLatency + model->handlerTicks < StepEngine::PULSE_WIDTH_TICKS) {
+            CHECK(engine.stats().overruns == 0, "%s: %u overruns", model->name, engine.stats().overruns);
+        }
+    }
+    return hostTestResult("step_engine_test");
+}
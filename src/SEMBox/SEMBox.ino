@@ -8,16 +8,49 @@
   - ArduinoJson: https://github.com/bblanchon/ArduinoJson
   
   Web UI is defined in: web_content.h
+  and served from the generated web_assets.h
+  (run tools/build_web_assets.py after editing web_content.h)
 *********/
 
 #include <WiFi.h>
 #include <AsyncTCP.h>
 #include <ESPAsyncWebServer.h>
 #include <ArduinoJson.h>
+#include <AsyncJson.h>
 #include <Preferences.h>
+#include <LittleFS.h>
 
-// Include web content (HTML, CSS, JS)
-#include "web_content.h"
+// Include web content (gzip-compressed HTML, CSS, JS generated from web_content.h)
+#include "web_assets.h"
+#include "status_snapshot.h"
+#include "step_engine.h"
+#include "index_math.h"
+#include "motion_profile.h"
+#include "command_queue.h"
+#include "command_check.h"
+#include "control_executive.h"
+#include "settings_store.h"
+#include "protocol.h"
+#include "route_metrics.h"
+#include "route_table.h"
+#include "query_fields.h"
+#include "response_pool.h"
+#include "gzip_splice.h"
+#include "heap_telemetry.h"
+#include "io_channels.h"
+#include "input_capture.h"
+#include "homing.h"
+#include "position_journal.h"
+#include "program_engine.h"
+#include "program_store.h"
+#include "encoder_feedback.h"
+#include "trace_ring.h"
+#include "event_log.h"
+#include <memory>
+#include <esp_timer.h>
+#include <esp_heap_caps.h>
+#include <esp_system.h>
+#include <sys/time.h>
 
 // ===========================================
 // Configuration
@@ -34,8 +67,77 @@ const char* AP_PASSWORD = "12345678";
 // Server port
 const int SERVER_PORT = 80;
 
+// Live status (snapshot refresh and Server-Sent Events push)
+const uint16_t EVENTS_CHECK_INTERVAL = 50;          // ms (control ticks) between change checks
+const unsigned long STATUS_REFRESH_INTERVAL = 1000; // ms, keeps uptime current
+const uint32_t EVENTS_HEAP_GRANULARITY = 1024;      // Push heap changes >= 1 KB
+
+// Heap telemetry: one sample per interval, HeapTelemetry::HISTORY kept
+const unsigned long HEAP_SAMPLE_INTERVAL = 30000;  // ms (60 samples = 30 min)
+
+// Settings persistence (see settings_store.h for the commit policy)
+const unsigned long SETTINGS_SERVICE_INTERVAL = 100;   // ms between commit checks
+
+// Event log (LittleFS on the "spiffs" partition, see partitions.csv)
+const char* LOG_PARTITION = "spiffs";
+const uint32_t CYCLE_LOG_INTERVAL = 100;    // Index moves per LOG_CYCLES record
+
 // GPIO Pin definitions
 const int LED_PIN = LED_BUILTIN;
+const int STEP_PIN = 32;
+const int DIR_PIN = 33;
+const int ENABLE_PIN = 25;      // Driver enable (active low), -1 if not wired
+
+// IO channels; channel i is bit i of every IO mask (see io_channels.h).
+// Inputs are switches to GND (internal pull-up) with a debounce time in us.
+const IoChannel IO_CHANNELS[] = {
+    { "led",    LED_PIN, IO_OUTPUT, false, 0 },
+    { "out26",  26,      IO_OUTPUT, false, 0 },
+    { "out27",  27,      IO_OUTPUT, false, 0 },
+    { "home",   14,      IO_INPUT,  true,  2000 },
+    { "locked", 13,      IO_INPUT,  true,  5000 },
+    { "estop",  4,       IO_INPUT,  true,  1000 },
+};
+const uint8_t IO_LED = 0;       // Channel behind /LED/on|off and the dashboard LED
+const uint8_t IO_HOME = 3;      // Reference sensor of the homing sequence
+static_assert(IO_LED == WIRE_LED_CHANNEL, "WIRE_LED must switch the LED channel");
+
+// Rotary table drive
+const long MOTOR_STEPS_PER_REV = 3200;  // Motor full steps x microstepping
+const uint16_t RAMP_BUILD_SLICE = 8;    // Ramp entries computed per control tick
+
+// Homing (see homing.h) and the position journal that lets a restart skip it
+const uint32_t HOMING_APPROACH_RATE = 2000; // steps/s, capped at the velocity limit
+const uint32_t HOMING_CREEP_RATE = 200;     // steps/s onto the sensor edge
+const int32_t HOMING_BACKOFF_STEPS = 400;   // Must clear the sensor's active zone
+const int8_t HOMING_DIRECTION = 1;          // Search forward (1) or backward (-1)
+const char* JOURNAL_PARTITION = "journal";  // Data partition, see partitions.csv
+
+// Quadrature encoder on the motor shaft (see encoder_feedback.h)
+const int ENCODER_PIN_A = 34;               // Input-only pins: external pull-ups
+const int ENCODER_PIN_B = 35;
+const long ENCODER_COUNTS_PER_REV = 4000;   // Lines x 4 per motor revolution
+const bool ENCODER_REVERSE = false;         // Counts down when the table steps forward
+const uint32_t ENCODER_GLITCH_NS = 1000;    // Shorter pulses are filtered out
+const uint32_t IN_POSITION_STEPS = 2;       // Settled when within this after a move
+const uint32_t MAX_FOLLOWING_LIMIT = 100000;    // steps, accepted by /params/save
+const uint16_t ENCODER_TRACE_MAX = 256;     // Samples per /encoder/trace response
+
+// Control task: fixed-rate executive for commands, motion and status
+const BaseType_t CONTROL_TASK_CORE = 1;
+const size_t CONTROL_NOTE_QUEUE_SIZE = 32;  // Console messages between loop() passes
+const UBaseType_t CONTROL_TASK_PRIORITY = 6;
+const uint32_t CONTROL_TASK_STACK = 4096;
+const uint64_t CONTROL_TICK_US = 1000;          // 1 kHz control tick
+const size_t COMMAND_QUEUE_SIZE = 16;           // Power of two, one slot kept free
+const uint8_t COMMAND_BATCH_SLOTS = 2;          // Batches queued at the same time
+const size_t BATCH_MAX_BODY = 2048;             // Largest accepted /batch body
+const size_t COMMAND_BIN_MAX_BODY = CommandBatch::MAX_OPS * sizeof(WireCommand);
+const size_t PROGRAM_MAX_BODY = 4096;           // Largest accepted /program/save body
+
+// Motion limit ranges accepted by /params/save
+const uint32_t MAX_ACCELERATION = 1000000;  // steps/s^2
+const uint32_t MAX_JERK = 100000000;        // steps/s^3
 
 // ===========================================
 // Global Variables
@@ -44,20 +146,168 @@ const int LED_PIN = LED_BUILTIN;
 // Create AsyncWebServer object on port 80
 AsyncWebServer server(SERVER_PORT);
 
-// Preferences for NVS storage
+// Server-Sent Events channel for live status updates
+AsyncEventSource events("/events");
+
+// Per-route request counters and latency histograms (/metrics), and
+// the allocations of each handler where the heap hooks are built in
+RouteMetrics routeMetrics(esp_timer_get_time, esp_get_free_heap_size,
+                          HeapTelemetry::countsAllocations() ? HeapTelemetry::taskAllocations : nullptr);
+
+// Slabs for small JSON replies, sent without a copy (AsyncTCP task)
+ResponsePool responsePool;
+
+// Dispatch of the ROUTES table (AsyncTCP task), with each route's metrics id
+RouteTable routeTable;
+int routeMetricIds[RouteTable::MAX_ROUTES];
+int notFoundRoute = -1;
+
+// Binary event trace (/trace), written from any task
+TraceRing traceRing(esp_timer_get_time);
+
+// Persistent event log (/log), queued from any task and written by loop()
+EventLog eventLog;
+uint32_t movesCompleted = 0;                // Control task only
+
+// Heap and fragmentation history (/heap)
+HeapTelemetry heapTelemetry;
+unsigned long lastHeapSample = 0;
+
+// Preferences for NVS storage, written only through the settings store
 Preferences preferences;
+SettingsStore settingsStore;
 
-// GPIO States
-String ledState = "off";
+// IO channels and their packed state (outputs written by the control task only)
+IoRegistry io;
+InputCapture inputCapture;
 
 // Rotary Table Parameters (stored in NVS)
 int tableDivision = 360;
-float tableRatio = 90.0;
+uint32_t tableRatioMilli = 90000;   // Gear ratio in 1/1000, exact
+float tableRatio = 90.0;            // Display copy of tableRatioMilli
+
+// Step/direction pulse engine for the table drive
+StepEngine stepEngine;
+
+// Velocity/acceleration/jerk limits (stored in NVS) and their ramp table
+MotionLimits motionLimits = { 4000, 20000, 200000 };
+MotionProfile motionProfile;
+
+// Division-to-step conversion and commanded table position
+IndexMath indexMath;
+int64_t tableIndex = 0;             // Commanded absolute division index
+int32_t indexOrigin = 0;            // Step position of division index 0
+
+// Encoder feedback and its following error fault limit (stored in NVS, 0 = off)
+EncoderFeedback encoderFeedback;
+uint32_t followingLimit = 50;
+
+// Home reference, and the journal of positions confirmed at rest
+HomingSequence homing(stepEngine, inputCapture, IO_HOME);
+PositionJournal positionJournal;
+bool tableHomed = false;            // Step 0 is the home sensor edge
+
+// Stored indexing programs, run step by step by the control task
+const char* executeCommand(const Command& command);
+bool tableBusy();
+ProgramStore programStore;
+ProgramEngine programEngine(esp_timer_get_time, executeCommand, tableBusy,
+                            []() -> uint16_t { return inputCapture.state(); });
+
+// Handlers -> control task commands, and the result of the last one
+SpscQueue<Command, COMMAND_QUEUE_SIZE> commandQueue;
+TaskHandle_t controlTaskHandle = nullptr;
+esp_timer_handle_t controlTimer = nullptr;
+ControlExecutive controlExecutive(esp_timer_get_time);
+uint32_t nextCommandId = 1;                 // Producer (AsyncTCP task) only
+uint32_t commandsDropped = 0;
+CommandBatch commandBatches[COMMAND_BATCH_SLOTS];
+volatile uint32_t lastCommandId = 0;
+const char* volatile lastCommandError = nullptr;
+volatile int lastCommandOp = -1;            // Failed operation of the last batch
+
+// Console messages of the control task, printed by loop(): Serial.printf
+// can wait on the UART and formats floats, too slow for a 1 ms tick
+enum ControlNoteType : uint8_t {
+    NOTE_COMMAND_FAILED,    // a = command id, text = error
+    NOTE_OUTPUTS,           // a = set, b = clear, c = outputs
+    NOTE_TABLE_PARAMS,      // a = division, b = ratio (thousandths)
+    NOTE_MOTION_LIMITS,     // a = velocity, b = acceleration, c = jerk
+    NOTE_FOLLOWING_LIMIT,   // a = limit
+    NOTE_INDEX,             // a = divisions, b = steps
+    NOTE_GOTO,              // a = division, b = steps
+    NOTE_HOMING,            // a = search steps
+    NOTE_HOMED,             // a = steps onto division 0
+    NOTE_HOMING_FAILED,     // text = error
+    NOTE_MOVE_COMPLETE,     // a = step position
+    NOTE_FOLLOWING_ERROR,   // a = error, b = step position
+    NOTE_PROGRAM_STARTED,   // name
+    NOTE_PROGRAM_ENDED,     // name, a = state, b = steps, text = error
+};
+
+struct ControlNote {
+    ControlNoteType type;
+    int32_t a;
+    int32_t b;
+    int32_t c;
+    const char* text;                   // String constant or nullptr
+    char name[PROGRAM_NAME_LENGTH];     // Program name
+};
+
+SpscQueue<ControlNote, CONTROL_NOTE_QUEUE_SIZE> controlNotes;
+std::atomic<uint32_t> controlNotesDropped{0};
 
 // System variables
 unsigned long startTime = 0;
 int clientCount = 0;
 
+// Constant system info, read once at boot
+uint32_t flashSize = 0;
+uint32_t sketchSize = 0;
+
+// Pre-serialized status served by /status and /events, and by /status.bin;
+// refreshed by loop() from the state the status job hands over
+StatusSnapshot<> statusSnapshot;
+StatusSnapshot<sizeof(StatusRecord)> statusBinary;
+
+struct StatusHandoff {
+    StatusRecord status;    // Control task fields (collectStatus)
+    const char* commandError;
+    uint8_t jobCount;
+    ControlJob jobs[ControlExecutive::MAX_JOBS];
+    bool changed;           // Push over /events
+};
+SpscQueue<StatusHandoff, 4> statusHandoff;
+StatusHandoff handoffScratch;       // Control task, too large for its stack
+StatusHandoff publishedStatus;      // loop()
+unsigned long lastStatusHandoff = 0;
+TaskHandle_t loopTaskHandle = nullptr;
+
+// The fixed part of /io (names, pins, directions) as JSON, formatted once
+// at boot for the bootstrap page
+char channelList[IoRegistry::MAX_CHANNELS * 96];
+size_t channelListLength = 0;
+
+// Last state handed to loop(), used to detect changes; clients and heap
+// are compared by loop() itself
+struct StatusSignature {
+    uint16_t outputs;
+    uint16_t inputs;
+    int division;
+    uint32_t ratio;
+    bool moving;
+    int32_t position;
+    uint32_t commandId;
+    bool homed;
+    uint8_t homing;
+    uint8_t program;
+    bool encoderFault;
+};
+StatusSignature lastPublished = {};
+int publishedClients = -1;
+uint32_t publishedHeapBucket = 0;
+bool wasMoving = false;
+
 // ===========================================
 // Function Prototypes
 // ===========================================
@@ -65,16 +315,165 @@ void initGPIO();
 void initWiFi();
 void initWebServer();
 void initNVS();
-String getStatus();
+void initEventLog();
+void saveSettings();
+void initMotion();
+void initPosition();
+void initControlTask();
+void controlTask(void *parameter);
+void onControlTick(void *parameter);
+void jobInputs();
+void jobCommands();
+void jobProgram();
+void jobMotion();
+void jobEncoder();
+void jobStatus();
+bool enqueueCommand(Command& command);
+const char* executeBatch(CommandBatch& batch);
+const char* validateCommand(const Command& command, int division);
+const char* parseBatchOp(JsonObject op, Command& command);
+bool parseChannelMask(JsonVariant value, uint16_t* mask);
+bool jsonField(JsonVariant value, int32_t* field);
+bool jsonField(JsonVariant value, uint32_t* field);
+bool jsonField(JsonVariant value, bool* field);
+const char* compileProgram(JsonArray steps, ProgramWriter& writer, int* failedStep);
+CommandBatch* findFreeBatch();
+const char* enqueueBatch(CommandBatch* batch, Command& command);
+TableState tableState();
+void rebasePosition();
+void configureIndexing();
+const char* startIndexMove(int64_t count, int64_t* steps);
+void finishHoming();
+void recordFault(TraceFault fault, uint32_t b = 0, uint32_t c = 0);
+void journalPosition(PositionState state);
+void controlNote(ControlNoteType type, int32_t a = 0, int32_t b = 0, int32_t c = 0,
+                 const char* text = nullptr, const char* name = nullptr);
+void printControlNotes();
+void collectStatus(StatusRecord& status);
+void collectSystemStatus(StatusRecord& status);
+size_t formatStatus(const StatusHandoff& handoff, char* buffer, size_t capacity);
+bool appendFormat(char* buffer, size_t capacity, size_t* length, const char* format, ...);
+bool refreshStatusSnapshot(StatusHandoff& handoff);
+size_t formatChannelList(char* buffer, size_t capacity);
+void handOffStatus();
+void publishStatus();
+void dispatchRoute(AsyncWebServerRequest *request);
+ArRequestHandlerFunction instrument(const char* route, ArRequestHandlerFunction handler);
+void sendJson(AsyncWebServerRequest *request, const JsonDocument& doc);
+void sendJsonf(AsyncWebServerRequest *request, const char* format, ...);
+void sendCommandReply(AsyncWebServerRequest *request, const char* error, const Command& command);
+void sendInvalidParam(AsyncWebServerRequest *request, const char* name);
+void sendText(AsyncWebServerRequest *request, int code, const char* text);
+void sendBytes(AsyncWebServerRequest *request, int code, const char* contentType, const uint8_t* data, size_t length);
+void sendAsset(AsyncWebServerRequest *request, const WebAsset& asset, bool immutable);
+const char* parseQuery(AsyncWebServerRequest *request, QueryFields& fields);
+const char* queryText(AsyncWebServerRequest *request, const char* name, const char* absent);
 
 // Request Handlers
+void handleAsset(AsyncWebServerRequest *request, const RouteParams& params);
+void handleImmutableAsset(AsyncWebServerRequest *request, const RouteParams& params);
+void handleBootstrap(AsyncWebServerRequest *request, const RouteParams& params);
 void handleLEDOn(AsyncWebServerRequest *request);
 void handleLEDOff(AsyncWebServerRequest *request);
+void handleIoList(AsyncWebServerRequest *request);
+void handleIoSet(AsyncWebServerRequest *request);
+void handleIoClear(AsyncWebServerRequest *request);
+void handleIoWrite(AsyncWebServerRequest *request);
+void handleIoChannel(AsyncWebServerRequest *request, const RouteParams& params);
+void handleIoEvents(AsyncWebServerRequest *request);
+void queueOutputs(AsyncWebServerRequest *request, const char* set, const char* clear);
 void handleStatus(AsyncWebServerRequest *request);
+void handleStatusBin(AsyncWebServerRequest *request);
 void handleParamsSave(AsyncWebServerRequest *request);
 void handleParamsLoad(AsyncWebServerRequest *request);
+void handleParamsFlush(AsyncWebServerRequest *request);
+void handleTableIndex(AsyncWebServerRequest *request);
+void handleTableGoto(AsyncWebServerRequest *request);
+void queueMove(AsyncWebServerRequest *request, Command& command, const char* param);
+void handleTableStop(AsyncWebServerRequest *request);
+void handleTableHome(AsyncWebServerRequest *request);
+void handlePosition(AsyncWebServerRequest *request);
+void handleEncoder(AsyncWebServerRequest *request);
+void handleEncoderTrace(AsyncWebServerRequest *request);
+void handleTrace(AsyncWebServerRequest *request);
+void handleLog(AsyncWebServerRequest *request);
+void handleLogInfo(AsyncWebServerRequest *request);
+void handleClock(AsyncWebServerRequest *request);
+void handleProgramSave(AsyncWebServerRequest *request, JsonVariant &json);
+void handleProgramList(AsyncWebServerRequest *request);
+void handleProgramStart(AsyncWebServerRequest *request);
+void handleProgramStop(AsyncWebServerRequest *request);
+void handleProgramStatus(AsyncWebServerRequest *request);
+void handleProgramDelete(AsyncWebServerRequest *request);
+void handleBatch(AsyncWebServerRequest *request, JsonVariant &json);
+void handleCommandBin(AsyncWebServerRequest *request);
+void handleCommandBinBody(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total);
+void handleMetrics(AsyncWebServerRequest *request);
+void handleHeap(AsyncWebServerRequest *request);
 void handleNotFound(AsyncWebServerRequest *request);
 
+// ===========================================
+// Route Table
+// ===========================================
+
+// GET routes, looked up by the catch-all handler (route_table.h). The
+// routes with a body (/batch, /program/save, /command.bin) and /events
+// stay library handlers, ahead of it.
+constexpr Route ROUTES[] = {
+    // Embedded web content (web_assets.h): the bootstrap page at /, and
+    // the page with separate stylesheet and script (hashed URLs immutable)
+    { HTTP_GET, asset_bootstrap.path, handleBootstrap, &asset_bootstrap },
+    { HTTP_GET, asset_index_html.path, handleAsset, &asset_index_html },
+    { HTTP_GET, asset_style_css.path, handleAsset, &asset_style_css },
+    { HTTP_GET, asset_style_css.hashedPath, handleImmutableAsset, &asset_style_css },
+    { HTTP_GET, asset_script_js.path, handleAsset, &asset_script_js },
+    { HTTP_GET, asset_script_js.hashedPath, handleImmutableAsset, &asset_script_js },
+    
+    // LED and IO channels (bulk output writes, or one channel by name)
+    { HTTP_GET, "/LED/on", handleLEDOn },
+    { HTTP_GET, "/LED/off", handleLEDOff },
+    { HTTP_GET, "/io", handleIoList },
+    { HTTP_GET, "/io/set", handleIoSet },
+    { HTTP_GET, "/io/clear", handleIoClear },
+    { HTTP_GET, "/io/write", handleIoWrite },
+    { HTTP_GET, "/io/events", handleIoEvents },
+    { HTTP_GET, "/io/{ch}/{on|off}", handleIoChannel },
+    
+    // Parameters (NVS)
+    { HTTP_GET, "/params/save", handleParamsSave },
+    { HTTP_GET, "/params/load", handleParamsLoad },
+    { HTTP_GET, "/params/flush", handleParamsFlush },
+    
+    // Rotary table motion, position and diagnostics
+    { HTTP_GET, "/table/index", handleTableIndex },
+    { HTTP_GET, "/table/goto", handleTableGoto },
+    { HTTP_GET, "/table/stop", handleTableStop },
+    { HTTP_GET, "/table/home", handleTableHome },
+    { HTTP_GET, "/position", handlePosition },
+    { HTTP_GET, "/encoder", handleEncoder },
+    { HTTP_GET, "/encoder/trace", handleEncoderTrace },
+    { HTTP_GET, "/trace", handleTrace },
+    { HTTP_GET, "/log", handleLog },
+    { HTTP_GET, "/log/info", handleLogInfo },
+    { HTTP_GET, "/clock", handleClock },
+    
+    // Stored programs
+    { HTTP_GET, "/program/list", handleProgramList },
+    { HTTP_GET, "/program/start", handleProgramStart },
+    { HTTP_GET, "/program/stop", handleProgramStop },
+    { HTTP_GET, "/program/status", handleProgramStatus },
+    { HTTP_GET, "/program/delete", handleProgramDelete },
+    
+    // Status (JSON and binary), heap details and Prometheus metrics
+    { HTTP_GET, "/status", handleStatus },
+    { HTTP_GET, "/status.bin", handleStatusBin },
+    { HTTP_GET, "/heap", handleHeap },
+    { HTTP_GET, "/metrics", handleMetrics },
+};
+
+const uint8_t ROUTE_COUNT = sizeof(ROUTES) / sizeof(ROUTES[0]);
+static_assert(ROUTE_COUNT <= RouteTable::MAX_ROUTES, "ROUTES does not fit the route table");
+
 // ===========================================
 // Setup
 // ===========================================
@@ -85,15 +484,30 @@ void setup() {
     Serial.println("  Starting up...");
     Serial.println("========================================\n");
     
+    // Count failed allocations from the start
+    heapTelemetry.begin();
+    loopTaskHandle = xTaskGetCurrentTaskHandle();     // setup() runs on the loop task
+    traceRing.record(TRACE_BOOT, esp_reset_reason());
+    
     // Record start time
     startTime = millis();
+    flashSize = ESP.getFlashChipSize();
+    sketchSize = ESP.getSketchSize();
     
     // Initialize components
     initNVS();
+    initEventLog();
     initGPIO();
+    initMotion();
+    configureIndexing();
+    initPosition();         // Resume the journalled position if it is still valid
     initWiFi();
+    initControlTask();      // First status snapshot is published by its status job
     initWebServer();
     
+    heapTelemetry.sample(0);
+    lastHeapSample = millis();
+    
     Serial.println("\n========================================");
     Serial.println("  System Ready!");
     Serial.println("========================================\n");
@@ -103,12 +517,31 @@ void setup() {
 // Main Loop
 // ===========================================
 void loop() {
-    // Main loop is mostly handled by AsyncWebServer
-    // Add any periodic tasks here
+    // Web traffic is handled by AsyncWebServer and all periodic work runs
+    // as jobs of the control executive (see initControlTask). Only the
+    // status snapshot and /events push, settings commit, program saves and
+    // deletes, journal writes and erases, event log writes, heap sampling
+    // and the console messages of the control task live here: formatting,
+    // flash writes, heap walks and serial output may take milliseconds and
+    // must not delay the control task or the AsyncTCP task.
+    publishStatus();
+    settingsStore.service(millis());
+    if (!programStore.service()) {
+        Serial.printf("[Program] Flash write failed, %s not changed\n", programStore.failedName());
+    }
+    if (!positionJournal.service()) {
+        recordFault(FAULT_JOURNAL);
+    }
+    eventLog.service();
+    printControlNotes();
     
-    // Example: You can add sensor readings, automation logic, etc.
+    if (millis() - lastHeapSample >= HEAP_SAMPLE_INTERVAL) {
+        lastHeapSample = millis();
+        heapTelemetry.sample((lastHeapSample - startTime) / 1000);
+    }
     
-    delay(10);
+    // The status job wakes us early when it hands over a change
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(SETTINGS_SERVICE_INTERVAL));
 }
 
 // ===========================================
@@ -121,13 +554,176 @@ void loop() {
 void initGPIO() {
     Serial.print("[GPIO] Initializing pins... ");
     
-    pinMode(LED_PIN, OUTPUT);
+    // All outputs start inactive
+    if (!io.begin(IO_CHANNELS, sizeof(IO_CHANNELS) / sizeof(IO_CHANNELS[0]))) {
+        Serial.println("FAILED (too many channels)");
+        return;
+    }
+    inputCapture.begin(io);
+    
+    Serial.println("OK");
+    for (uint8_t i = 0; i < io.count(); i++) {
+        const IoChannel& channel = io.channel(i);
+        Serial.printf("[GPIO] Channel %u: %s on GPIO %u (%s%s)\n", i, channel.name, channel.pin,
+                      channel.direction == IO_OUTPUT ? "output" : "input",
+                      channel.activeLow ? ", active low" : "");
+    }
+    channelListLength = formatChannelList(channelList, sizeof(channelList));
+}
+
+/**
+ * Initialize the step/direction drive of the rotary table
+ */
+void initMotion() {
+    Serial.print("[Motion] Initializing step engine... ");
+    
+    if (!stepEngine.begin(STEP_PIN, DIR_PIN, ENABLE_PIN)) {
+        Serial.println("FAILED");
+        return;
+    }
+    
+    // Initial ramp is built right away so the table can move after boot
+    motionProfile.configure(motionLimits, StepEngine::TIMER_HZ);
+    motionProfile.buildAll();
+    
+    Serial.println("OK");
+    Serial.printf("[Motion] STEP=%d DIR=%d, rate capped at %u Hz\n",
+                  STEP_PIN, DIR_PIN, (unsigned)stepEngine.maxStepRate());
+    Serial.printf("[Motion] Limits: %u steps/s, %u steps/s^2, jerk %u, ramp %u steps%s\n",
+                  (unsigned)motionLimits.maxVelocity, (unsigned)motionLimits.acceleration,
+                  (unsigned)motionLimits.jerk, (unsigned)motionProfile.active()->length,
+                  motionProfile.reachesMaxVelocity() ? "" : " (max velocity not reached)");
+    
+    // Counting is done by the PCNT peripheral; the encoder job samples it
+    encoderFeedback.setLimit(followingLimit);
+    encoderFeedback.setInPositionBand(IN_POSITION_STEPS);
+    if (encoderFeedback.begin(ENCODER_PIN_A, ENCODER_PIN_B, ENCODER_COUNTS_PER_REV,
+                              MOTOR_STEPS_PER_REV, ENCODER_REVERSE, ENCODER_GLITCH_NS)) {
+        Serial.printf("[Encoder] A=%d B=%d, %ld counts/rev, following limit %u steps\n",
+                      ENCODER_PIN_A, ENCODER_PIN_B, ENCODER_COUNTS_PER_REV, (unsigned)followingLimit);
+    } else {
+        Serial.println("[Encoder] PCNT setup FAILED, no position feedback");
+    }
+}
+
+/**
+ * Open the position journal and resume from the last position confirmed
+ * at rest, so a clean restart needs no homing run. Anything else (a
+ * power loss during a move, a changed table setup) requires homing.
+ */
+void initPosition() {
+    Serial.print("[Position] Opening journal... ");
+    
+    if (!positionJournal.begin(JOURNAL_PARTITION)) {
+        Serial.println("FAILED (no journal partition), homing required");
+        return;
+    }
+    
+    PositionRecord record;
+    const char* reason = nullptr;
+    if (!positionJournal.latest(record)) {
+        reason = "no position recorded";
+    } else if (record.state != POSITION_AT_REST) {
+        reason = "power lost while moving or homing";
+    } else if (record.division != tableDivision || record.ratioMilli != tableRatioMilli) {
+        reason = "table setup changed";
+    }
+    
+    if (reason) {
+        Serial.printf("OK, homing required (%s)\n", reason);
+        journalPosition(POSITION_UNKNOWN);
+        return;
+    }
+    
+    stepEngine.setPosition(record.position);
+    encoderFeedback.align(record.position);
+    tableHomed = true;
+    indexOrigin = 0;
+    tableIndex = record.index;
+    
+    Serial.println("OK");
+    Serial.printf("[Position] Resumed at step %ld, division %ld (no homing needed)\n",
+                  (long)record.position, (long)(((tableIndex % tableDivision) + tableDivision) % tableDivision));
+}
+
+/**
+ * Start the control task that owns outputs, NVS writes and motion,
+ * and the timer that drives it at a fixed rate
+ */
+void initControlTask() {
+    Serial.print("[Control] Starting control executive... ");
+    
+    // name, function, period (ticks), budget (us), phase
+    controlExecutive.addJob("inputs", jobInputs, 1, 200);
+    controlExecutive.addJob("commands", jobCommands, 1, 500);
+    controlExecutive.addJob("program", jobProgram, 1, 300);
+    controlExecutive.addJob("motion", jobMotion, 1, 500);
+    controlExecutive.addJob("encoder", jobEncoder, 1, 100);
+    controlExecutive.addJob("status", jobStatus, EVENTS_CHECK_INTERVAL, 2000, 7);
+    
+    xTaskCreatePinnedToCore(controlTask, "control", CONTROL_TASK_STACK, nullptr,
+                            CONTROL_TASK_PRIORITY, &controlTaskHandle, CONTROL_TASK_CORE);
     
-    // Set initial state (off)
-    digitalWrite(LED_PIN, LOW);
+    esp_timer_create_args_t timerArgs = {};
+    timerArgs.callback = onControlTick;
+    timerArgs.name = "control_tick";
+    if (!controlTaskHandle ||
+        esp_timer_create(&timerArgs, &controlTimer) != ESP_OK ||
+        esp_timer_start_periodic(controlTimer, CONTROL_TICK_US) != ESP_OK) {
+        Serial.println("FAILED");
+        return;
+    }
     
     Serial.println("OK");
-    Serial.println("[GPIO] Pins configured: Built-in LED");
+    Serial.printf("[Control] Core %d, %u Hz tick, %u jobs, queue %u commands\n",
+                  (int)CONTROL_TASK_CORE, (unsigned)(1000000 / CONTROL_TICK_US),
+                  (unsigned)controlExecutive.jobCount(), (unsigned)commandQueue.capacity());
+}
+
+/**
+ * The table state commands are checked against (control task)
+ */
+TableState tableState() {
+    TableState state;
+    state.busy = tableBusy();
+    state.programRunning = programEngine.running();
+    state.encoderFault = encoderFeedback.fault();
+    state.homed = tableHomed;
+    state.position = stepEngine.position();
+    state.index = tableIndex;
+    state.origin = indexOrigin;
+    state.motorStepsPerRev = MOTOR_STEPS_PER_REV;
+    state.math = indexMath;
+    return state;
+}
+
+/**
+ * At rest, take whole periods of the index pattern off the step position
+ * and the index, so the int32 step position never overflows however far
+ * the table indexes one way (control task)
+ */
+void rebasePosition() {
+    TableState state = tableState();
+    int64_t shift = rebaseTable(state);
+    if (shift == 0 || !stepEngine.setPosition((int32_t)state.position)) {
+        return;
+    }
+    encoderFeedback.rebase(shift);
+    tableIndex = state.index;
+}
+
+/**
+ * Precompute the division-to-step distribution for the current parameters.
+ * Once homed, division 0 is the home position and the index continues
+ * from the nearest division; before that the current position becomes
+ * division 0.
+ */
+void configureIndexing() {
+    TableState state = tableState();
+    reindexTable(state, tableDivision, tableRatioMilli);
+    indexMath = state.math;
+    indexOrigin = state.origin;
+    tableIndex = state.index;
 }
 
 /**
@@ -138,13 +734,75 @@ void initNVS() {
     
     preferences.begin("sembox", false);  // false = read/write mode
     
-    // Load saved parameters or use defaults
-    tableDivision = preferences.getInt("division", 360);
-    tableRatio = preferences.getFloat("ratio", 90.0);
+    // Load the settings record, or start from the defaults
+    Settings settings = { tableDivision, tableRatioMilli, motionLimits, followingLimit };
+    bool loaded = settingsStore.begin(preferences, settings);
     
-    Serial.println("OK");
+    if (!loaded && (preferences.isKey("division") || preferences.isKey("ratio"))) {
+        // Migrate the separate keys written by older firmware
+        settings.division = preferences.getInt("division", settings.division);
+        if (preferences.isKey("ratioMilli")) {
+            settings.ratioMilli = preferences.getUInt("ratioMilli", settings.ratioMilli);
+        } else {
+            settings.ratioMilli = lroundf(preferences.getFloat("ratio", 90.0) * IndexMath::RATIO_SCALE);
+        }
+        settings.limits.maxVelocity = preferences.getUInt("maxVel", settings.limits.maxVelocity);
+        settings.limits.acceleration = preferences.getUInt("accel", settings.limits.acceleration);
+        settings.limits.jerk = preferences.getUInt("jerk", settings.limits.jerk);
+        
+        settingsStore.update(settings, millis());
+        settingsStore.requestFlush();
+        if (settingsStore.service(millis())) {
+            const char* legacyKeys[] = { "division", "ratio", "ratioMilli", "maxVel", "accel", "jerk" };
+            for (const char* key : legacyKeys) {
+                preferences.remove(key);
+            }
+            Serial.print("migrated... ");
+        }
+    }
+    
+    tableDivision = settings.division;
+    tableRatioMilli = settings.ratioMilli;
+    tableRatio = tableRatioMilli / (float)IndexMath::RATIO_SCALE;
+    motionLimits = settings.limits;
+    followingLimit = settings.followingLimit;
+    
+    Serial.println(loaded ? "OK" : "OK (defaults)");
     Serial.printf("[NVS] Division: %d\n", tableDivision);
     Serial.printf("[NVS] Ratio: 1:%.3f\n", tableRatio);
+    
+    // Programs live in their own namespace, one blob per program
+    if (programStore.begin("programs")) {
+        ProgramInfo programs[ProgramStore::MAX_PROGRAMS];
+        Serial.printf("[NVS] Programs: %u stored\n",
+                      (unsigned)programStore.list(programs, ProgramStore::MAX_PROGRAMS));
+    } else {
+        Serial.println("[NVS] Program store unavailable");
+    }
+}
+
+/**
+ * Mount the log file system and open the event log. The dashboard is
+ * compiled in, so the former SPIFFS data area holds only the log.
+ */
+void initEventLog() {
+    Serial.print("[Log] Mounting file system... ");
+    if (!LittleFS.begin(true, "/littlefs", 4, LOG_PARTITION) || !eventLog.begin(LittleFS)) {
+        Serial.println("FAILED, event log disabled");
+        return;
+    }
+    
+    EventLogStats stats = eventLog.stats();
+    Serial.printf("OK, %u records in %u segments\n", (unsigned)stats.records, (unsigned)stats.segments);
+    eventLog.log(LOG_BOOT, esp_reset_reason(), sketchSize);
+}
+
+/**
+ * Stage the current parameters for a coalesced write (see settings_store.h)
+ */
+void saveSettings() {
+    Settings settings = { tableDivision, tableRatioMilli, motionLimits, followingLimit };
+    settingsStore.update(settings, millis());
 }
 
 /**
@@ -172,36 +830,55 @@ void initWiFi() {
 void initWebServer() {
     Serial.print("[Server] Configuring routes... ");
     
-    // Serve embedded web content (from web_content.h)
-    server.on("/", HTTP_GET, [](AsyncWebServerRequest *request){
-        request->send_P(200, "text/html", index_html);
-    });
-    
-    server.on("/index.html", HTTP_GET, [](AsyncWebServerRequest *request){
-        request->send_P(200, "text/html", index_html);
-    });
-    
-    server.on("/style.css", HTTP_GET, [](AsyncWebServerRequest *request){
-        request->send_P(200, "text/css", style_css);
-    });
+    // GET routes (ROUTES), one metrics slot each
+    if (!routeTable.begin(ROUTES, ROUTE_COUNT)) {
+        Serial.printf("FAILED at %s\n", routeTable.error());
+        return;
+    }
+    for (uint8_t i = 0; i < ROUTE_COUNT; i++) {
+        routeMetricIds[i] = routeMetrics.add(ROUTES[i].pattern);
+    }
     
-    server.on("/script.js", HTTP_GET, [](AsyncWebServerRequest *request){
-        request->send_P(200, "application/javascript", script_js);
-    });
+    // Stored programs; the body of /program/save is JSON
+    int programSaveRoute = routeMetrics.add("/program/save");
+    AsyncCallbackJsonWebHandler* programHandler = new AsyncCallbackJsonWebHandler("/program/save",
+        [programSaveRoute](AsyncWebServerRequest *request, JsonVariant &json) {
+            routeMetrics.begin(programSaveRoute);
+            handleProgramSave(request, json);
+            routeMetrics.end();
+        });
+    programHandler->setMethod(HTTP_POST);
+    programHandler->setMaxContentLength(PROGRAM_MAX_BODY);
+    server.addHandler(programHandler);
     
-    // LED routes
-    server.on("/LED/on", HTTP_GET, handleLEDOn);
-    server.on("/LED/off", HTTP_GET, handleLEDOff);
+    // Ordered list of operations in one JSON body
+    int batchRoute = routeMetrics.add("/batch");
+    AsyncCallbackJsonWebHandler* batchHandler = new AsyncCallbackJsonWebHandler("/batch",
+        [batchRoute](AsyncWebServerRequest *request, JsonVariant &json) {
+            routeMetrics.begin(batchRoute);
+            handleBatch(request, json);
+            routeMetrics.end();
+        });
+    batchHandler->setMethod(HTTP_POST);
+    batchHandler->setMaxContentLength(BATCH_MAX_BODY);
+    server.addHandler(batchHandler);
     
-    // Parameters routes (NVS)
-    server.on("/params/save", HTTP_GET, handleParamsSave);
-    server.on("/params/load", HTTP_GET, handleParamsLoad);
+    // Binary command endpoint (protocol.h)
+    server.on("/command.bin", HTTP_POST, instrument("/command.bin", handleCommandBin), nullptr, handleCommandBinBody);
     
-    // Status endpoint (JSON)
-    server.on("/status", HTTP_GET, handleStatus);
+    // Live status stream; new clients get the current state immediately
+    events.onConnect([](AsyncEventSourceClient *client){
+        size_t length;
+        uint8_t slot;
+        const char* status = statusSnapshot.acquire(&length, &slot);
+        client->send(status, "status", millis(), 1000);
+        statusSnapshot.release(slot);
+    });
+    server.addHandler(&events);
     
-    // 404 handler
-    server.onNotFound(handleNotFound);
+    // Everything else goes through the route table, or is not found
+    notFoundRoute = routeMetrics.add("not_found");
+    server.onNotFound(dispatchRoute);
     
     // Start server
     server.begin();
@@ -214,113 +891,2004 @@ void initWebServer() {
 // Request Handlers
 // ===========================================
 
-void handleLEDOn(AsyncWebServerRequest *request) {
-    Serial.println("[GPIO] Built-in LED -> ON");
-    ledState = "on";
-    digitalWrite(LED_PIN, HIGH);
-    request->send(200, "text/plain", "LED ON");
+/**
+ * Catch-all handler: one route table lookup, timed as the route found
+ */
+void dispatchRoute(AsyncWebServerRequest *request) {
+    RouteParams params;
+    int index = routeTable.match(request->method(), request->url().c_str(), &params);
+    
+    routeMetrics.begin(index >= 0 ? routeMetricIds[index] : notFoundRoute);
+    if (index >= 0) {
+        routeTable.dispatch(index, request, params);
+    } else {
+        handleNotFound(request);
+    }
+    routeMetrics.end();
 }
 
-void handleLEDOff(AsyncWebServerRequest *request) {
-    Serial.println("[GPIO] Built-in LED -> OFF");
-    ledState = "off";
-    digitalWrite(LED_PIN, LOW);
-    request->send(200, "text/plain", "LED OFF");
+/**
+ * Compressed web assets (route context). Hashed URLs never change
+ * content, so they are marked immutable; canonical URLs are revalidated
+ * with the ETag on every load.
+ */
+void handleAsset(AsyncWebServerRequest *request, const RouteParams& params) {
+    sendAsset(request, *(const WebAsset*)params.context, false);
 }
 
-void handleStatus(AsyncWebServerRequest *request) {
-    // Create JSON response
-    JsonDocument doc;
+void handleImmutableAsset(AsyncWebServerRequest *request, const RouteParams& params) {
+    sendAsset(request, *(const WebAsset*)params.context, true);
+}
+
+/**
+ * Bootstrap page (route context): stylesheet, script, the current
+ * status and the channel list in one response, so the dashboard paints
+ * live after a single round trip. Both are spliced into the
+ * precompressed page as it is sent (gzip_splice.h); never cached, as
+ * it is only current once.
+ */
+void handleBootstrap(AsyncWebServerRequest *request, const RouteParams& params) {
+    const WebBootstrap& page = *(const WebBootstrap*)params.context;
+    size_t length;
+    uint8_t slot;
+    const char* status = statusSnapshot.acquire(&length, &slot);
     
-    doc["led"] = ledState;
-    doc["uptime"] = (millis() - startTime) / 1000;
-    doc["clients"] = WiFi.softAPgetStationNum();
-    doc["freeHeap"] = ESP.getFreeHeap();
-    doc["totalHeap"] = ESP.getHeapSize();
-    doc["flashSize"] = ESP.getFlashChipSize();
-    doc["sketchSize"] = ESP.getSketchSize();
-    doc["division"] = tableDivision;
-    doc["ratio"] = tableRatio;
-    doc["ip"] = WiFi.softAPIP().toString();
+    const SpliceText parts[] = {
+        { status, length },
+        { page.middle, strlen(page.middle) },
+        { channelList, channelListLength },
+        { page.tail, strlen(page.tail) },
+    };
+    std::shared_ptr<GzipSplice> splice = std::make_shared<GzipSplice>();
+    bool spliced = splice->begin(page.head, page.headLength, page.headCrc, page.headRawLength,
+                                 parts, sizeof(parts) / sizeof(parts[0]));
+    statusSnapshot.release(slot);
+    if (!spliced) {
+        sendAsset(request, asset_index_html, false);    // Fetches status and channels itself
+        return;
+    }
     
+    routeMetrics.addBytes(splice->length());
+    AsyncWebServerResponse *response = request->beginChunkedResponse(page.contentType,
+        [splice](uint8_t *buffer, size_t maxLen, size_t index) -> size_t {
+            return splice->read(buffer, maxLen);
+        });
+    response->addHeader("Content-Encoding", "gzip");
+    response->addHeader("Cache-Control", "no-store");
+    request->send(response);
+}
+
+/**
+ * Wrap a route handler so that its requests are counted and timed
+ */
+ArRequestHandlerFunction instrument(const char* route, ArRequestHandlerFunction handler) {
+    int id = routeMetrics.add(route);
+    return [id, handler](AsyncWebServerRequest *request) {
+        routeMetrics.begin(id);
+        handler(request);
+        routeMetrics.end();
+    };
+}
+
+/**
+ * Response helpers; they account the body size to the current route.
+ * sendText() and sendBytes() do not copy: the text or data must stay
+ * valid (string constants, snapshots).
+ */
+void sendJson(AsyncWebServerRequest *request, const JsonDocument& doc) {
     String response;
     serializeJson(doc, response);
-    
+    routeMetrics.addBytes(response.length());
     request->send(200, "application/json", response);
 }
 
-void handleParamsSave(AsyncWebServerRequest *request) {
-    JsonDocument doc;
+/**
+ * Small JSON reply formatted straight into a pooled slab, without a
+ * JsonDocument or String; the slab is released when the connection
+ * closes. Falls back to a copying send when the pool is exhausted.
+ * String arguments are inserted as they are, so they must not need
+ * escaping (the handlers' own messages and names).
+ */
+void sendJsonf(AsyncWebServerRequest *request, const char* format, ...) {
+    char fallback[ResponsePool::SLAB_SIZE];
+    char* slab = responsePool.acquire();
+    char* body = slab ? slab : fallback;
     
-    if (request->hasParam("division") && request->hasParam("ratio")) {
-        int newDivision = request->getParam("division")->value().toInt();
-        float newRatio = request->getParam("ratio")->value().toFloat();
-        
-        // Validate
-        if (newDivision >= 1 && newDivision <= 9999 && newRatio >= 1 && newRatio <= 9999) {
-            tableDivision = newDivision;
-            tableRatio = newRatio;
-            
-            // Save to NVS
-            preferences.putInt("division", tableDivision);
-            preferences.putFloat("ratio", tableRatio);
-            
-            Serial.printf("[NVS] Saved: Division=%d, Ratio=1:%.3f\n", tableDivision, tableRatio);
-            
-            doc["success"] = true;
-            doc["division"] = tableDivision;
-            doc["ratio"] = tableRatio;
-        } else {
-            doc["success"] = false;
-            doc["error"] = "Invalid values (1-9999)";
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(body, ResponsePool::SLAB_SIZE, format, args);
+    va_end(args);
+    
+    if (length < 0 || length >= ResponsePool::SLAB_SIZE) {
+        if (slab) {
+            responsePool.release(slab);
         }
+        sendText(request, 500, "Reply too long");
+        return;
+    }
+    if (!slab) {
+        routeMetrics.addBytes(length);
+        request->send(200, "application/json", body);
+        return;
+    }
+    request->onDisconnect([slab]() {
+        responsePool.release(slab);
+    });
+    routeMetrics.addBytes(length);
+    request->send_P(200, "application/json", (const uint8_t*)slab, length);
+}
+
+/**
+ * Outcome of a queued command: its id, or the error
+ */
+void sendCommandReply(AsyncWebServerRequest *request, const char* error, const Command& command) {
+    if (error) {
+        sendJsonf(request, "{\"success\":false,\"error\":\"%s\"}", error);
     } else {
-        doc["success"] = false;
-        doc["error"] = "Missing parameters";
+        sendJsonf(request, "{\"success\":true,\"command\":%lu}", (unsigned long)command.id);
+    }
+}
+
+void sendInvalidParam(AsyncWebServerRequest *request, const char* name) {
+    sendJsonf(request, "{\"success\":false,\"error\":\"Invalid %s\"}", name);
+}
+
+void sendText(AsyncWebServerRequest *request, int code, const char* text) {
+    size_t length = strlen(text);
+    routeMetrics.addBytes(length);
+    request->send_P(code, "text/plain", (const uint8_t*)text, length);
+}
+
+void sendBytes(AsyncWebServerRequest *request, int code, const char* contentType, const uint8_t* data, size_t length) {
+    routeMetrics.addBytes(length);
+    request->send_P(code, contentType, data, length);
+}
+
+/**
+ * Feed the query parameters to fields, reading the request's own
+ * strings (no String temporaries); returns the name of the first
+ * invalid field, or nullptr
+ */
+const char* parseQuery(AsyncWebServerRequest *request, QueryFields& fields) {
+    for (size_t i = 0; i < request->params(); i++) {
+        const AsyncWebParameter* param = request->getParam(i);
+        if (!param->isPost() && !param->isFile()) {
+            fields.set(param->name().c_str(), param->value().c_str());
+        }
+    }
+    return fields.invalid();
+}
+
+/**
+ * Text of one query parameter, or absent if it is not given
+ */
+const char* queryText(AsyncWebServerRequest *request, const char* name, const char* absent) {
+    const char* text = absent;
+    const QueryField spec[] = { { name, QUERY_TEXT, &text } };
+    QueryFields fields(spec, 1);
+    parseQuery(request, fields);
+    return text;
+}
+
+void sendAsset(AsyncWebServerRequest *request, const WebAsset& asset, bool immutable) {
+    const char* cacheControl = immutable ? "public, max-age=31536000, immutable" : "no-cache";
+    
+    // Browser already holds this exact content
+    if (request->hasHeader("If-None-Match") &&
+        request->header("If-None-Match").indexOf(asset.etag) >= 0) {
+        AsyncWebServerResponse *response = request->beginResponse(304);
+        response->addHeader("ETag", asset.etag);
+        response->addHeader("Cache-Control", cacheControl);
+        request->send(response);
+        return;
     }
     
-    String response;
-    serializeJson(doc, response);
-    request->send(200, "application/json", response);
+    routeMetrics.addBytes(asset.length);
+    AsyncWebServerResponse *response = request->beginResponse_P(200, asset.contentType, asset.data, asset.length);
+    response->addHeader("Content-Encoding", "gzip");
+    response->addHeader("ETag", asset.etag);
+    response->addHeader("Cache-Control", cacheControl);
+    request->send(response);
 }
 
-void handleParamsLoad(AsyncWebServerRequest *request) {
+void handleLEDOn(AsyncWebServerRequest *request) {
+    Command command;
+    command.type = CMD_OUTPUTS;
+    command.outputs.set = 1 << IO_LED;
+    command.outputs.clear = 0;
+    
+    if (!enqueueCommand(command)) {
+        sendText(request, 503, "Command queue full");
+        return;
+    }
+    sendText(request, 200, "LED ON");
+}
+
+void handleLEDOff(AsyncWebServerRequest *request) {
+    Command command;
+    command.type = CMD_OUTPUTS;
+    command.outputs.set = 0;
+    command.outputs.clear = 1 << IO_LED;
+    
+    if (!enqueueCommand(command)) {
+        sendText(request, 503, "Command queue full");
+        return;
+    }
+    sendText(request, 200, "LED OFF");
+}
+
+void handleIoList(AsyncWebServerRequest *request) {
     JsonDocument doc;
+    IoMask outputs = io.outputs();
+    IoMask inputs = inputCapture.state();
+    IoMask raw = io.readInputs();
     
-    doc["division"] = tableDivision;
-    doc["ratio"] = tableRatio;
+    JsonArray channels = doc["channels"].to<JsonArray>();
+    for (uint8_t i = 0; i < io.count(); i++) {
+        const IoChannel& channel = io.channel(i);
+        JsonObject item = channels.add<JsonObject>();
+        item["name"] = channel.name;
+        item["pin"] = channel.pin;
+        item["direction"] = channel.direction == IO_OUTPUT ? "output" : "input";
+        item["activeLow"] = channel.activeLow;
+        item["active"] = (((channel.direction == IO_OUTPUT ? outputs : inputs) >> i) & 1) != 0;
+        if (channel.direction == IO_INPUT) {
+            item["raw"] = ((raw >> i) & 1) != 0;
+            item["debounceUs"] = channel.debounceUs;
+            item["lastEdgeUs"] = inputCapture.lastEdge(i);
+        }
+    }
+    doc["outputs"] = outputs;
+    doc["inputs"] = inputs;
+    doc["nowUs"] = esp_timer_get_time();
     
-    String response;
-    serializeJson(doc, response);
-    request->send(200, "application/json", response);
+    sendJson(request, doc);
 }
 
-void handleNotFound(AsyncWebServerRequest *request) {
-    Serial.printf("[Server] 404 Not Found: %s\n", request->url().c_str());
-    request->send(404, "text/plain", "Not Found");
+/**
+ * Recent debounced input edges, oldest first, with esp_timer timestamps
+ */
+void handleIoEvents(AsyncWebServerRequest *request) {
+    InputEdge edges[InputCapture::HISTORY];
+    uint8_t count = inputCapture.history(edges, InputCapture::HISTORY);
+    
+    JsonDocument doc;
+    doc["nowUs"] = esp_timer_get_time();
+    doc["edges"] = inputCapture.edges();
+    doc["overflows"] = inputCapture.overflows();
+    JsonArray list = doc["events"].to<JsonArray>();
+    for (uint8_t i = 0; i < count; i++) {
+        JsonObject event = list.add<JsonObject>();
+        event["t"] = edges[i].time;
+        event["channel"] = io.channel(edges[i].channel).name;
+        event["active"] = edges[i].active;
+    }
+    
+    sendJson(request, doc);
 }
 
-// ===========================================
-// Utility Functions
-// ===========================================
+// /io/set?ch=a,b and /io/clear?ch=a,b ("all" = every output)
+void handleIoSet(AsyncWebServerRequest *request) {
+    queueOutputs(request, queryText(request, "ch", ""), nullptr);
+}
+
+void handleIoClear(AsyncWebServerRequest *request) {
+    queueOutputs(request, nullptr, queryText(request, "ch", ""));
+}
+
+// /io/write?set=a,b&clear=c: both applied in the same command
+void handleIoWrite(AsyncWebServerRequest *request) {
+    queueOutputs(request, queryText(request, "set", nullptr), queryText(request, "clear", nullptr));
+}
+
+// /io/<channel>/on and /io/<channel>/off
+void handleIoChannel(AsyncWebServerRequest *request, const RouteParams& params) {
+    char name[24];
+    if (!params.copy(0, name, sizeof(name))) {
+        name[0] = 0;    // Too long for any channel: reported as unknown
+    }
+    bool on = params.items[1].value == 0;
+    queueOutputs(request, on ? name : nullptr, on ? nullptr : name);
+}
 
 /**
- * Get system status as JSON string
+ * Queue one bulk output write from channel name lists (either may be null)
  */
-String getStatus() {
-    JsonDocument doc;
+void queueOutputs(AsyncWebServerRequest *request, const char* set, const char* clear) {
+    Command command;
+    command.type = CMD_OUTPUTS;
+    command.outputs.set = 0;
+    command.outputs.clear = 0;
+    
+    const char* error = nullptr;
+    if ((set && !io.parseNames(set, &command.outputs.set)) ||
+        (clear && !io.parseNames(clear, &command.outputs.clear))) {
+        error = "Unknown channel";
+    } else {
+        error = validateCommand(command, tableDivision);
+    }
+    
+    if (!error && !enqueueCommand(command)) {
+        error = "Command queue full";
+    }
+    
+    if (error) {
+        sendCommandReply(request, error, command);
+        return;
+    }
+    sendJsonf(request, "{\"success\":true,\"command\":%lu,\"set\":%u,\"clear\":%u}",
+              (unsigned long)command.id, command.outputs.set, command.outputs.clear);
+}
+
+void handleStatus(AsyncWebServerRequest *request) {
+    // Served straight from the current snapshot, no JSON or String
+    // building; the buffer stays pinned until the response is sent
+    size_t length;
+    uint8_t slot;
+    const char* body = statusSnapshot.acquire(&length, &slot);
+    request->onDisconnect([slot]() {
+        statusSnapshot.release(slot);
+    });
+    sendBytes(request, 200, "application/json", (const uint8_t*)body, length);
+}
+
+void handleStatusBin(AsyncWebServerRequest *request) {
+    size_t length;
+    uint8_t slot;
+    const char* body = statusBinary.acquire(&length, &slot);
+    request->onDisconnect([slot]() {
+        statusBinary.release(slot);
+    });
+    sendBytes(request, 200, "application/octet-stream", (const uint8_t*)body, length);
+}
+
+void handleParamsSave(AsyncWebServerRequest *request) {
+    int32_t newDivision = tableDivision;
+    uint32_t newRatioMilli = tableRatioMilli;
+    MotionLimits newLimits = motionLimits;
+    uint32_t newFollowing = followingLimit;
+    
+    // Parsed in place into the new values; those not given stay current
+    enum { DIVISION, RATIO, VELOCITY, ACCEL, JERK, FOLLOWING };
+    const QueryField spec[] = {
+        { "division", QUERY_INT, &newDivision },
+        { "ratio", QUERY_RATIO, &newRatioMilli },
+        { "velocity", QUERY_UINT, &newLimits.maxVelocity },
+        { "accel", QUERY_UINT, &newLimits.acceleration },
+        { "jerk", QUERY_UINT, &newLimits.jerk },
+        { "following", QUERY_UINT, &newFollowing },
+    };
+    QueryFields fields(spec, sizeof(spec) / sizeof(spec[0]));
+    const char* invalid = parseQuery(request, fields);
+    if (invalid) {
+        sendInvalidParam(request, invalid);
+        return;
+    }
+    
+    // Division/ratio, motion limits and the following error limit can be
+    // saved together or separately
+    bool hasTable = fields.has(DIVISION) || fields.has(RATIO);
+    bool hasLimits = fields.has(VELOCITY) || fields.has(ACCEL) || fields.has(JERK);
+    bool hasFollowing = fields.has(FOLLOWING);
+    const char* error = nullptr;
     
-    doc["led"] = ledState;
-    doc["uptime"] = (millis() - startTime) / 1000;
-    doc["clients"] = WiFi.softAPgetStationNum();
-    doc["freeHeap"] = ESP.getFreeHeap();
-    doc["totalHeap"] = ESP.getHeapSize();
-    doc["flashSize"] = ESP.getFlashChipSize();
-    doc["sketchSize"] = ESP.getSketchSize();
-    doc["division"] = tableDivision;
-    doc["ratio"] = tableRatio;
-    
-    String output;
-    serializeJson(doc, output);
-    return output;
+    if (!hasTable && !hasLimits && !hasFollowing) {
+        error = "Missing parameters";
+    } else if (stepEngine.busy()) {
+        error = "Table busy";
+    } else if (hasTable && !(fields.has(DIVISION) && fields.has(RATIO))) {
+        error = "Missing parameters";
+    }
+    
+    // Applied by the control task, then persisted by the settings store
+    Command command;
+    command.type = CMD_PARAMS;
+    command.params.hasTable = hasTable;
+    command.params.hasLimits = hasLimits;
+    command.params.hasFollowing = hasFollowing;
+    command.params.division = newDivision;
+    command.params.ratioMilli = newRatioMilli;
+    command.params.limits = newLimits;
+    command.params.followingLimit = newFollowing;
+    
+    if (!error) {
+        error = validateCommand(command, tableDivision);
+    }
+    if (!error && !enqueueCommand(command)) {
+        error = "Command queue full";
+    }
+    
+    if (error) {
+        sendCommandReply(request, error, command);
+        return;
+    }
+    sendJsonf(request,
+              "{\"success\":true,\"command\":%lu,\"division\":%ld,\"ratio\":%lu.%03lu,"
+              "\"velocity\":%lu,\"accel\":%lu,\"jerk\":%lu,\"following\":%lu}",
+              (unsigned long)command.id, (long)newDivision,
+              (unsigned long)(newRatioMilli / IndexMath::RATIO_SCALE),
+              (unsigned long)(newRatioMilli % IndexMath::RATIO_SCALE),
+              (unsigned long)newLimits.maxVelocity, (unsigned long)newLimits.acceleration,
+              (unsigned long)newLimits.jerk, (unsigned long)newFollowing);
+}
+
+void handleParamsLoad(AsyncWebServerRequest *request) {
+    uint32_t ratioMilli = tableRatioMilli;
+    sendJsonf(request,
+              "{\"division\":%d,\"ratio\":%lu.%03lu,\"velocity\":%lu,\"accel\":%lu,"
+              "\"jerk\":%lu,\"following\":%lu}",
+              tableDivision, (unsigned long)(ratioMilli / IndexMath::RATIO_SCALE),
+              (unsigned long)(ratioMilli % IndexMath::RATIO_SCALE),
+              (unsigned long)motionLimits.maxVelocity, (unsigned long)motionLimits.acceleration,
+              (unsigned long)motionLimits.jerk, (unsigned long)followingLimit);
+}
+
+void handleParamsFlush(AsyncWebServerRequest *request) {
+    // Only raises a flag; the write happens in loop() within one service interval
+    settingsStore.requestFlush();
+    sendJsonf(request, "{\"success\":true}");
+}
+
+void handleTableIndex(AsyncWebServerRequest *request) {
+    Command command;
+    command.type = CMD_TABLE_INDEX;
+    command.move.value = 1;
+    queueMove(request, command, "count");
+}
+
+void handleTableGoto(AsyncWebServerRequest *request) {
+    Command command;
+    command.type = CMD_TABLE_GOTO;
+    command.move.value = -1;
+    queueMove(request, command, "division");
+}
+
+/**
+ * Queue an index or goto move; the named query parameter, if given,
+ * replaces the default in command.move.value
+ */
+void queueMove(AsyncWebServerRequest *request, Command& command, const char* param) {
+    const QueryField spec[] = { { param, QUERY_INT, &command.move.value } };
+    QueryFields fields(spec, 1);
+    if (parseQuery(request, fields)) {
+        sendInvalidParam(request, param);
+        return;
+    }
+    
+    const char* error = validateCommand(command, tableDivision);
+    if (!error && !enqueueCommand(command)) {
+        error = "Command queue full";
+    }
+    sendCommandReply(request, error, command);
+}
+
+void handleTableStop(AsyncWebServerRequest *request) {
+    // Not queued: stopping must work even with a full queue, and
+    // the stop requests of the engine, homing and programs are safe from any task
+    Serial.println("[Motion] Stop requested");
+    traceRing.record(TRACE_STOP, STOP_REQUEST, stepEngine.position());
+    programEngine.stop();
+    homing.abort();
+    stepEngine.stop();
+    sendText(request, 200, "STOPPING");
+}
+
+void handleTableHome(AsyncWebServerRequest *request) {
+    Command command;
+    command.type = CMD_TABLE_HOME;
+    
+    const char* error = enqueueCommand(command) ? nullptr : "Command queue full";
+    sendCommandReply(request, error, command);
+}
+
+/**
+ * Home reference, homing progress and the position journal
+ */
+void handlePosition(AsyncWebServerRequest *request) {
+    PositionJournalStats journal = positionJournal.stats();
+    PositionRecord record;
+    
+    JsonDocument doc;
+    doc["homed"] = tableHomed;
+    doc["homing"] = HomingSequence::phaseName(homing.phase());
+    if (homing.error()) {
+        doc["homingError"] = homing.error();
+    }
+    doc["position"] = stepEngine.position();
+    doc["index"] = ((tableIndex % tableDivision) + tableDivision) % tableDivision;
+    
+    JsonObject log = doc["journal"].to<JsonObject>();
+    log["sectors"] = journal.sectors;
+    log["appends"] = journal.appends;
+    log["erases"] = journal.erases;
+    log["failures"] = journal.failures;
+    log["dropped"] = journal.dropped;
+    if (positionJournal.latest(record)) {
+        JsonObject last = log["last"].to<JsonObject>();
+        last["sequence"] = record.sequence;
+        last["state"] = record.state == POSITION_AT_REST ? "rest" : record.state == POSITION_MOVING ? "moving" : "unknown";
+        last["position"] = record.position;
+        last["index"] = record.index;
+    }
+    
+    sendJson(request, doc);
+}
+
+void handleEncoder(AsyncWebServerRequest *request) {
+    EncoderStatus status = encoderFeedback.status();
+    
+    JsonDocument doc;
+    doc["ready"] = encoderFeedback.ready();
+    doc["counts"] = status.counts;
+    doc["commanded"] = stepEngine.position();
+    doc["actual"] = status.actual;
+    doc["error"] = status.error;
+    doc["peakError"] = status.peakError;
+    doc["limit"] = encoderFeedback.limit();
+    doc["fault"] = status.fault;
+    doc["sequence"] = encoderFeedback.sequence();
+    
+    JsonObject move = doc["lastMove"].to<JsonObject>();
+    move["count"] = status.moves;
+    move["peakError"] = status.movePeakError;
+    move["overshoot"] = status.overshoot;
+    move["band"] = encoderFeedback.inPositionBand();
+    if (status.settleUs >= 0) {
+        move["settleUs"] = status.settleUs;
+    } else {
+        move["settleUs"] = nullptr;     // Still settling
+    }
+    
+    sendJson(request, doc);
+}
+
+/**
+ * /encoder/trace?from=N&max=M: samples from sequence number N onward as
+ * [time us, commanded, actual] (steps). Pass the returned "next" as from
+ * to continue without gaps; "first" > from means samples were missed.
+ */
+void handleEncoderTrace(AsyncWebServerRequest *request) {
+    // Static: too large for the AsyncTCP stack, and handlers never overlap
+    static EncoderSample samples[ENCODER_TRACE_MAX];
+    uint32_t from = 0;
+    uint32_t max = ENCODER_TRACE_MAX;
+    const QueryField spec[] = {
+        { "from", QUERY_UINT, &from },
+        { "max", QUERY_UINT, &max },
+    };
+    QueryFields fields(spec, sizeof(spec) / sizeof(spec[0]));
+    const char* invalid = parseQuery(request, fields);
+    if (invalid) {
+        sendInvalidParam(request, invalid);
+        return;
+    }
+    if (max < 1 || max > ENCODER_TRACE_MAX) {
+        max = ENCODER_TRACE_MAX;
+    }
+    
+    uint32_t first = 0;
+    uint16_t count = encoderFeedback.trace(from, samples, max, &first);
+    
+    JsonDocument doc;
+    doc["first"] = first;
+    doc["next"] = first + count;
+    JsonArray list = doc["samples"].to<JsonArray>();
+    for (uint16_t i = 0; i < count; i++) {
+        JsonArray sample = list.add<JsonArray>();
+        sample.add(samples[i].time);
+        sample.add(samples[i].commanded);
+        sample.add(samples[i].actual);
+    }
+    
+    sendJson(request, doc);
+}
+
+/**
+ * /trace?from=N: the binary event trace (trace_ring.h), a TraceHeader
+ * followed by TraceRecords, streamed straight from the ring. Pass the
+ * header's end as from to continue where the last download stopped.
+ */
+void handleTrace(AsyncWebServerRequest *request) {
+    uint32_t from = 0;
+    const QueryField spec[] = { { "from", QUERY_UINT, &from } };
+    QueryFields fields(spec, 1);
+    if (parseQuery(request, fields)) {
+        sendInvalidParam(request, "from");
+        return;
+    }
+    std::shared_ptr<TraceReader> reader = std::make_shared<TraceReader>(traceRing, from, esp_timer_get_time());
+    AsyncWebServerResponse *response = request->beginChunkedResponse("application/octet-stream",
+        [reader](uint8_t *buffer, size_t maxLen, size_t index) -> size_t {
+            return reader->read(buffer, maxLen);
+        });
+    request->send(response);
+}
+
+/**
+ * /log?from=T&to=T: the persistent event log (event_log.h) between two
+ * log clock times in ms (both inclusive, default everything), a LogHeader
+ * followed by LogRecords, oldest first.
+ */
+void handleLog(AsyncWebServerRequest *request) {
+    if (!eventLog.ready()) {
+        sendText(request, 503, "Event log unavailable");
+        return;
+    }
+    int64_t from = 0;
+    int64_t to = INT64_MAX;
+    const QueryField spec[] = {
+        { "from", QUERY_INT64, &from },
+        { "to", QUERY_INT64, &to },
+    };
+    QueryFields fields(spec, sizeof(spec) / sizeof(spec[0]));
+    const char* invalid = parseQuery(request, fields);
+    if (invalid) {
+        sendInvalidParam(request, invalid);
+        return;
+    }
+    std::shared_ptr<LogReader> reader = std::make_shared<LogReader>(eventLog, from, to);
+    AsyncWebServerResponse *response = request->beginChunkedResponse("application/octet-stream",
+        [reader](uint8_t *buffer, size_t maxLen, size_t index) -> size_t {
+            return reader->read(buffer, maxLen);
+        });
+    request->send(response);
+}
+
+/**
+ * /log/info: event log size, time range and the current log clock
+ */
+void handleLogInfo(AsyncWebServerRequest *request) {
+    JsonDocument doc;
+    EventLogStats stats = eventLog.stats();
+    doc["ready"] = eventLog.ready();
+    doc["segments"] = stats.segments;
+    doc["records"] = stats.records;
+    doc["pending"] = stats.pending;
+    doc["dropped"] = stats.dropped;
+    doc["first"] = stats.first;
+    doc["last"] = stats.last;
+    doc["now"] = eventLog.now();
+    doc["unixTime"] = eventLog.now() >= EventLog::VALID_UNIX_MS;
+    sendJson(request, doc);
+}
+
+/**
+ * /clock?unix=S: set the system time (Unix seconds), so that log records
+ * carry wall clock times. Earlier records keep their times.
+ */
+void handleClock(AsyncWebServerRequest *request) {
+    int64_t seconds = 0;
+    const QueryField spec[] = { { "unix", QUERY_INT64, &seconds } };
+    QueryFields fields(spec, 1);
+    if (parseQuery(request, fields)) {
+        sendInvalidParam(request, "unix");
+        return;
+    }
+    
+    JsonDocument doc;
+    if (seconds < EventLog::VALID_UNIX_MS / 1000) {
+        doc["success"] = false;
+        doc["error"] = "Expected unix=<seconds since 1970>";
+    } else {
+        struct timeval tv = { (time_t)seconds, 0 };
+        settimeofday(&tv, nullptr);
+        Serial.printf("[Log] Clock set to %lld\n", (long long)seconds);
+        doc["success"] = true;
+        doc["now"] = eventLog.now();
+    }
+    sendJson(request, doc);
+}
+
+/**
+ * POST /program/save: {"name": "cycle", "steps": [{"op":"home"},
+ * {"op":"loop","count":12}, {"op":"index","count":1}, {"op":"dwell","ms":500},
+ * {"op":"next"}, {"op":"wait","input":"locked","active":true,"timeoutMs":5000}]}
+ * Moves and outputs use the /batch operation syntax.
+ */
+void handleProgramSave(AsyncWebServerRequest *request, JsonVariant &json) {
+    JsonDocument doc;
+    uint8_t code[PROGRAM_MAX_CODE];
+    ProgramWriter writer(code, sizeof(code));
+    int failedStep = -1;
+    
+    JsonArray steps = json["steps"].as<JsonArray>();
+    const char* error = steps.isNull() || steps.size() == 0
+        ? "Expected a non-empty steps array"
+        : compileProgram(steps, writer, &failedStep);
+    if (!error) {
+        error = programStore.save(json["name"] | "", code, writer.length());
+    }
+    
+    if (error) {
+        doc["success"] = false;
+        doc["error"] = error;
+        if (failedStep >= 0) {
+            doc["step"] = failedStep;
+        }
+    } else {
+        doc["success"] = true;
+        doc["bytes"] = writer.length();
+        Serial.printf("[Program] Saving %s (%u bytes)\n", json["name"].as<const char*>(), (unsigned)writer.length());
+    }
+    
+    sendJson(request, doc);
+}
+
+void handleProgramList(AsyncWebServerRequest *request) {
+    ProgramInfo programs[ProgramStore::MAX_PROGRAMS];
+    uint8_t count = programStore.list(programs, ProgramStore::MAX_PROGRAMS);
+    
+    JsonDocument doc;
+    doc["max"] = ProgramStore::MAX_PROGRAMS;
+    doc["maxBytes"] = PROGRAM_MAX_CODE;
+    JsonArray list = doc["programs"].to<JsonArray>();
+    for (uint8_t i = 0; i < count; i++) {
+        JsonObject program = list.add<JsonObject>();
+        program["name"] = programs[i].name;
+        program["bytes"] = programs[i].length;
+    }
+    
+    sendJson(request, doc);
+}
+
+void handleProgramStart(AsyncWebServerRequest *request) {
+    uint8_t code[PROGRAM_MAX_CODE];
+    uint16_t length = 0;
+    const char* name = queryText(request, "name", "");
+    
+    Command command;
+    command.type = CMD_PROGRAM_START;
+    
+    const char* error = nullptr;
+    if (!programStore.load(name, code, &length)) {
+        error = "Unknown program";
+    } else if (!programEngine.stage(name, code, length)) {
+        error = "Program start pending";
+    } else if (!enqueueCommand(command)) {
+        programEngine.unstage();
+        error = "Command queue full";
+    }
+    
+    sendCommandReply(request, error, command);
+}
+
+void handleProgramStop(AsyncWebServerRequest *request) {
+    // Like /table/stop: not queued, and the table decelerates too
+    Serial.println("[Program] Stop requested");
+    traceRing.record(TRACE_STOP, STOP_PROGRAM, stepEngine.position());
+    programEngine.stop();
+    homing.abort();
+    stepEngine.stop();
+    sendText(request, 200, "STOPPING");
+}
+
+void handleProgramStatus(AsyncWebServerRequest *request) {
+    ProgramStatus status = programEngine.status();
+    int64_t end = status.state == PROGRAM_RUNNING ? esp_timer_get_time() : status.endedUs;
+    
+    JsonDocument doc;
+    doc["state"] = ProgramEngine::stateName(status.state);
+    if (status.state != PROGRAM_IDLE) {
+        doc["name"] = status.name;
+        doc["pc"] = status.pc;
+        doc["op"] = ProgramEngine::opName(status.op);
+        doc["steps"] = status.steps;
+        doc["elapsedUs"] = end - status.startedUs;
+    }
+    doc["error"] = status.error;
+    
+    sendJson(request, doc);
+}
+
+void handleProgramDelete(AsyncWebServerRequest *request) {
+    const char* name = queryText(request, "name", "");
+    
+    const char* error = programStore.remove(name);
+    if (error) {
+        sendJsonf(request, "{\"success\":false,\"error\":\"%s\"}", error);
+        return;
+    }
+    sendJsonf(request, "{\"success\":true}");
+}
+
+/**
+ * POST /batch: [{"op":"outputs","set":"led,out26"}, {"op":"params","division":24,"ratio":"90"},
+ * {"op":"index","count":1}, {"op":"goto","division":3}, ...]
+ * All operations are validated first; if any is invalid nothing is queued.
+ * A valid batch runs as one command, so no other command interleaves.
+ */
+void handleBatch(AsyncWebServerRequest *request, JsonVariant &json) {
+    JsonDocument doc;
+    JsonArray results = doc["results"].to<JsonArray>();
+    const char* error = nullptr;
+    
+    JsonArray ops = json.as<JsonArray>();
+    CommandBatch* batch = findFreeBatch();
+    
+    if (ops.isNull() || ops.size() == 0) {
+        error = "Expected a non-empty array of operations";
+    } else if (ops.size() > CommandBatch::MAX_OPS) {
+        error = "Too many operations";
+    } else if (!batch) {
+        error = "Batch slots busy";
+    } else {
+        // Divisions of later operations follow parameter changes in the batch
+        int division = tableDivision;
+        batch->count = 0;
+        for (JsonVariant item : ops) {
+            Command& command = batch->ops[batch->count++];
+            const char* opError = parseBatchOp(item.as<JsonObject>(), command);
+            if (!opError) {
+                opError = validateCommand(command, division);
+            }
+            if (!opError && command.type == CMD_PARAMS && command.params.hasTable) {
+                division = command.params.division;
+            }
+            
+            JsonObject result = results.add<JsonObject>();
+            result["ok"] = opError == nullptr;
+            if (opError) {
+                result["error"] = opError;
+                error = "Invalid operation, nothing executed";
+            }
+        }
+    }
+    
+    Command command;
+    if (!error) {
+        error = enqueueBatch(batch, command);
+    }
+    
+    if (error) {
+        doc["success"] = false;
+        doc["error"] = error;
+    } else {
+        doc["success"] = true;
+        doc["command"] = command.id;
+    }
+    
+    sendJson(request, doc);
+}
+
+/**
+ * Collect the /command.bin body; bodies may arrive in several chunks
+ */
+void handleCommandBinBody(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total) {
+    if (total > COMMAND_BIN_MAX_BODY) {
+        return;     // Rejected in handleCommandBin()
+    }
+    if (index == 0) {
+        request->_tempObject = malloc(total);  // Freed with the request
+    }
+    if (request->_tempObject) {
+        memcpy((uint8_t*)request->_tempObject + index, data, len);
+    }
+}
+
+/**
+ * POST /command.bin: one or more WireCommand records, replied to with a
+ * WireCommandReply. Several records are queued as one batch, with the
+ * same all-or-nothing semantics as /batch.
+ */
+void handleCommandBin(AsyncWebServerRequest *request) {
+    WireCommandReply reply = { 0, 0, 0xFF, 0 };
+    size_t length = request->contentLength();
+    size_t count = length / sizeof(WireCommand);
+    const uint8_t* body = (const uint8_t*)request->_tempObject;
+    int status = 200;
+    
+    if (!body || count == 0 || count > CommandBatch::MAX_OPS || length % sizeof(WireCommand) != 0) {
+        status = 400;
+    } else {
+        CommandBatch* batch = count > 1 ? findFreeBatch() : nullptr;
+        Command single;
+        Command* ops = batch ? batch->ops : &single;
+        
+        if (count > 1 && !batch) {
+            status = 503;
+        }
+        int division = tableDivision;
+        for (uint8_t i = 0; status == 200 && i < count; i++) {
+            WireCommand wire;
+            memcpy(&wire, body + i * sizeof(WireCommand), sizeof(wire));
+            if (!decodeCommand(wire, ops[i]) || validateCommand(ops[i], division) != nullptr) {
+                reply.failedOp = i;
+                status = 400;
+            } else if (ops[i].type == CMD_PARAMS && ops[i].params.hasTable) {
+                division = ops[i].params.division;
+            }
+        }
+        
+        Command command;
+        if (status == 200 && batch) {
+            batch->count = count;
+            if (enqueueBatch(batch, command)) {
+                status = 503;
+            }
+        } else if (status == 200) {
+            command = single;
+            if (!enqueueCommand(command)) {
+                status = 503;
+            }
+        }
+        if (status == 200) {
+            reply.command = command.id;
+            reply.accepted = 1;
+        }
+    }
+    
+    // Streamed response: copies the reply, which lives on this stack frame
+    routeMetrics.addBytes(sizeof(reply));
+    AsyncResponseStream *response = request->beginResponseStream("application/octet-stream");
+    response->setCode(status);
+    response->write((const uint8_t*)&reply, sizeof(reply));
+    request->send(response);
+}
+
+/**
+ * Prometheus text exposition, written straight into the TCP send buffer
+ * in chunks so the document is never held in memory as a whole
+ */
+void handleMetrics(AsyncWebServerRequest *request) {
+    std::shared_ptr<MetricsWriter> writer = std::make_shared<MetricsWriter>(routeMetrics);
+    AsyncWebServerResponse *response = request->beginChunkedResponse("text/plain; version=0.0.4",
+        [writer](uint8_t *buffer, size_t maxLen, size_t index) -> size_t {
+            return writer->read((char*)buffer, maxLen);
+        });
+    request->send(response);
+}
+
+/**
+ * Heap details: current state per capability, failed allocations, the
+ * sample history (oldest first), heap held and allocations per route and
+ * the reply slab pool
+ */
+void handleHeap(AsyncWebServerRequest *request) {
+    // Static: too large for the AsyncTCP stack, and handlers never overlap
+    static HeapSample samples[HeapTelemetry::HISTORY];
+    uint8_t count = heapTelemetry.history(samples, HeapTelemetry::HISTORY);
+    HeapSample latest = heapTelemetry.latest();
+    
+    JsonDocument doc;
+    const HeapRegion* regions[] = { &latest.internal, &latest.spiram };
+    const char* names[] = { "internal", "spiram" };
+    for (uint8_t i = 0; i < 2; i++) {
+        if (regions[i]->total == 0) {
+            continue;   // No PSRAM fitted
+        }
+        JsonObject region = doc[names[i]].to<JsonObject>();
+        region["total"] = regions[i]->total;
+        region["free"] = regions[i]->free;
+        region["largest"] = regions[i]->largest;
+        region["minFree"] = regions[i]->minFree;
+        region["blocks"] = regions[i]->blocks;
+        region["fragmentation"] = HeapTelemetry::fragmentation(*regions[i]) / 1000.0;
+    }
+    doc["allocFailed"] = heapTelemetry.failedAllocs();
+    doc["lastFailedSize"] = heapTelemetry.lastFailedSize();
+    doc["sampleInterval"] = HEAP_SAMPLE_INTERVAL / 1000;
+    
+    // Internal RAM history as rows of [uptime, free, largest, minFree, blocks]
+    JsonArray history = doc["history"].to<JsonArray>();
+    for (uint8_t i = 0; i < count; i++) {
+        JsonArray row = history.add<JsonArray>();
+        row.add(samples[i].uptime);
+        row.add(samples[i].internal.free);
+        row.add(samples[i].internal.largest);
+        row.add(samples[i].internal.minFree);
+        row.add(samples[i].internal.blocks);
+    }
+    
+    JsonArray routes = doc["routes"].to<JsonArray>();
+    for (uint8_t i = 0; i < routeMetrics.count(); i++) {
+        const RouteCounters& counters = routeMetrics.route(i);
+        JsonObject route = routes.add<JsonObject>();
+        route["route"] = counters.route;
+        route["requests"] = counters.requests.load(std::memory_order_relaxed);
+        route["heapBytes"] = counters.heapBytes.load(std::memory_order_relaxed);
+        if (routeMetrics.countsAllocations()) {
+            route["allocations"] = counters.allocations.load(std::memory_order_relaxed);
+        }
+    }
+    
+    JsonObject pool = doc["responsePool"].to<JsonObject>();
+    pool["slabs"] = ResponsePool::SLABS;
+    pool["inUse"] = responsePool.inUse();
+    pool["peak"] = responsePool.peak();
+    pool["misses"] = responsePool.misses();
+    
+    sendJson(request, doc);
+}
+
+void handleNotFound(AsyncWebServerRequest *request) {
+    Serial.printf("[Server] 404 Not Found: %s\n", request->url().c_str());
+    sendText(request, 404, "Not Found");
+}
+
+// ===========================================
+// Control Task
+// ===========================================
+
+/**
+ * Free batch slot, or nullptr if all are queued (AsyncTCP task only)
+ */
+CommandBatch* findFreeBatch() {
+    for (uint8_t i = 0; i < COMMAND_BATCH_SLOTS; i++) {
+        if (!commandBatches[i].inUse.load(std::memory_order_acquire)) {
+            return &commandBatches[i];
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * Queue a filled batch as one CMD_BATCH command (AsyncTCP task only).
+ * Returns an error message, or nullptr with command.id assigned.
+ */
+const char* enqueueBatch(CommandBatch* batch, Command& command) {
+    command.type = CMD_BATCH;
+    command.batch.slot = batch - commandBatches;
+    batch->inUse.store(true, std::memory_order_release);
+    if (!enqueueCommand(command)) {
+        batch->inUse.store(false, std::memory_order_release);
+        return "Command queue full";
+    }
+    return nullptr;
+}
+
+/**
+ * Queue a command for the control task (AsyncTCP task only).
+ * Assigns command.id; false if the queue is full.
+ */
+bool enqueueCommand(Command& command) {
+    command.id = nextCommandId++;
+    if (!commandQueue.push(command)) {
+        commandsDropped++;
+        traceRing.record(TRACE_FAULT, FAULT_QUEUE_FULL, command.type);
+        return false;
+    }
+    traceRing.record(TRACE_COMMAND, command.type, command.id);
+    return true;
+}
+
+/**
+ * Control timer callback: wake the control task for one tick
+ */
+void onControlTick(void *parameter) {
+    xTaskNotifyGive(controlTaskHandle);
+}
+
+/**
+ * Control task: run the executive once per timer tick. A notification
+ * count above 1 means ticks were signalled while the last one still ran.
+ */
+void controlTask(void *parameter) {
+    for (;;) {
+        uint32_t pendingTicks = ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        controlExecutive.tick(pendingTicks);
+    }
+}
+
+/**
+ * Job: debounce captured input edges (first, so later jobs see them)
+ */
+void jobInputs() {
+    inputCapture.service(esp_timer_get_time());
+}
+
+/**
+ * Job: execute all queued commands
+ */
+void jobCommands() {
+    Command command;
+    while (commandQueue.pop(command)) {
+        lastCommandOp = -1;
+        // A running program owns the table (batches are checked per operation)
+        const char* error = programEngine.running() && needsIdleTable(command.type)
+            ? "Program running"
+            : executeCommand(command);
+        lastCommandError = error;
+        lastCommandId = command.id;
+        traceRing.record(TRACE_COMMAND_DONE, error != nullptr, command.id, lastCommandOp + 1);
+        if (error) {
+            controlNote(NOTE_COMMAND_FAILED, command.id, 0, 0, error);
+        }
+    }
+}
+
+/**
+ * Job: run the due steps of the active program
+ */
+void jobProgram() {
+    bool wasRunning = programEngine.running();
+    programEngine.service();
+    
+    if (wasRunning && !programEngine.running()) {
+        ProgramStatus status = programEngine.status();
+        controlNote(NOTE_PROGRAM_ENDED, status.state, status.steps, 0, status.error, status.name);
+        if (status.state == PROGRAM_FAILED) {
+            recordFault(FAULT_PROGRAM, status.pc);
+        }
+        eventLog.log(LOG_PROGRAM, status.state, status.steps);
+    }
+}
+
+/**
+ * Job: motion supervision (move completion, ramp rebuilds while idle)
+ */
+void jobMotion() {
+    if (homing.service(esp_timer_get_time())) {
+        finishHoming();
+    }
+    
+    // Moves between homing phases are not journalled
+    bool moving = stepEngine.busy();
+    if (wasMoving && !moving && !homing.active()) {
+        rebasePosition();
+        controlNote(NOTE_MOVE_COMPLETE, stepEngine.position());
+        traceRing.record(TRACE_MOVE_END, 0, stepEngine.position());
+        journalPosition(POSITION_AT_REST);
+        if (++movesCompleted % CYCLE_LOG_INTERVAL == 0) {
+            eventLog.log(LOG_CYCLES, 0, movesCompleted, CYCLE_LOG_INTERVAL);
+        }
+    }
+    wasMoving = moving;
+    
+    if (motionProfile.pending() && !moving) {
+        motionProfile.build(RAMP_BUILD_SLICE);
+    }
+}
+
+/**
+ * Job: sample the encoder and watch the following error. A fault means
+ * the table did not follow the steps, so its position is lost: the table
+ * stops and must be homed again.
+ */
+void jobEncoder() {
+    // Homing redefines the step position; the encoder just follows it
+    if (homing.active()) {
+        encoderFeedback.align(stepEngine.position());
+    }
+    if (!encoderFeedback.sample(esp_timer_get_time(), stepEngine.position(), stepEngine.busy())) {
+        return;
+    }
+    
+    controlNote(NOTE_FOLLOWING_ERROR, encoderFeedback.error(), stepEngine.position());
+    recordFault(FAULT_FOLLOWING_ERROR, encoderFeedback.error(), stepEngine.position());
+    programEngine.stop();
+    homing.abort();
+    stepEngine.stop();
+    tableHomed = false;
+    journalPosition(POSITION_UNKNOWN);
+}
+
+/**
+ * Job: hand status changes to loop() for the snapshot and /events
+ */
+void jobStatus() {
+    handOffStatus();
+}
+
+/**
+ * Execute one command. Returns an error message, or nullptr on success.
+ */
+const char* executeCommand(const Command& command) {
+    switch (command.type) {
+        case CMD_OUTPUTS:
+            io.write(command.outputs.set, command.outputs.clear);
+            traceRing.record(TRACE_OUTPUTS, io.outputs(), command.outputs.set, command.outputs.clear);
+            controlNote(NOTE_OUTPUTS, command.outputs.set, command.outputs.clear, io.outputs());
+            return nullptr;
+        
+        case CMD_PARAMS:
+            if (tableBusy()) {
+                return "Table busy";
+            }
+            if (command.params.hasTable) {
+                tableDivision = command.params.division;
+                tableRatioMilli = command.params.ratioMilli;
+                tableRatio = tableRatioMilli / (float)IndexMath::RATIO_SCALE;
+                configureIndexing();
+                journalPosition(POSITION_AT_REST);
+                controlNote(NOTE_TABLE_PARAMS, tableDivision, tableRatioMilli);
+            }
+            if (command.params.hasLimits) {
+                // Ramp table is rebuilt below while the table is idle
+                motionLimits = command.params.limits;
+                motionProfile.configure(motionLimits, StepEngine::TIMER_HZ);
+                controlNote(NOTE_MOTION_LIMITS, motionLimits.maxVelocity, motionLimits.acceleration, motionLimits.jerk);
+            }
+            if (command.params.hasFollowing) {
+                followingLimit = command.params.followingLimit;
+                encoderFeedback.setLimit(followingLimit);
+                controlNote(NOTE_FOLLOWING_LIMIT, followingLimit);
+            }
+            traceRing.record(TRACE_PARAMS, tableDivision, tableRatioMilli, motionLimits.maxVelocity);
+            eventLog.log(LOG_PARAMS, tableDivision, tableRatioMilli, motionLimits.maxVelocity);
+            saveSettings();
+            return nullptr;
+        
+        case CMD_TABLE_INDEX: {
+            int64_t steps = 0;
+            const char* error = startIndexMove(command.move.value, &steps);
+            if (!error) {
+                controlNote(NOTE_INDEX, command.move.value, steps);
+            }
+            return error;
+        }
+        
+        case CMD_TABLE_GOTO: {
+            if (command.move.value >= tableDivision) {
+                return "Invalid division";
+            }
+            // Shortest way round; 0 divisions is a valid no-op
+            int64_t count = shortestIndexDelta(tableIndex, command.move.value, tableDivision);
+            int64_t steps = 0;
+            const char* error = count != 0 ? startIndexMove(count, &steps) : nullptr;
+            if (!error) {
+                controlNote(NOTE_GOTO, command.move.value, steps);
+            }
+            return error;
+        }
+        
+        case CMD_TABLE_HOME: {
+            if (tableBusy()) {
+                return "Table busy";
+            }
+            // Invalidate the journal before the table moves
+            tableHomed = false;
+            journalPosition(POSITION_UNKNOWN);
+            
+            HomingConfig config;
+            config.approachRate = min(HOMING_APPROACH_RATE, motionLimits.maxVelocity);
+            config.creepRate = HOMING_CREEP_RATE;
+            config.backoffSteps = HOMING_BACKOFF_STEPS;
+            // A table revolution and 10 % finds the sensor from anywhere
+            int64_t revolution = (int64_t)MOTOR_STEPS_PER_REV * tableRatioMilli / IndexMath::RATIO_SCALE;
+            config.searchSteps = HOMING_DIRECTION * (int32_t)min(revolution * 11 / 10, (int64_t)INT32_MAX);
+            
+            const char* error = homing.start(config);
+            if (!error) {
+                controlNote(NOTE_HOMING, config.searchSteps);
+            }
+            return error;
+        }
+        
+        case CMD_PROGRAM_START: {
+            if (tableBusy()) {
+                programEngine.unstage();
+                return "Table busy";
+            }
+            const char* error = programEngine.start();
+            if (!error) {
+                controlNote(NOTE_PROGRAM_STARTED, 0, 0, 0, nullptr, programEngine.status().name);
+            }
+            return error;
+        }
+        
+        case CMD_BATCH:
+            return executeBatch(commandBatches[command.batch.slot]);
+    }
+    return "Unknown command";
+}
+
+/**
+ * Run the operations of a batch in order. Every operation is checked
+ * against the state the earlier ones leave (command_check.h) before the
+ * first one runs, so a batch that would fail is rejected as a whole.
+ * Only a step timer that fails to start can still stop a batch partway.
+ * Releases the batch slot.
+ */
+const char* executeBatch(CommandBatch& batch) {
+    uint8_t failedOp = 0;
+    const char* error = checkBatch(batch.ops, batch.count, tableState(), &failedOp);
+    if (error) {
+        lastCommandOp = failedOp;
+    }
+    
+    for (uint8_t i = 0; i < batch.count && !error; i++) {
+        error = executeCommand(batch.ops[i]);
+        if (error) {
+            lastCommandOp = i;
+        }
+    }
+    
+    batch.inUse.store(false, std::memory_order_release);
+    return error;
+}
+
+/**
+ * Check the ranges of a command's arguments against the given division
+ * count. Shared by the GET handlers and /batch. Returns an error message,
+ * or nullptr if valid.
+ */
+const char* validateCommand(const Command& command, int division) {
+    switch (command.type) {
+        case CMD_OUTPUTS:
+            if ((command.outputs.set | command.outputs.clear) == 0) {
+                return "Missing parameters";
+            }
+            if ((command.outputs.set | command.outputs.clear) & ~io.outputMask()) {
+                return "Not an output channel";
+            }
+            if (command.outputs.set & command.outputs.clear) {
+                return "Channel both set and cleared";
+            }
+            return nullptr;
+        
+        case CMD_PARAMS:
+            if (!command.params.hasTable && !command.params.hasLimits && !command.params.hasFollowing) {
+                return "Missing parameters";
+            }
+            if (command.params.hasTable &&
+                (command.params.division < 1 || command.params.division > 9999 ||
+                 command.params.ratioMilli < 1 * IndexMath::RATIO_SCALE ||
+                 command.params.ratioMilli > 9999 * IndexMath::RATIO_SCALE)) {
+                return "Invalid values (1-9999, ratio max 3 decimals)";
+            }
+            if (command.params.hasLimits &&
+                (command.params.limits.maxVelocity < 1 ||
+                 command.params.limits.maxVelocity > stepEngine.maxStepRate() ||
+                 command.params.limits.acceleration < 1 ||
+                 command.params.limits.acceleration > MAX_ACCELERATION ||
+                 command.params.limits.jerk > MAX_JERK)) {
+                return "Invalid motion limits";
+            }
+            if (command.params.hasFollowing && command.params.followingLimit > MAX_FOLLOWING_LIMIT) {
+                return "Invalid following error limit";
+            }
+            return nullptr;
+        
+        case CMD_TABLE_INDEX:
+            return command.move.value == 0 ? "Invalid count" : nullptr;
+        
+        case CMD_TABLE_GOTO:
+            return command.move.value < 0 || command.move.value >= division ? "Invalid division" : nullptr;
+        
+        case CMD_TABLE_HOME:
+        case CMD_PROGRAM_START:
+            return nullptr;
+        
+        case CMD_BATCH:
+            break;
+    }
+    return "Unknown command";
+}
+
+/**
+ * Channel mask from a /batch field: absent (0), a mask, or a name list
+ */
+bool parseChannelMask(JsonVariant value, uint16_t* mask) {
+    if (value.isNull()) {
+        *mask = 0;
+        return true;
+    }
+    if (value.is<uint16_t>()) {
+        *mask = value.as<uint16_t>();
+        return true;
+    }
+    return value.is<const char*>() && io.parseNames(value.as<const char*>(), mask);
+}
+
+/**
+ * Build a command from one /batch operation object. Omitted parameter
+ * fields keep their current values. Returns an error message, or nullptr.
+ */
+const char* parseBatchOp(JsonObject op, Command& command) {
+    const char* name = op["op"] | "";
+    
+    if (strcmp(name, "led") == 0) {
+        bool on = false;
+        if (!jsonField(op["on"], &on)) {
+            return "Invalid on";
+        }
+        command.type = CMD_OUTPUTS;
+        command.outputs.set = on ? 1 << IO_LED : 0;
+        command.outputs.clear = on ? 0 : 1 << IO_LED;
+        return nullptr;
+    }
+    
+    // {"op":"outputs","set":"led,out26","clear":4}: names or masks
+    if (strcmp(name, "outputs") == 0) {
+        command.type = CMD_OUTPUTS;
+        if (!parseChannelMask(op["set"], &command.outputs.set) ||
+            !parseChannelMask(op["clear"], &command.outputs.clear)) {
+            return "Unknown channel";
+        }
+        return nullptr;
+    }
+    
+    if (strcmp(name, "params") == 0) {
+        command.type = CMD_PARAMS;
+        command.params.hasTable = !op["division"].isNull() || !op["ratio"].isNull();
+        command.params.hasLimits = !op["velocity"].isNull() || !op["accel"].isNull() || !op["jerk"].isNull();
+        command.params.hasFollowing = !op["following"].isNull();
+        command.params.division = tableDivision;
+        command.params.ratioMilli = tableRatioMilli;
+        command.params.limits = motionLimits;
+        command.params.followingLimit = followingLimit;
+        if (!jsonField(op["division"], &command.params.division)) {
+            return "Invalid division";
+        }
+        if (!jsonField(op["velocity"], &command.params.limits.maxVelocity)) {
+            return "Invalid velocity";
+        }
+        if (!jsonField(op["accel"], &command.params.limits.acceleration)) {
+            return "Invalid accel";
+        }
+        if (!jsonField(op["jerk"], &command.params.limits.jerk)) {
+            return "Invalid jerk";
+        }
+        if (!jsonField(op["following"], &command.params.followingLimit)) {
+            return "Invalid following";
+        }
+        
+        if (command.params.hasTable) {
+            // Ratio as a string keeps its exact decimal form; numbers are accepted too
+            char ratio[16];
+            if (op["ratio"].is<const char*>()) {
+                strlcpy(ratio, op["ratio"].as<const char*>(), sizeof(ratio));
+            } else if (op["ratio"].is<float>()) {
+                snprintf(ratio, sizeof(ratio), "%.3f", op["ratio"].as<double>());
+            } else {
+                return "Missing parameters";
+            }
+            if (!op["division"].is<int>() || !parseRatioMilli(ratio, &command.params.ratioMilli)) {
+                return "Invalid values (1-9999, ratio max 3 decimals)";
+            }
+        }
+        return nullptr;
+    }
+    
+    if (strcmp(name, "index") == 0) {
+        command.type = CMD_TABLE_INDEX;
+        command.move.value = 1;
+        return jsonField(op["count"], &command.move.value) ? nullptr : "Invalid count";
+    }
+    
+    if (strcmp(name, "goto") == 0) {
+        command.type = CMD_TABLE_GOTO;
+        command.move.value = -1;
+        return jsonField(op["division"], &command.move.value) ? nullptr : "Invalid division";
+    }
+    
+    if (strcmp(name, "home") == 0) {
+        command.type = CMD_TABLE_HOME;
+        return nullptr;
+    }
+    
+    return "Unknown operation";
+}
+
+/**
+ * Optional typed field of a /batch or /program/save operation: absent
+ * keeps the default; present with another type or out of range is
+ * invalid, as QueryFields treats query parameters
+ */
+bool jsonField(JsonVariant value, int32_t* field) {
+    if (value.isNull()) {
+        return true;
+    }
+    if (!value.is<int32_t>()) {
+        return false;
+    }
+    *field = value.as<int32_t>();
+    return true;
+}
+
+bool jsonField(JsonVariant value, uint32_t* field) {
+    if (value.isNull()) {
+        return true;
+    }
+    if (!value.is<uint32_t>()) {
+        return false;
+    }
+    *field = value.as<uint32_t>();
+    return true;
+}
+
+bool jsonField(JsonVariant value, bool* field) {
+    if (value.isNull()) {
+        return true;
+    }
+    if (!value.is<bool>()) {
+        return false;
+    }
+    *field = value.as<bool>();
+    return true;
+}
+
+/**
+ * Compile /program/save steps into bytecode. Besides the /batch moves and
+ * outputs: {"op":"dwell","ms":500} (or "us"), {"op":"wait","input":"home",
+ * "active":true,"timeoutMs":2000}, {"op":"loop","count":10} ... {"op":"next"}.
+ * Sets failedStep to the offending step on error.
+ */
+const char* compileProgram(JsonArray steps, ProgramWriter& writer, int* failedStep) {
+    int number = 0;
+    for (JsonVariant item : steps) {
+        JsonObject step = item.as<JsonObject>();
+        const char* name = step["op"] | "";
+        const char* error = nullptr;
+        
+        if (strcmp(name, "dwell") == 0) {
+            if (step["us"].is<uint32_t>()) {
+                error = writer.dwell(step["us"].as<uint32_t>());
+            } else if (step["ms"].is<uint32_t>() && step["ms"].as<uint32_t>() <= UINT32_MAX / 1000) {
+                error = writer.dwell(step["ms"].as<uint32_t>() * 1000);
+            } else {
+                error = "Invalid dwell";
+            }
+        } else if (strcmp(name, "wait") == 0) {
+            int channel = io.find(step["input"] | "");
+            bool active = true;
+            uint32_t timeoutMs = 0;
+            if (channel < 0 || !((io.inputMask() >> channel) & 1)) {
+                error = "Not an input channel";
+            } else if (!jsonField(step["active"], &active)) {
+                error = "Invalid active";
+            } else if (!jsonField(step["timeoutMs"], &timeoutMs)) {
+                error = "Invalid timeoutMs";
+            } else {
+                error = writer.wait(channel, active, timeoutMs);
+            }
+        } else if (strcmp(name, "loop") == 0) {
+            error = step["count"].is<uint16_t>()
+                ? writer.loop(step["count"].as<uint16_t>())
+                : "Invalid loop count";
+        } else if (strcmp(name, "next") == 0) {
+            error = writer.next();
+        } else {
+            Command command;
+            error = parseBatchOp(step, command);
+            // Goto is checked against the division in use when the program runs
+            if (!error && command.type != CMD_TABLE_GOTO) {
+                error = validateCommand(command, tableDivision);
+            }
+            if (!error) {
+                switch (command.type) {
+                    case CMD_OUTPUTS:
+                        error = writer.outputs(command.outputs.set, command.outputs.clear);
+                        break;
+                    case CMD_TABLE_GOTO:
+                        error = writer.gotoDivision(command.move.value);
+                        break;
+                    case CMD_TABLE_INDEX:
+                        error = writer.index(command.move.value);
+                        break;
+                    case CMD_TABLE_HOME:
+                        error = writer.home();
+                        break;
+                    default:
+                        error = "Not allowed in a program";
+                        break;
+                }
+            }
+        }
+        
+        if (error) {
+            *failedStep = number;
+            return error;
+        }
+        number++;
+    }
+    return writer.end();
+}
+
+// ===========================================
+// Utility Functions
+// ===========================================
+
+/**
+ * Move the table by count divisions along the active motion profile.
+ * Steps are computed to the absolute target, so a stopped move is made
+ * up by the next one. Returns an error message, or nullptr on success.
+ */
+const char* startIndexMove(int64_t count, int64_t* steps) {
+    int64_t target = tableIndex + count;
+    const char* error = checkIndexMove(tableState(), count, steps);
+    if (error) {
+        return error;
+    }
+    if (*steps != 0) {
+        // Journalled before the first step, so a power loss mid-move forces homing
+        journalPosition(POSITION_MOVING);
+        if (!stepEngine.move((int32_t)*steps, motionProfile.active())) {
+            journalPosition(POSITION_AT_REST);
+            return "Table busy";
+        }
+        traceRing.record(TRACE_MOVE_START, 0, (int32_t)*steps, (uint32_t)target);
+    }
+    
+    tableIndex = target;
+    return nullptr;
+}
+
+/**
+ * True while a move or the homing sequence owns the table
+ */
+bool tableBusy() {
+    return stepEngine.busy() || homing.active();
+}
+
+/**
+ * Homing ended (control task). On success the home edge is step 0 and
+ * division 0, and the table moves onto division 0 exactly; the journal
+ * entry is written when that move completes.
+ */
+void finishHoming() {
+    if (homing.phase() != HOMING_DONE) {
+        controlNote(NOTE_HOMING_FAILED, 0, 0, 0, homing.error());
+        recordFault(FAULT_HOMING, stepEngine.position());
+        return;
+    }
+    
+    // The home edge is a new step origin; a following error fault is cleared
+    encoderFeedback.align(stepEngine.position());
+    encoderFeedback.clearFault();
+    tableHomed = true;
+    configureIndexing();
+    int64_t steps = 0;
+    startIndexMove(0, &steps);
+    eventLog.log(LOG_HOMED, tableDivision);
+    controlNote(NOTE_HOMED, steps);
+}
+
+/**
+ * A fault goes to the trace and, since it matters after a reboot too,
+ * to the event log
+ */
+void recordFault(TraceFault fault, uint32_t b, uint32_t c) {
+    traceRing.record(TRACE_FAULT, fault, b, c);
+    eventLog.log(LOG_FAULT, fault, b, c);
+}
+
+/**
+ * Queue the table position for the journal (control task); loop() writes
+ * it. Without a home reference only an "unknown" record is written, once,
+ * so an older position can never be resumed.
+ */
+void journalPosition(PositionState state) {
+    PositionRecord record = {};
+    if (!positionJournal.ready()) {
+        return;
+    }
+    if (!tableHomed) {
+        PositionState latest;
+        if (!positionJournal.latestState(latest) || latest == POSITION_UNKNOWN) {
+            return;
+        }
+        state = POSITION_UNKNOWN;
+    }
+    
+    record.position = stepEngine.position();
+    record.index = tableIndex;
+    record.division = tableDivision;
+    record.ratioMilli = tableRatioMilli;
+    record.state = state;
+    if (!positionJournal.append(record)) {
+        recordFault(FAULT_JOURNAL);
+    }
+}
+
+/**
+ * Queue a console message (control task); dropped and counted if loop()
+ * has fallen behind
+ */
+void controlNote(ControlNoteType type, int32_t a, int32_t b, int32_t c, const char* text, const char* name) {
+    ControlNote note = { type, a, b, c, text, "" };
+    if (name) {
+        strlcpy(note.name, name, sizeof(note.name));
+    }
+    if (!controlNotes.push(note)) {
+        controlNotesDropped.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+/**
+ * Print the queued console messages of the control task (loop task)
+ */
+void printControlNotes() {
+    static uint32_t droppedReported = 0;
+    ControlNote note;
+    while (controlNotes.pop(note)) {
+        switch (note.type) {
+            case NOTE_COMMAND_FAILED:
+                Serial.printf("[Control] Command %u failed: %s\n", (unsigned)note.a, note.text);
+                break;
+            case NOTE_OUTPUTS:
+                Serial.printf("[GPIO] Outputs set 0x%04x clear 0x%04x -> 0x%04x\n",
+                              (unsigned)note.a, (unsigned)note.b, (unsigned)note.c);
+                break;
+            case NOTE_TABLE_PARAMS:
+                Serial.printf("[NVS] Staged: Division=%d, Ratio=1:%.3f\n",
+                              (int)note.a, (uint32_t)note.b / (float)IndexMath::RATIO_SCALE);
+                break;
+            case NOTE_MOTION_LIMITS:
+                Serial.printf("[NVS] Staged: Velocity=%u, Accel=%u, Jerk=%u\n",
+                              (unsigned)note.a, (unsigned)note.b, (unsigned)note.c);
+                break;
+            case NOTE_FOLLOWING_LIMIT:
+                Serial.printf("[NVS] Staged: Following limit=%u\n", (unsigned)note.a);
+                break;
+            case NOTE_INDEX:
+                Serial.printf("[Motion] Index %d divisions (%ld steps)\n", (int)note.a, (long)note.b);
+                break;
+            case NOTE_GOTO:
+                Serial.printf("[Motion] Goto division %d (%ld steps)\n", (int)note.a, (long)note.b);
+                break;
+            case NOTE_HOMING:
+                Serial.printf("[Motion] Homing, search up to %ld steps\n", (long)note.a);
+                break;
+            case NOTE_HOMED:
+                Serial.printf("[Motion] Homed, %ld steps onto division 0\n", (long)note.a);
+                break;
+            case NOTE_HOMING_FAILED:
+                Serial.printf("[Motion] Homing failed: %s\n", note.text);
+                break;
+            case NOTE_MOVE_COMPLETE:
+                Serial.printf("[Motion] Move complete at step %ld\n", (long)note.a);
+                break;
+            case NOTE_FOLLOWING_ERROR:
+                Serial.printf("[Encoder] Following error %ld steps at step %ld, stopping\n",
+                              (long)note.a, (long)note.b);
+                break;
+            case NOTE_PROGRAM_STARTED:
+                Serial.printf("[Program] Started %s\n", note.name);
+                break;
+            case NOTE_PROGRAM_ENDED:
+                Serial.printf("[Program] %s %s after %u steps%s%s\n", note.name,
+                              ProgramEngine::stateName((ProgramState)note.a), (unsigned)note.b,
+                              note.text ? ": " : "", note.text ? note.text : "");
+                break;
+        }
+    }
+    
+    uint32_t dropped = controlNotesDropped.load(std::memory_order_relaxed);
+    if (dropped != droppedReported) {
+        Serial.printf("[Control] %u console messages dropped\n", (unsigned)(dropped - droppedReported));
+        droppedReported = dropped;
+    }
+}
+
+/**
+ * Gather the current state into a status record (control task)
+ */
+void collectStatus(StatusRecord& status) {
+    StepEngineStats motion = stepEngine.stats();
+    SettingsStoreStats settings = settingsStore.stats();
+    
+    status.schema = STATUS_SCHEMA_VERSION;
+    status.size = sizeof(StatusRecord);
+    status.led = (io.outputs() >> IO_LED) & 1;
+    status.outputs = io.outputs();
+    status.inputs = inputCapture.state();
+    status.inputEdges = inputCapture.edges();
+    status.homed = tableHomed;
+    status.homing = homing.phase();
+    status.program = programEngine.state();
+    status.encoder = encoderFeedback.actual();
+    status.followError = encoderFeedback.error();
+    status.encoderFault = encoderFeedback.fault();
+    status.uptime = (millis() - startTime) / 1000;
+    status.flashSize = flashSize;
+    status.sketchSize = sketchSize;
+    status.division = tableDivision;
+    status.ratio = tableRatioMilli;
+    status.moving = stepEngine.busy();
+    status.position = stepEngine.position();
+    status.index = ((tableIndex % tableDivision) + tableDivision) % tableDivision;
+    status.stepJitterUs = (uint64_t)motion.maxLatencyTicks * 10000000 / StepEngine::TIMER_HZ;
+    status.stepOverruns = motion.overruns;
+    status.cmdId = lastCommandId;
+    status.cmdOp = lastCommandOp;
+    status.cmdFailed = lastCommandError != nullptr;
+    status.cmdDropped = commandsDropped;
+    status.nvsWrites = settings.writes;
+    status.nvsPending = settings.pending;
+    status.tickMissed = controlExecutive.missedTicks();
+}
+
+/**
+ * Add the network and heap figures to a status record (loop task)
+ */
+void collectSystemStatus(StatusRecord& status) {
+    status.clients = WiFi.softAPgetStationNum();
+    status.freeHeap = ESP.getFreeHeap();
+    status.totalHeap = ESP.getHeapSize();
+    status.ip = (uint32_t)WiFi.softAPIP();
+    
+    // Low-water mark is tracked by the allocator; the rest comes from the
+    // last heap sample, since walking the heap here would stall the loop
+    HeapSample heap = heapTelemetry.latest();
+    status.heapMinFree = heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL);
+    status.heapLargest = heap.internal.largest;
+    status.heapFrag = HeapTelemetry::fragmentation(heap.internal);
+    status.allocFailed = heapTelemetry.failedAllocs();
+}
+
+/**
+ * Format a status record as JSON into a caller-provided buffer, adding
+ * the members that have no binary form (error text, job table).
+ * Returns the length written, or 0 if the buffer is too small.
+ */
+size_t formatStatus(const StatusHandoff& handoff, char* buffer, size_t capacity) {
+    const char* commandError = handoff.commandError;
+    size_t used = 0;
+    
+    bool ok = formatStatusFields(handoff.status, buffer, capacity, &used) &&
+        appendFormat(buffer, capacity, &used, "\"cmdError\":%s%s%s,",
+                     commandError ? "\"" : "", commandError ? commandError : "null", commandError ? "\"" : "");
+    
+    // Control executive: per-job execution time
+    ok = ok && appendFormat(buffer, capacity, &used, "\"jobs\":[");
+    for (uint8_t i = 0; ok && i < handoff.jobCount; i++) {
+        const ControlJob& job = handoff.jobs[i];
+        ok = appendFormat(buffer, capacity, &used,
+            "%s{\"name\":\"%s\",\"runs\":%u,\"lastUs\":%u,\"avgUs\":%u,\"maxUs\":%u,\"overruns\":%u}",
+            i ? "," : "", job.name, (unsigned)job.runs, (unsigned)job.lastUs,
+            (unsigned)(job.runs ? job.totalUs / job.runs : 0),
+            (unsigned)job.maxUs, (unsigned)job.overruns);
+    }
+    ok = ok && appendFormat(buffer, capacity, &used, "]}");
+    
+    return ok ? used : 0;
+}
+
+/**
+ * snprintf() at *length into buffer, advancing *length.
+ * Returns false (leaving *length unchanged) if the text does not fit.
+ */
+bool appendFormat(char* buffer, size_t capacity, size_t* length, const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    int written = vsnprintf(buffer + *length, capacity - *length, format, args);
+    va_end(args);
+    
+    if (written < 0 || (size_t)written >= capacity - *length) {
+        return false;
+    }
+    *length += written;
+    return true;
+}
+
+/**
+ * The channels as in /io, without their state (the status carries the
+ * output and input masks); 0 if the buffer is too small
+ */
+size_t formatChannelList(char* buffer, size_t capacity) {
+    size_t length = 0;
+    bool ok = appendFormat(buffer, capacity, &length, "[");
+    for (uint8_t i = 0; ok && i < io.count(); i++) {
+        const IoChannel& channel = io.channel(i);
+        ok = appendFormat(buffer, capacity, &length, "%s{\"name\":\"%s\",\"pin\":%u,\"direction\":\"%s\",\"activeLow\":%s",
+                          i ? "," : "", channel.name, channel.pin,
+                          channel.direction == IO_OUTPUT ? "output" : "input", channel.activeLow ? "true" : "false");
+        if (ok && channel.direction == IO_INPUT) {
+            ok = appendFormat(buffer, capacity, &length, ",\"debounceUs\":%lu", (unsigned long)channel.debounceUs);
+        }
+        ok = ok && appendFormat(buffer, capacity, &length, "}");
+    }
+    ok = ok && appendFormat(buffer, capacity, &length, "]");
+    return ok ? length : 0;
+}
+
+/**
+ * Serialize a handed-over status, with the network and heap figures,
+ * into the snapshot back buffers and publish it; false if nothing was
+ * published (loop task)
+ */
+bool refreshStatusSnapshot(StatusHandoff& handoff) {
+    // Slow clients still sending both older snapshots hold them; retry
+    // on the next pass rather than rewrite one under its response
+    if (!statusSnapshot.writable() || !statusBinary.writable()) {
+        return false;
+    }
+    
+    collectSystemStatus(handoff.status);
+    size_t length = formatStatus(handoff, statusSnapshot.back(), statusSnapshot.capacity());
+    if (length == 0) {
+        Serial.println("[Status] Snapshot buffer too small");
+        return false;
+    }
+    statusSnapshot.commit(length);
+    
+    memcpy(statusBinary.back(), &handoff.status, sizeof(handoff.status));
+    statusBinary.commit(sizeof(handoff.status));
+    return true;
+}
+
+/**
+ * Job side of the status: when outputs, inputs, motion, parameters or
+ * commands changed (or the refresh interval elapsed), copy the state and
+ * the job table for loop() and wake it. Only the signature check and
+ * the copy run on the control task.
+ */
+void handOffStatus() {
+    StatusSignature current;
+    current.outputs = io.outputs();
+    current.inputs = inputCapture.state();
+    current.division = tableDivision;
+    current.ratio = tableRatioMilli;
+    current.moving = stepEngine.busy();
+    current.position = stepEngine.position();
+    current.commandId = lastCommandId;
+    current.homed = tableHomed;
+    current.homing = homing.phase();
+    current.program = programEngine.state();
+    current.encoderFault = encoderFeedback.fault();
+    
+    bool changed = current.outputs != lastPublished.outputs ||
+        current.inputs != lastPublished.inputs ||
+        current.moving != lastPublished.moving ||
+        current.position != lastPublished.position ||
+        current.commandId != lastPublished.commandId ||
+        current.homed != lastPublished.homed ||
+        current.homing != lastPublished.homing ||
+        current.program != lastPublished.program ||
+        current.encoderFault != lastPublished.encoderFault ||
+        current.division != lastPublished.division ||
+        current.ratio != lastPublished.ratio;
+    unsigned long sinceHandoff = millis() - lastStatusHandoff;
+    
+    if (sinceHandoff < StatusSnapshot<>::MIN_REFRESH_INTERVAL ||
+        (!changed && sinceHandoff < STATUS_REFRESH_INTERVAL)) {
+        return;
+    }
+    
+    StatusHandoff& handoff = handoffScratch;
+    collectStatus(handoff.status);
+    handoff.commandError = lastCommandError;
+    handoff.jobCount = controlExecutive.jobCount();
+    for (uint8_t i = 0; i < handoff.jobCount; i++) {
+        handoff.jobs[i] = controlExecutive.job(i);
+    }
+    handoff.changed = changed;
+    
+    // loop() is behind; the change is still there on the next run
+    if (!statusHandoff.push(handoff)) {
+        return;
+    }
+    lastPublished = current;
+    lastStatusHandoff = millis();
+    xTaskNotifyGive(loopTaskHandle);
+}
+
+/**
+ * Loop side of the status: refresh the snapshot from the newest state
+ * the status job handed over, or when the client count or free heap
+ * changed, and push changes over /events (loop task)
+ */
+void publishStatus() {
+    static bool received = false;
+    static bool refreshPending = false;
+    static bool pushPending = false;
+    
+    while (statusHandoff.pop(publishedStatus)) {
+        received = true;
+        refreshPending = true;
+        pushPending = pushPending || publishedStatus.changed;
+    }
+    if (!received) {
+        return;
+    }
+    
+    int clients = WiFi.softAPgetStationNum();
+    uint32_t heapBucket = ESP.getFreeHeap() / EVENTS_HEAP_GRANULARITY;
+    if (clients != publishedClients || heapBucket != publishedHeapBucket) {
+        refreshPending = true;
+        pushPending = true;
+    }
+    
+    if (!refreshPending || !refreshStatusSnapshot(publishedStatus)) {
+        return;
+    }
+    refreshPending = false;
+    publishedClients = clients;
+    publishedHeapBucket = heapBucket;
+    
+    if (pushPending && events.count() > 0) {
+        events.send(statusSnapshot.front(nullptr), "status", millis());
+    }
+    pushPending = false;
 }
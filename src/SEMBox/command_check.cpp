@@ -0,0 +1,111 @@
+/*********
+  SEMBox ESP32 - Command Check
+*********/
+
+#include "command_check.h"
+
+bool reindexTable(TableState& state, uint32_t division, uint32_t ratioMilli) {
+    if (!state.math.configure(division, ratioMilli, state.motorStepsPerRev)) {
+        return false;
+    }
+    // Once homed, division 0 is the home position and the index continues
+    // from the nearest division; before that the position becomes division 0
+    if (state.homed) {
+        state.origin = 0;
+        state.index = state.math.indexNear(state.position);
+    } else {
+        state.index = 0;
+        state.origin = state.position;
+    }
+    return true;
+}
+
+int64_t rebaseTable(TableState& state) {
+    int64_t period = state.math.periodIndexes();
+    int64_t periods = state.index / period;
+    if (state.index % period < 0) {
+        periods--;
+    }
+    if (periods == 0) {
+        return 0;
+    }
+    int64_t shift = periods * state.math.periodSteps();
+    state.index -= periods * period;
+    state.position -= shift;
+    return shift;
+}
+
+const char* checkIndexMove(const TableState& state, int64_t count, int64_t* steps) {
+    *steps = state.origin + state.math.stepsAt(state.index + count) - state.position;
+    int64_t target = state.position + *steps;
+    if (*steps > INT32_MAX || *steps < INT32_MIN || target > INT32_MAX || target < INT32_MIN) {
+        return "Move too long";
+    }
+    if (state.encoderFault) {
+        return "Following error, home the table";
+    }
+    if (state.busy) {
+        return "Table busy";
+    }
+    return nullptr;
+}
+
+const char* checkBatch(const Command* ops, uint8_t count, TableState state, uint8_t* failedOp) {
+    for (uint8_t i = 0; i < count; i++) {
+        const Command& op = ops[i];
+        const char* error = nullptr;
+        int64_t steps = 0;
+        bool needsIdle = needsIdleTable(op.type);
+
+        if (needsIdle && state.programRunning) {
+            error = "Program running";
+        } else if (needsIdle && state.busy) {
+            error = "Table busy";
+        } else {
+            switch (op.type) {
+                case CMD_PARAMS:
+                    if (op.params.hasTable && !reindexTable(state, op.params.division, op.params.ratioMilli)) {
+                        error = "Invalid values (1-9999, ratio max 3 decimals)";
+                    }
+                    break;
+
+                case CMD_TABLE_INDEX:
+                    error = checkIndexMove(state, op.move.value, &steps);
+                    break;
+
+                case CMD_TABLE_GOTO: {
+                    if (op.move.value < 0 || (uint32_t)op.move.value >= state.math.division()) {
+                        error = "Invalid division";
+                        break;
+                    }
+                    int64_t delta = shortestIndexDelta(state.index, op.move.value, state.math.division());
+                    error = delta != 0 ? checkIndexMove(state, delta, &steps) : nullptr;
+                    break;
+                }
+
+                case CMD_OUTPUTS:
+                case CMD_TABLE_HOME:
+                    break;
+
+                default:
+                    error = "Not allowed in a batch";
+                    break;
+            }
+        }
+
+        if (error) {
+            *failedOp = i;
+            return error;
+        }
+        // Any move (even of 0 steps) or homing owns the table for the rest of the batch
+        if (needsIdle && op.type != CMD_PARAMS) {
+            state.busy = true;
+        }
+    }
+    return nullptr;
+}
+
+bool needsIdleTable(CommandType type) {
+    return type == CMD_PARAMS || type == CMD_TABLE_INDEX || type == CMD_TABLE_GOTO ||
+           type == CMD_TABLE_HOME;
+}
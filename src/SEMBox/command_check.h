@@ -0,0 +1,63 @@
+/*********
+  SEMBox ESP32 - Command Check
+  Preconditions of table commands, checked without side effects
+
+  A batch runs on the control task as one command and must either run
+  completely or be rejected before its first operation, so that an
+  output switched by operation 0 is never left behind by a move that
+  then fails. checkBatch() replays the batch on a copy of the table
+  state (TableState): parameter changes re-derive the indexing as
+  configureIndexing() does, and each move is checked against the state
+  the operations before it leave, with the same errors executeCommand()
+  would return. startIndexMove() uses checkIndexMove() itself, so the
+  check and the execution cannot disagree.
+  Plain C++, builds on a Linux host.
+*********/
+
+#ifndef COMMAND_CHECK_H
+#define COMMAND_CHECK_H
+
+#include <stdint.h>
+#include "command_queue.h"
+#include "index_math.h"
+
+struct TableState {
+    bool busy;                  // A move or homing owns the table
+    bool programRunning;
+    bool encoderFault;          // Following error: moves need homing first
+    bool homed;
+    int64_t position;           // Step position
+    int64_t index;              // Commanded absolute division index
+    int64_t origin;             // Step position of division index 0
+    uint32_t motorStepsPerRev;
+    IndexMath math;
+};
+
+/**
+ * At rest: take whole periods of the step pattern (IndexMath) off the
+ * index and the step position, so that both stay within one period
+ * however far the table turns one way. The step target of every index
+ * is unchanged. Returns the steps taken off the position (0 if none).
+ */
+int64_t rebaseTable(TableState& state);
+
+// Re-derive index and origin for a new division and ratio; false if invalid
+bool reindexTable(TableState& state, uint32_t division, uint32_t ratioMilli);
+
+/**
+ * Steps of a move by count divisions from the state; returns the error
+ * executeCommand() would report, or nullptr
+ */
+const char* checkIndexMove(const TableState& state, int64_t count, int64_t* steps);
+
+/**
+ * Check all operations of a batch in order against the state they will
+ * meet. Returns the first error and sets *failedOp, or nullptr if every
+ * operation will succeed.
+ */
+const char* checkBatch(const Command* ops, uint8_t count, TableState state, uint8_t* failedOp);
+
+// Commands that move the table or change its setup, and so need it idle
+bool needsIdleTable(CommandType type);
+
+#endif // COMMAND_CHECK_H
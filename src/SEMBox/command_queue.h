@@ -0,0 +1,115 @@
+/*********
+  SEMBox ESP32 - Command Queue
+  Lock-free single-producer/single-consumer ring of fixed-size records
+
+  Web request handlers (all running in the AsyncTCP task, the single
+  producer) validate a request, push a Command and return at once. The
+  control task (the single consumer) pops and executes them, so slow
+  actuator and NVS work never blocks network processing.
+
+  Head and tail are only ever written by one side each; one slot stays
+  empty to tell full from empty. Plain C++11, builds on a Linux host.
+*********/
+
+#ifndef COMMAND_QUEUE_H
+#define COMMAND_QUEUE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+#include "motion_profile.h"
+
+template <typename T, size_t Capacity>
+class SpscQueue {
+    static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+    SpscQueue() : _head(0), _tail(0) {}
+
+    // Producer side; false if full
+    bool push(const T& item) {
+        size_t head = _head.load(std::memory_order_relaxed);
+        size_t next = (head + 1) & (Capacity - 1);
+        if (next == _tail.load(std::memory_order_acquire)) {
+            return false;
+        }
+        _items[head] = item;
+        _head.store(next, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side; false if empty
+    bool pop(T& item) {
+        size_t tail = _tail.load(std::memory_order_relaxed);
+        if (tail == _head.load(std::memory_order_acquire)) {
+            return false;
+        }
+        item = _items[tail];
+        _tail.store((tail + 1) & (Capacity - 1), std::memory_order_release);
+        return true;
+    }
+
+    // Approximate when called concurrently
+    size_t size() const {
+        return (_head.load(std::memory_order_acquire) - _tail.load(std::memory_order_acquire)) & (Capacity - 1);
+    }
+    size_t capacity() const { return Capacity - 1; }
+
+private:
+    T _items[Capacity];
+    std::atomic<size_t> _head;      // Next slot to write (producer)
+    std::atomic<size_t> _tail;      // Next slot to read (consumer)
+};
+
+// ===========================================
+// Control Commands
+// ===========================================
+
+enum CommandType : uint8_t {
+    CMD_OUTPUTS,        // outputs.set/clear = IO channel masks
+    CMD_PARAMS,         // params
+    CMD_TABLE_INDEX,    // move.value = divisions to advance
+    CMD_TABLE_GOTO,     // move.value = target division
+    CMD_BATCH,          // batch.slot = CommandBatch holding the operations
+    CMD_TABLE_HOME,     // Run the homing sequence
+    CMD_PROGRAM_START   // Start the program staged in the program engine
+};
+
+struct Command {
+    uint32_t id;
+    CommandType type;
+    union {
+        struct {
+            uint16_t set;
+            uint16_t clear;
+        } outputs;
+        struct {
+            bool hasTable;
+            bool hasLimits;
+            bool hasFollowing;
+            int32_t division;
+            uint32_t ratioMilli;
+            MotionLimits limits;
+            uint32_t followingLimit;    // Encoder following error fault, steps
+        } params;
+        struct {
+            int32_t value;
+        } move;
+        struct {
+            uint8_t slot;
+        } batch;
+    };
+};
+
+// Ordered operations executed by the control task as one command. The
+// producer fills a free slot and sets inUse before queueing CMD_BATCH;
+// the consumer clears it once the operations have run.
+struct CommandBatch {
+    static const uint8_t MAX_OPS = 16;
+
+    std::atomic<bool> inUse;
+    uint8_t count;
+    Command ops[MAX_OPS];
+};
+
+#endif // COMMAND_QUEUE_H
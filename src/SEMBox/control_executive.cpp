@@ -0,0 +1,66 @@
+/*********
+  SEMBox ESP32 - Control Executive
+*********/
+
+#include "control_executive.h"
+
+ControlExecutive::ControlExecutive(ControlClock clock)
+    : _clock(clock), _jobCount(0), _ticks(0), _missedTicks(0) {
+}
+
+bool ControlExecutive::addJob(const char* name, ControlJobFunction function,
+                              uint16_t period, uint32_t budgetUs, uint16_t phase) {
+    if (_jobCount >= MAX_JOBS || period == 0 || function == nullptr) {
+        return false;
+    }
+
+    ControlJob& job = _jobs[_jobCount++];
+    job.name = name;
+    job.function = function;
+    job.period = period;
+    job.phase = phase % period;
+    job.budgetUs = budgetUs;
+    job.nextTick = _ticks - _ticks % period + job.phase;
+    if ((int32_t)(job.nextTick - _ticks) <= 0) {
+        job.nextTick += period;
+    }
+    job.runs = 0;
+    job.lastUs = 0;
+    job.maxUs = 0;
+    job.overruns = 0;
+    job.totalUs = 0;
+    return true;
+}
+
+void ControlExecutive::tick(uint32_t pendingTicks) {
+    if (pendingTicks > 1) {
+        _missedTicks += pendingTicks - 1;
+    }
+
+    // Late ticks are dropped, not replayed: a job due in any of them runs
+    // once on the current tick
+    _ticks += pendingTicks ? pendingTicks : 1;
+
+    for (uint8_t i = 0; i < _jobCount; i++) {
+        ControlJob& job = _jobs[i];
+        int32_t late = (int32_t)(_ticks - job.nextTick);
+        if (late < 0) {
+            continue;
+        }
+        job.nextTick += job.period * ((uint32_t)late / job.period + 1);
+
+        int64_t start = _clock();
+        job.function();
+        uint32_t elapsed = (uint32_t)(_clock() - start);
+
+        job.runs++;
+        job.lastUs = elapsed;
+        job.totalUs += elapsed;
+        if (elapsed > job.maxUs) {
+            job.maxUs = elapsed;
+        }
+        if (elapsed > job.budgetUs) {
+            job.overruns++;
+        }
+    }
+}
@@ -0,0 +1,70 @@
+/*********
+  SEMBox ESP32 - Control Executive
+  Fixed-rate cyclic scheduler for the control task
+
+  The control task is woken once per tick (1 kHz, see SEMBox.ino) and
+  calls tick(). Each registered job runs every `period` ticks, offset by
+  `phase` so that slow jobs do not share a tick. After a late wakeup a
+  job whose due tick was passed runs once, then keeps its phase; missed
+  runs are not replayed. Execution time of every
+  run is measured; a run longer than the job's budget counts as an
+  overrun, and ticks that were signalled while the previous one was
+  still running count as missed.
+
+  Statistics are written and read from the control task only.
+  Plain C++, the clock is injected so it also runs on a Linux host.
+*********/
+
+#ifndef CONTROL_EXECUTIVE_H
+#define CONTROL_EXECUTIVE_H
+
+#include <stdint.h>
+
+typedef void (*ControlJobFunction)();
+typedef int64_t (*ControlClock)();      // Microseconds, monotonic
+
+struct ControlJob {
+    const char* name;
+    ControlJobFunction function;
+    uint16_t period;            // Ticks between runs
+    uint16_t phase;             // Tick offset within the period
+    uint32_t budgetUs;          // Longer runs count as overruns
+    uint32_t nextTick;          // Next due tick
+
+    uint32_t runs;
+    uint32_t lastUs;
+    uint32_t maxUs;
+    uint32_t overruns;
+    uint64_t totalUs;
+};
+
+class ControlExecutive {
+public:
+    static const uint8_t MAX_JOBS = 8;
+
+    explicit ControlExecutive(ControlClock clock);
+
+    // Register a job; false if the table is full or period is 0
+    bool addJob(const char* name, ControlJobFunction function,
+                uint16_t period, uint32_t budgetUs, uint16_t phase = 0);
+
+    /**
+     * Run all jobs due on this tick.
+     * pendingTicks: ticks signalled since the last call (1 if on time)
+     */
+    void tick(uint32_t pendingTicks);
+
+    uint8_t jobCount() const { return _jobCount; }
+    const ControlJob& job(uint8_t index) const { return _jobs[index]; }
+    uint32_t ticks() const { return _ticks; }
+    uint32_t missedTicks() const { return _missedTicks; }
+
+private:
+    ControlClock _clock;
+    ControlJob _jobs[MAX_JOBS];
+    uint8_t _jobCount;
+    uint32_t _ticks;
+    uint32_t _missedTicks;
+};
+
+#endif // CONTROL_EXECUTIVE_H
@@ -0,0 +1,232 @@
+/*********
+  SEMBox ESP32 - Encoder Feedback
+*********/
+
+#include "encoder_feedback.h"
+#include <stdlib.h>
+#include <string.h>
+
+EncoderFeedback::EncoderFeedback()
+    : _unit(nullptr), _countsPerRev(1), _stepsPerRev(1), _sign(1),
+      _lastRaw(0), _counts(0), _offset(0), _actual(0), _error(0), _limit(0), _band(0),
+      _fault(false), _moving(false), _moveStart(0), _settling(false), _moveEnd(0), _inBand(0),
+      _head(0) {
+    memset(&_status, 0, sizeof(_status));
+    _status.settleUs = -1;
+    memset(_trace, 0, sizeof(_trace));
+}
+
+bool EncoderFeedback::begin(int pinA, int pinB, int32_t countsPerRev, int32_t stepsPerRev,
+                            bool reverse, uint32_t glitchNs) {
+    if (countsPerRev <= 0 || stepsPerRev <= 0) {
+        return false;
+    }
+    _countsPerRev = countsPerRev;
+    _stepsPerRev = stepsPerRev;
+    _sign = reverse ? -1 : 1;
+
+    pcnt_unit_config_t config = {};
+    config.low_limit = -COUNTER_LIMIT;
+    config.high_limit = COUNTER_LIMIT;
+    pcnt_unit_handle_t unit = nullptr;
+    if (pcnt_new_unit(&config, &unit) != ESP_OK) {
+        return false;
+    }
+
+    pcnt_glitch_filter_config_t filter = {};
+    filter.max_glitch_ns = glitchNs;
+    if (glitchNs > 0 && pcnt_unit_set_glitch_filter(unit, &filter) != ESP_OK) {
+        pcnt_del_unit(unit);
+        return false;
+    }
+
+    // Both edges of both signals, direction from the other signal's level
+    pcnt_chan_config_t configA = {};
+    configA.edge_gpio_num = pinA;
+    configA.level_gpio_num = pinB;
+    pcnt_chan_config_t configB = {};
+    configB.edge_gpio_num = pinB;
+    configB.level_gpio_num = pinA;
+    pcnt_channel_handle_t channelA = nullptr;
+    pcnt_channel_handle_t channelB = nullptr;
+    bool ok = pcnt_new_channel(unit, &configA, &channelA) == ESP_OK
+        && pcnt_new_channel(unit, &configB, &channelB) == ESP_OK
+        && pcnt_channel_set_edge_action(channelA, PCNT_CHANNEL_EDGE_ACTION_DECREASE,
+                                        PCNT_CHANNEL_EDGE_ACTION_INCREASE) == ESP_OK
+        && pcnt_channel_set_level_action(channelA, PCNT_CHANNEL_LEVEL_ACTION_KEEP,
+                                         PCNT_CHANNEL_LEVEL_ACTION_INVERSE) == ESP_OK
+        && pcnt_channel_set_edge_action(channelB, PCNT_CHANNEL_EDGE_ACTION_INCREASE,
+                                        PCNT_CHANNEL_EDGE_ACTION_DECREASE) == ESP_OK
+        && pcnt_channel_set_level_action(channelB, PCNT_CHANNEL_LEVEL_ACTION_KEEP,
+                                         PCNT_CHANNEL_LEVEL_ACTION_INVERSE) == ESP_OK
+        && pcnt_unit_enable(unit) == ESP_OK
+        && pcnt_unit_clear_count(unit) == ESP_OK
+        && pcnt_unit_start(unit) == ESP_OK;
+    if (!ok) {
+        if (channelA) {
+            pcnt_del_channel(channelA);
+        }
+        if (channelB) {
+            pcnt_del_channel(channelB);
+        }
+        pcnt_del_unit(unit);
+        return false;
+    }
+
+    _lastRaw = 0;
+    _counts = 0;
+    _unit = unit;
+    return true;
+}
+
+bool EncoderFeedback::sample(int64_t now, int32_t commanded, bool moving) {
+    if (!_unit) {
+        return false;
+    }
+
+    int raw = 0;
+    if (pcnt_unit_get_count(_unit, &raw) == ESP_OK) {
+        // The counter wraps to 0 at +-limit, so changes are modulo the limit
+        int delta = raw - _lastRaw;
+        if (delta > COUNTER_LIMIT / 2) {
+            delta -= COUNTER_LIMIT;
+        } else if (delta < -COUNTER_LIMIT / 2) {
+            delta += COUNTER_LIMIT;
+        }
+        _lastRaw = raw;
+        _counts += _sign * delta;
+    }
+
+    int32_t actual = toSteps(_counts) + _offset;
+    int32_t error = commanded - actual;
+    int32_t magnitude = abs(error);
+    _actual = actual;
+    _error = error;
+
+    bool tripped = _limit != 0 && magnitude > (int32_t)_limit && !_fault;
+    if (tripped) {
+        _fault = true;
+    }
+
+    uint32_t head = _head.load(std::memory_order_relaxed);
+    EncoderSample& slot = _trace[head & (TRACE_SIZE - 1)];
+    slot.time = now;
+    slot.commanded = commanded;
+    slot.actual = actual;
+    _head.store(head + 1, std::memory_order_release);
+
+    std::lock_guard<std::mutex> guard(_statusLock);
+    if (moving && !_moving) {
+        _moveStart = commanded;
+        _settling = false;
+        _status.movePeakError = 0;
+        _status.overshoot = 0;
+        _status.settleUs = -1;
+    }
+    if (!moving && _moving) {
+        _moveEnd = now;
+        _settling = true;
+        _inBand = 0;
+        _status.moves++;
+    }
+    _moving = moving;
+
+    if (moving && magnitude > _status.movePeakError) {
+        _status.movePeakError = magnitude;
+    }
+    if (_settling) {
+        // Overshoot counts in the direction of the move only
+        int32_t past = commanded >= _moveStart ? actual - commanded : commanded - actual;
+        if (past > _status.overshoot) {
+            _status.overshoot = past;
+        }
+        if (magnitude <= (int32_t)_band) {
+            if (++_inBand == 1) {
+                _status.settleUs = now - _moveEnd;
+            }
+            if (_inBand >= SETTLE_SAMPLES) {
+                _settling = false;
+            }
+        } else {
+            _inBand = 0;
+            _status.settleUs = -1;
+        }
+    }
+
+    _status.counts = _counts;
+    _status.actual = actual;
+    _status.error = error;
+    if (magnitude > _status.peakError) {
+        _status.peakError = magnitude;
+    }
+    _status.fault = _fault;
+    return tripped;
+}
+
+void EncoderFeedback::align(int32_t steps) {
+    _offset = steps - toSteps(_counts);
+    _actual = steps;
+}
+
+void EncoderFeedback::rebase(int64_t shift) {
+    // Whole motor revolutions of counts are a whole number of steps
+    _counts %= _countsPerRev;
+    _actual = (int32_t)(_actual - shift);
+    _offset = _actual - toSteps(_counts);
+}
+
+void EncoderFeedback::clearFault() {
+    std::lock_guard<std::mutex> guard(_statusLock);
+    _fault = false;
+    _status.fault = false;
+    _status.peakError = 0;
+}
+
+EncoderStatus EncoderFeedback::status() {
+    std::lock_guard<std::mutex> guard(_statusLock);
+    EncoderStatus status = _status;
+    if (_settling) {
+        status.settleUs = -1;
+    }
+    return status;
+}
+
+uint16_t EncoderFeedback::trace(uint32_t from, EncoderSample* samples, uint16_t maxSamples, uint32_t* first) {
+    // The slot the writer fills next is never handed out
+    uint32_t head = _head.load(std::memory_order_acquire);
+    uint32_t oldest = head >= TRACE_SIZE ? head - TRACE_SIZE + 1 : 0;
+    uint32_t start = from > oldest ? from : oldest;
+    if (start > head) {
+        start = head;
+    }
+    uint32_t count = head - start;
+    if (count > maxSamples) {
+        count = maxSamples;
+    }
+
+    for (uint32_t i = 0; i < count; i++) {
+        samples[i] = _trace[(start + i) & (TRACE_SIZE - 1)];
+    }
+
+    // Drop copies the writer may have overwritten meanwhile
+    uint32_t now = _head.load(std::memory_order_acquire);
+    uint32_t valid = now >= TRACE_SIZE ? now - TRACE_SIZE + 1 : 0;
+    uint32_t drop = valid > start ? valid - start : 0;
+    if (drop >= count) {
+        *first = start + count;
+        return 0;
+    }
+    if (drop > 0) {
+        memmove(samples, samples + drop, (count - drop) * sizeof(EncoderSample));
+    }
+    *first = start + drop;
+    return count - drop;
+}
+
+int32_t EncoderFeedback::toSteps(int64_t counts) const {
+    // Rounded to the nearest step
+    int64_t scaled = counts * _stepsPerRev;
+    int64_t half = _countsPerRev / 2;
+    int64_t steps = scaled >= 0 ? (scaled + half) / _countsPerRev : -((-scaled + half) / _countsPerRev);
+    return (int32_t)steps;
+}
@@ -0,0 +1,132 @@
+/*********
+  SEMBox ESP32 - Encoder Feedback
+  Quadrature encoder on the PCNT peripheral, following error and trace
+
+  The PCNT unit counts all four edges of the A/B signals in hardware
+  (with its glitch filter), so the CPU does no work per encoder edge.
+  The hardware counter is 16 bits and resets to 0 at its limits;
+  sample() reads it at a fixed rate and extends it to 64 bits from the
+  change since the previous read. That is exact as long as the encoder
+  moves less than half the counter range between two samples (16383
+  counts per control tick).
+
+  Every sample converts the count to motor steps, compares it with the
+  commanded step position and stores both in a trace ring. A following
+  error beyond the limit latches a fault. After each move the samples
+  also give the overshoot past the target and the time until the table
+  settled inside the in-position band.
+*********/
+
+#ifndef ENCODER_FEEDBACK_H
+#define ENCODER_FEEDBACK_H
+
+#include <stdint.h>
+#include <atomic>
+#include <mutex>
+#include "driver/pulse_cnt.h"
+
+struct EncoderSample {
+    int64_t time;               // esp_timer microseconds
+    int32_t commanded;          // Step position issued to the driver
+    int32_t actual;             // Step position measured by the encoder
+};
+
+struct EncoderStatus {
+    int64_t counts;             // Extended encoder count
+    int32_t actual;             // In steps
+    int32_t error;              // Commanded - actual, steps
+    int32_t peakError;          // Largest |error| since the fault was cleared
+    bool fault;                 // Following error exceeded the limit
+    uint32_t moves;             // Moves completed
+    int32_t movePeakError;      // Largest |error| during the last move
+    int32_t overshoot;          // Travel past the target after the last move
+    int64_t settleUs;           // Move end to in position, -1 while settling
+};
+
+class EncoderFeedback {
+public:
+    static const uint16_t TRACE_SIZE = 1024;        // Power of two, 1 s at 1 kHz
+    static const int COUNTER_LIMIT = 32767;         // PCNT counter resets at +-limit
+    static const uint8_t SETTLE_SAMPLES = 10;       // In band this long = settled
+
+    EncoderFeedback();
+
+    /**
+     * Count the A/B signals in 4x quadrature. countsPerRev and stepsPerRev
+     * scale counts to steps (both per motor revolution); reverse swaps the
+     * counting direction. Pulses shorter than glitchNs are ignored.
+     */
+    bool begin(int pinA, int pinB, int32_t countsPerRev, int32_t stepsPerRev,
+               bool reverse, uint32_t glitchNs);
+    bool ready() const { return _unit != nullptr; }
+
+    /**
+     * Read the counter and record a sample (control task, fixed rate).
+     * Returns true when this sample tripped the following error fault.
+     */
+    bool sample(int64_t now, int32_t commanded, bool moving);
+
+    // Make the current encoder reading equal a step position (control task)
+    void align(int32_t steps);
+
+    // Follow a step position moved by -shift (rebaseTable), keeping the error
+    void rebase(int64_t shift);
+
+    // Fault threshold in steps, 0 = no monitoring
+    void setLimit(uint32_t steps) { _limit = steps; }
+    uint32_t limit() const { return _limit; }
+
+    // Tolerance for "in position" after a move, steps
+    void setInPositionBand(uint32_t steps) { _band = steps; }
+    uint32_t inPositionBand() const { return _band; }
+
+    bool fault() const { return _fault; }
+    void clearFault();
+
+    int32_t actual() const { return _actual; }
+    int32_t error() const { return _error; }
+    EncoderStatus status();
+
+    /**
+     * Copy samples from sequence number from (or the oldest kept) onward,
+     * oldest first. Returns the number copied; first receives the sequence
+     * number of the first one. Any task; samples overwritten while copying
+     * are dropped.
+     */
+    uint16_t trace(uint32_t from, EncoderSample* samples, uint16_t maxSamples, uint32_t* first);
+
+    // Sequence number the next sample will get
+    uint32_t sequence() const { return _head.load(std::memory_order_acquire); }
+
+private:
+    int32_t toSteps(int64_t counts) const;
+
+    pcnt_unit_handle_t _unit;
+    int32_t _countsPerRev;
+    int32_t _stepsPerRev;
+    int8_t _sign;
+
+    // Control task state
+    int _lastRaw;
+    int64_t _counts;
+    int32_t _offset;            // Step position at count 0
+    volatile int32_t _actual;
+    volatile int32_t _error;
+    volatile uint32_t _limit;
+    volatile uint32_t _band;
+    volatile bool _fault;
+    bool _moving;
+    int32_t _moveStart;
+    bool _settling;
+    int64_t _moveEnd;
+    uint8_t _inBand;
+
+    // Copy for status readers
+    std::mutex _statusLock;
+    EncoderStatus _status;
+
+    EncoderSample _trace[TRACE_SIZE];
+    std::atomic<uint32_t> _head;    // Samples written
+};
+
+#endif // ENCODER_FEEDBACK_H
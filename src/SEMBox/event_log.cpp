@@ -0,0 +1,372 @@
+/*********
+  SEMBox ESP32 - Event Log
+*********/
+
+#include "event_log.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include "esp_timer.h"
+
+static const char* LOG_DIR = "/log";
+
+static_assert(sizeof(LogRecord) == 24, "LogRecord is a storage format");
+static_assert(sizeof(LogHeader) == 24, "LogHeader is a wire format");
+
+EventLog::EventLog()
+    : _fs(nullptr), _segmentCount(0), _sealed(false), _nextSequence(0),
+      _clockBase(0), _lastTime(0), _queued(0), _dropped(0) {
+    memset(_segments, 0, sizeof(_segments));
+}
+
+bool EventLog::begin(fs::FS& fs) {
+    if (!fs.exists(LOG_DIR) && !fs.mkdir(LOG_DIR)) {
+        return false;
+    }
+
+    // Segment numbers from the directory, sorted oldest first
+    Segment found[MAX_SEGMENTS + 4];
+    size_t sizes[MAX_SEGMENTS + 4];
+    uint8_t count = 0;
+    bool torn = false;
+    fs::File dir = fs.open(LOG_DIR);
+    for (fs::File file = dir.openNextFile(); file; file = dir.openNextFile()) {
+        const char* name = strrchr(file.name(), '/');
+        name = name ? name + 1 : file.name();
+        char* end = nullptr;
+        unsigned long number = strtoul(name, &end, 10);
+        if (end == name || strcmp(end, ".seg") != 0 || count == sizeof(found) / sizeof(found[0])) {
+            continue;
+        }
+        uint8_t i = count++;
+        while (i > 0 && found[i - 1].number > number) {
+            found[i] = found[i - 1];
+            sizes[i] = sizes[i - 1];
+            i--;
+        }
+        found[i].number = number;
+        found[i].count = file.size() / sizeof(LogRecord);
+        sizes[i] = file.size();
+    }
+    dir.close();
+
+    _fs = &fs;
+    _segmentCount = 0;
+    char path[24];
+    for (uint8_t i = 0; i < count; i++) {
+        LogRecord first;
+        LogRecord last;
+        bool excess = count - i > MAX_SEGMENTS;
+        bool empty = found[i].count == 0;
+        if (excess || empty || !readRecord(found[i].number, 0, &first) ||
+            !readRecord(found[i].number, found[i].count - 1, &last)) {
+            segmentPath(found[i].number, path);
+            fs.remove(path);
+            continue;
+        }
+        torn = sizes[i] % sizeof(LogRecord) != 0;
+        found[i].first = first.time;
+        found[i].last = last.time;
+        _segments[_segmentCount++] = found[i];
+        _nextSequence = last.sequence + 1;
+        _lastTime = last.time;
+    }
+
+    // A record torn by a power loss ends the newest segment
+    _sealed = torn;
+    _clockBase = _lastTime + 1 - esp_timer_get_time() / 1000;
+    return true;
+}
+
+bool EventLog::log(LogType type, uint16_t a, uint32_t b, uint32_t c) {
+    std::lock_guard<std::mutex> guard(_lock);
+    if (_queued == QUEUE_SIZE) {
+        _dropped++;
+        return false;
+    }
+    LogRecord& record = _queue[_queued++];
+    record.time = clock();
+    record.sequence = _nextSequence++;
+    record.type = type;
+    record.a = a;
+    record.b = b;
+    record.c = c;
+    return true;
+}
+
+void EventLog::service() {
+    LogRecord records[QUEUE_SIZE];
+    uint8_t count;
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        count = _queued;
+        memcpy(records, _queue, count * sizeof(LogRecord));
+        _queued = 0;
+    }
+    if (count == 0 || !_fs) {
+        return;
+    }
+    if (!append(records, count)) {
+        std::lock_guard<std::mutex> guard(_lock);
+        _dropped += count;
+    }
+}
+
+int64_t EventLog::now() {
+    std::lock_guard<std::mutex> guard(_lock);
+    return clock();
+}
+
+/**
+ * Next log clock value (lock held). Unix time once the system time was
+ * set, otherwise continued from the last record; never below the last.
+ */
+int64_t EventLog::clock() {
+    struct timeval tv;
+    gettimeofday(&tv, nullptr);
+    int64_t time = (int64_t)tv.tv_sec * 1000 + tv.tv_usec / 1000;
+    if (time < VALID_UNIX_MS) {
+        time = _clockBase + esp_timer_get_time() / 1000;
+    }
+    if (time < _lastTime) {
+        time = _lastTime;
+    }
+    _lastTime = time;
+    return time;
+}
+
+EventLogStats EventLog::stats() {
+    std::lock_guard<std::mutex> guard(_lock);
+    EventLogStats stats = {};
+    stats.segments = _segmentCount;
+    for (uint8_t i = 0; i < _segmentCount; i++) {
+        stats.records += _segments[i].count;
+    }
+    stats.pending = _queued;
+    stats.dropped = _dropped;
+    for (uint8_t i = 0; i < _segmentCount; i++) {
+        if (_segments[i].count > 0) {
+            stats.first = stats.first ? stats.first : _segments[i].first;
+            stats.last = _segments[i].last;
+        }
+    }
+    return stats;
+}
+
+bool EventLog::append(const LogRecord* records, uint8_t count) {
+    char path[24];
+    while (count > 0) {
+        if (_segmentCount == 0 || _sealed || _segments[_segmentCount - 1].count >= SEGMENT_RECORDS) {
+            if (!startSegment()) {
+                return false;
+            }
+        }
+
+        // Only this task changes the newest segment
+        Segment& segment = _segments[_segmentCount - 1];
+        uint32_t room = SEGMENT_RECORDS - segment.count;
+        uint8_t chunk = count < room ? count : room;
+        segmentPath(segment.number, path);
+        fs::File file = _fs->open(path, FILE_APPEND);
+        if (!file) {
+            return false;
+        }
+        size_t bytes = chunk * sizeof(LogRecord);
+        bool written = file.write((const uint8_t*)records, bytes) == bytes;
+        file.close();
+        if (!written) {
+            // The segment may now end in a partial record
+            _sealed = true;
+            return false;
+        }
+
+        std::lock_guard<std::mutex> guard(_lock);
+        if (segment.count == 0) {
+            segment.first = records[0].time;
+        }
+        segment.count += chunk;
+        segment.last = records[chunk - 1].time;
+        records += chunk;
+        count -= chunk;
+    }
+    return true;
+}
+
+/**
+ * Create the next segment file, deleting the oldest one beyond
+ * MAX_SEGMENTS
+ */
+bool EventLog::startSegment() {
+    char path[24];
+    uint32_t number = _segmentCount > 0 ? _segments[_segmentCount - 1].number + 1 : 1;
+
+    if (_segmentCount == MAX_SEGMENTS) {
+        uint32_t oldest;
+        {
+            std::lock_guard<std::mutex> guard(_lock);
+            oldest = _segments[0].number;
+            memmove(_segments, _segments + 1, (MAX_SEGMENTS - 1) * sizeof(Segment));
+            _segmentCount--;
+        }
+        segmentPath(oldest, path);
+        _fs->remove(path);
+    }
+
+    segmentPath(number, path);
+    fs::File file = _fs->open(path, FILE_WRITE);
+    if (!file) {
+        return false;
+    }
+    file.close();
+
+    std::lock_guard<std::mutex> guard(_lock);
+    Segment& segment = _segments[_segmentCount++];
+    segment.number = number;
+    segment.count = 0;
+    segment.first = 0;
+    segment.last = 0;
+    _sealed = false;
+    return true;
+}
+
+void EventLog::segmentPath(uint32_t number, char* path) {
+    snprintf(path, 24, "%s/%08lu.seg", LOG_DIR, (unsigned long)number);
+}
+
+bool EventLog::readRecord(uint32_t number, uint32_t index, LogRecord* record) {
+    char path[24];
+    segmentPath(number, path);
+    fs::File file = _fs->open(path, FILE_READ);
+    return file && file.seek(index * sizeof(LogRecord))
+        && file.read((uint8_t*)record, sizeof(LogRecord)) == sizeof(LogRecord);
+}
+
+// ===========================================
+// Log Reader
+// ===========================================
+
+LogReader::LogReader(EventLog& log, int64_t from, int64_t to)
+    : _log(log), _from(from), _to(to), _segment(0), _index(0), _done(false),
+      _recordCount(0), _recordNext(0), _pendingOffset(0) {
+    {
+        // Segments are immutable up to the count seen here
+        std::lock_guard<std::mutex> guard(log._lock);
+        _segmentCount = log._segmentCount;
+        memcpy(_segments, log._segments, _segmentCount * sizeof(EventLog::Segment));
+    }
+
+    // The directory skips every segment that ends before the range
+    while (_segment < _segmentCount && _segments[_segment].last < from) {
+        _segment++;
+    }
+
+    memset(&_pending, 0, sizeof(_pending));
+    _pending.header.magic = EventLog::MAGIC;
+    _pending.header.version = EventLog::VERSION;
+    _pending.header.recordSize = sizeof(LogRecord);
+    _pending.header.from = from;
+    _pending.header.to = to;
+    _pendingLength = sizeof(LogHeader);
+}
+
+size_t LogReader::read(uint8_t* buffer, size_t maxLength) {
+    size_t written = 0;
+    while (written < maxLength) {
+        if (_pendingOffset == _pendingLength) {
+            if (!next()) {
+                break;
+            }
+        }
+        size_t chunk = _pendingLength - _pendingOffset;
+        if (chunk > maxLength - written) {
+            chunk = maxLength - written;
+        }
+        memcpy(buffer + written, (const uint8_t*)&_pending + _pendingOffset, chunk);
+        _pendingOffset += chunk;
+        written += chunk;
+    }
+    return written;
+}
+
+bool LogReader::next() {
+    while (!_done) {
+        if (_recordNext < _recordCount) {
+            const LogRecord& record = _records[_recordNext++];
+            if (record.time > _to) {
+                break;
+            }
+            _pending.record = record;
+            _pendingLength = sizeof(LogRecord);
+            _pendingOffset = 0;
+            return true;
+        }
+
+        if (!_file && !openSegment()) {
+            break;
+        }
+
+        // Read ahead a few records of the current segment
+        uint32_t left = _segments[_segment].count - _index;
+        uint8_t count = left < sizeof(_records) / sizeof(_records[0]) ? left : sizeof(_records) / sizeof(_records[0]);
+        size_t bytes = count * sizeof(LogRecord);
+        if (count == 0 || _file.read((uint8_t*)_records, bytes) != bytes) {
+            _file.close();
+            _segment++;
+            continue;
+        }
+        _index += count;
+        _recordCount = count;
+        _recordNext = 0;
+    }
+    _done = true;
+    _file.close();
+    return false;
+}
+
+/**
+ * Open the next segment that still exists, positioned at its first
+ * record inside the range
+ */
+bool LogReader::openSegment() {
+    char path[24];
+    for (; _segment < _segmentCount; _segment++) {
+        if (_segments[_segment].first > _to) {
+            return false;
+        }
+        EventLog::segmentPath(_segments[_segment].number, path);
+        _file = _log._fs->open(path, FILE_READ);
+        if (!_file) {
+            continue;   // Rotated away meanwhile
+        }
+        _index = lowerBound(_segments[_segment].count);
+        if (_file.seek(_index * sizeof(LogRecord))) {
+            return true;
+        }
+        _file.close();
+    }
+    return false;
+}
+
+/**
+ * First record of the open segment with time >= from: a binary search
+ * over the time-sorted, fixed-size records, reading only their times
+ */
+uint32_t LogReader::lowerBound(uint32_t count) {
+    uint32_t low = 0;
+    uint32_t high = count;
+    while (low < high) {
+        uint32_t middle = low + (high - low) / 2;
+        int64_t time = 0;
+        if (!_file.seek(middle * sizeof(LogRecord)) ||
+            _file.read((uint8_t*)&time, sizeof(time)) != sizeof(time)) {
+            return count;
+        }
+        if (time < _from) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return low;
+}
@@ -0,0 +1,164 @@
+/*********
+  SEMBox ESP32 - Event Log
+  Persistent, append-only event history on LittleFS
+
+  Events that must survive a reboot (boots, parameter changes, cycle
+  counts, program results, faults) are 24-byte records appended to
+  segment files /log/<number>.seg. A segment holds SEGMENT_RECORDS
+  records; then the next one is started, and beyond MAX_SEGMENTS the
+  oldest is deleted, so the log keeps a fixed amount of history.
+
+  Record times come from the log clock: Unix milliseconds once the
+  system time has been set, otherwise the last logged time plus the
+  uptime. It never runs backwards, so records are sorted by time both
+  within and across segments. This ordering is the time index. A RAM
+  directory holds the first and last time of every segment. Together
+  with the fixed record size, a range query goes straight to the first
+  matching segment, binary searches it for the start record, and then
+  reads sequentially until the end of the range.
+
+  log() may be called from any task and only queues the record;
+  service() writes the queue from loop(), since flash writes may block.
+  LogReader streams a query result a piece at a time for a chunked
+  response.
+*********/
+
+#ifndef EVENT_LOG_H
+#define EVENT_LOG_H
+
+#include <FS.h>
+#include <stdint.h>
+#include <mutex>
+
+enum LogType : uint16_t {
+    LOG_BOOT = 1,           // a: reset reason, b: firmware sketch size
+    LOG_PARAMS,             // a: division, b: ratio (1/1000), c: max velocity
+    LOG_CYCLES,             // b: index moves completed since boot, c: since the last record
+    LOG_PROGRAM,            // a: ProgramState, b: steps executed
+    LOG_HOMED,              // a: division count
+    LOG_FAULT               // a: TraceFault code (trace_ring.h), b/c: details
+};
+
+// Stored and streamed layout (little endian)
+struct LogRecord {
+    int64_t time;           // Log clock, ms
+    uint32_t sequence;      // Continues across reboots
+    uint16_t type;
+    uint16_t a;
+    uint32_t b;
+    uint32_t c;
+};
+
+// Start of a /log download
+struct LogHeader {
+    uint32_t magic;         // "SBLG"
+    uint16_t version;
+    uint16_t recordSize;
+    int64_t from;           // Query range, ms
+    int64_t to;
+};
+
+struct EventLogStats {
+    uint8_t segments;
+    uint32_t records;       // Records on flash
+    uint32_t pending;       // Queued, not yet written
+    uint32_t dropped;       // Lost to a full queue or a failed write
+    int64_t first;          // Time of the oldest record, 0 if empty
+    int64_t last;
+};
+
+class EventLog {
+public:
+    static const uint32_t MAGIC = 0x474C4253;
+    static const uint16_t VERSION = 1;
+    static const uint16_t SEGMENT_RECORDS = 2048;   // 48 KB per segment
+    static const uint8_t MAX_SEGMENTS = 16;         // 768 KB of history
+    static const uint8_t QUEUE_SIZE = 32;
+    static const int64_t VALID_UNIX_MS = 1672531200000LL;   // 2023-01-01
+
+    EventLog();
+
+    // Load the segment directory from the mounted file system
+    bool begin(fs::FS& fs);
+    bool ready() const { return _fs != nullptr; }
+
+    // Queue a record (any task); false if the queue is full
+    bool log(LogType type, uint16_t a = 0, uint32_t b = 0, uint32_t c = 0);
+
+    // Write queued records (loop only)
+    void service();
+
+    // Current log clock, ms
+    int64_t now();
+
+    EventLogStats stats();
+
+private:
+    friend class LogReader;
+
+    struct Segment {
+        uint32_t number;
+        uint32_t count;
+        int64_t first;
+        int64_t last;
+    };
+
+    bool append(const LogRecord* records, uint8_t count);
+    bool startSegment();
+    int64_t clock();
+    static void segmentPath(uint32_t number, char* path);
+    bool readRecord(uint32_t number, uint32_t index, LogRecord* record);
+
+    fs::FS* _fs;
+    std::mutex _lock;           // Directory, queue and clock
+
+    Segment _segments[MAX_SEGMENTS];
+    uint8_t _segmentCount;      // Oldest first
+    bool _sealed;               // Newest segment ends in a torn record
+    uint32_t _nextSequence;
+    int64_t _clockBase;         // Log clock at boot when the system time is unset
+    int64_t _lastTime;
+
+    LogRecord _queue[QUEUE_SIZE];
+    uint8_t _queued;
+    uint32_t _dropped;
+};
+
+/**
+ * Resumable /log exporter: read() fills the buffer with the next part of
+ * the header and the records with from <= time <= to, oldest first, and
+ * returns 0 once all were written. Segments rotated away meanwhile are
+ * skipped.
+ */
+class LogReader {
+public:
+    LogReader(EventLog& log, int64_t from, int64_t to);
+
+    size_t read(uint8_t* buffer, size_t maxLength);
+
+private:
+    bool next();
+    bool openSegment();
+    uint32_t lowerBound(uint32_t count);
+
+    EventLog& _log;
+    int64_t _from;
+    int64_t _to;
+    EventLog::Segment _segments[EventLog::MAX_SEGMENTS];
+    uint8_t _segmentCount;
+    uint8_t _segment;           // Current entry of _segments
+    uint32_t _index;            // Next record in it
+    bool _done;
+    fs::File _file;
+    LogRecord _records[8];      // Read-ahead
+    uint8_t _recordCount;
+    uint8_t _recordNext;
+    union {
+        LogHeader header;
+        LogRecord record;
+    } _pending;
+    size_t _pendingLength;
+    size_t _pendingOffset;
+};
+
+#endif // EVENT_LOG_H
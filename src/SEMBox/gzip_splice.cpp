@@ -0,0 +1,67 @@
+/*********
+  SEMBox ESP32 - Gzip Splice
+*********/
+
+#include "gzip_splice.h"
+#include <string.h>
+#include "esp_rom_crc.h"
+
+static void putLe16(uint8_t* out, uint16_t value) {
+    out[0] = value & 0xFF;
+    out[1] = value >> 8;
+}
+
+static void putLe32(uint8_t* out, uint32_t value) {
+    for (uint8_t i = 0; i < 4; i++) {
+        out[i] = (value >> (8 * i)) & 0xFF;
+    }
+}
+
+GzipSplice::GzipSplice() : _head(nullptr), _headLength(0), _restLength(0), _offset(0) {
+}
+
+bool GzipSplice::begin(const uint8_t* head, size_t headLength, uint32_t headCrc, uint32_t headRawLength,
+                       const SpliceText* parts, uint8_t count) {
+    size_t total = 0;
+    for (uint8_t i = 0; i < count; i++) {
+        total += parts[i].length;
+    }
+    if (total > MAX_TEXT) {
+        return false;
+    }
+    uint16_t rawLength = total;
+    uint8_t* raw = _rest + BLOCK_HEADER;
+    size_t offset = 0;
+    for (uint8_t i = 0; i < count; i++) {
+        memcpy(raw + offset, parts[i].data, parts[i].length);
+        offset += parts[i].length;
+    }
+
+    // Final stored block; the head ends on a byte boundary
+    _rest[0] = 0x01;
+    putLe16(_rest + 1, rawLength);
+    putLe16(_rest + 3, ~rawLength);
+
+    uint8_t* trailer = raw + rawLength;
+    putLe32(trailer, esp_rom_crc32_le(headCrc, raw, rawLength));
+    putLe32(trailer + 4, headRawLength + rawLength);
+
+    _head = head;
+    _headLength = headLength;
+    _restLength = BLOCK_HEADER + rawLength + TRAILER;
+    _offset = 0;
+    return true;
+}
+
+size_t GzipSplice::read(uint8_t* buffer, size_t maxLength) {
+    size_t written = 0;
+    while (written < maxLength && _offset < length()) {
+        const uint8_t* source = _offset < _headLength ? _head + _offset : _rest + (_offset - _headLength);
+        size_t available = _offset < _headLength ? _headLength - _offset : length() - _offset;
+        size_t chunk = available < maxLength - written ? available : maxLength - written;
+        memcpy(buffer + written, source, chunk);
+        written += chunk;
+        _offset += chunk;
+    }
+    return written;
+}
@@ -0,0 +1,56 @@
+/*********
+  SEMBox ESP32 - Gzip Splice
+  A precompressed page completed with run-time text, without recompressing
+
+  The build cuts the gzip stream of a page after a byte-aligned, non-final
+  deflate block (web_assets.h, WebBootstrap). begin() copies the run-time
+  texts and the page parts between and behind them, in order, as one
+  final stored deflate block,
+  followed by the gzip trailer: the CRC-32 of the whole page, continued
+  from the head's CRC computed at build time, and its length. The result
+  is one valid gzip stream that read() hands out a piece at a time, so
+  it can be sent as a chunked response. The parts are copied, so their
+  sources may change while the page is sent.
+  Plain C++, builds on a Linux host.
+*********/
+
+#ifndef GZIP_SPLICE_H
+#define GZIP_SPLICE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// One piece of the text appended to the head
+struct SpliceText {
+    const char* data;
+    size_t length;
+};
+
+class GzipSplice {
+public:
+    static const size_t MAX_TEXT = 3072;    // All parts together
+
+    GzipSplice();
+
+    // False if the parts together do not fit MAX_TEXT
+    bool begin(const uint8_t* head, size_t headLength, uint32_t headCrc, uint32_t headRawLength,
+               const SpliceText* parts, uint8_t count);
+
+    // Length of the complete gzip stream
+    size_t length() const { return _headLength + _restLength; }
+
+    // Next part of the stream; 0 at the end
+    size_t read(uint8_t* buffer, size_t maxLength);
+
+private:
+    static const size_t BLOCK_HEADER = 5;   // BFINAL/BTYPE byte, LEN, NLEN
+    static const size_t TRAILER = 8;        // CRC-32, ISIZE
+
+    const uint8_t* _head;
+    size_t _headLength;
+    uint8_t _rest[BLOCK_HEADER + MAX_TEXT + TRAILER];
+    size_t _restLength;
+    size_t _offset;
+};
+
+#endif // GZIP_SPLICE_H
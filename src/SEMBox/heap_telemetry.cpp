@@ -0,0 +1,119 @@
+/*********
+  SEMBox ESP32 - Heap Telemetry
+*********/
+
+#include "heap_telemetry.h"
+#include <string.h>
+#include <atomic>
+#include "esp_heap_caps.h"
+#include "sdkconfig.h"
+
+// Keep the allocation hook in IRAM on the ESP32, no-op elsewhere
+#ifndef IRAM_ATTR
+#define IRAM_ATTR
+#endif
+
+static std::atomic<uint32_t> failedCount{0};
+static std::atomic<uint32_t> failedSize{0};
+
+#if CONFIG_HEAP_USE_HOOKS
+// Per task (thread-local storage): only the task itself touches it
+static thread_local uint32_t allocCount = 0;
+
+// ESP-IDF heap hooks, called on every allocation and free
+extern "C" void IRAM_ATTR esp_heap_trace_alloc_hook(void* ptr, size_t size, uint32_t caps) {
+    allocCount++;
+}
+
+extern "C" void IRAM_ATTR esp_heap_trace_free_hook(void* ptr) {
+}
+#endif
+
+static void onAllocFailed(size_t size, uint32_t caps, const char* functionName) {
+    failedCount.fetch_add(1, std::memory_order_relaxed);
+    failedSize.store(size, std::memory_order_relaxed);
+}
+
+HeapTelemetry::HeapTelemetry() : _head(0), _count(0) {
+    memset(_history, 0, sizeof(_history));
+}
+
+void HeapTelemetry::begin() {
+    heap_caps_register_failed_alloc_callback(onAllocFailed);
+}
+
+void HeapTelemetry::sample(uint32_t uptimeSeconds) {
+    HeapSample sample;
+    sample.uptime = uptimeSeconds;
+    readRegion(MALLOC_CAP_INTERNAL, sample.internal);
+    readRegion(MALLOC_CAP_SPIRAM, sample.spiram);
+
+    std::lock_guard<std::mutex> guard(_lock);
+    _history[_head] = sample;
+    _head = (_head + 1) % HISTORY;
+    if (_count < HISTORY) {
+        _count++;
+    }
+}
+
+HeapSample HeapTelemetry::latest() {
+    std::lock_guard<std::mutex> guard(_lock);
+    if (_count == 0) {
+        HeapSample empty;
+        memset(&empty, 0, sizeof(empty));
+        return empty;
+    }
+    return _history[(_head + HISTORY - 1) % HISTORY];
+}
+
+uint8_t HeapTelemetry::history(HeapSample* samples, uint8_t maxSamples) {
+    std::lock_guard<std::mutex> guard(_lock);
+    uint8_t count = _count < maxSamples ? _count : maxSamples;
+    uint8_t first = (_head + HISTORY - count) % HISTORY;
+    for (uint8_t i = 0; i < count; i++) {
+        samples[i] = _history[(first + i) % HISTORY];
+    }
+    return count;
+}
+
+uint32_t HeapTelemetry::failedAllocs() const {
+    return failedCount.load(std::memory_order_relaxed);
+}
+
+uint32_t HeapTelemetry::lastFailedSize() const {
+    return failedSize.load(std::memory_order_relaxed);
+}
+
+bool HeapTelemetry::countsAllocations() {
+#if CONFIG_HEAP_USE_HOOKS
+    return true;
+#else
+    return false;
+#endif
+}
+
+uint32_t HeapTelemetry::taskAllocations() {
+#if CONFIG_HEAP_USE_HOOKS
+    return allocCount;
+#else
+    return 0;
+#endif
+}
+
+uint16_t HeapTelemetry::fragmentation(const HeapRegion& region) {
+    if (region.free == 0) {
+        return 0;
+    }
+    return 1000 - (uint16_t)((uint64_t)region.largest * 1000 / region.free);
+}
+
+void HeapTelemetry::readRegion(uint32_t caps, HeapRegion& region) {
+    multi_heap_info_t info;
+    heap_caps_get_info(&info, caps);
+
+    region.total = heap_caps_get_total_size(caps);
+    region.free = info.total_free_bytes;
+    region.largest = info.largest_free_block;
+    region.minFree = info.minimum_free_bytes;
+    region.blocks = info.allocated_blocks;
+}
@@ -0,0 +1,86 @@
+/*********
+  SEMBox ESP32 - Heap Telemetry
+  Heap and fragmentation sampling with a history ring
+
+  Free heap alone hides fragmentation: after days of request churn there
+  can be plenty of free memory but no block large enough for the next
+  response. sample() records free size, largest free block, low-water
+  mark and allocated block count of internal RAM and (if fitted) PSRAM,
+  and keeps one sample per interval in a ring for trend inspection.
+  Failed allocations are counted through the ESP-IDF failed-alloc hook.
+  With CONFIG_HEAP_USE_HOOKS, the allocation hook also counts every
+  allocation per task, so the allocations of one stretch of code (a
+  request handler) are the difference of two taskAllocations() reads.
+
+  The precompiled ESP-IDF of the stock Arduino core is built without
+  CONFIG_HEAP_USE_HOOKS, so a normal firmware build does not count
+  allocations: countsAllocations() is false, RouteMetrics gets no
+  counter, and /metrics and /heap leave the allocation figures out
+  rather than report zeros. Counting needs an ESP-IDF build with the
+  option set (Arduino as an ESP-IDF component, or a core rebuilt with
+  the lib builder). The host emulator always counts, except under a
+  sanitizer.
+
+  sample() walks the heap (heap_caps_get_info), so it is called from
+  loop() at a low rate and never from the control task; readers get
+  copies taken under a lock.
+*********/
+
+#ifndef HEAP_TELEMETRY_H
+#define HEAP_TELEMETRY_H
+
+#include <stdint.h>
+#include <mutex>
+
+struct HeapRegion {
+    uint32_t total;
+    uint32_t free;
+    uint32_t largest;           // Largest free block
+    uint32_t minFree;           // Low-water mark since boot
+    uint32_t blocks;            // Allocated blocks
+};
+
+struct HeapSample {
+    uint32_t uptime;            // Seconds since boot
+    HeapRegion internal;
+    HeapRegion spiram;          // All zero without PSRAM
+};
+
+class HeapTelemetry {
+public:
+    static const uint8_t HISTORY = 60;
+
+    HeapTelemetry();
+
+    // Register the failed-allocation hook; call early in setup()
+    void begin();
+
+    // Take a sample and append it to the history (loop task)
+    void sample(uint32_t uptimeSeconds);
+
+    HeapSample latest();
+
+    // Copy the history, oldest first; returns the number of samples
+    uint8_t history(HeapSample* samples, uint8_t maxSamples);
+
+    uint32_t failedAllocs() const;
+    uint32_t lastFailedSize() const;
+
+    // Allocations made by the calling task so far; false/0 in builds
+    // without the heap hooks (the stock Arduino core)
+    static bool countsAllocations();
+    static uint32_t taskAllocations();
+
+    // Share of free memory not in the largest block, in 1/1000
+    static uint16_t fragmentation(const HeapRegion& region);
+
+private:
+    static void readRegion(uint32_t caps, HeapRegion& region);
+
+    std::mutex _lock;
+    HeapSample _history[HISTORY];
+    uint8_t _head;              // Next slot to write
+    uint8_t _count;
+};
+
+#endif // HEAP_TELEMETRY_H
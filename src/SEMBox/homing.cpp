@@ -0,0 +1,127 @@
+/*********
+  SEMBox ESP32 - Homing
+*********/
+
+#include "homing.h"
+
+HomingSequence::HomingSequence(StepEngine& engine, const InputCapture& inputs, uint8_t channel)
+    : _engine(engine), _inputs(inputs), _channel(channel), _phase(HOMING_IDLE), _error(nullptr),
+      _stopping(false), _edgeTime(0), _stopTime(0), _abortRequested(false) {
+    memset(&_config, 0, sizeof(_config));
+}
+
+const char* HomingSequence::start(const HomingConfig& config) {
+    if (active()) {
+        return "Homing in progress";
+    }
+    if (_engine.busy()) {
+        return "Table busy";
+    }
+    if (config.searchSteps == 0 || config.backoffSteps <= 0 ||
+        config.approachRate == 0 || config.creepRate == 0) {
+        return "Invalid homing setup";
+    }
+
+    _config = config;
+    _error = nullptr;
+    _abortRequested = false;
+
+    // Already on the sensor: back off first, no search needed
+    int32_t direction = config.searchSteps > 0 ? 1 : -1;
+    bool started = sensorActive()
+        ? enter(HOMING_BACKOFF, -direction * config.backoffSteps, config.approachRate)
+        : enter(HOMING_APPROACH, config.searchSteps, config.approachRate);
+    return started ? nullptr : _error;
+}
+
+bool HomingSequence::service(int64_t now) {
+    if (!active()) {
+        return false;
+    }
+    if (_abortRequested.exchange(false)) {
+        fail("Homing aborted");
+        return true;
+    }
+
+    int32_t direction = _config.searchSteps > 0 ? 1 : -1;
+    bool moving = _engine.busy();
+
+    switch (_phase) {
+        case HOMING_APPROACH:
+            if (!_stopping && sensorActive()) {
+                _engine.stop();
+                _stopping = true;
+            }
+            if (moving) {
+                return false;
+            }
+            if (!_stopping) {
+                return !fail("Home sensor not found");
+            }
+            return !enter(HOMING_BACKOFF, -direction * _config.backoffSteps, _config.approachRate);
+
+        case HOMING_BACKOFF:
+            if (moving) {
+                return false;
+            }
+            if (sensorActive()) {
+                return !fail("Home sensor did not release");
+            }
+            return !enter(HOMING_CREEP, direction * 2 * _config.backoffSteps, _config.creepRate);
+
+        case HOMING_CREEP: {
+            if (!_stopping && sensorActive()) {
+                _engine.stop();
+                _stopping = true;
+                _edgeTime = _inputs.lastEdge(_channel);
+                _stopTime = now;
+            }
+            if (moving) {
+                return false;
+            }
+            if (!_stopping) {
+                return !fail("Home sensor not found");
+            }
+
+            // Steps made between the captured edge and the stop, at creep rate
+            int64_t late = (_stopTime - _edgeTime) * _config.creepRate / 1000000;
+            if (late < 0) {
+                late = 0;
+            }
+            _engine.setPosition(direction * late);
+            _phase = HOMING_DONE;
+            return true;
+        }
+
+        default:
+            return false;
+    }
+}
+
+const char* HomingSequence::phaseName(HomingPhase phase) {
+    switch (phase) {
+        case HOMING_IDLE:     return "idle";
+        case HOMING_APPROACH: return "approach";
+        case HOMING_BACKOFF:  return "backoff";
+        case HOMING_CREEP:    return "creep";
+        case HOMING_DONE:     return "done";
+        case HOMING_FAILED:   return "failed";
+    }
+    return "unknown";
+}
+
+bool HomingSequence::enter(HomingPhase phase, int32_t steps, uint32_t rate) {
+    _phase = phase;
+    _stopping = false;
+    if (!_engine.move(steps, rate)) {
+        return fail("Table busy");
+    }
+    return true;
+}
+
+bool HomingSequence::fail(const char* error) {
+    _engine.stop();
+    _error = error;
+    _phase = HOMING_FAILED;
+    return false;
+}
@@ -0,0 +1,83 @@
+/*********
+  SEMBox ESP32 - Homing
+  Reference run of the rotary table onto the home sensor
+
+  The sequence runs in three constant-rate moves:
+    approach  search at approachRate for the sensor, at most searchSteps
+    backoff   move backoffSteps back so the sensor releases
+    creep     run onto the sensor again at creepRate
+  The sensor is read through InputCapture, so the creep stops on the
+  debounced edge but the home position is taken at the edge's capture
+  timestamp: the steps made since then (at the known creep rate) are
+  subtracted, which keeps the reference independent of the debounce
+  time and of the control tick.
+
+  start() and service() run in the control task; abort() may be called
+  from any task.
+*********/
+
+#ifndef HOMING_H
+#define HOMING_H
+
+#include <Arduino.h>
+#include <atomic>
+#include "step_engine.h"
+#include "input_capture.h"
+
+enum HomingPhase : uint8_t {
+    HOMING_IDLE,
+    HOMING_APPROACH,
+    HOMING_BACKOFF,
+    HOMING_CREEP,
+    HOMING_DONE,
+    HOMING_FAILED
+};
+
+struct HomingConfig {
+    uint32_t approachRate;      // steps/s
+    uint32_t creepRate;         // steps/s
+    int32_t searchSteps;        // Longest approach; the sign gives the direction
+    int32_t backoffSteps;
+};
+
+class HomingSequence {
+public:
+    HomingSequence(StepEngine& engine, const InputCapture& inputs, uint8_t channel);
+
+    // Begin the sequence; returns an error message, or nullptr
+    const char* start(const HomingConfig& config);
+
+    /**
+     * Advance the sequence (control task, every tick). Returns true on
+     * the tick it ends; phase() then tells HOMING_DONE from HOMING_FAILED.
+     * On success the engine position is 0 at the home edge.
+     */
+    bool service(int64_t now);
+
+    // Stop the table and fail the sequence on the next service()
+    void abort() { _abortRequested = true; }
+
+    bool active() const { return _phase >= HOMING_APPROACH && _phase <= HOMING_CREEP; }
+    HomingPhase phase() const { return _phase; }
+    const char* error() const { return _error; }
+
+    static const char* phaseName(HomingPhase phase);
+
+private:
+    bool sensorActive() const { return (_inputs.state() >> _channel) & 1; }
+    bool enter(HomingPhase phase, int32_t steps, uint32_t rate);
+    bool fail(const char* error);
+
+    StepEngine& _engine;
+    const InputCapture& _inputs;
+    uint8_t _channel;
+    HomingConfig _config;
+    volatile HomingPhase _phase;
+    const char* volatile _error;
+    bool _stopping;             // Stop issued, waiting for the engine to idle
+    int64_t _edgeTime;          // Capture time of the creep edge
+    int64_t _stopTime;
+    std::atomic<bool> _abortRequested;
+};
+
+#endif // HOMING_H
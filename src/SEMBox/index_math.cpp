@@ -0,0 +1,106 @@
+/*********
+  SEMBox ESP32 - Index Math
+*********/
+
+#include "index_math.h"
+
+// Floor division; C++ division truncates towards zero
+static int64_t floorDiv(int64_t a, int64_t b) {
+    int64_t q = a / b;
+    if ((a % b != 0) && ((a < 0) != (b < 0))) {
+        q--;
+    }
+    return q;
+}
+
+static int64_t gcd(int64_t a, int64_t b) {
+    while (b != 0) {
+        int64_t r = a % b;
+        a = b;
+        b = r;
+    }
+    return a;
+}
+
+IndexMath::IndexMath()
+    : _division(1), _ratioMilli(RATIO_SCALE), _modulus(RATIO_SCALE),
+      _quotient(0), _remainder(0), _periodIndexes(1), _periodSteps(0) {
+}
+
+bool IndexMath::configure(uint32_t division, uint32_t ratioMilli, uint32_t motorStepsPerRev) {
+    if (division == 0 || ratioMilli == 0 || motorStepsPerRev == 0) {
+        return false;
+    }
+
+    // Steps per division = stepsPerRevNumerator / _modulus, exactly
+    int64_t stepsPerRevNumerator = (int64_t)motorStepsPerRev * ratioMilli;
+
+    _division = division;
+    _ratioMilli = ratioMilli;
+    _modulus = (int64_t)division * RATIO_SCALE;
+    _quotient = stepsPerRevNumerator / _modulus;
+    _remainder = stepsPerRevNumerator % _modulus;
+
+    // Smallest whole number of revolutions that is also a whole number of steps
+    int64_t common = gcd(stepsPerRevNumerator, _modulus);
+    int64_t exact = _modulus / common;
+    _periodIndexes = exact / gcd(exact, division) * division;
+    _periodSteps = _periodIndexes / exact * (stepsPerRevNumerator / common);
+    return true;
+}
+
+int64_t IndexMath::stepsAt(int64_t index) const {
+    // round(index * (q + r / m)) = index * q + floor((index * r + m / 2) / m)
+    return index * _quotient + floorDiv(index * _remainder + _modulus / 2, _modulus);
+}
+
+int64_t IndexMath::indexNear(int64_t steps) const {
+    // round(steps / (q + r / m)) = floor((2 * steps * m + p) / (2 * p)), p = q * m + r
+    int64_t perDivision = _quotient * _modulus + _remainder;
+    if (perDivision == 0) {
+        return 0;
+    }
+    return floorDiv(2 * steps * _modulus + perDivision, 2 * perDivision);
+}
+
+bool parseRatioMilli(const char* text, uint32_t* ratioMilli) {
+    if (text == nullptr || *text == '\0') {
+        return false;
+    }
+
+    uint64_t value = 0;
+    int decimals = -1;      // -1 until the decimal point is seen
+
+    for (const char* p = text; *p != '\0'; p++) {
+        if (*p == '.') {
+            if (decimals >= 0) {
+                return false;
+            }
+            decimals = 0;
+            continue;
+        }
+        if (*p < '0' || *p > '9') {
+            return false;
+        }
+        if (decimals >= 3) {
+            return false;
+        }
+        value = value * 10 + (uint64_t)(*p - '0');
+        if (value > 0xFFFFFFFFull) {
+            return false;
+        }
+        if (decimals >= 0) {
+            decimals++;
+        }
+    }
+
+    for (int i = decimals < 0 ? 0 : decimals; i < 3; i++) {
+        value *= 10;
+    }
+    if (value > 0xFFFFFFFFull) {
+        return false;
+    }
+
+    *ratioMilli = (uint32_t)value;
+    return true;
+}
@@ -0,0 +1,74 @@
+/*********
+  SEMBox ESP32 - Index Math
+  Exact division-to-step conversion for the rotary table
+
+  The gear ratio is kept as an integer number of thousandths, so steps per
+  table revolution are the exact fraction
+      motorStepsPerRev * ratioMilli / 1000
+  and the step target of division k is that fraction times k / division,
+  rounded. It is split Bresenham-style into a whole quotient and a
+  remainder when the parameters are configured, so a lookup is O(1) with
+  integer arithmetic only and every division lands on its exactly rounded
+  position: the error never exceeds half a step and does not accumulate,
+  whatever the number of indexes. A full revolution returns to exactly
+  zero error whenever it is a whole number of steps.
+*********/
+
+#ifndef INDEX_MATH_H
+#define INDEX_MATH_H
+
+#include <stdint.h>
+
+class IndexMath {
+public:
+    static const uint32_t RATIO_SCALE = 1000;   // Ratio stored in 1/1000
+
+    IndexMath();
+
+    /**
+     * Precompute the step distribution.
+     * Returns false (and keeps the previous setup) if any value is 0.
+     */
+    bool configure(uint32_t division, uint32_t ratioMilli, uint32_t motorStepsPerRev);
+
+    // Step target of absolute division index k (may be negative), relative to index 0
+    int64_t stepsAt(int64_t index) const;
+
+    // Nearest absolute division index to a step offset from index 0
+    int64_t indexNear(int64_t steps) const;
+
+    // Steps needed to move from one absolute division index to another
+    int64_t stepsBetween(int64_t fromIndex, int64_t toIndex) const {
+        return stepsAt(toIndex) - stepsAt(fromIndex);
+    }
+
+    uint32_t division() const { return _division; }
+    uint32_t ratioMilli() const { return _ratioMilli; }
+
+    /**
+     * The step pattern repeats exactly after periodIndexes() divisions,
+     * which are periodSteps() whole steps: stepsAt(k + periodIndexes()) ==
+     * stepsAt(k) + periodSteps() for every k. Always whole table
+     * revolutions: one for whole ratios, at most 5 when the motor steps per
+     * revolution are a multiple of 200.
+     */
+    int64_t periodIndexes() const { return _periodIndexes; }
+    int64_t periodSteps() const { return _periodSteps; }
+
+private:
+    uint32_t _division;
+    uint32_t _ratioMilli;
+    int64_t _modulus;       // division * RATIO_SCALE
+    int64_t _quotient;      // Whole steps per division
+    int64_t _remainder;     // Fractional steps per division, in 1/_modulus
+    int64_t _periodIndexes;
+    int64_t _periodSteps;
+};
+
+/**
+ * Parse a decimal ratio such as "90" or "1234.567" into thousandths.
+ * Rejects signs, exponents, more than 3 decimals and trailing characters.
+ */
+bool parseRatioMilli(const char* text, uint32_t* ratioMilli);
+
+#endif // INDEX_MATH_H
@@ -0,0 +1,146 @@
+/*********
+  SEMBox ESP32 - Input Capture
+*********/
+
+#include "input_capture.h"
+#include "esp_timer.h"
+#include "soc/gpio_reg.h"
+
+InputCapture::InputCapture()
+    : _io(nullptr), _state(0), _edges(0), _overflows(0), _resync(false),
+      _historyHead(0), _historyCount(0) {
+    memset(_channels, 0, sizeof(_channels));
+    memset(_lastEdge, 0, sizeof(_lastEdge));
+}
+
+bool InputCapture::begin(const IoRegistry& io) {
+    _io = &io;
+    int64_t now = esp_timer_get_time();
+    IoMask state = 0;
+
+    for (uint8_t i = 0; i < io.count(); i++) {
+        if (!(io.inputMask() & (1 << i))) {
+            continue;
+        }
+        bool active = readLevel(i);
+        _channels[i].raw = active;
+        _channels[i].rawSince = now;
+        _channels[i].changeStart = now;
+        if (active) {
+            state |= 1 << i;
+        }
+
+        _contexts[i].self = this;
+        _contexts[i].channel = i;
+        attachInterruptArg(io.channel(i).pin, onEdge, &_contexts[i], CHANGE);
+    }
+
+    _state.store(state, std::memory_order_release);
+    return true;
+}
+
+void IRAM_ATTR InputCapture::onEdge(void* arg) {
+    IsrContext* context = (IsrContext*)arg;
+    InputCapture* self = context->self;
+
+    InputEdge edge;
+    edge.time = esp_timer_get_time();
+    edge.channel = context->channel;
+    edge.active = self->readLevel(context->channel);
+
+    // Single producer: GPIO interrupts are serviced one at a time
+    if (!self->_raw.push(edge)) {
+        self->_overflows.fetch_add(1, std::memory_order_relaxed);
+        self->_resync.store(true, std::memory_order_relaxed);
+    }
+}
+
+void InputCapture::service(int64_t now) {
+    if (!_io) {
+        return;
+    }
+
+    InputEdge edge;
+    while (_raw.pop(edge)) {
+        ChannelState& channel = _channels[edge.channel];
+        uint32_t debounceUs = _io->channel(edge.channel).debounceUs;
+
+        // The previous level may have settled before this edge (late service)
+        if (channel.raw != ((state() >> edge.channel) & 1) &&
+            edge.time - channel.rawSince >= (int64_t)debounceUs) {
+            accept(edge.channel, channel.raw, channel.changeStart);
+        }
+        bool stable = (state() >> edge.channel) & 1;
+
+        // A new transition starts unless this is contact bounce of the current one
+        if (channel.raw == stable && edge.active != stable &&
+            edge.time - channel.rawSince >= (int64_t)debounceUs) {
+            channel.changeStart = edge.time;
+        }
+        channel.raw = edge.active;
+        channel.rawSince = edge.time;
+
+        // Without debouncing every edge counts, including short pulses
+        if (debounceUs == 0 && edge.active != stable) {
+            accept(edge.channel, edge.active, edge.time);
+        }
+    }
+
+    // Edges were lost: take the pins' current levels as the raw state
+    if (_resync.exchange(false, std::memory_order_relaxed)) {
+        for (uint8_t i = 0; i < _io->count(); i++) {
+            if ((_io->inputMask() & (1 << i)) && readLevel(i) != _channels[i].raw) {
+                _channels[i].raw = !_channels[i].raw;
+                _channels[i].rawSince = now;
+                _channels[i].changeStart = now;
+            }
+        }
+    }
+
+    IoMask current = state();
+    for (uint8_t i = 0; i < _io->count(); i++) {
+        if (!(_io->inputMask() & (1 << i))) {
+            continue;
+        }
+        const ChannelState& channel = _channels[i];
+        bool stable = (current >> i) & 1;
+        if (channel.raw != stable && now - channel.rawSince >= (int64_t)_io->channel(i).debounceUs) {
+            accept(i, channel.raw, channel.changeStart);
+        }
+    }
+}
+
+void InputCapture::accept(uint8_t channel, bool active, int64_t time) {
+    IoMask bit = 1 << channel;
+    IoMask current = state();
+    _state.store(active ? current | bit : current & ~bit, std::memory_order_release);
+    _lastEdge[channel] = time;
+    _edges.fetch_add(1, std::memory_order_relaxed);
+
+    std::lock_guard<std::mutex> guard(_historyLock);
+    InputEdge& edge = _history[_historyHead];
+    edge.time = time;
+    edge.channel = channel;
+    edge.active = active;
+    _historyHead = (_historyHead + 1) % HISTORY;
+    if (_historyCount < HISTORY) {
+        _historyCount++;
+    }
+}
+
+uint8_t InputCapture::history(InputEdge* edges, uint8_t maxEdges) {
+    std::lock_guard<std::mutex> guard(_historyLock);
+    uint8_t count = _historyCount < maxEdges ? _historyCount : maxEdges;
+    uint8_t first = (_historyHead + HISTORY - count) % HISTORY;
+    for (uint8_t i = 0; i < count; i++) {
+        edges[i] = _history[(first + i) % HISTORY];
+    }
+    return count;
+}
+
+bool IRAM_ATTR InputCapture::readLevel(uint8_t channel) const {
+    const IoChannel& config = _io->channel(channel);
+    uint32_t in = config.pin < 32 ? REG_READ(GPIO_IN_REG) : REG_READ(GPIO_IN1_REG);
+    bool level = (in >> (config.pin & 31)) & 1;
+    return level != config.activeLow;
+}
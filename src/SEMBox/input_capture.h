@@ -0,0 +1,90 @@
+/*********
+  SEMBox ESP32 - Input Capture
+  Interrupt-driven digital input edges with timestamps and debouncing
+
+  Every input channel of the IO registry gets a GPIO interrupt on both
+  edges. The interrupt only records the level and an esp_timer
+  timestamp (microseconds) into a lock-free ring, so pulses much shorter
+  than the control tick are not lost.
+
+  The control task calls service() every tick. It drains the ring and
+  debounces each channel: a new level is accepted once it has been
+  stable for the channel's debounceUs, and the accepted edge carries the
+  timestamp of the first raw edge of the transition, i.e. the time the
+  contact actually changed. Accepted edges update the debounced state
+  mask and are kept in a short history for the web interface.
+*********/
+
+#ifndef INPUT_CAPTURE_H
+#define INPUT_CAPTURE_H
+
+#include <Arduino.h>
+#include <mutex>
+#include "io_channels.h"
+#include "command_queue.h"
+
+struct InputEdge {
+    int64_t time;               // esp_timer microseconds
+    uint8_t channel;
+    bool active;                // Logical level after the edge
+};
+
+class InputCapture {
+public:
+    static const uint8_t HISTORY = 32;
+    static const size_t RAW_QUEUE_SIZE = 64;    // Power of two
+
+    InputCapture();
+
+    // Attach interrupts to all input channels of the registry
+    bool begin(const IoRegistry& io);
+
+    // Drain raw edges and debounce (control task, every tick)
+    void service(int64_t now);
+
+    // Debounced logical levels (bit i = channel i)
+    IoMask state() const { return _state.load(std::memory_order_acquire); }
+
+    // Debounced edges since boot, and raw edges lost to a full ring
+    uint32_t edges() const { return _edges.load(std::memory_order_relaxed); }
+    uint32_t overflows() const { return _overflows.load(std::memory_order_relaxed); }
+
+    // Time of the last debounced edge of a channel, 0 if none
+    int64_t lastEdge(uint8_t channel) const { return _lastEdge[channel]; }
+
+    // Copy the recent edges, oldest first; returns the number copied
+    uint8_t history(InputEdge* edges, uint8_t maxEdges);
+
+private:
+    struct IsrContext {
+        InputCapture* self;
+        uint8_t channel;
+    };
+
+    struct ChannelState {
+        bool raw;               // Last raw level seen
+        int64_t rawSince;       // Time of the last raw edge
+        int64_t changeStart;    // First raw edge away from the debounced level
+    };
+
+    static void IRAM_ATTR onEdge(void* arg);
+    void accept(uint8_t channel, bool active, int64_t time);
+    bool readLevel(uint8_t channel) const;
+
+    const IoRegistry* _io;
+    IsrContext _contexts[IoRegistry::MAX_CHANNELS];
+    ChannelState _channels[IoRegistry::MAX_CHANNELS];
+    int64_t _lastEdge[IoRegistry::MAX_CHANNELS];
+    SpscQueue<InputEdge, RAW_QUEUE_SIZE> _raw;
+    std::atomic<IoMask> _state;
+    std::atomic<uint32_t> _edges;
+    std::atomic<uint32_t> _overflows;
+    std::atomic<bool> _resync;
+
+    std::mutex _historyLock;
+    InputEdge _history[HISTORY];
+    uint8_t _historyHead;
+    uint8_t _historyCount;
+};
+
+#endif // INPUT_CAPTURE_H
@@ -0,0 +1,114 @@
+/*********
+  SEMBox ESP32 - IO Channels
+*********/
+
+#include "io_channels.h"
+#include "soc/gpio_reg.h"
+
+IoRegistry::IoRegistry()
+    : _channels(nullptr), _count(0), _outputMask(0), _inputMask(0), _outputs(0) {
+}
+
+bool IoRegistry::begin(const IoChannel* channels, uint8_t count) {
+    if (count > MAX_CHANNELS) {
+        return false;
+    }
+    _channels = channels;
+    _count = count;
+
+    for (uint8_t i = 0; i < count; i++) {
+        const IoChannel& channel = channels[i];
+        if (channel.direction == IO_OUTPUT) {
+            _outputMask |= 1 << i;
+            digitalWrite(channel.pin, channel.activeLow ? HIGH : LOW);
+            pinMode(channel.pin, OUTPUT);
+        } else {
+            _inputMask |= 1 << i;
+            pinMode(channel.pin, channel.activeLow ? INPUT_PULLUP : INPUT);
+        }
+    }
+    _outputs.store(0, std::memory_order_release);
+    return true;
+}
+
+void IoRegistry::write(IoMask set, IoMask clear) {
+    set &= _outputMask;
+    clear &= _outputMask & ~set;
+
+    // Logical to physical: an active-low output is driven low when active
+    uint32_t high[2] = { 0, 0 };
+    uint32_t low[2] = { 0, 0 };
+    for (uint8_t i = 0; i < _count; i++) {
+        IoMask bit = 1 << i;
+        if (!((set | clear) & bit)) {
+            continue;
+        }
+        uint8_t pin = _channels[i].pin;
+        bool level = ((set & bit) != 0) != _channels[i].activeLow;
+        uint32_t* masks = level ? high : low;
+        masks[pin >> 5] |= 1UL << (pin & 31);
+    }
+
+    if (high[0]) REG_WRITE(GPIO_OUT_W1TS_REG, high[0]);
+    if (low[0]) REG_WRITE(GPIO_OUT_W1TC_REG, low[0]);
+    if (high[1]) REG_WRITE(GPIO_OUT1_W1TS_REG, high[1]);
+    if (low[1]) REG_WRITE(GPIO_OUT1_W1TC_REG, low[1]);
+
+    _outputs.store((outputs() | set) & ~clear, std::memory_order_release);
+}
+
+IoMask IoRegistry::readInputs() const {
+    uint32_t in[2] = { REG_READ(GPIO_IN_REG), REG_READ(GPIO_IN1_REG) };
+    IoMask inputs = 0;
+    for (uint8_t i = 0; i < _count; i++) {
+        if (!(_inputMask & (1 << i))) {
+            continue;
+        }
+        uint8_t pin = _channels[i].pin;
+        bool level = (in[pin >> 5] >> (pin & 31)) & 1;
+        if (level != _channels[i].activeLow) {
+            inputs |= 1 << i;
+        }
+    }
+    return inputs;
+}
+
+int IoRegistry::find(const char* name) const {
+    for (uint8_t i = 0; i < _count; i++) {
+        if (strcmp(_channels[i].name, name) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+bool IoRegistry::parseNames(const char* list, IoMask* mask) const {
+    IoMask result = 0;
+    char name[16];
+
+    while (*list) {
+        size_t length = strcspn(list, ",");
+        if (length == 0 || length >= sizeof(name)) {
+            return false;
+        }
+        memcpy(name, list, length);
+        name[length] = '\0';
+        list += length;
+        if (*list == ',') {
+            list++;
+        }
+
+        if (strcmp(name, "all") == 0) {
+            result |= _outputMask;
+            continue;
+        }
+        int index = find(name);
+        if (index < 0) {
+            return false;
+        }
+        result |= 1 << index;
+    }
+
+    *mask = result;
+    return result != 0;
+}
@@ -0,0 +1,79 @@
+/*********
+  SEMBox ESP32 - IO Channels
+  Table-driven digital IO with packed state and bulk output writes
+
+  Channels are declared once in a table (name, pin, direction, polarity);
+  channel i is bit i of every mask. Output state is a packed bitmask of
+  logical levels (1 = active). write() turns a set/clear request into
+  physical pin masks once and applies them with the GPIO W1TS/W1TC
+  registers, so all outputs switching on change in one register write
+  and all outputs switching off in the next one, a few nanoseconds later.
+  Outputs on GPIO 32-39 use the second register bank, so keep channels
+  that must switch together on GPIO 0-31.
+
+  Outputs are written by the control task only; state reads are safe
+  from any task.
+*********/
+
+#ifndef IO_CHANNELS_H
+#define IO_CHANNELS_H
+
+#include <Arduino.h>
+#include <atomic>
+
+enum IoDirection : uint8_t {
+    IO_OUTPUT,
+    IO_INPUT
+};
+
+struct IoChannel {
+    const char* name;
+    uint8_t pin;
+    IoDirection direction;
+    bool activeLow;
+    uint32_t debounceUs;        // Inputs: stable time before an edge counts
+};
+
+typedef uint16_t IoMask;
+
+class IoRegistry {
+public:
+    static const uint8_t MAX_CHANNELS = 16;
+
+    IoRegistry();
+
+    // Configure all pins, outputs inactive; false if the table is invalid
+    bool begin(const IoChannel* channels, uint8_t count);
+
+    // Activate `set` and deactivate `clear` outputs in bulk (control task)
+    void write(IoMask set, IoMask clear);
+
+    // Logical output levels (bit i = channel i)
+    IoMask outputs() const { return _outputs.load(std::memory_order_acquire); }
+
+    // Logical input levels read from the pins now
+    IoMask readInputs() const;
+
+    IoMask outputMask() const { return _outputMask; }
+    IoMask inputMask() const { return _inputMask; }
+    uint8_t count() const { return _count; }
+    const IoChannel& channel(uint8_t index) const { return _channels[index]; }
+
+    // Channel index by name, or -1
+    int find(const char* name) const;
+
+    /**
+     * Parse a comma-separated list of channel names ("all" = every
+     * output) into a mask. Returns false on an unknown name.
+     */
+    bool parseNames(const char* list, IoMask* mask) const;
+
+private:
+    const IoChannel* _channels;
+    uint8_t _count;
+    IoMask _outputMask;
+    IoMask _inputMask;
+    std::atomic<IoMask> _outputs;
+};
+
+#endif // IO_CHANNELS_H
@@ -0,0 +1,152 @@
+/*********
+  SEMBox ESP32 - Motion Profile
+*********/
+
+#include "motion_profile.h"
+#include <math.h>
+
+MotionProfile::MotionProfile()
+    : _active(0), _timerHz(0), _reachesMax(false), _building(false),
+      _next(0), _target(0), _lastTime(0),
+      _peakAccel(0), _jerk(0), _t1(0), _t2(0), _t3(0),
+      _s1(0), _v1(0), _s2(0), _v2(0), _sEnd(0) {
+    _limits.maxVelocity = 0;
+    _limits.acceleration = 0;
+    _limits.jerk = 0;
+    _tables[0].length = 0;
+    _tables[0].cruisePeriod = 0;
+    _tables[1].length = 0;
+    _tables[1].cruisePeriod = 0;
+}
+
+bool MotionProfile::configure(const MotionLimits& limits, uint32_t timerHz) {
+    if (limits.maxVelocity == 0 || limits.acceleration == 0 || timerHz == 0) {
+        return false;
+    }
+
+    _limits = limits;
+    _timerHz = timerHz;
+
+    double v = limits.maxVelocity;
+    double a = limits.acceleration;
+    _jerk = limits.jerk;
+
+    if (_jerk == 0) {
+        // Trapezoidal: constant acceleration straight to max velocity
+        _peakAccel = a;
+        _t1 = 0;
+        _t2 = v / a;
+    } else if (v >= a * a / _jerk) {
+        // S-curve reaching full acceleration
+        _peakAccel = a;
+        _t1 = a / _jerk;
+        _t2 = (v - a * a / _jerk) / a;
+    } else {
+        // S-curve whose velocity limit is hit before full acceleration
+        _peakAccel = sqrt(v * _jerk);
+        _t1 = _peakAccel / _jerk;
+        _t2 = 0;
+    }
+    _t3 = _t1;
+
+    _v1 = _jerk * _t1 * _t1 / 2;
+    _s1 = _jerk * _t1 * _t1 * _t1 / 6;
+    _v2 = _v1 + _peakAccel * _t2;
+    _s2 = _s1 + _v1 * _t2 + _peakAccel * _t2 * _t2 / 2;
+    _sEnd = _s2 + _v2 * _t3 + _peakAccel * _t3 * _t3 / 2 - _jerk * _t3 * _t3 * _t3 / 6;
+
+    double rampSteps = floor(_sEnd);
+    _reachesMax = rampSteps <= RampTable::MAX_STEPS;
+    _target = _reachesMax ? (uint16_t)rampSteps : RampTable::MAX_STEPS;
+
+    _next = 0;
+    _lastTime = 0;
+    _building = true;
+    return true;
+}
+
+bool MotionProfile::build(uint16_t budget) {
+    if (!_building) {
+        return true;
+    }
+
+    RampTable& table = _tables[1 - _active];
+    uint32_t cruisePeriod = (uint32_t)lround((double)_timerHz / _limits.maxVelocity);
+    if (cruisePeriod == 0) {
+        cruisePeriod = 1;
+    }
+
+    while (budget > 0 && _next < _target) {
+        double time = timeAt(_next + 1, _lastTime);
+
+        // Round absolute edge times so quantization does not accumulate
+        int64_t period = llround(time * _timerHz) - llround(_lastTime * _timerHz);
+        table.periods[_next] = period > cruisePeriod ? (uint32_t)period : cruisePeriod;
+
+        _lastTime = time;
+        _next++;
+        budget--;
+    }
+
+    if (_next < _target) {
+        return false;
+    }
+
+    table.length = _target;
+    table.cruisePeriod = _reachesMax ? cruisePeriod : table.periods[_target - 1];
+    _active = 1 - _active;
+    _building = false;
+    return true;
+}
+
+double MotionProfile::positionAt(double t) const {
+    if (t <= _t1) {
+        return _jerk * t * t * t / 6;
+    }
+    t -= _t1;
+    if (t <= _t2) {
+        return _s1 + _v1 * t + _peakAccel * t * t / 2;
+    }
+    t -= _t2;
+    if (t <= _t3) {
+        return _s2 + _v2 * t + _peakAccel * t * t / 2 - _jerk * t * t * t / 6;
+    }
+    t -= _t3;
+    return _sEnd + _limits.maxVelocity * t;
+}
+
+double MotionProfile::timeAt(double position, double tLow) const {
+    // Bracket, then bisect down to a quarter timer tick
+    double low = tLow;
+    double step = 1e-4;
+    double high = tLow + step;
+    while (positionAt(high) < position) {
+        low = high;
+        step *= 2;
+        high = tLow + step;
+    }
+
+    double resolution = 0.25 / _timerHz;
+    while (high - low > resolution) {
+        double mid = (low + high) / 2;
+        if (positionAt(mid) < position) {
+            low = mid;
+        } else {
+            high = mid;
+        }
+    }
+    return high;
+}
+
+int64_t shortestIndexDelta(int64_t currentIndex, uint32_t targetDivision, uint32_t division) {
+    int64_t d = division;
+    int64_t current = ((currentIndex % d) + d) % d;
+    int64_t delta = (int64_t)targetDivision - current;
+
+    if (2 * delta > d) {
+        delta -= d;
+    } else if (2 * delta <= -d) {
+        delta += d;
+    }
+    return delta;
+}
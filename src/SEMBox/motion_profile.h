@@ -0,0 +1,94 @@
+/*********
+  SEMBox ESP32 - Motion Profile
+  Trapezoidal and S-curve velocity planning for the rotary table
+
+  The acceleration ramp from standstill to maximum velocity is converted
+  once into a table of step periods (timer ticks). A move of any length
+  then only looks up entries: step k of an N-step move uses entry
+  min(k, N-1-k), or the cruise period past the end of the table, so the
+  step interrupt never does any math. Deceleration mirrors acceleration.
+
+  The table is rebuilt in small slices (build()) when the limits change,
+  into a second buffer, and swapped in once complete. Moves started
+  meanwhile keep using the previous table.
+
+  Plain C++, builds on a Linux host.
+*********/
+
+#ifndef MOTION_PROFILE_H
+#define MOTION_PROFILE_H
+
+#include <stdint.h>
+
+struct MotionLimits {
+    uint32_t maxVelocity;       // steps/s
+    uint32_t acceleration;      // steps/s^2
+    uint32_t jerk;              // steps/s^3, 0 = trapezoidal profile
+};
+
+struct RampTable {
+    static const uint16_t MAX_STEPS = 1024;
+
+    uint32_t periods[MAX_STEPS];    // Period of ramp step i, in timer ticks
+    uint16_t length;                // Valid entries
+    uint32_t cruisePeriod;          // Period once the ramp is complete
+};
+
+class MotionProfile {
+public:
+    MotionProfile();
+
+    /**
+     * Start building the ramp for new limits at the given timer resolution.
+     * Returns false if the limits are out of range.
+     */
+    bool configure(const MotionLimits& limits, uint32_t timerHz);
+
+    /**
+     * Compute up to budget more ramp entries.
+     * Returns true once the table for the latest limits is active.
+     */
+    bool build(uint16_t budget);
+
+    // Complete and swap in the pending table in one go
+    void buildAll() { while (!build(RampTable::MAX_STEPS)) {} }
+
+    bool pending() const { return _building; }
+    const RampTable* active() const { return &_tables[_active]; }
+    const MotionLimits& limits() const { return _limits; }
+
+    // True if maximum velocity is reached within the table
+    bool reachesMaxVelocity() const { return _reachesMax; }
+
+private:
+    double positionAt(double t) const;
+    double timeAt(double position, double tLow) const;
+
+    RampTable _tables[2];
+    uint8_t _active;
+
+    MotionLimits _limits;
+    uint32_t _timerHz;
+    bool _reachesMax;
+
+    // Build state of the inactive table
+    bool _building;
+    uint16_t _next;
+    uint16_t _target;
+    double _lastTime;
+
+    // Ramp phases: jerk up, constant acceleration, jerk down
+    double _peakAccel;
+    double _jerk;
+    double _t1, _t2, _t3;
+    double _s1, _v1, _s2, _v2;
+    double _sEnd;               // Distance to reach max velocity
+};
+
+/**
+ * Shortest signed distance in divisions from the current absolute index
+ * to a target division (0 .. division-1). Ties go forward.
+ */
+int64_t shortestIndexDelta(int64_t currentIndex, uint32_t targetDivision, uint32_t division);
+
+#endif // MOTION_PROFILE_H
@@ -0,0 +1,195 @@
+/*********
+  SEMBox ESP32 - Position Journal
+*********/
+
+#include "position_journal.h"
+#include <stddef.h>
+#include <string.h>
+#include "esp_rom_crc.h"
+
+static const uint16_t SCAN_CHUNK = 16;     // Records read per flash access at boot
+static const uint8_t NO_STATE = 0xFF;
+
+PositionJournal::PositionJournal()
+    : _partition(nullptr), _sectors(0), _sector(0), _slot(0), _erased(0), _hasLatest(false),
+      _queuedState(NO_STATE), _dropped(0) {
+    memset(&_latest, 0, sizeof(_latest));
+    memset(&_stats, 0, sizeof(_stats));
+}
+
+bool PositionJournal::begin(const char* label) {
+    const esp_partition_t* partition =
+        esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, label);
+    if (partition == nullptr || partition->size < 2 * SECTOR_SIZE) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> guard(_lock);
+    _partition = partition;
+    _sectors = partition->size / SECTOR_SIZE;
+    if (_sectors > MAX_SECTORS) {
+        _sectors = MAX_SECTORS;
+    }
+    _erased = 0;
+    _hasLatest = false;
+
+    // Newest valid record, and which sectors are blank
+    uint16_t latestSector = 0;
+    uint16_t latestSlot = 0;
+    uint16_t lastUsed[MAX_SECTORS];     // Slots up to here are not blank
+    PositionRecord chunk[SCAN_CHUNK];
+
+    for (uint16_t sector = 0; sector < _sectors; sector++) {
+        lastUsed[sector] = 0;
+        bool erased = true;
+        for (uint16_t first = 0; first < RECORDS_PER_SECTOR; first += SCAN_CHUNK) {
+            if (!readRecords(sector, first, chunk, SCAN_CHUNK)) {
+                erased = false;
+                continue;
+            }
+            for (uint16_t i = 0; i < SCAN_CHUNK; i++) {
+                const PositionRecord& record = chunk[i];
+                if (slotErased(record)) {
+                    continue;
+                }
+                erased = false;
+                lastUsed[sector] = first + i + 1;
+                if (record.crc == checksum(record) &&
+                    (!_hasLatest || (int32_t)(record.sequence - _latest.sequence) > 0)) {
+                    _latest = record;
+                    _hasLatest = true;
+                    latestSector = sector;
+                    latestSlot = first + i;
+                }
+            }
+        }
+        if (erased) {
+            _erased |= 1UL << sector;
+        }
+    }
+
+    // Continue behind the newest record, past any torn slots after it
+    if (_hasLatest) {
+        _sector = latestSector;
+        _slot = latestSlot + 1 > lastUsed[latestSector] ? latestSlot + 1 : lastUsed[latestSector];
+    } else {
+        _sector = 0;
+        _slot = 0;
+    }
+    _queuedState.store(_hasLatest ? _latest.state : NO_STATE, std::memory_order_relaxed);
+    return true;
+}
+
+bool PositionJournal::latest(PositionRecord& record) {
+    std::lock_guard<std::mutex> guard(_lock);
+    if (_hasLatest) {
+        record = _latest;
+    }
+    return _hasLatest;
+}
+
+bool PositionJournal::latestState(PositionState& state) const {
+    uint8_t queued = _queuedState.load(std::memory_order_relaxed);
+    if (queued == NO_STATE) {
+        return false;
+    }
+    state = (PositionState)queued;
+    return true;
+}
+
+bool PositionJournal::append(const PositionRecord& record) {
+    if (_partition == nullptr) {
+        return false;
+    }
+    if (!_queue.push(record)) {
+        _dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    _queuedState.store(record.state, std::memory_order_relaxed);
+    return true;
+}
+
+bool PositionJournal::service() {
+    std::lock_guard<std::mutex> guard(_lock);
+    if (_partition == nullptr) {
+        return true;
+    }
+
+    bool ok = true;
+    PositionRecord record;
+    while (_queue.pop(record)) {
+        ok = write(record) && ok;
+    }
+
+    // The sector after the current one holds the oldest records
+    uint16_t next = (_sector + 1) % _sectors;
+    if (!(_erased & (1UL << next))) {
+        ok = eraseSector(next) && ok;
+    }
+    return ok;
+}
+
+bool PositionJournal::write(PositionRecord& record) {
+
+    if (_slot >= RECORDS_PER_SECTOR) {
+        _sector = (_sector + 1) % _sectors;
+        _slot = 0;
+    }
+    if (_slot == 0 && !(_erased & (1UL << _sector)) && !eraseSector(_sector)) {
+        return false;
+    }
+
+    record.sequence = _hasLatest ? _latest.sequence + 1 : 1;
+    memset(record.reserved, 0, sizeof(record.reserved));
+    record.crc = checksum(record);
+
+    size_t offset = (size_t)_sector * SECTOR_SIZE + (size_t)_slot * sizeof(PositionRecord);
+    _erased &= ~(1UL << _sector);
+    _slot++;    // A failed write may have left bits behind; never reuse the slot
+    if (esp_partition_write(_partition, offset, &record, sizeof(record)) != ESP_OK) {
+        _stats.failures++;
+        return false;
+    }
+
+    _latest = record;
+    _hasLatest = true;
+    _stats.appends++;
+    return true;
+}
+
+PositionJournalStats PositionJournal::stats() {
+    std::lock_guard<std::mutex> guard(_lock);
+    PositionJournalStats result = _stats;
+    result.sectors = _sectors;
+    result.dropped = _dropped.load(std::memory_order_relaxed);
+    return result;
+}
+
+bool PositionJournal::readRecords(uint16_t sector, uint16_t first, PositionRecord* records, uint16_t count) const {
+    size_t offset = (size_t)sector * SECTOR_SIZE + (size_t)first * sizeof(PositionRecord);
+    return esp_partition_read(_partition, offset, records, count * sizeof(PositionRecord)) == ESP_OK;
+}
+
+bool PositionJournal::eraseSector(uint16_t sector) {
+    if (esp_partition_erase_range(_partition, (size_t)sector * SECTOR_SIZE, SECTOR_SIZE) != ESP_OK) {
+        _stats.failures++;
+        return false;
+    }
+    _erased |= 1UL << sector;
+    _stats.erases++;
+    return true;
+}
+
+bool PositionJournal::slotErased(const PositionRecord& record) {
+    const uint8_t* bytes = (const uint8_t*)&record;
+    for (size_t i = 0; i < sizeof(record); i++) {
+        if (bytes[i] != 0xFF) {
+            return false;
+        }
+    }
+    return true;
+}
+
+uint32_t PositionJournal::checksum(const PositionRecord& record) {
+    return esp_rom_crc32_le(0, (const uint8_t*)&record, offsetof(PositionRecord, crc));
+}
@@ -0,0 +1,108 @@
+/*********
+  SEMBox ESP32 - Position Journal
+  Wear-levelled append log of the table position in a flash partition
+
+  Every record is appended to the next erased slot of a raw data
+  partition ("journal", see partitions.csv) instead of rewriting one
+  location, so the sectors are erased in turn: with a 64 KB partition
+  each sector is erased once per 2048 records. The newest record is
+  found on boot by its sequence number; records with a bad CRC (torn
+  by a power loss during the write) are skipped.
+
+  append() is called from the control task and only pushes the record
+  onto a lock-free queue; service() is called from loop() and writes the
+  queued records, then erases the sector after the current one ahead of
+  time. The control task therefore never touches flash and never takes
+  the lock that service() holds across an erase.
+*********/
+
+#ifndef POSITION_JOURNAL_H
+#define POSITION_JOURNAL_H
+
+#include <stdint.h>
+#include <atomic>
+#include <mutex>
+#include "esp_partition.h"
+#include "command_queue.h"
+
+enum PositionState : uint8_t {
+    POSITION_AT_REST,           // Table stopped at `position`
+    POSITION_MOVING,            // Move started; position unknown after a power loss
+    POSITION_UNKNOWN            // Not homed; nothing to resume
+};
+
+struct PositionRecord {
+    uint32_t sequence;          // Increments with every record
+    int32_t position;           // Motor steps from home
+    int32_t index;              // Absolute division index
+    int32_t division;           // Table setup the index belongs to
+    uint32_t ratioMilli;
+    uint8_t state;              // PositionState
+    uint8_t reserved[7];
+    uint32_t crc;
+};
+
+struct PositionJournalStats {
+    uint32_t appends;           // Records written since boot
+    uint32_t erases;            // Sectors erased since boot
+    uint32_t failures;          // Failed flash operations
+    uint32_t dropped;           // Records lost to a full queue
+    uint16_t sectors;
+};
+
+class PositionJournal {
+public:
+    static const uint32_t SECTOR_SIZE = 4096;
+    static const uint16_t RECORDS_PER_SECTOR = SECTOR_SIZE / sizeof(PositionRecord);
+    static const uint16_t MAX_SECTORS = 32;
+    static const size_t QUEUE_SIZE = 16;      // Power of two; one slot stays empty
+
+    PositionJournal();
+
+    /**
+     * Open the partition and find the newest record and the next free
+     * slot. Returns false if the partition does not exist.
+     */
+    bool begin(const char* label);
+
+    bool ready() const { return _partition != nullptr; }
+
+    // Newest valid record; false if the journal is empty
+    bool latest(PositionRecord& record);
+
+    // State of the newest record written or queued; false if there is none.
+    // Lock-free, for the control task.
+    bool latestState(PositionState& state) const;
+
+    // Queue a record for service() (single producer); false if the queue is full
+    bool append(const PositionRecord& record);
+
+    // Write the queued records (sequence and CRC are filled in) and erase
+    // the next sector if needed; may block for tens of ms. False if a
+    // flash operation failed.
+    bool service();
+
+    PositionJournalStats stats();
+
+private:
+    bool write(PositionRecord& record);
+    bool readRecords(uint16_t sector, uint16_t first, PositionRecord* records, uint16_t count) const;
+    bool eraseSector(uint16_t sector);
+    static bool slotErased(const PositionRecord& record);
+    static uint32_t checksum(const PositionRecord& record);
+
+    const esp_partition_t* _partition;
+    std::mutex _lock;
+    uint16_t _sectors;
+    uint16_t _sector;           // Sector being written
+    uint16_t _slot;             // Next free slot in _sector
+    uint32_t _erased;           // Bit per sector known to be fully erased
+    bool _hasLatest;
+    PositionRecord _latest;
+    PositionJournalStats _stats;
+    SpscQueue<PositionRecord, QUEUE_SIZE> _queue;
+    std::atomic<uint8_t> _queuedState;  // PositionState, or NO_STATE
+    std::atomic<uint32_t> _dropped;
+};
+
+#endif // POSITION_JOURNAL_H
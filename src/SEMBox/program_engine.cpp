@@ -0,0 +1,383 @@
+/*********
+  SEMBox ESP32 - Program Engine
+*********/
+
+#include "program_engine.h"
+#include <string.h>
+
+// ===========================================
+// Program Writer
+// ===========================================
+
+ProgramWriter::ProgramWriter(uint8_t* code, uint16_t capacity)
+    : _code(code), _capacity(capacity), _length(0), _depth(0), _error(nullptr) {
+}
+
+const char* ProgramWriter::put(const uint8_t* bytes, uint16_t count) {
+    if (_error) {
+        return _error;
+    }
+    if (_length + count > _capacity) {
+        return _error = "Program too long";
+    }
+    memcpy(_code + _length, bytes, count);
+    _length += count;
+    return nullptr;
+}
+
+const char* ProgramWriter::gotoDivision(int32_t division) {
+    if (!_error && (division < 0 || division > 0xFFFF)) {
+        _error = "Invalid division";
+    }
+    uint8_t bytes[] = { OP_GOTO, (uint8_t)division, (uint8_t)(division >> 8) };
+    return put(bytes, sizeof(bytes));
+}
+
+const char* ProgramWriter::index(int32_t count) {
+    if (!_error && (count == 0 || count < INT16_MIN || count > INT16_MAX)) {
+        _error = "Invalid count";
+    }
+    uint8_t bytes[] = { OP_INDEX, (uint8_t)count, (uint8_t)(count >> 8) };
+    return put(bytes, sizeof(bytes));
+}
+
+const char* ProgramWriter::home() {
+    uint8_t bytes[] = { OP_HOME };
+    return put(bytes, sizeof(bytes));
+}
+
+const char* ProgramWriter::outputs(uint16_t set, uint16_t clear) {
+    uint8_t bytes[] = { OP_OUTPUTS, (uint8_t)set, (uint8_t)(set >> 8), (uint8_t)clear, (uint8_t)(clear >> 8) };
+    return put(bytes, sizeof(bytes));
+}
+
+const char* ProgramWriter::dwell(uint32_t us) {
+    uint8_t bytes[] = { OP_DWELL, (uint8_t)us, (uint8_t)(us >> 8), (uint8_t)(us >> 16), (uint8_t)(us >> 24) };
+    return put(bytes, sizeof(bytes));
+}
+
+const char* ProgramWriter::wait(uint8_t channel, bool active, uint32_t timeoutMs) {
+    if (!_error && channel >= 16) {
+        _error = "Invalid channel";
+    }
+    uint8_t bytes[] = { OP_WAIT, channel, active,
+                        (uint8_t)timeoutMs, (uint8_t)(timeoutMs >> 8),
+                        (uint8_t)(timeoutMs >> 16), (uint8_t)(timeoutMs >> 24) };
+    return put(bytes, sizeof(bytes));
+}
+
+const char* ProgramWriter::loop(uint16_t count) {
+    if (!_error && _depth >= PROGRAM_MAX_LOOP_DEPTH) {
+        _error = "Loops nested too deep";
+    }
+    uint8_t bytes[] = { OP_LOOP, (uint8_t)count, (uint8_t)(count >> 8) };
+    const char* error = put(bytes, sizeof(bytes));
+    if (!error) {
+        _depth++;
+    }
+    return error;
+}
+
+const char* ProgramWriter::next() {
+    if (!_error && _depth == 0) {
+        _error = "next without loop";
+    }
+    uint8_t bytes[] = { OP_NEXT };
+    const char* error = put(bytes, sizeof(bytes));
+    if (!error) {
+        _depth--;
+    }
+    return error;
+}
+
+const char* ProgramWriter::end() {
+    if (!_error && _depth != 0) {
+        _error = "loop without next";
+    }
+    uint8_t bytes[] = { OP_END };
+    return put(bytes, sizeof(bytes));
+}
+
+// ===========================================
+// Program Engine
+// ===========================================
+
+ProgramEngine::ProgramEngine(ProgramClock clock, ProgramExecute execute, ProgramBusy busy, ProgramInputs inputs)
+    : _clock(clock), _execute(execute), _busy(busy), _inputs(inputs),
+      _staged(false), _stagedLength(0), _stopRequested(false),
+      _length(0), _pc(0), _opPc(0), _steps(0), _state(PROGRAM_IDLE), _wait(WAIT_NONE),
+      _stepEnd(0), _deadline(0), _waitMask(0), _waitActive(false), _depth(0) {
+    memset(&_status, 0, sizeof(_status));
+    _stagedName[0] = '\0';
+}
+
+bool ProgramEngine::stage(const char* name, const uint8_t* code, uint16_t length) {
+    if (_staged.load(std::memory_order_acquire) || length > PROGRAM_MAX_CODE) {
+        return false;
+    }
+    strncpy(_stagedName, name, PROGRAM_NAME_LENGTH - 1);
+    _stagedName[PROGRAM_NAME_LENGTH - 1] = '\0';
+    memcpy(_stagedCode, code, length);
+    _stagedLength = length;
+    _staged.store(true, std::memory_order_release);
+    return true;
+}
+
+const char* ProgramEngine::start() {
+    if (!_staged.load(std::memory_order_acquire)) {
+        return "No program staged";
+    }
+    if (running()) {
+        _staged.store(false, std::memory_order_release);
+        return "Program running";
+    }
+
+    memcpy(_code, _stagedCode, _stagedLength);
+    _length = _stagedLength;
+    int64_t now = _clock();
+
+    std::lock_guard<std::mutex> guard(_statusLock);
+    memcpy(_status.name, _stagedName, sizeof(_status.name));
+    _staged.store(false, std::memory_order_release);
+
+    _pc = 0;
+    _opPc = 0;
+    _steps = 0;
+    _depth = 0;
+    _wait = WAIT_NONE;
+    _stepEnd = now;
+    _stopRequested = false;
+    _state = PROGRAM_RUNNING;
+
+    _status.state = PROGRAM_RUNNING;
+    _status.pc = 0;
+    _status.op = _length ? (ProgramOp)_code[0] : OP_END;
+    _status.steps = 0;
+    _status.startedUs = now;
+    _status.endedUs = 0;
+    _status.error = nullptr;
+    return nullptr;
+}
+
+void ProgramEngine::service() {
+    if (!running()) {
+        return;
+    }
+
+    int64_t now = _clock();
+    if (_stopRequested.exchange(false)) {
+        finish(PROGRAM_STOPPED, nullptr, now);
+        return;
+    }
+
+    // Steps that need no waiting follow each other within the tick
+    for (uint8_t i = 0; i < MAX_STEPS_PER_TICK && running(); i++) {
+        if (_wait != WAIT_NONE && waiting(now)) {
+            break;
+        }
+        if (!step(now)) {
+            break;
+        }
+    }
+
+    if (running()) {
+        std::lock_guard<std::mutex> guard(_statusLock);
+        _status.pc = _opPc;
+        _status.op = (ProgramOp)_code[_opPc];
+        _status.steps = _steps;
+    }
+}
+
+bool ProgramEngine::waiting(int64_t now) {
+    switch (_wait) {
+        case WAIT_TABLE:
+            if (_busy()) {
+                return true;
+            }
+            _stepEnd = now;
+            break;
+
+        case WAIT_TIME:
+            if (now < _deadline) {
+                return true;
+            }
+            // Chain from the deadline, not from the tick that noticed it
+            _stepEnd = _deadline;
+            break;
+
+        case WAIT_INPUT:
+            if (((_inputs() & _waitMask) != 0) != _waitActive) {
+                if (_deadline != 0 && now >= _deadline) {
+                    finish(PROGRAM_FAILED, "Input timeout", now);
+                }
+                return true;
+            }
+            _stepEnd = now;
+            break;
+
+        case WAIT_NONE:
+            break;
+    }
+    _wait = WAIT_NONE;
+    return false;
+}
+
+bool ProgramEngine::step(int64_t now) {
+    if (_pc >= _length) {
+        finish(PROGRAM_FAILED, "Corrupt program", now);
+        return false;
+    }
+
+    _opPc = _pc;
+    _steps++;
+    ProgramOp op = (ProgramOp)_code[_pc];
+    uint32_t a = 0;
+    uint32_t b = 0;
+    Command command;
+    const char* error = nullptr;
+
+    switch (op) {
+        case OP_END:
+            finish(PROGRAM_DONE, nullptr, now);
+            return false;
+
+        case OP_GOTO:
+        case OP_INDEX:
+        case OP_HOME:
+            if (op != OP_HOME && !operand(_pc + 1, 2, &a)) {
+                break;
+            }
+            command.type = op == OP_GOTO ? CMD_TABLE_GOTO : op == OP_INDEX ? CMD_TABLE_INDEX : CMD_TABLE_HOME;
+            command.move.value = op == OP_INDEX ? (int16_t)a : (int32_t)a;
+            error = _execute(command);
+            if (error) {
+                finish(PROGRAM_FAILED, error, now);
+                return false;
+            }
+            _pc += op == OP_HOME ? 1 : 3;
+            _wait = WAIT_TABLE;
+            return true;
+
+        case OP_OUTPUTS:
+            if (!operand(_pc + 1, 2, &a) || !operand(_pc + 3, 2, &b)) {
+                break;
+            }
+            command.type = CMD_OUTPUTS;
+            command.outputs.set = a;
+            command.outputs.clear = b;
+            error = _execute(command);
+            if (error) {
+                finish(PROGRAM_FAILED, error, now);
+                return false;
+            }
+            // Takes no time: a following dwell still chains from the last wait
+            _pc += 5;
+            return true;
+
+        case OP_DWELL:
+            if (!operand(_pc + 1, 4, &a)) {
+                break;
+            }
+            _deadline = _stepEnd + a;
+            _wait = WAIT_TIME;
+            _pc += 5;
+            return true;
+
+        case OP_WAIT:
+            if (!operand(_pc + 1, 1, &a) || !operand(_pc + 2, 1, &b) || a >= 16) {
+                break;
+            }
+            _waitMask = 1 << a;
+            _waitActive = b != 0;
+            if (!operand(_pc + 3, 4, &a)) {
+                break;
+            }
+            _deadline = a ? now + (int64_t)a * 1000 : 0;
+            _wait = WAIT_INPUT;
+            _pc += 7;
+            return true;
+
+        case OP_LOOP:
+            if (!operand(_pc + 1, 2, &a) || _depth >= PROGRAM_MAX_LOOP_DEPTH) {
+                break;
+            }
+            _loops[_depth].body = _pc + 3;
+            _loops[_depth].remaining = a;
+            _depth++;
+            _pc += 3;
+            return true;
+
+        case OP_NEXT: {
+            if (_depth == 0) {
+                break;
+            }
+            LoopFrame& frame = _loops[_depth - 1];
+            if (frame.remaining == 0 || --frame.remaining > 0) {
+                _pc = frame.body;
+            } else {
+                _depth--;
+                _pc += 1;
+            }
+            return true;
+        }
+    }
+
+    finish(PROGRAM_FAILED, "Corrupt program", now);
+    return false;
+}
+
+bool ProgramEngine::operand(uint16_t offset, uint8_t size, uint32_t* value) const {
+    if (offset + size > _length) {
+        return false;
+    }
+    uint32_t result = 0;
+    for (uint8_t i = 0; i < size; i++) {
+        result |= (uint32_t)_code[offset + i] << (8 * i);
+    }
+    *value = result;
+    return true;
+}
+
+void ProgramEngine::finish(ProgramState state, const char* error, int64_t now) {
+    _state = state;
+    _wait = WAIT_NONE;
+
+    std::lock_guard<std::mutex> guard(_statusLock);
+    _status.state = state;
+    _status.pc = _opPc;
+    _status.op = _opPc < _length ? (ProgramOp)_code[_opPc] : OP_END;
+    _status.steps = _steps;
+    _status.endedUs = now;
+    _status.error = error;
+}
+
+ProgramStatus ProgramEngine::status() {
+    std::lock_guard<std::mutex> guard(_statusLock);
+    return _status;
+}
+
+const char* ProgramEngine::stateName(ProgramState state) {
+    switch (state) {
+        case PROGRAM_IDLE:    return "idle";
+        case PROGRAM_RUNNING: return "running";
+        case PROGRAM_DONE:    return "done";
+        case PROGRAM_FAILED:  return "failed";
+        case PROGRAM_STOPPED: return "stopped";
+    }
+    return "unknown";
+}
+
+const char* ProgramEngine::opName(ProgramOp op) {
+    switch (op) {
+        case OP_END:     return "end";
+        case OP_GOTO:    return "goto";
+        case OP_INDEX:   return "index";
+        case OP_HOME:    return "home";
+        case OP_OUTPUTS: return "outputs";
+        case OP_DWELL:   return "dwell";
+        case OP_WAIT:    return "wait";
+        case OP_LOOP:    return "loop";
+        case OP_NEXT:    return "next";
+    }
+    return "unknown";
+}
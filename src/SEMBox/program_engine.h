@@ -0,0 +1,186 @@
+/*********
+  SEMBox ESP32 - Program Engine
+  Stored indexing sequences executed on the control task
+
+  A program is a compact bytecode: one opcode byte followed by its
+  little-endian operands.
+
+    OP_GOTO    u16 division     Move to a division, wait until at rest
+    OP_INDEX   i16 count        Index by count divisions, wait until at rest
+    OP_HOME                     Run the homing sequence, wait until done
+    OP_OUTPUTS u16 set, clear   Switch outputs (IO channel masks)
+    OP_DWELL   u32 us           Wait, measured from the end of the last wait
+    OP_WAIT    u8 channel, u8 active, u32 timeout ms (0 = none)
+                                Wait for a debounced input level
+    OP_LOOP    u16 count        Repeat up to the matching OP_NEXT (0 = forever)
+    OP_NEXT
+    OP_END
+
+  Moves and output switches become the same Command the web handlers
+  queue and run through the same execute function, so a program obeys
+  all command validation. service() runs every control tick and executes
+  steps back to back until one has to wait; dwell deadlines are absolute
+  microsecond times chained from the end of the previous step, so loops
+  do not drift. ProgramWriter builds and checks the bytecode.
+
+  Plain C++, the clock and the table/IO access are injected.
+*********/
+
+#ifndef PROGRAM_ENGINE_H
+#define PROGRAM_ENGINE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+#include <mutex>
+#include "command_queue.h"
+
+enum ProgramOp : uint8_t {
+    OP_END,
+    OP_GOTO,
+    OP_INDEX,
+    OP_HOME,
+    OP_OUTPUTS,
+    OP_DWELL,
+    OP_WAIT,
+    OP_LOOP,
+    OP_NEXT
+};
+
+enum ProgramState : uint8_t {
+    PROGRAM_IDLE,
+    PROGRAM_RUNNING,
+    PROGRAM_DONE,
+    PROGRAM_FAILED,
+    PROGRAM_STOPPED
+};
+
+static const uint16_t PROGRAM_MAX_CODE = 256;
+static const uint8_t PROGRAM_NAME_LENGTH = 16;     // Including the terminator
+static const uint8_t PROGRAM_MAX_LOOP_DEPTH = 4;
+
+/**
+ * Appends checked instructions to a code buffer. Every method returns
+ * an error message, or nullptr; the first error sticks.
+ */
+class ProgramWriter {
+public:
+    ProgramWriter(uint8_t* code, uint16_t capacity);
+
+    const char* gotoDivision(int32_t division);
+    const char* index(int32_t count);
+    const char* home();
+    const char* outputs(uint16_t set, uint16_t clear);
+    const char* dwell(uint32_t us);
+    const char* wait(uint8_t channel, bool active, uint32_t timeoutMs);
+    const char* loop(uint16_t count);
+    const char* next();
+
+    // Terminate the program; fails on an unclosed loop
+    const char* end();
+
+    uint16_t length() const { return _length; }
+
+private:
+    const char* put(const uint8_t* bytes, uint16_t count);
+
+    uint8_t* _code;
+    uint16_t _capacity;
+    uint16_t _length;
+    uint8_t _depth;
+    const char* _error;
+};
+
+struct ProgramStatus {
+    ProgramState state;
+    char name[PROGRAM_NAME_LENGTH];
+    uint16_t pc;                // Offset of the current instruction
+    ProgramOp op;               // Current instruction
+    uint32_t steps;             // Instructions executed
+    int64_t startedUs;
+    int64_t endedUs;            // 0 while running
+    const char* error;
+};
+
+typedef int64_t (*ProgramClock)();                          // Microseconds, monotonic
+typedef const char* (*ProgramExecute)(const Command& command);
+typedef bool (*ProgramBusy)();                              // Table moving or homing
+typedef uint16_t (*ProgramInputs)();                        // Debounced input mask
+
+class ProgramEngine {
+public:
+    static const uint8_t MAX_STEPS_PER_TICK = 16;
+
+    ProgramEngine(ProgramClock clock, ProgramExecute execute, ProgramBusy busy, ProgramInputs inputs);
+
+    /**
+     * Hand over a program to start (request handler). Returns false if
+     * the previous one has not been picked up by start() yet.
+     */
+    bool stage(const char* name, const uint8_t* code, uint16_t length);
+
+    // Withdraw a staged program whose start could not be queued
+    void unstage() { _staged.store(false, std::memory_order_release); }
+
+    // Start the staged program (control task); error message or nullptr
+    const char* start();
+
+    // Run due steps (control task, every tick)
+    void service();
+
+    // End the program on the next service() (any task)
+    void stop() { _stopRequested = true; }
+
+    bool running() const { return _state == PROGRAM_RUNNING; }
+    ProgramState state() const { return _state; }
+    ProgramStatus status();
+
+    static const char* stateName(ProgramState state);
+    static const char* opName(ProgramOp op);
+
+private:
+    enum Wait : uint8_t { WAIT_NONE, WAIT_TABLE, WAIT_TIME, WAIT_INPUT };
+
+    struct LoopFrame {
+        uint16_t body;          // First instruction of the loop body
+        uint16_t remaining;     // Passes left, 0 = forever
+    };
+
+    bool step(int64_t now);
+    bool waiting(int64_t now);
+    bool operand(uint16_t offset, uint8_t size, uint32_t* value) const;
+    void finish(ProgramState state, const char* error, int64_t now);
+
+    ProgramClock _clock;
+    ProgramExecute _execute;
+    ProgramBusy _busy;
+    ProgramInputs _inputs;
+
+    // Staging area, filled by the request handler
+    std::atomic<bool> _staged;
+    char _stagedName[PROGRAM_NAME_LENGTH];
+    uint8_t _stagedCode[PROGRAM_MAX_CODE];
+    uint16_t _stagedLength;
+    std::atomic<bool> _stopRequested;
+
+    // Running program (control task)
+    uint8_t _code[PROGRAM_MAX_CODE];
+    uint16_t _length;
+    uint16_t _pc;               // Next instruction
+    uint16_t _opPc;             // Instruction being executed or waited on
+    uint32_t _steps;
+    volatile ProgramState _state;
+    Wait _wait;
+    int64_t _stepEnd;           // End of the last step; base of the next dwell
+    int64_t _deadline;          // Dwell end or input timeout (0 = none)
+    uint16_t _waitMask;
+    bool _waitActive;
+    LoopFrame _loops[PROGRAM_MAX_LOOP_DEPTH];
+    uint8_t _depth;
+
+    // Copy for status readers
+    std::mutex _statusLock;
+    ProgramStatus _status;
+};
+
+#endif // PROGRAM_ENGINE_H
@@ -0,0 +1,182 @@
+/*********
+  SEMBox ESP32 - Program Store
+*********/
+
+#include "program_store.h"
+#include <stddef.h>
+#include <string.h>
+#include "esp_rom_crc.h"
+
+static const uint32_t RECORD_MAGIC = 0x53425047;   // "SBPG"
+
+ProgramStore::ProgramStore() : _open(false) {
+    memset(&_record, 0, sizeof(_record));
+    memset(_changes, 0, sizeof(_changes));
+    memset(_sequence, 0, sizeof(_sequence));
+    memset(_pending, 0, sizeof(_pending));
+    memset(&_write, 0, sizeof(_write));
+    _failedName[0] = '\0';
+}
+
+bool ProgramStore::begin(const char* nvsNamespace) {
+    _open = _preferences.begin(nvsNamespace, false);
+    return _open;
+}
+
+const char* ProgramStore::save(const char* name, const uint8_t* code, uint16_t length) {
+    size_t nameLength = strlen(name);
+    if (nameLength == 0 || nameLength >= PROGRAM_NAME_LENGTH) {
+        return "Invalid program name (1-15 characters)";
+    }
+    if (length > PROGRAM_MAX_CODE) {
+        return "Program too long";
+    }
+    if (!_open) {
+        return "Program store unavailable";
+    }
+
+    // Same name replaces, otherwise the first free slot
+    int slot = find(name, &_record);
+    for (uint8_t i = 0; slot < 0 && i < MAX_PROGRAMS; i++) {
+        if (!read(i, &_record)) {
+            slot = i;
+        }
+    }
+    if (slot < 0) {
+        return "Program store full";
+    }
+
+    memset(&_record, 0, sizeof(_record));
+    _record.magic = RECORD_MAGIC;
+    strlcpy(_record.name, name, sizeof(_record.name));
+    _record.length = length;
+    memcpy(_record.code, code, length);
+    _record.crc = checksum(_record);
+    queue(CHANGE_SAVE, slot);
+    return nullptr;
+}
+
+bool ProgramStore::load(const char* name, uint8_t* code, uint16_t* length) {
+    if (find(name, &_record) < 0) {
+        return false;
+    }
+    memcpy(code, _record.code, _record.length);
+    *length = _record.length;
+    return true;
+}
+
+const char* ProgramStore::remove(const char* name) {
+    int slot = find(name, &_record);
+    if (slot < 0) {
+        return "Unknown program";
+    }
+    queue(CHANGE_REMOVE, slot);
+    return nullptr;
+}
+
+void ProgramStore::queue(Change change, int slot) {
+    std::lock_guard<std::mutex> guard(_lock);
+    memcpy(&_pending[slot], &_record, sizeof(_pending[slot]));
+    _changes[slot] = change;
+    _sequence[slot]++;
+}
+
+bool ProgramStore::service() {
+    bool ok = true;
+    for (uint8_t slot = 0; slot < MAX_PROGRAMS; slot++) {
+        Change change;
+        uint32_t sequence;
+        {
+            std::lock_guard<std::mutex> guard(_lock);
+            change = _changes[slot];
+            sequence = _sequence[slot];
+            if (change != CHANGE_NONE) {
+                memcpy(&_write, &_pending[slot], sizeof(_write));
+            }
+        }
+        if (change == CHANGE_NONE) {
+            continue;
+        }
+
+        // Written without the lock; read() keeps serving the slot from
+        // _pending until the newest change for it is in flash
+        char key[4];
+        slotKey(slot, key);
+        bool written = change == CHANGE_SAVE
+            ? _preferences.putBytes(key, &_write, HEADER_SIZE + _write.length) == HEADER_SIZE + _write.length
+            : _preferences.remove(key);
+        if (!written) {
+            memcpy(_failedName, _write.name, sizeof(_failedName));
+            ok = false;
+        }
+
+        std::lock_guard<std::mutex> guard(_lock);
+        if (_sequence[slot] == sequence) {
+            _changes[slot] = CHANGE_NONE;
+        }
+    }
+    return ok;
+}
+
+uint8_t ProgramStore::list(ProgramInfo* programs, uint8_t maxPrograms) {
+    uint8_t count = 0;
+    for (uint8_t i = 0; i < MAX_PROGRAMS && count < maxPrograms; i++) {
+        if (read(i, &_record)) {
+            memcpy(programs[count].name, _record.name, sizeof(programs[count].name));
+            programs[count].length = _record.length;
+            count++;
+        }
+    }
+    return count;
+}
+
+int ProgramStore::find(const char* name, Record* record) {
+    for (uint8_t i = 0; i < MAX_PROGRAMS; i++) {
+        if (read(i, record) && strcmp(record->name, name) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+bool ProgramStore::read(uint8_t slot, Record* record) {
+    if (!_open) {
+        return false;
+    }
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        if (_changes[slot] != CHANGE_NONE) {
+            if (_changes[slot] == CHANGE_SAVE) {
+                memcpy(record, &_pending[slot], sizeof(*record));
+            }
+            return _changes[slot] == CHANGE_SAVE;
+        }
+    }
+    char key[4];
+    slotKey(slot, key);
+    if (!_preferences.isKey(key)) {
+        return false;
+    }
+
+    size_t size = _preferences.getBytesLength(key);
+    if (size < HEADER_SIZE || size > sizeof(Record) ||
+        _preferences.getBytes(key, record, size) != size) {
+        return false;
+    }
+    record->name[PROGRAM_NAME_LENGTH - 1] = '\0';
+    return record->magic == RECORD_MAGIC
+        && size == HEADER_SIZE + record->length
+        && record->crc == checksum(*record);
+}
+
+void ProgramStore::slotKey(uint8_t slot, char* key) {
+    key[0] = 'p';
+    key[1] = '0' + slot;
+    key[2] = '\0';
+}
+
+uint32_t ProgramStore::checksum(const Record& record) {
+    uint32_t crc = esp_rom_crc32_le(0, (const uint8_t*)record.name, sizeof(record.name));
+    crc = esp_rom_crc32_le(crc, (const uint8_t*)&record.length, sizeof(record.length));
+    return esp_rom_crc32_le(crc, record.code, record.length);
+}
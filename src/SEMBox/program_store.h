@@ -0,0 +1,89 @@
+/*********
+  SEMBox ESP32 - Program Store
+  Named indexing programs kept in NVS
+
+  Each program is one CRC-protected blob (name, length, bytecode) in a
+  fixed slot of its own NVS namespace, so saving one program never
+  rewrites another and the settings record is not touched. Saving under
+  an existing name replaces that program.
+
+  Request handlers only check and queue a save or delete; service(),
+  called from loop(), writes it, so NVS writes never block the AsyncTCP
+  task. Each slot holds its newest queued change, which load() and list()
+  already see. The control task runs a RAM copy (ProgramEngine::stage).
+*********/
+
+#ifndef PROGRAM_STORE_H
+#define PROGRAM_STORE_H
+
+#include <Preferences.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <mutex>
+#include "program_engine.h"
+
+struct ProgramInfo {
+    char name[PROGRAM_NAME_LENGTH];
+    uint16_t length;            // Bytecode bytes
+};
+
+class ProgramStore {
+public:
+    static const uint8_t MAX_PROGRAMS = 8;
+
+    ProgramStore();
+
+    bool begin(const char* nvsNamespace);
+
+    // Queue storing under a name (replacing it); error message or nullptr
+    const char* save(const char* name, const uint8_t* code, uint16_t length);
+
+    // Read a program; false if missing or corrupt
+    bool load(const char* name, uint8_t* code, uint16_t* length);
+
+    // Queue removing a program; error message or nullptr
+    const char* remove(const char* name);
+
+    // Write the queued changes; call from a task that may block on flash.
+    // False if a write failed (that change is dropped).
+    bool service();
+
+    // Program whose change the last failed service() dropped
+    const char* failedName() const { return _failedName; }
+
+    // Stored programs in slot order; returns the count
+    uint8_t list(ProgramInfo* programs, uint8_t maxPrograms);
+
+private:
+    struct Record {
+        uint32_t magic;
+        char name[PROGRAM_NAME_LENGTH];
+        uint16_t length;
+        uint16_t reserved;
+        uint32_t crc;           // Over name, length and code
+        uint8_t code[PROGRAM_MAX_CODE];
+    };
+    static const size_t HEADER_SIZE = offsetof(Record, code);   // Stored size = header + length
+
+    enum Change : uint8_t { CHANGE_NONE, CHANGE_SAVE, CHANGE_REMOVE };
+
+    int find(const char* name, Record* record);
+    bool read(uint8_t slot, Record* record);
+    void queue(Change change, int slot);
+    static void slotKey(uint8_t slot, char* key);
+    static uint32_t checksum(const Record& record);
+
+    Preferences _preferences;
+    bool _open;
+    Record _record;             // Scratch, too large for the AsyncTCP stack
+
+    // Queued changes by slot; _pending is the record to save or remove
+    std::mutex _lock;
+    Change _changes[MAX_PROGRAMS];
+    uint32_t _sequence[MAX_PROGRAMS];   // Bumped by every change queued
+    Record _pending[MAX_PROGRAMS];
+    Record _write;              // Copy service() writes from
+    char _failedName[PROGRAM_NAME_LENGTH];
+};
+
+#endif // PROGRAM_STORE_H
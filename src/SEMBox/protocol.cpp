@@ -0,0 +1,112 @@
+/*********
+  SEMBox ESP32 - Protocol
+*********/
+
+#include "protocol.h"
+#include <stdio.h>
+
+static bool appendField(char* buffer, size_t capacity, size_t* length,
+                        const char* name, StatusFormat format, int64_t value) {
+    char* out = buffer + *length;
+    size_t space = capacity - *length;
+    int written;
+
+    switch (format) {
+        case FMT_INT:
+            written = snprintf(out, space, "\"%s\":%ld,", name, (long)value);
+            break;
+        case FMT_BOOL:
+            written = snprintf(out, space, "\"%s\":%s,", name, value ? "true" : "false");
+            break;
+        case FMT_ONOFF:
+            written = snprintf(out, space, "\"%s\":\"%s\",", name, value ? "on" : "off");
+            break;
+        case FMT_MILLI:
+            written = snprintf(out, space, "\"%s\":%lu.%03lu,", name,
+                               (unsigned long)(value / 1000), (unsigned long)(value % 1000));
+            break;
+        case FMT_TENTHS:
+            written = snprintf(out, space, "\"%s\":%lu.%lu,", name,
+                               (unsigned long)(value / 10), (unsigned long)(value % 10));
+            break;
+        case FMT_IPV4:
+            written = snprintf(out, space, "\"%s\":\"%u.%u.%u.%u\",", name,
+                               (unsigned)(value & 0xFF), (unsigned)((value >> 8) & 0xFF),
+                               (unsigned)((value >> 16) & 0xFF), (unsigned)((value >> 24) & 0xFF));
+            break;
+        default:
+            written = snprintf(out, space, "\"%s\":%lu,", name, (unsigned long)value);
+            break;
+    }
+
+    if (written < 0 || (size_t)written >= space) {
+        return false;
+    }
+    *length += written;
+    return true;
+}
+
+bool formatStatusFields(const StatusRecord& status, char* buffer, size_t capacity, size_t* length) {
+    size_t used = *length;
+    if (used + 1 >= capacity) {
+        return false;
+    }
+    buffer[used++] = '{';
+
+    bool ok = true;
+#define STATUS_JSON(name, type, format) \
+    ok = ok && appendField(buffer, capacity, &used, #name, format, (int64_t)status.name);
+    STATUS_FIELDS(STATUS_JSON)
+#undef STATUS_JSON
+
+    if (ok) {
+        *length = used;
+    }
+    return ok;
+}
+
+bool decodeCommand(const WireCommand& wire, Command& command) {
+    switch (wire.type) {
+        case WIRE_LED:
+            command.type = CMD_OUTPUTS;
+            command.outputs.set = (wire.flags & WIRE_LED_ON) ? 1u << WIRE_LED_CHANNEL : 0;
+            command.outputs.clear = (wire.flags & WIRE_LED_ON) ? 0 : 1u << WIRE_LED_CHANNEL;
+            return true;
+
+        case WIRE_OUTPUTS:
+            command.type = CMD_OUTPUTS;
+            command.outputs.set = (uint32_t)wire.value & 0xFFFF;
+            command.outputs.clear = (uint32_t)wire.value >> 16;
+            return true;
+
+        case WIRE_PARAMS:
+            command.type = CMD_PARAMS;
+            command.params.hasTable = wire.flags & WIRE_PARAMS_TABLE;
+            command.params.hasLimits = wire.flags & WIRE_PARAMS_LIMITS;
+            command.params.hasFollowing = false;
+            command.params.division = wire.value;
+            command.params.ratioMilli = wire.ratioMilli;
+            command.params.limits.maxVelocity = wire.maxVelocity;
+            command.params.limits.acceleration = wire.acceleration;
+            command.params.limits.jerk = wire.jerk;
+            return true;
+
+        case WIRE_TABLE_INDEX:
+            command.type = CMD_TABLE_INDEX;
+            command.move.value = wire.value;
+            return true;
+
+        case WIRE_TABLE_GOTO:
+            command.type = CMD_TABLE_GOTO;
+            command.move.value = wire.value;
+            return true;
+
+        case WIRE_TABLE_HOME:
+            command.type = CMD_TABLE_HOME;
+            command.move.value = wire.value;
+            return true;
+
+        default:
+            return false;
+    }
+}
@@ -0,0 +1,136 @@
+/*********
+  SEMBox ESP32 - Protocol
+  Status and command schema shared by the JSON and binary endpoints
+
+  STATUS_FIELDS lists every scalar status field once: its name (also the
+  JSON key), its wire type and how it is rendered as JSON. The packed
+  StatusRecord served by /status.bin and the fields of the /status JSON
+  are both generated from this list, so the two cannot diverge.
+
+  Commands posted to /command.bin are WireCommand records. Their type is
+  a WireOpcode, numbered independently of CommandType so the wire values
+  stay fixed when the command set changes. They decode into the same
+  Command the GET and /batch handlers build and go through the same
+  validation.
+
+  All binary data is little-endian (native on the ESP32) and unpadded.
+*********/
+
+#ifndef PROTOCOL_H
+#define PROTOCOL_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "command_queue.h"
+
+// JSON rendering of a status field
+enum StatusFormat : uint8_t {
+    FMT_UINT,
+    FMT_INT,
+    FMT_BOOL,
+    FMT_ONOFF,      // "on" / "off"
+    FMT_MILLI,      // Fixed point, 3 decimals
+    FMT_TENTHS,     // Fixed point, 1 decimal
+    FMT_IPV4        // First octet in the low byte
+};
+
+// X(name, wire type, format); append only, bump STATUS_SCHEMA_VERSION on change
+#define STATUS_FIELDS(X) \
+    X(led,          uint8_t,  FMT_ONOFF) \
+    X(uptime,       uint32_t, FMT_UINT) \
+    X(clients,      uint8_t,  FMT_UINT) \
+    X(freeHeap,     uint32_t, FMT_UINT) \
+    X(totalHeap,    uint32_t, FMT_UINT) \
+    X(flashSize,    uint32_t, FMT_UINT) \
+    X(sketchSize,   uint32_t, FMT_UINT) \
+    X(division,     uint16_t, FMT_UINT) \
+    X(ratio,        uint32_t, FMT_MILLI) \
+    X(ip,           uint32_t, FMT_IPV4) \
+    X(moving,       uint8_t,  FMT_BOOL) \
+    X(position,     int32_t,  FMT_INT) \
+    X(index,        uint16_t, FMT_UINT) \
+    X(stepJitterUs, uint32_t, FMT_TENTHS) \
+    X(stepOverruns, uint32_t, FMT_UINT) \
+    X(cmdId,        uint32_t, FMT_UINT) \
+    X(cmdOp,        int8_t,   FMT_INT) \
+    X(cmdFailed,    uint8_t,  FMT_BOOL) \
+    X(cmdDropped,   uint32_t, FMT_UINT) \
+    X(nvsWrites,    uint32_t, FMT_UINT) \
+    X(nvsPending,   uint8_t,  FMT_BOOL) \
+    X(tickMissed,   uint32_t, FMT_UINT) \
+    X(heapMinFree,  uint32_t, FMT_UINT) \
+    X(heapLargest,  uint32_t, FMT_UINT) \
+    X(heapFrag,     uint16_t, FMT_MILLI) \
+    X(allocFailed,  uint32_t, FMT_UINT) \
+    X(outputs,      uint16_t, FMT_UINT) \
+    X(inputs,       uint16_t, FMT_UINT) \
+    X(inputEdges,   uint32_t, FMT_UINT) \
+    X(homed,        uint8_t,  FMT_BOOL) \
+    X(homing,       uint8_t,  FMT_UINT) \
+    X(program,      uint8_t,  FMT_UINT) \
+    X(encoder,      int32_t,  FMT_INT) \
+    X(followError,  int32_t,  FMT_INT) \
+    X(encoderFault, uint8_t,  FMT_BOOL)
+
+const uint16_t STATUS_SCHEMA_VERSION = 7;
+
+// Command types on the wire. Values are never reused or renumbered.
+enum WireOpcode : uint8_t {
+    WIRE_LED = 0,           // Switch the LED channel
+    WIRE_PARAMS = 1,
+    WIRE_TABLE_INDEX = 2,
+    WIRE_TABLE_GOTO = 3,
+    // 4 was reserved for batches, which are sent as several records
+    WIRE_TABLE_HOME = 5,
+    WIRE_OUTPUTS = 6,       // Set and clear output masks
+};
+
+#pragma pack(push, 1)
+
+struct StatusRecord {
+    uint16_t schema;        // STATUS_SCHEMA_VERSION
+    uint16_t size;          // sizeof(StatusRecord)
+#define STATUS_MEMBER(name, type, format) type name;
+    STATUS_FIELDS(STATUS_MEMBER)
+#undef STATUS_MEMBER
+};
+
+// One operation on /command.bin; several records form a batch
+struct WireCommand {
+    uint8_t type;           // WireOpcode
+    uint8_t flags;          // LED: bit 0 = on; params: bit 0 = table, bit 1 = limits
+    uint16_t reserved;
+    int32_t value;          // Outputs: set mask | clear mask << 16;
+                            // division (params, goto) or count (index)
+    uint32_t ratioMilli;
+    uint32_t maxVelocity;
+    uint32_t acceleration;
+    uint32_t jerk;
+};
+
+// Reply to /command.bin
+struct WireCommandReply {
+    uint32_t command;       // Command id, 0 if rejected
+    uint8_t accepted;
+    uint8_t failedOp;       // Index of the invalid record, 0xFF if none
+    uint16_t reserved;
+};
+
+#pragma pack(pop)
+
+const uint8_t WIRE_LED_ON = 0x01;
+const uint8_t WIRE_LED_CHANNEL = 0;     // Output channel behind WIRE_LED
+const uint8_t WIRE_PARAMS_TABLE = 0x01;
+const uint8_t WIRE_PARAMS_LIMITS = 0x02;
+
+/**
+ * Append the status fields as JSON members, starting with '{' and ending
+ * with ',' so the caller can add its own members and close the object.
+ * Returns false (leaving *length unchanged) if the buffer is too small.
+ */
+bool formatStatusFields(const StatusRecord& status, char* buffer, size_t capacity, size_t* length);
+
+// Decode one wire record; false if the opcode is not accepted
+bool decodeCommand(const WireCommand& wire, Command& command);
+
+#endif // PROTOCOL_H
@@ -0,0 +1,82 @@
+/*********
+  SEMBox ESP32 - Query Fields
+*********/
+
+#include "query_fields.h"
+#include "index_math.h"
+#include <string.h>
+
+// Optional '-' then 1 to maxDigits digits, nothing else
+static bool parseDecimal(const char* text, bool allowNegative, uint8_t maxDigits, int64_t* value) {
+    bool negative = allowNegative && *text == '-';
+    if (negative) {
+        text++;
+    }
+    if (*text == 0) {
+        return false;
+    }
+    int64_t number = 0;
+    for (uint8_t digits = 0; *text; text++, digits++) {
+        if (*text < '0' || *text > '9' || digits == maxDigits) {
+            return false;
+        }
+        number = number * 10 + (*text - '0');
+    }
+    *value = negative ? -number : number;
+    return true;
+}
+
+QueryFields::QueryFields(const QueryField* fields, uint8_t count)
+    : _fields(fields), _count(count < MAX_FIELDS ? count : MAX_FIELDS), _present(0), _seen(0), _invalid(nullptr) {
+}
+
+bool QueryFields::set(const char* name, const char* text) {
+    for (uint8_t i = 0; i < _count; i++) {
+        if (strcmp(_fields[i].name, name) != 0) {
+            continue;
+        }
+        if (_seen & (1 << i)) {
+            return true;
+        }
+        _seen |= 1 << i;
+        if (!parse(_fields[i], text)) {
+            if (!_invalid) {
+                _invalid = _fields[i].name;
+            }
+            return false;
+        }
+        _present |= 1 << i;
+        return true;
+    }
+    return true;
+}
+
+bool QueryFields::parse(const QueryField& field, const char* text) {
+    int64_t number;
+    switch (field.type) {
+        case QUERY_INT:
+            if (!parseDecimal(text, true, 10, &number) || number < INT32_MIN || number > INT32_MAX) {
+                return false;
+            }
+            *(int32_t*)field.value = (int32_t)number;
+            return true;
+
+        case QUERY_UINT:
+            if (!parseDecimal(text, false, 10, &number) || number > UINT32_MAX) {
+                return false;
+            }
+            *(uint32_t*)field.value = (uint32_t)number;
+            return true;
+
+        case QUERY_INT64:
+            return parseDecimal(text, true, 18, (int64_t*)field.value);
+
+        case QUERY_RATIO:
+            return parseRatioMilli(text, (uint32_t*)field.value);
+
+        case QUERY_TEXT:
+            *(const char**)field.value = text;
+            return true;
+    }
+    return false;
+}
@@ -0,0 +1,61 @@
+/*********
+  SEMBox ESP32 - Query Fields
+  Strict typed parsing of query parameters, in place
+
+  A handler lists the parameters it takes, each with a type and the
+  variable it goes into; set() is fed every name/value pair of the
+  request and parses the value straight from the request's own text
+  into that variable, without String temporaries or copies. Unlike
+  toInt(), a number must be the whole value: "12abc", "", "+5", "1e3",
+  a sign on an unsigned field or a value outside the type's range make
+  the field invalid instead of quietly becoming 12 or 0. Range checks
+  that depend on the machine (validateCommand) stay with the caller.
+  Unknown names are ignored; of repeated names the first one counts.
+  Plain C++, builds on a Linux host.
+*********/
+
+#ifndef QUERY_FIELDS_H
+#define QUERY_FIELDS_H
+
+#include <stdint.h>
+
+enum QueryFieldType : uint8_t {
+    QUERY_INT,      // int32_t, optional leading '-'
+    QUERY_UINT,     // uint32_t
+    QUERY_INT64,    // int64_t, optional leading '-', up to 18 digits
+    QUERY_RATIO,    // uint32_t thousandths, up to 3 decimals (parseRatioMilli)
+    QUERY_TEXT      // const char*, pointing into the request
+};
+
+struct QueryField {
+    const char* name;
+    QueryFieldType type;
+    void* value;                // Written only when the text is valid
+};
+
+class QueryFields {
+public:
+    static const uint8_t MAX_FIELDS = 16;
+
+    QueryFields(const QueryField* fields, uint8_t count);
+
+    // One parameter; false if it is one of the fields and invalid
+    bool set(const char* name, const char* text);
+
+    // Field given with a valid value (index into the field list)
+    bool has(uint8_t index) const { return (_present >> index) & 1; }
+
+    // Name of the first invalid field, or nullptr
+    const char* invalid() const { return _invalid; }
+
+private:
+    static bool parse(const QueryField& field, const char* text);
+
+    const QueryField* _fields;
+    uint8_t _count;
+    uint16_t _present;
+    uint16_t _seen;
+    const char* _invalid;
+};
+
+#endif // QUERY_FIELDS_H
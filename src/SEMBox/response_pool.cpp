@@ -0,0 +1,41 @@
+/*********
+  SEMBox ESP32 - Response Pool
+*********/
+
+#include "response_pool.h"
+
+ResponsePool::ResponsePool() : _used(0), _peak(0), _misses(0) {
+}
+
+char* ResponsePool::acquire() {
+    uint32_t used = _used.load(std::memory_order_relaxed);
+    for (;;) {
+        uint8_t slab = 0;
+        while (slab < SLABS && (used >> slab) & 1) {
+            slab++;
+        }
+        if (slab == SLABS) {
+            _misses.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        if (_used.compare_exchange_weak(used, used | (1u << slab), std::memory_order_acquire,
+                                        std::memory_order_relaxed)) {
+            uint8_t count = __builtin_popcount(used) + 1;
+            uint8_t peak = _peak.load(std::memory_order_relaxed);
+            while (count > peak && !_peak.compare_exchange_weak(peak, count, std::memory_order_relaxed)) {
+            }
+            return _slabs[slab];
+        }
+    }
+}
+
+void ResponsePool::release(char* slab) {
+    uint32_t index = (slab - _slabs[0]) / SLAB_SIZE;
+    if (index < SLABS) {
+        _used.fetch_and(~(1u << index), std::memory_order_release);
+    }
+}
+
+uint8_t ResponsePool::inUse() const {
+    return __builtin_popcount(_used.load(std::memory_order_relaxed));
+}
@@ -0,0 +1,42 @@
+/*********
+  SEMBox ESP32 - Response Pool
+  Fixed slabs for small response bodies
+
+  A control reply ({"success":true,"command":12}) is formatted into a
+  slab and handed to the server without a copy; the slab goes back to
+  the pool when the connection closes. SLABS bounds the replies in
+  flight at once, which the AsyncTCP connection limit keeps in the same
+  range; when all are taken acquire() fails, the miss is counted and
+  the caller falls back to a copying send. acquire() and release() are
+  lock-free. Plain C++, builds on a Linux host.
+*********/
+
+#ifndef RESPONSE_POOL_H
+#define RESPONSE_POOL_H
+
+#include <stdint.h>
+#include <atomic>
+
+class ResponsePool {
+public:
+    static const uint8_t SLABS = 8;
+    static const uint16_t SLAB_SIZE = 256;
+
+    ResponsePool();
+
+    // Free slab of SLAB_SIZE bytes, or nullptr if all are in use
+    char* acquire();
+    void release(char* slab);
+
+    uint8_t inUse() const;
+    uint8_t peak() const { return _peak.load(std::memory_order_relaxed); }
+    uint32_t misses() const { return _misses.load(std::memory_order_relaxed); }
+
+private:
+    char _slabs[SLABS][SLAB_SIZE];
+    std::atomic<uint32_t> _used;        // Bit per slab
+    std::atomic<uint8_t> _peak;
+    std::atomic<uint32_t> _misses;
+};
+
+#endif // RESPONSE_POOL_H
@@ -0,0 +1,222 @@
+/*********
+  SEMBox ESP32 - Route Metrics
+*********/
+
+#include "route_metrics.h"
+#include <stdio.h>
+#include <string.h>
+
+RouteMetrics::RouteMetrics(MetricsClock clock, MetricsHeapFree heapFree, MetricsAllocCount allocCount)
+    : _clock(clock), _heapFree(heapFree), _allocCount(allocCount), _count(0), _current(-1), _start(0),
+      _heapStart(0), _allocStart(0), _allocEnd(0), _responded(false) {
+}
+
+int RouteMetrics::add(const char* route) {
+    if (_count >= MAX_ROUTES) {
+        return -1;
+    }
+    RouteCounters& counters = _routes[_count];
+    counters.route = route;
+    counters.requests.store(0, std::memory_order_relaxed);
+    counters.bytes.store(0, std::memory_order_relaxed);
+    counters.heapBytes.store(0, std::memory_order_relaxed);
+    counters.allocations.store(0, std::memory_order_relaxed);
+    counters.sumUs.store(0, std::memory_order_relaxed);
+    for (uint8_t i = 0; i < BUCKETS; i++) {
+        counters.buckets[i].store(0, std::memory_order_relaxed);
+    }
+    return _count++;
+}
+
+void RouteMetrics::begin(int id) {
+    _current = id;
+    _heapStart = _heapFree ? _heapFree() : 0;
+    _allocStart = _allocCount ? _allocCount() : 0;
+    _responded = false;
+    _start = _clock();
+}
+
+void RouteMetrics::end() {
+    if (_current < 0) {
+        return;
+    }
+    uint32_t elapsed = (uint32_t)(_clock() - _start);
+    RouteCounters& counters = _routes[_current];
+    _current = -1;
+
+    if (_allocCount) {
+        uint32_t allocEnd = _responded ? _allocEnd : _allocCount();
+        counters.allocations.fetch_add(allocEnd - _allocStart, std::memory_order_relaxed);
+    }
+
+    uint32_t heapEnd = _heapFree ? _heapFree() : 0;
+    if (heapEnd < _heapStart) {
+        counters.heapBytes.fetch_add(_heapStart - heapEnd, std::memory_order_relaxed);
+    }
+
+    uint8_t bucket = 0;
+    while (bucket < BUCKETS - 1 && elapsed > bucketBound(bucket)) {
+        bucket++;
+    }
+    counters.buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+    counters.sumUs.fetch_add(elapsed, std::memory_order_relaxed);
+    counters.requests.fetch_add(1, std::memory_order_relaxed);
+}
+
+void RouteMetrics::addBytes(uint32_t bytes) {
+    if (_current < 0) {
+        return;
+    }
+    if (_allocCount && !_responded) {
+        _allocEnd = _allocCount();
+        _responded = true;
+    }
+    _routes[_current].bytes.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+uint32_t RouteMetrics::bucketBound(uint8_t bucket) {
+    return bucket < BUCKETS - 1 ? FIRST_BUCKET_US << (2 * bucket) : 0;
+}
+
+// ===========================================
+// Prometheus Export
+// ===========================================
+
+enum MetricsFamily : uint8_t {
+    FAMILY_REQUESTS,
+    FAMILY_BYTES,
+    FAMILY_HEAP,
+    FAMILY_ALLOCATIONS,
+    FAMILY_DURATION,
+    FAMILY_DONE
+};
+
+MetricsWriter::MetricsWriter(const RouteMetrics& metrics)
+    : _metrics(metrics), _family(FAMILY_REQUESTS), _route(0), _step(0),
+      _snapshotSumUs(0), _lineLength(0), _lineOffset(0) {
+    memset(_snapshot, 0, sizeof(_snapshot));
+}
+
+size_t MetricsWriter::read(char* buffer, size_t maxLength) {
+    size_t written = 0;
+    while (written < maxLength) {
+        if (_lineOffset == _lineLength) {
+            if (!nextLine()) {
+                break;
+            }
+        }
+        size_t chunk = _lineLength - _lineOffset;
+        if (chunk > maxLength - written) {
+            chunk = maxLength - written;
+        }
+        memcpy(buffer + written, _line + _lineOffset, chunk);
+        _lineOffset += chunk;
+        written += chunk;
+    }
+    return written;
+}
+
+/**
+ * Format the next line(s) of the document into _line.
+ * Families are written one after another, each with its HELP/TYPE header
+ * followed by one sample (or, for the histogram, one sample set) per route.
+ */
+bool MetricsWriter::nextLine() {
+    int length = 0;
+    _lineOffset = 0;
+
+    while (_family != FAMILY_DONE) {
+        if (_family == FAMILY_ALLOCATIONS && !_metrics.countsAllocations()) {
+            _family++;
+            continue;
+        }
+
+        if (_step == 0 && _route == 0) {
+            static const char* const headers[] = {
+                "# HELP sembox_http_requests_total HTTP requests handled.\n"
+                "# TYPE sembox_http_requests_total counter\n",
+                "# HELP sembox_http_response_bytes_total HTTP response body bytes.\n"
+                "# TYPE sembox_http_response_bytes_total counter\n",
+                "# HELP sembox_http_heap_bytes_total Heap held by the response when the handler returned.\n"
+                "# TYPE sembox_http_heap_bytes_total counter\n",
+                "# HELP sembox_http_handler_allocations_total Heap allocations made by the handler.\n"
+                "# TYPE sembox_http_handler_allocations_total counter\n",
+                "# HELP sembox_http_request_duration_seconds Handler execution time.\n"
+                "# TYPE sembox_http_request_duration_seconds histogram\n"
+            };
+            length = snprintf(_line, sizeof(_line), "%s", headers[_family]);
+            _step = 1;
+            break;
+        }
+
+        if (_route >= _metrics.count()) {
+            _family++;
+            _route = 0;
+            _step = 0;
+            continue;
+        }
+
+        const RouteCounters& counters = _metrics.route(_route);
+
+        if (_family != FAMILY_DURATION) {
+            static const char* const names[] = { "requests", "response_bytes", "heap_bytes",
+                                                 "handler_allocations" };
+            const std::atomic<uint32_t>& counter = _family == FAMILY_REQUESTS ? counters.requests
+                : _family == FAMILY_BYTES ? counters.bytes
+                : _family == FAMILY_HEAP ? counters.heapBytes : counters.allocations;
+            const char* name = names[_family];
+            uint32_t value = counter.load(std::memory_order_relaxed);
+            length = snprintf(_line, sizeof(_line), "sembox_http_%s_total{route=\"%s\"} %lu\n",
+                              name, counters.route, (unsigned long)value);
+            _route++;
+            break;
+        }
+
+        // Histogram: snapshot the route once so buckets, sum and count agree
+        uint8_t bucket = _step - 1;
+        if (bucket == 0) {
+            for (uint8_t i = 0; i < RouteMetrics::BUCKETS; i++) {
+                _snapshot[i] = counters.buckets[i].load(std::memory_order_relaxed);
+            }
+            _snapshotSumUs = counters.sumUs.load(std::memory_order_relaxed);
+        }
+
+        uint32_t cumulative = 0;
+        for (uint8_t i = 0; i <= bucket && i < RouteMetrics::BUCKETS; i++) {
+            cumulative += _snapshot[i];
+        }
+
+        if (bucket < RouteMetrics::BUCKETS - 1) {
+            uint32_t bound = RouteMetrics::bucketBound(bucket);
+            length = snprintf(_line, sizeof(_line),
+                              "sembox_http_request_duration_seconds_bucket{route=\"%s\",le=\"%lu.%06lu\"} %lu\n",
+                              counters.route, (unsigned long)(bound / 1000000),
+                              (unsigned long)(bound % 1000000), (unsigned long)cumulative);
+            _step++;
+        } else if (bucket == RouteMetrics::BUCKETS - 1) {
+            length = snprintf(_line, sizeof(_line),
+                              "sembox_http_request_duration_seconds_bucket{route=\"%s\",le=\"+Inf\"} %lu\n"
+                              "sembox_http_request_duration_seconds_sum{route=\"%s\"} %lu.%06lu\n",
+                              counters.route, (unsigned long)cumulative, counters.route,
+                              (unsigned long)(_snapshotSumUs / 1000000),
+                              (unsigned long)(_snapshotSumUs % 1000000));
+            _step++;
+        } else {
+            length = snprintf(_line, sizeof(_line),
+                              "sembox_http_request_duration_seconds_count{route=\"%s\"} %lu\n",
+                              counters.route, (unsigned long)cumulative);
+            _route++;
+            _step = 1;
+        }
+        break;
+    }
+
+    if (_family == FAMILY_DONE || length <= 0) {
+        _lineLength = 0;
+        return false;
+    }
+    // A truncated line (overlong route name) still ends with a newline
+    _lineLength = (size_t)length < sizeof(_line) ? (size_t)length : sizeof(_line) - 1;
+    _line[_lineLength - 1] = '\n';
+    return true;
+}
@@ -0,0 +1,110 @@
+/*********
+  SEMBox ESP32 - Route Metrics
+  Per-route request counters and latency histograms, Prometheus export
+
+  Every registered route gets a slot with its request count, response
+  body bytes, heap still held when the handler returned (the response
+  and its buffers) and a histogram of handler execution time in
+  log-spaced buckets (64 us, x4 per bucket, up to 65.5 ms, plus +Inf). Handlers run
+  in the AsyncTCP task, which brackets each one with begin()/end(); the
+  counters are relaxed atomics so any task may read them.
+
+  Given an allocation counter of the handler's task, a route also
+  counts the heap allocations its handler made up to the first
+  addBytes(), where the body is handed to the server: parsing and
+  response building, without the library's own response objects. A
+  handler that reports no body is counted until it returns.
+
+  MetricsWriter renders the counters as Prometheus text a piece at a
+  time, so /metrics can be sent as a chunked response without building
+  the whole document in memory. Plain C++, builds on a Linux host.
+*********/
+
+#ifndef ROUTE_METRICS_H
+#define ROUTE_METRICS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+
+typedef int64_t (*MetricsClock)();      // Microseconds, monotonic
+typedef uint32_t (*MetricsHeapFree)();  // Free heap bytes, O(1)
+typedef uint32_t (*MetricsAllocCount)(); // Allocations by the calling task so far
+
+const uint8_t ROUTE_METRICS_BUCKETS = 7;    // Last one is +Inf
+
+struct RouteCounters {
+    const char* route;
+    std::atomic<uint32_t> requests;
+    std::atomic<uint32_t> bytes;
+    std::atomic<uint32_t> heapBytes;
+    std::atomic<uint32_t> allocations;
+    std::atomic<uint32_t> sumUs;        // Wraps after ~71 min of handler time
+    std::atomic<uint32_t> buckets[ROUTE_METRICS_BUCKETS];
+};
+
+class RouteMetrics {
+public:
+    static const uint8_t MAX_ROUTES = 48;
+    static const uint8_t BUCKETS = ROUTE_METRICS_BUCKETS;
+    static const uint32_t FIRST_BUCKET_US = 64;
+
+    explicit RouteMetrics(MetricsClock clock, MetricsHeapFree heapFree = nullptr,
+                          MetricsAllocCount allocCount = nullptr);
+
+    // Register a route (setup only); returns its id, or -1 if full
+    int add(const char* route);
+
+    // Bracket one handler call (AsyncTCP task)
+    void begin(int id);
+    void end();
+
+    // Account response body bytes to the route being handled
+    void addBytes(uint32_t bytes);
+
+    uint8_t count() const { return _count; }
+    bool countsAllocations() const { return _allocCount != nullptr; }
+    const RouteCounters& route(uint8_t id) const { return _routes[id]; }
+
+    // Upper bound of a bucket in microseconds (0 for +Inf)
+    static uint32_t bucketBound(uint8_t bucket);
+
+private:
+    MetricsClock _clock;
+    MetricsHeapFree _heapFree;
+    MetricsAllocCount _allocCount;
+    RouteCounters _routes[MAX_ROUTES];
+    uint8_t _count;
+    int _current;
+    int64_t _start;
+    uint32_t _heapStart;
+    uint32_t _allocStart;
+    uint32_t _allocEnd;
+    bool _responded;            // addBytes() seen, _allocEnd taken
+};
+
+/**
+ * Resumable Prometheus text exporter: read() fills the buffer with the
+ * next part of the document and returns 0 once everything was written.
+ */
+class MetricsWriter {
+public:
+    explicit MetricsWriter(const RouteMetrics& metrics);
+
+    size_t read(char* buffer, size_t maxLength);
+
+private:
+    bool nextLine();
+
+    const RouteMetrics& _metrics;
+    uint8_t _family;
+    uint8_t _route;
+    uint8_t _step;
+    uint32_t _snapshot[RouteMetrics::BUCKETS];
+    uint32_t _snapshotSumUs;
+    char _line[160];
+    size_t _lineLength;
+    size_t _lineOffset;
+};
+
+#endif // ROUTE_METRICS_H
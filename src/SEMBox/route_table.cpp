@@ -0,0 +1,301 @@
+/*********
+  SEMBox ESP32 - Route Table
+  Implementation (see route_table.h)
+*********/
+
+#include "route_table.h"
+#include <string.h>
+
+bool RouteParams::copy(uint8_t index, char* buffer, size_t size) const {
+    if (index >= count || items[index].length >= size) {
+        return false;
+    }
+    memcpy(buffer, items[index].text, items[index].length);
+    buffer[items[index].length] = 0;
+    return true;
+}
+
+RouteTable::RouteTable()
+    : _routes(nullptr), _count(0), _nodeCount(0), _edgeCount(0), _error(nullptr) {
+}
+
+bool RouteTable::begin(const Route* routes, uint8_t count) {
+    _routes = routes;
+    _count = 0;
+    _nodeCount = 0;
+    _edgeCount = 0;
+    _error = nullptr;
+    for (uint16_t i = 0; i < EDGE_SLOTS; i++) {
+        _edges[i].segment = nullptr;
+    }
+    if (count > MAX_ROUTES) {
+        _error = "too many routes";
+        return false;
+    }
+
+    newNode();      // Root, the path "/"
+    for (uint8_t i = 0; i < count; i++) {
+        if (!add(i)) {
+            _error = routes[i].pattern ? routes[i].pattern : "null pattern";
+            return false;
+        }
+    }
+    _count = count;
+    return true;
+}
+
+int RouteTable::match(uint8_t method, const char* path, RouteParams* params) const {
+    params->count = 0;
+    params->context = nullptr;
+    int found = -1;
+    if (!path || path[0] != '/' || !matchFrom(0, path + 1, method, params, &found)) {
+        return -1;
+    }
+    params->context = _routes[found].context;
+    return found;
+}
+
+void RouteTable::dispatch(uint8_t index, AsyncWebServerRequest* request, const RouteParams& params) const {
+    const Route& route = _routes[index];
+    if (route.paramHandler) {
+        route.paramHandler(request, params);
+    } else {
+        route.handler(request);
+    }
+}
+
+bool RouteTable::add(uint8_t index) {
+    const Route& route = _routes[index];
+    const char* segment = route.pattern;
+    if (!segment || segment[0] != '/' || (!route.handler && !route.paramHandler)) {
+        return false;
+    }
+
+    uint8_t node = 0;
+    uint8_t params = 0;
+    for (segment++; *segment; ) {
+        const char* end = strchr(segment, '/');
+        if (!end) {
+            end = segment + strlen(segment);
+        }
+        size_t length = end - segment;
+        if (length == 0 || length > 255) {
+            return false;
+        }
+
+        if (segment[0] == '{') {
+            // {name}, {name:u32} or {a|b|...}
+            if (length < 3 || segment[length - 1] != '}' || ++params > ROUTE_MAX_PARAMS) {
+                return false;
+            }
+            const char* inner = segment + 1;
+            uint8_t innerLength = length - 2;
+            const char* colon = (const char*)memchr(inner, ':', innerLength);
+            const char* bar = (const char*)memchr(inner, '|', innerLength);
+            ParamType type = PARAM_TEXT;
+            if (bar) {
+                // Every word non-empty
+                if (colon || inner[0] == '|' || inner[innerLength - 1] == '|') {
+                    return false;
+                }
+                for (uint8_t i = 1; i < innerLength; i++) {
+                    if (inner[i] == '|' && inner[i - 1] == '|') {
+                        return false;
+                    }
+                }
+                type = PARAM_CHOICE;
+            } else if (colon) {
+                if (inner + innerLength - colon - 1 != 3 || memcmp(colon + 1, "u32", 3) != 0) {
+                    return false;
+                }
+                type = PARAM_UINT;
+            }
+
+            Node& parent = _nodes[node];
+            if (parent.param == NONE) {
+                uint8_t child = newNode();
+                if (child == NONE) {
+                    return false;
+                }
+                _nodes[node].param = child;
+                _nodes[node].paramType = type;
+                _nodes[node].choices = type == PARAM_CHOICE ? inner : nullptr;
+                _nodes[node].choicesLength = type == PARAM_CHOICE ? innerLength : 0;
+            } else if (parent.paramType != type ||
+                       (type == PARAM_CHOICE && (parent.choicesLength != innerLength ||
+                                                 memcmp(parent.choices, inner, innerLength) != 0))) {
+                return false;   // Two kinds of parameter at the same place
+            }
+            node = _nodes[node].param;
+        } else {
+            if (memchr(segment, '{', length) || memchr(segment, '}', length) ||
+                !addLiteral(node, segment, length, &node)) {
+                return false;
+            }
+        }
+        segment = *end ? end + 1 : end;
+    }
+
+    // Routes ending at the same node are tried in table order
+    _nextRoute[index] = NONE;
+    if (_nodes[node].route == NONE) {
+        _nodes[node].route = index;
+    } else {
+        uint8_t last = _nodes[node].route;
+        while (_nextRoute[last] != NONE) {
+            last = _nextRoute[last];
+        }
+        _nextRoute[last] = index;
+    }
+    return true;
+}
+
+uint8_t RouteTable::newNode() {
+    if (_nodeCount >= MAX_NODES) {
+        return NONE;
+    }
+    Node& node = _nodes[_nodeCount];
+    node.route = NONE;
+    node.param = NONE;
+    node.paramType = PARAM_NONE;
+    node.choicesLength = 0;
+    node.choices = nullptr;
+    return _nodeCount++;
+}
+
+uint16_t RouteTable::slot(uint8_t node, const char* segment, uint8_t length) {
+    // FNV-1a over the parent node and the segment
+    uint32_t hash = 2166136261u ^ node;
+    hash *= 16777619u;
+    for (uint8_t i = 0; i < length; i++) {
+        hash ^= (uint8_t)segment[i];
+        hash *= 16777619u;
+    }
+    return (hash ^ (hash >> 16)) & (EDGE_SLOTS - 1);
+}
+
+int RouteTable::literalChild(uint8_t node, const char* segment, uint8_t length) const {
+    for (uint16_t i = slot(node, segment, length), probes = 0; probes < EDGE_SLOTS;
+         i = (i + 1) & (EDGE_SLOTS - 1), probes++) {
+        const Edge& edge = _edges[i];
+        if (!edge.segment) {
+            return -1;
+        }
+        if (edge.parent == node && edge.length == length && memcmp(edge.segment, segment, length) == 0) {
+            return edge.child;
+        }
+    }
+    return -1;
+}
+
+bool RouteTable::addLiteral(uint8_t node, const char* segment, uint8_t length, uint8_t* child) {
+    int existing = literalChild(node, segment, length);
+    if (existing >= 0) {
+        *child = existing;
+        return true;
+    }
+    if (_edgeCount >= EDGE_SLOTS / 2) {
+        return false;
+    }
+    uint8_t created = newNode();
+    if (created == NONE) {
+        return false;
+    }
+    uint16_t i = slot(node, segment, length);
+    while (_edges[i].segment) {
+        i = (i + 1) & (EDGE_SLOTS - 1);
+    }
+    _edges[i].segment = segment;
+    _edges[i].length = length;
+    _edges[i].parent = node;
+    _edges[i].child = created;
+    _edgeCount++;
+    *child = created;
+    return true;
+}
+
+bool RouteTable::matchFrom(uint8_t node, const char* path, uint8_t method, RouteParams* params, int* found) const {
+    if (*path == 0) {
+        for (uint8_t route = _nodes[node].route; route != NONE; route = _nextRoute[route]) {
+            if (_routes[route].methods & method) {
+                *found = route;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    const char* end = strchr(path, '/');
+    if (!end) {
+        end = path + strlen(path);
+    }
+    size_t length = end - path;
+    if (length == 0 || length > 255) {
+        return false;
+    }
+    const char* rest = *end ? end + 1 : end;   // A trailing slash leaves ""
+
+    int child = literalChild(node, path, length);
+    if (child >= 0 && matchFrom(child, rest, method, params, found)) {
+        return true;
+    }
+
+    const Node& current = _nodes[node];
+    uint32_t value = 0;
+    if (current.param != NONE && params->count < ROUTE_MAX_PARAMS && paramMatches(current, path, length, &value)) {
+        uint8_t saved = params->count;
+        RouteParam& param = params->items[saved];
+        param.text = path;
+        param.length = length;
+        param.value = value;
+        params->count++;
+        if (matchFrom(current.param, rest, method, params, found)) {
+            return true;
+        }
+        params->count = saved;
+    }
+    return false;
+}
+
+bool RouteTable::paramMatches(const Node& node, const char* segment, uint8_t length, uint32_t* value) {
+    switch (node.paramType) {
+        case PARAM_TEXT:
+            return true;
+
+        case PARAM_UINT: {
+            uint64_t number = 0;
+            if (length > 10) {
+                return false;
+            }
+            for (uint8_t i = 0; i < length; i++) {
+                if (segment[i] < '0' || segment[i] > '9') {
+                    return false;
+                }
+                number = number * 10 + (segment[i] - '0');
+            }
+            if (number > UINT32_MAX) {
+                return false;
+            }
+            *value = (uint32_t)number;
+            return true;
+        }
+
+        case PARAM_CHOICE: {
+            const char* word = node.choices;
+            const char* end = node.choices + node.choicesLength;
+            for (uint32_t index = 0; word < end; index++) {
+                const char* bar = (const char*)memchr(word, '|', end - word);
+                size_t wordLength = (bar ? bar : end) - word;
+                if (wordLength == length && memcmp(word, segment, length) == 0) {
+                    *value = index;
+                    return true;
+                }
+                word = bar ? bar + 1 : end;
+            }
+            return false;
+        }
+
+        default:
+            return false;
+    }
+}
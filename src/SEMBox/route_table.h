@@ -0,0 +1,120 @@
+/*********
+  SEMBox ESP32 - Route Table
+  Request dispatch from one constexpr table of method + path patterns
+
+  A pattern is a path of segments, each either literal or a parameter:
+    /io/{ch}/{on|off}     {name} any segment, {a|b} one of the words
+    /table/goto/{n:u32}   {name:u32} a decimal number up to 2^32-1
+  Parameters are passed to the handler as views into the URL (no
+  copies); a choice carries the index of the word, a number its value.
+
+  begin() compiles the table once into a tree of segments whose literal
+  edges sit in a hash table keyed by (node, segment). A lookup hashes
+  each URL segment once, so dispatch costs the same with 10 routes or
+  100. A literal segment wins over a parameter at the same place; the
+  parameter is tried when the rest of the path does not match below
+  the literal. A trailing slash is ignored. All storage is fixed; plain
+  C++, builds on a Linux host.
+*********/
+
+#ifndef ROUTE_TABLE_H
+#define ROUTE_TABLE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+class AsyncWebServerRequest;
+
+const uint8_t ROUTE_MAX_PARAMS = 4;
+
+struct RouteParam {
+    const char* text;           // Into the URL, not NUL-terminated
+    uint8_t length;
+    uint32_t value;             // Number, or index of the word for {a|b}
+};
+
+struct RouteParams {
+    uint8_t count;
+    RouteParam items[ROUTE_MAX_PARAMS];
+    const void* context;        // Route::context
+
+    // NUL-terminated copy of a parameter; false if it does not fit
+    bool copy(uint8_t index, char* buffer, size_t size) const;
+};
+
+typedef void (*RouteHandler)(AsyncWebServerRequest* request);
+typedef void (*RouteParamHandler)(AsyncWebServerRequest* request, const RouteParams& params);
+
+struct Route {
+    constexpr Route(uint8_t methods, const char* pattern, RouteHandler handler, const void* context = nullptr)
+        : methods(methods), pattern(pattern), handler(handler), paramHandler(nullptr), context(context) {}
+    constexpr Route(uint8_t methods, const char* pattern, RouteParamHandler handler, const void* context = nullptr)
+        : methods(methods), pattern(pattern), handler(nullptr), paramHandler(handler), context(context) {}
+
+    uint8_t methods;            // Bit mask of WebRequestMethod
+    const char* pattern;
+    RouteHandler handler;       // One of the two is set
+    RouteParamHandler paramHandler;
+    const void* context;        // Passed in RouteParams (e.g. the asset)
+};
+
+class RouteTable {
+public:
+    static const uint8_t MAX_ROUTES = 64;
+    static const uint8_t MAX_NODES = 80;
+    static const uint16_t EDGE_SLOTS = 128;     // Power of two, kept at most half full
+    static const uint8_t NONE = 0xFF;
+
+    RouteTable();
+
+    // Compile the table (setup only); false and the offending route in
+    // error() if a pattern is malformed or the table does not fit
+    bool begin(const Route* routes, uint8_t count);
+    const char* error() const { return _error; }
+
+    // Index of the route for method and path (without query), or -1
+    int match(uint8_t method, const char* path, RouteParams* params) const;
+
+    const Route& route(uint8_t index) const { return _routes[index]; }
+    uint8_t count() const { return _count; }
+
+    // Call the route's handler
+    void dispatch(uint8_t index, AsyncWebServerRequest* request, const RouteParams& params) const;
+
+private:
+    enum ParamType : uint8_t { PARAM_NONE, PARAM_TEXT, PARAM_UINT, PARAM_CHOICE };
+
+    struct Node {
+        uint8_t route;          // First route ending here, chained by _nextRoute
+        uint8_t param;          // Child for the parameter segment, or NONE
+        ParamType paramType;
+        uint8_t choicesLength;
+        const char* choices;    // "a|b" inside the pattern, for PARAM_CHOICE
+    };
+
+    struct Edge {
+        const char* segment;    // Inside the pattern
+        uint8_t length;
+        uint8_t parent;
+        uint8_t child;
+    };
+
+    bool add(uint8_t index);
+    int literalChild(uint8_t node, const char* segment, uint8_t length) const;
+    bool addLiteral(uint8_t node, const char* segment, uint8_t length, uint8_t* child);
+    uint8_t newNode();
+    bool matchFrom(uint8_t node, const char* path, uint8_t method, RouteParams* params, int* found) const;
+    static bool paramMatches(const Node& node, const char* segment, uint8_t length, uint32_t* value);
+    static uint16_t slot(uint8_t node, const char* segment, uint8_t length);
+
+    const Route* _routes;
+    uint8_t _count;
+    Node _nodes[MAX_NODES];
+    uint8_t _nodeCount;
+    Edge _edges[EDGE_SLOTS];
+    uint16_t _edgeCount;
+    uint8_t _nextRoute[MAX_ROUTES];
+    const char* _error;
+};
+
+#endif // ROUTE_TABLE_H
@@ -0,0 +1,145 @@
+/*********
+  SEMBox ESP32 - Settings Store
+*********/
+
+#include "settings_store.h"
+#include <stddef.h>
+#include <string.h>
+
+static const char* RECORD_KEY = "settings";
+static const uint32_t RECORD_MAGIC = 0x53424F58;   // "SBOX"
+
+SettingsStore::SettingsStore()
+    : _preferences(nullptr), _dirty(false), _flushRequested(false),
+      _firstChangeMs(0), _lastChangeMs(0) {
+    memset(&_committed, 0, sizeof(_committed));
+    memset(&_staged, 0, sizeof(_staged));
+    memset(&_stats, 0, sizeof(_stats));
+}
+
+bool SettingsStore::begin(Preferences& preferences, Settings& settings) {
+    _preferences = &preferences;
+
+    // The CRC follows the settings, which are shorter in older versions
+    Record record;
+    memset(&record, 0, sizeof(record));
+    size_t length = preferences.getBytesLength(RECORD_KEY);
+    bool valid = length >= offsetof(Record, settings) + sizeof(uint32_t)
+        && length <= sizeof(record)
+        && preferences.getBytes(RECORD_KEY, &record, length) == length
+        && record.magic == RECORD_MAGIC
+        && record.version >= 1 && record.version <= VERSION
+        && record.size <= sizeof(Settings)
+        && length == offsetof(Record, settings) + record.size + sizeof(uint32_t);
+    if (valid) {
+        size_t crcOffset = length - sizeof(uint32_t);
+        uint32_t crc;
+        memcpy(&crc, (const uint8_t*)&record + crcOffset, sizeof(crc));
+        valid = crc == crc32(&record, crcOffset);
+    }
+
+    if (valid) {
+        memcpy(&settings, &record.settings, record.size);
+    }
+    bool current = valid && record.version == VERSION;
+
+    std::lock_guard<std::mutex> guard(_lock);
+    // Without a current record everything counts as changed, so the first
+    // staged update is always written
+    if (current) {
+        _committed = settings;
+    } else {
+        memset(&_committed, 0xFF, sizeof(_committed));
+    }
+    _staged = settings;
+    _dirty = false;
+    return valid;
+}
+
+void SettingsStore::update(const Settings& settings, uint32_t nowMs) {
+    std::lock_guard<std::mutex> guard(_lock);
+    if (_dirty) {
+        _stats.coalesced++;
+    } else {
+        _firstChangeMs = nowMs;
+    }
+    _staged = settings;
+    _lastChangeMs = nowMs;
+    _dirty = true;
+}
+
+bool SettingsStore::service(uint32_t nowMs) {
+    Settings settings;
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        if (!_dirty) {
+            _flushRequested = false;
+            return false;
+        }
+        bool due = _flushRequested
+            || nowMs - _lastChangeMs >= COMMIT_IDLE_MS
+            || nowMs - _firstChangeMs >= COMMIT_MAX_DELAY_MS;
+        if (!due) {
+            return false;
+        }
+        _flushRequested = false;
+        _dirty = false;
+        if (memcmp(&_staged, &_committed, sizeof(Settings)) == 0) {
+            _stats.skipped++;
+            return false;
+        }
+        settings = _staged;
+    }
+
+    // Flash access happens outside the lock; a change staged meanwhile
+    // simply marks the store dirty again
+    if (!write(settings)) {
+        std::lock_guard<std::mutex> guard(_lock);
+        if (!_dirty) {
+            _dirty = true;
+            _firstChangeMs = _lastChangeMs = nowMs;
+        }
+        return false;
+    }
+
+    std::lock_guard<std::mutex> guard(_lock);
+    _committed = settings;
+    _stats.writes++;
+    return true;
+}
+
+SettingsStoreStats SettingsStore::stats() {
+    std::lock_guard<std::mutex> guard(_lock);
+    SettingsStoreStats stats = _stats;
+    stats.pending = _dirty;
+    return stats;
+}
+
+bool SettingsStore::write(const Settings& settings) {
+    if (_preferences == nullptr) {
+        return false;
+    }
+
+    Record record;
+    memset(&record, 0, sizeof(record));     // Deterministic padding for the CRC
+    record.magic = RECORD_MAGIC;
+    record.version = VERSION;
+    record.size = sizeof(Settings);
+    record.settings = settings;
+    record.crc = crc32(&record, offsetof(Record, crc));
+
+    return _preferences->putBytes(RECORD_KEY, &record, sizeof(record)) == sizeof(record);
+}
+
+uint32_t SettingsStore::crc32(const void* data, size_t length) {
+    // Bitwise CRC-32 (IEEE); only used on load and commit
+    const uint8_t* bytes = (const uint8_t*)data;
+    uint32_t crc = 0xFFFFFFFF;
+    for (size_t i = 0; i < length; i++) {
+        crc ^= bytes[i];
+        for (uint8_t bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+        }
+    }
+    return ~crc;
+}
@@ -0,0 +1,90 @@
+/*********
+  SEMBox ESP32 - Settings Store
+  Single versioned, CRC-protected settings record in NVS
+
+  All persistent configuration lives in one struct that is written as a
+  single blob, so a power loss can never leave division and ratio from
+  different saves. Changes are only staged by update(); service(), called
+  from a low-priority task, commits once no change came in for
+  COMMIT_IDLE_MS (or at the latest COMMIT_MAX_DELAY_MS after the first
+  staged change), and skips the write if the record equals what is
+  already in flash. This keeps scripted parameter changes from wearing
+  the flash and keeps NVS latency out of the control task.
+
+  Fields are only appended to Settings. A record written by an older
+  version is shorter; it still loads, and the fields it lacks keep the
+  defaults passed to begin().
+*********/
+
+#ifndef SETTINGS_STORE_H
+#define SETTINGS_STORE_H
+
+#include <Preferences.h>
+#include <stdint.h>
+#include <mutex>
+#include "motion_profile.h"
+
+struct Settings {
+    int32_t division;
+    uint32_t ratioMilli;
+    MotionLimits limits;
+    uint32_t followingLimit;    // Encoder following error fault, steps (version 2)
+};
+
+struct SettingsStoreStats {
+    uint32_t writes;        // Records committed to flash
+    uint32_t coalesced;     // Staged changes merged into a later write
+    uint32_t skipped;       // Commits dropped because flash already matched
+    bool pending;           // Staged change not yet committed
+};
+
+class SettingsStore {
+public:
+    static const uint16_t VERSION = 2;
+    static const uint32_t COMMIT_IDLE_MS = 2000;
+    static const uint32_t COMMIT_MAX_DELAY_MS = 10000;
+
+    SettingsStore();
+
+    /**
+     * Load the record in one read. Returns false (leaving settings as
+     * passed in, i.e. defaults) if it is missing, corrupt or from an
+     * unknown version. An older record is rewritten on the next commit.
+     */
+    bool begin(Preferences& preferences, Settings& settings);
+
+    // Stage new settings (any task); nothing is written here
+    void update(const Settings& settings, uint32_t nowMs);
+
+    // Commit now, regardless of the idle delay
+    void requestFlush() { _flushRequested = true; }
+
+    // Commit if due; call periodically from a task that may block on flash
+    bool service(uint32_t nowMs);
+
+    SettingsStoreStats stats();
+
+private:
+    struct Record {
+        uint32_t magic;
+        uint16_t version;
+        uint16_t size;
+        Settings settings;
+        uint32_t crc;
+    };
+
+    bool write(const Settings& settings);
+    static uint32_t crc32(const void* data, size_t length);
+
+    Preferences* _preferences;
+    std::mutex _lock;
+    Settings _committed;
+    Settings _staged;
+    bool _dirty;
+    volatile bool _flushRequested;
+    uint32_t _firstChangeMs;
+    uint32_t _lastChangeMs;
+    SettingsStoreStats _stats;
+};
+
+#endif // SETTINGS_STORE_H
@@ -0,0 +1,112 @@
+/*********
+  SEMBox ESP32 - Status Snapshot
+  Triple-buffered, pre-serialized status document
+
+  A single writer (the control task's status job) formats the status
+  (JSON for /status, a packed StatusRecord for /status.bin) into a back
+  buffer and publishes it with one atomic index swap. Readers (AsyncTCP
+  request handlers) send the front buffer as-is, so answering /status
+  never touches the heap.
+
+  The server sends a response lazily, possibly long after the handler
+  returned, so a reader pins the buffer with acquire() and releases it
+  when the connection closes. A client that stalls keeps its buffer
+  pinned until it disconnects. writable() picks a back buffer no reader
+  holds; with three buffers one stalled reader never holds up a
+  refresh, and only readers pinning both older buffers at once defer it
+  to the next tick. Readers that only copy (the /events stream) use
+  front().
+*********/
+
+#ifndef STATUS_SNAPSHOT_H
+#define STATUS_SNAPSHOT_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+
+template <size_t Capacity = 1536>
+class StatusSnapshot {
+public:
+    static const size_t CAPACITY = Capacity;
+    static const uint8_t BUFFERS = 3;
+    static const uint32_t MIN_REFRESH_INTERVAL = 20;   // ms
+
+    StatusSnapshot() : _back(1) {
+        for (uint8_t i = 0; i < BUFFERS; i++) {
+            _buffers[i][0] = '\0';
+            _lengths[i] = 0;
+        }
+    }
+
+    /**
+     * Writer side: choose a buffer that is neither current nor held by a
+     * reader as the back buffer; false if there is none. Call before
+     * back() and commit().
+     */
+    bool writable() {
+        uint8_t current = _front.load(std::memory_order_relaxed);
+        for (uint8_t i = 1; i < BUFFERS; i++) {
+            uint8_t candidate = (current + i) % BUFFERS;
+            if (_readers[candidate].load() == 0) {
+                _back = candidate;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Writer side: buffer that is not visible to readers
+    char* back() { return _buffers[_back]; }
+
+    size_t capacity() const { return CAPACITY; }
+
+    // Writer side: make the back buffer current
+    void commit(size_t length) {
+        _lengths[_back] = length;
+        _front.store(_back);    // Sequentially consistent, pairs with acquire()
+        _sequence.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * Reader side: current document, pinned until release(*slot). The
+     * front is re-read after pinning, so a buffer the writer took over
+     * in between is never returned.
+     */
+    const char* acquire(size_t* length, uint8_t* slot) {
+        for (;;) {
+            uint8_t current = _front.load();
+            _readers[current].fetch_add(1);
+            if (_front.load() == current) {
+                *slot = current;
+                *length = _lengths[current];
+                return _buffers[current];
+            }
+            _readers[current].fetch_sub(1);
+        }
+    }
+
+    void release(uint8_t slot) { _readers[slot].fetch_sub(1, std::memory_order_release); }
+
+    // Reader side for the writer's own task, which cannot race a refresh
+    const char* front(size_t* length) const {
+        uint8_t current = _front.load(std::memory_order_acquire);
+        if (length) {
+            *length = _lengths[current];
+        }
+        return _buffers[current];
+    }
+
+    // Number of snapshots published so far
+    uint32_t sequence() const { return _sequence.load(std::memory_order_relaxed); }
+
+private:
+    char _buffers[BUFFERS][CAPACITY];
+    size_t _lengths[BUFFERS];
+    std::atomic<uint8_t> _front{0};
+    uint8_t _back;              // Writer only
+    std::atomic<uint16_t> _readers[BUFFERS] = {{0}, {0}, {0}};
+    std::atomic<uint32_t> _sequence{0};
+};
+
+#endif // STATUS_SNAPSHOT_H
@@ -0,0 +1,168 @@
+/*********
+  SEMBox ESP32 - Step Engine
+*********/
+
+#include "step_engine.h"
+#include "soc/gpio_reg.h"
+
+// Direct register writes: usable from the ISR and take a single cycle
+static inline void IRAM_ATTR pinSet(uint8_t pin, bool high) {
+    if (pin < 32) {
+        REG_WRITE(high ? GPIO_OUT_W1TS_REG : GPIO_OUT_W1TC_REG, 1UL << pin);
+    } else {
+        REG_WRITE(high ? GPIO_OUT1_W1TS_REG : GPIO_OUT1_W1TC_REG, 1UL << (pin - 32));
+    }
+}
+
+StepEngine::StepEngine()
+    : _timer(nullptr), _mux(portMUX_INITIALIZER_UNLOCKED), _stepPin(0), _dirPin(0), _running(false), _pulseHigh(false),
+      _period(0), _stepAlarm(0), _steps(0), _maxLatency(0), _overruns(0) {
+}
+
+bool StepEngine::begin(int stepPin, int dirPin, int enablePin) {
+    _stepPin = stepPin;
+    _dirPin = dirPin;
+
+    pinMode(_stepPin, OUTPUT);
+    pinMode(_dirPin, OUTPUT);
+    digitalWrite(_stepPin, LOW);
+    digitalWrite(_dirPin, LOW);
+    if (enablePin >= 0) {
+        pinMode(enablePin, OUTPUT);
+        digitalWrite(enablePin, LOW);   // Driver enabled, holding torque
+    }
+
+    gptimer_config_t config = {};
+    config.clk_src = GPTIMER_CLK_SRC_DEFAULT;
+    config.direction = GPTIMER_COUNT_UP;
+    config.resolution_hz = TIMER_HZ;
+    if (gptimer_new_timer(&config, &_timer) != ESP_OK) {
+        return false;
+    }
+
+    gptimer_event_callbacks_t callbacks = {};
+    callbacks.on_alarm = onAlarm;
+    if (gptimer_register_event_callbacks(_timer, &callbacks, this) != ESP_OK) {
+        return false;
+    }
+    return gptimer_enable(_timer) == ESP_OK;
+}
+
+bool StepEngine::move(int32_t steps, uint32_t stepRateHz) {
+    if (_timer == nullptr || _running || steps == 0 || stepRateHz == 0) {
+        return false;
+    }
+
+    uint32_t period = TIMER_HZ / stepRateHz;
+    if (period < MIN_PERIOD_TICKS) {
+        period = MIN_PERIOD_TICKS;
+    }
+    if (!_planner.begin(steps, period)) {
+        return false;
+    }
+    return startPlanned();
+}
+
+bool StepEngine::move(int32_t steps, const RampTable* ramp) {
+    if (_timer == nullptr || _running || steps == 0) {
+        return false;
+    }
+    if (!_planner.begin(steps, ramp)) {
+        return false;
+    }
+    return startPlanned();
+}
+
+bool StepEngine::startPlanned() {
+    // DIR is settled before the first STEP edge
+    pinSet(_dirPin, _planner.forward());
+    _pulseHigh = false;
+
+    uint64_t now = 0;
+    gptimer_get_raw_count(_timer, &now);
+    gptimer_alarm_config_t alarm = {};
+    alarm.alarm_count = now + DIR_SETUP_TICKS;
+    gptimer_set_alarm_action(_timer, &alarm);
+
+    _running = true;
+    if (gptimer_start(_timer) != ESP_OK) {
+        _running = false;
+        _planner.abort();
+        return false;
+    }
+    return true;
+}
+
+void StepEngine::stop() {
+    // The ISR may run on the other core while the planner is shortened
+    portENTER_CRITICAL(&_mux);
+    _planner.stop();
+    portEXIT_CRITICAL(&_mux);
+}
+
+bool StepEngine::setPosition(int32_t position) {
+    if (_running) {
+        return false;
+    }
+    _planner.setPosition(position);
+    return true;
+}
+
+StepEngineStats StepEngine::stats() const {
+    StepEngineStats result;
+    result.steps = _steps;
+    result.maxLatencyTicks = _maxLatency;
+    result.overruns = _overruns;
+    return result;
+}
+
+bool IRAM_ATTR StepEngine::onAlarm(gptimer_handle_t timer, const gptimer_alarm_event_data_t *edata, void *ctx) {
+    return static_cast<StepEngine*>(ctx)->handleAlarm(timer, edata);
+}
+
+bool IRAM_ATTR StepEngine::handleAlarm(gptimer_handle_t timer, const gptimer_alarm_event_data_t *edata) {
+    uint64_t now = 0;
+    gptimer_get_raw_count(timer, &now);
+
+    uint32_t latency = (uint32_t)(now - edata->alarm_value);
+    if (latency > _maxLatency) {
+        _maxLatency = latency;
+    }
+
+    uint64_t next;
+    if (_pulseHigh) {
+        // Falling edge; the next step stays on the grid of this one even
+        // if this edge was late
+        pinSet(_stepPin, false);
+        _pulseHigh = false;
+        next = _stepAlarm + _period;
+    } else {
+        portENTER_CRITICAL_ISR(&_mux);
+        _period = _planner.nextPeriod();
+        portEXIT_CRITICAL_ISR(&_mux);
+        if (_period == 0) {
+            gptimer_stop(timer);
+            _running = false;
+            return false;
+        }
+        if (_period < MIN_PERIOD_TICKS) {
+            _period = MIN_PERIOD_TICKS;
+        }
+        pinSet(_stepPin, true);
+        _pulseHigh = true;
+        _steps = _steps + 1;
+        _stepAlarm = edata->alarm_value;
+        next = _stepAlarm + PULSE_WIDTH_TICKS;
+    }
+
+    // Schedule on the absolute grid; only slip if the edge is already late
+    if (next <= now) {
+        _overruns = _overruns + 1;
+        next = now + 1;
+    }
+
+    gptimer_alarm_config_t alarm = {};
+    alarm.alarm_count = next;
+    gptimer_set_alarm_action(timer, &alarm);
+    return false;
+}
@@ -0,0 +1,76 @@
+/*********
+  SEMBox ESP32 - Step Engine
+  Hardware-timed step/direction pulse generation
+
+  Edges are produced from a GPTimer alarm interrupt that is re-armed at
+  absolute tick values, so interrupt latency never accumulates into the
+  step timing. The planner (step_planner.h) supplies the period of each
+  step; this file only owns the timer and the pins.
+*********/
+
+#ifndef STEP_ENGINE_H
+#define STEP_ENGINE_H
+
+#include <Arduino.h>
+#include "driver/gptimer.h"
+#include "step_planner.h"
+
+struct StepEngineStats {
+    uint32_t steps;             // Steps emitted since boot
+    uint32_t maxLatencyTicks;   // Worst alarm-to-edge latency (edge jitter)
+    uint32_t overruns;          // Edges that could not be scheduled on time
+};
+
+class StepEngine {
+public:
+    static const uint32_t TIMER_HZ = 10000000;      // 0.1 us resolution
+    static const uint32_t PULSE_WIDTH_TICKS = 25;   // 2.5 us STEP high time
+    static const uint32_t DIR_SETUP_TICKS = 50;     // 5 us DIR-to-STEP setup
+    static const uint32_t MIN_PERIOD_TICKS = 200;   // 50 kHz sustained maximum
+
+    StepEngine();
+
+    // Configure pins and timer; enablePin may be -1 (active low)
+    bool begin(int stepPin, int dirPin, int enablePin);
+
+    // Start a constant-rate move of signed steps; false if busy or invalid
+    bool move(int32_t steps, uint32_t stepRateHz);
+
+    // Start a move along an acceleration ramp (see motion_profile.h)
+    bool move(int32_t steps, const RampTable* ramp);
+
+    // Decelerate to a stop (immediate for constant-rate moves)
+    void stop();
+
+    bool busy() const { return _running; }
+    int32_t position() const { return _planner.position(); }
+
+    // Redefine the current position (e.g. after homing); false while moving
+    bool setPosition(int32_t position);
+    // Configured cap (MIN_PERIOD_TICKS), not a measurement: the rate and
+    // jitter actually achieved are measured by host/tests/step_engine_test
+    // and, on the device, by stats()
+    uint32_t maxStepRate() const { return TIMER_HZ / MIN_PERIOD_TICKS; }
+    StepEngineStats stats() const;
+    float ticksToMicros(uint32_t ticks) const { return ticks * 1000000.0f / TIMER_HZ; }
+
+private:
+    static bool onAlarm(gptimer_handle_t timer, const gptimer_alarm_event_data_t *edata, void *ctx);
+    bool handleAlarm(gptimer_handle_t timer, const gptimer_alarm_event_data_t *edata);
+    bool startPlanned();
+
+    gptimer_handle_t _timer;
+    StepPlanner _planner;
+    portMUX_TYPE _mux;
+    uint8_t _stepPin;
+    uint8_t _dirPin;
+    volatile bool _running;
+    bool _pulseHigh;
+    uint32_t _period;
+    uint64_t _stepAlarm;        // Alarm of the current step's rising edge
+    volatile uint32_t _steps;
+    volatile uint32_t _maxLatency;
+    volatile uint32_t _overruns;
+};
+
+#endif // STEP_ENGINE_H
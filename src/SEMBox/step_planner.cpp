@@ -0,0 +1,73 @@
+/*********
+  SEMBox ESP32 - Step Planner
+*********/
+
+#include "step_planner.h"
+
+StepPlanner::StepPlanner()
+    : _remaining(0), _position(0), _total(0), _period(0), _ramp(nullptr), _forward(true) {
+}
+
+bool StepPlanner::begin(int32_t steps, uint32_t periodTicks) {
+    if (busy() || periodTicks == 0) {
+        return false;
+    }
+
+    _period = periodTicks;
+    _ramp = nullptr;
+    return start(steps);
+}
+
+bool StepPlanner::begin(int32_t steps, const RampTable* ramp) {
+    if (busy() || ramp == nullptr || ramp->cruisePeriod == 0) {
+        return false;
+    }
+
+    _period = ramp->cruisePeriod;
+    _ramp = ramp;
+    return start(steps);
+}
+
+bool StepPlanner::start(int32_t steps) {
+    _forward = steps >= 0;
+    _total = _forward ? (uint32_t)steps : (uint32_t)(-(int64_t)steps);
+    _remaining = _total;
+    return true;
+}
+
+uint32_t IRAM_ATTR StepPlanner::nextPeriod() {
+    if (_remaining == 0) {
+        return 0;
+    }
+
+    uint32_t fromStart = _total - _remaining;
+    _remaining = _remaining - 1;
+    _position = _forward ? _position + 1 : _position - 1;
+
+    if (_ramp == nullptr) {
+        return _period;
+    }
+
+    // Accelerate from the start, decelerate symmetrically into the end
+    uint32_t rampIndex = fromStart < _remaining ? fromStart : _remaining;
+    return rampIndex < _ramp->length ? _ramp->periods[rampIndex] : _period;
+}
+
+void StepPlanner::abort() {
+    _remaining = 0;
+}
+
+void StepPlanner::stop() {
+    if (_ramp == nullptr) {
+        abort();
+        return;
+    }
+
+    // As many steps as it took to reach the current speed, at most the ramp
+    uint32_t done = _total - _remaining;
+    uint32_t decel = done < _ramp->length ? done : _ramp->length;
+    if (decel < _remaining) {
+        _total = done + decel;
+        _remaining = decel;
+    }
+}
@@ -0,0 +1,72 @@
+/*********
+  SEMBox ESP32 - Step Planner
+  Hardware-independent pulse planning for the rotary table drive
+
+  The planner turns a move request into a sequence of step periods in
+  timer ticks, either at a constant rate or by walking a precomputed
+  acceleration ramp (motion_profile.h) up and back down. The step engine
+  asks for one period per step from its timer interrupt, so every call
+  here must be bounded and allocation-free.
+  No Arduino or ESP-IDF headers are used, so the module also builds on a
+  Linux host against a simulated timer.
+*********/
+
+#ifndef STEP_PLANNER_H
+#define STEP_PLANNER_H
+
+#include <stdint.h>
+#include "motion_profile.h"
+
+// Keep ISR-called code in IRAM on the ESP32, no-op elsewhere
+#ifndef IRAM_ATTR
+#define IRAM_ATTR
+#endif
+
+class StepPlanner {
+public:
+    StepPlanner();
+
+    /**
+     * Plan a constant-rate move.
+     * steps: signed step count (positive = forward)
+     * periodTicks: timer ticks between step starts
+     * Returns false if a move is still running or the period is 0.
+     */
+    bool begin(int32_t steps, uint32_t periodTicks);
+
+    /**
+     * Plan a move that accelerates and decelerates along a ramp table.
+     * The table must stay unchanged until the move is done.
+     */
+    bool begin(int32_t steps, const RampTable* ramp);
+
+    /**
+     * Advance to the next step.
+     * Returns the period of that step in ticks, or 0 when the move is done.
+     */
+    uint32_t nextPeriod();
+
+    // Abort the current move after the step in progress
+    void abort();
+
+    // Decelerate along the ramp from the current speed, then end the move
+    void stop();
+
+    bool busy() const { return _remaining != 0; }
+    bool forward() const { return _forward; }
+    uint32_t remaining() const { return _remaining; }
+    int32_t position() const { return _position; }
+    void setPosition(int32_t position) { _position = position; }
+
+private:
+    bool start(int32_t steps);
+
+    volatile uint32_t _remaining;
+    volatile int32_t _position;
+    uint32_t _total;
+    uint32_t _period;
+    const RampTable* _ramp;
+    bool _forward;
+};
+
+#endif // STEP_PLANNER_H
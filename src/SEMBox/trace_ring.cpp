@@ -0,0 +1,88 @@
+/*********
+  SEMBox ESP32 - Trace Ring
+*********/
+
+#include "trace_ring.h"
+#include <string.h>
+
+static_assert(sizeof(TraceRecord) == 24, "TraceRecord is a wire format");
+static_assert(sizeof(TraceHeader) == 24, "TraceHeader is a wire format");
+
+TraceRing::TraceRing(TraceClock clock) : _clock(clock), _head(0) {
+    for (uint32_t i = 0; i < SIZE; i++) {
+        // No record has this sequence number yet (slot i first holds record i)
+        _slots[i].sequence.store(~i, std::memory_order_relaxed);
+        _slots[i].type = 0;
+        _slots[i].a = 0;
+        _slots[i].time = 0;
+        _slots[i].b = 0;
+        _slots[i].c = 0;
+    }
+}
+
+bool TraceRing::read(uint32_t sequence, TraceRecord* record) const {
+    const Slot& slot = _slots[sequence & (SIZE - 1)];
+    if (slot.sequence.load(std::memory_order_acquire) != sequence) {
+        return false;
+    }
+    record->sequence = sequence;
+    record->type = slot.type;
+    record->a = slot.a;
+    record->time = slot.time;
+    record->b = slot.b;
+    record->c = slot.c;
+    // Unchanged afterwards: no writer touched the slot while it was copied
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return slot.sequence.load(std::memory_order_relaxed) == sequence;
+}
+
+TraceReader::TraceReader(const TraceRing& ring, uint32_t from, int64_t now)
+    : _ring(ring), _pendingOffset(0) {
+    _end = ring.head();
+    uint32_t oldest = _end > TraceRing::SIZE ? _end - TraceRing::SIZE : 0;
+    _next = from < oldest ? oldest : from > _end ? _end : from;
+
+    memset(&_pending, 0, sizeof(_pending));
+    _pending.header.magic = TraceRing::MAGIC;
+    _pending.header.version = TraceRing::VERSION;
+    _pending.header.recordSize = sizeof(TraceRecord);
+    _pending.header.time = now;
+    _pending.header.first = _next;
+    _pending.header.end = _end;
+    _pendingLength = sizeof(TraceHeader);
+}
+
+size_t TraceReader::read(uint8_t* buffer, size_t maxLength) {
+    size_t written = 0;
+    while (written < maxLength) {
+        if (_pendingOffset == _pendingLength) {
+            if (!next()) {
+                break;
+            }
+        }
+        size_t chunk = _pendingLength - _pendingOffset;
+        if (chunk > maxLength - written) {
+            chunk = maxLength - written;
+        }
+        memcpy(buffer + written, (const uint8_t*)&_pending + _pendingOffset, chunk);
+        _pendingOffset += chunk;
+        written += chunk;
+    }
+    return written;
+}
+
+/**
+ * Stage the next readable record. Records overwritten since the download
+ * started are skipped; the gap shows in the sequence numbers.
+ */
+bool TraceReader::next() {
+    while (_next != _end) {
+        uint32_t sequence = _next++;
+        if (_ring.read(sequence, &_pending.record)) {
+            _pendingLength = sizeof(TraceRecord);
+            _pendingOffset = 0;
+            return true;
+        }
+    }
+    return false;
+}
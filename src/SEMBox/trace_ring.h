@@ -0,0 +1,140 @@
+/*********
+  SEMBox ESP32 - Trace Ring
+  Fixed-size binary event trace, written from any task
+
+  Events (commands, output switches, parameter changes, motion start and
+  end, faults) are 24-byte records in a ring; the oldest are overwritten.
+  record() claims a slot with a single atomic increment and fills it, so
+  any task can write without a lock in well under a microsecond, and the
+  trace can stay on in production. Every slot carries the sequence
+  number of its record, written last. A reader can thus tell a slot that
+  is being written, or was overwritten while it was read, and skips it.
+
+  TraceReader streams a header and the records a piece at a time, so
+  /trace can be sent as a chunked response straight from the ring.
+  Plain C++, builds on a Linux host.
+*********/
+
+#ifndef TRACE_RING_H
+#define TRACE_RING_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+
+enum TraceType : uint16_t {
+    TRACE_BOOT = 1,         // a: reset reason
+    TRACE_COMMAND,          // a: command type, b: command id (queued by a handler)
+    TRACE_COMMAND_DONE,     // a: failed, b: command id, c: failed batch operation + 1
+    TRACE_OUTPUTS,          // a: resulting outputs, b: set mask, c: clear mask
+    TRACE_PARAMS,           // a: division, b: ratio (1/1000), c: max velocity
+    TRACE_MOVE_START,       // b: steps (signed), c: target division index (low 32 bits)
+    TRACE_MOVE_END,         // b: step position (signed)
+    TRACE_STOP,             // a: TraceStop source, b: step position (signed)
+    TRACE_FAULT             // a: TraceFault, b/c: details
+};
+
+enum TraceStop : uint16_t {
+    STOP_REQUEST,           // /table/stop
+    STOP_PROGRAM            // /program/stop
+};
+
+enum TraceFault : uint16_t {
+    FAULT_FOLLOWING_ERROR,  // b: error in steps, c: step position
+    FAULT_HOMING,           // b: step position
+    FAULT_PROGRAM,          // b: program counter
+    FAULT_QUEUE_FULL,       // b: command type
+    FAULT_JOURNAL           // Position journal write failed
+};
+
+// Wire layout of a record (little endian, as stored)
+struct TraceRecord {
+    uint32_t sequence;
+    uint16_t type;
+    uint16_t a;
+    int64_t time;           // esp_timer microseconds
+    uint32_t b;
+    uint32_t c;
+};
+
+// Start of a /trace download
+struct TraceHeader {
+    uint32_t magic;         // "SBTR"
+    uint16_t version;
+    uint16_t recordSize;
+    int64_t time;           // When the download started
+    uint32_t first;         // Sequence number of the first record sent
+    uint32_t end;           // Sequence number after the last record sent
+};
+
+typedef int64_t (*TraceClock)();    // Microseconds, monotonic
+
+class TraceRing {
+public:
+    static const uint32_t SIZE = 512;       // Records, power of two (12 KB)
+    static const uint32_t MAGIC = 0x52544253;
+    static const uint16_t VERSION = 1;
+
+    explicit TraceRing(TraceClock clock);
+
+    // Append an event (any task)
+    void record(TraceType type, uint16_t a = 0, uint32_t b = 0, uint32_t c = 0) {
+        uint32_t sequence = _head.fetch_add(1, std::memory_order_relaxed);
+        Slot& slot = _slots[sequence & (SIZE - 1)];
+        slot.sequence.store(~sequence, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        slot.type = type;
+        slot.a = a;
+        slot.time = _clock();
+        slot.b = b;
+        slot.c = c;
+        slot.sequence.store(sequence, std::memory_order_release);
+    }
+
+    // Sequence number the next record will get
+    uint32_t head() const { return _head.load(std::memory_order_acquire); }
+
+    // Copy one record; false if it was overwritten or is being written
+    bool read(uint32_t sequence, TraceRecord* record) const;
+
+private:
+    struct Slot {
+        std::atomic<uint32_t> sequence;
+        uint16_t type;
+        uint16_t a;
+        int64_t time;
+        uint32_t b;
+        uint32_t c;
+    };
+
+    TraceClock _clock;
+    std::atomic<uint32_t> _head;
+    Slot _slots[SIZE];
+};
+
+/**
+ * Resumable /trace exporter: read() fills the buffer with the next part of
+ * the header and the records from sequence number from (or the oldest
+ * kept) to the head at construction, and returns 0 once all were written.
+ */
+class TraceReader {
+public:
+    TraceReader(const TraceRing& ring, uint32_t from, int64_t now);
+
+    size_t read(uint8_t* buffer, size_t maxLength);
+
+private:
+    bool next();
+
+    const TraceRing& _ring;
+    uint32_t _next;
+    uint32_t _end;
+    union {
+        TraceHeader header;
+        TraceRecord record;
+    } _pending;
+    size_t _pendingLength;
+    size_t _pendingOffset;
+};
+
+#endif // TRACE_RING_H
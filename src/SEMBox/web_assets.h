@@ -0,0 +1,1107 @@
+/*********
+  SEMBox ESP32 - Compressed Web Assets
+  GENERATED by tools/build_web_assets.py from web_content.h - DO NOT EDIT
+
+  Each asset is stored gzip-compressed together with a strong ETag.
+  Stylesheet and script are also reachable under a content-hashed URL
+  which may be cached as immutable. The assets are constexpr, so their
+  URLs can appear in the route table.
+*********/
+
+#ifndef WEB_ASSETS_H
+#define WEB_ASSETS_H
+
+#include <Arduino.h>
+
+struct WebAsset {
+    const char* path;           // Canonical URL (revalidated with ETag)
+    const char* hashedPath;     // Content-hashed URL (immutable), or nullptr
+    const char* contentType;
+    const char* etag;           // Strong ETag, including quotes
+    const uint8_t* data;        // gzip-compressed body
+    size_t length;              // Compressed length
+    size_t rawLength;           // Uncompressed length (informational)
+};
+
+// The page at / with stylesheet and script inlined: a gzip stream cut
+// after its last full deflate block. The firmware appends the status,
+// middle, channel list and tail as a final stored block, then CRC-32
+// (continued from headCrc) and length of the whole page (see GzipSplice).
+struct WebBootstrap {
+    const char* path;
+    const char* contentType;
+    const uint8_t* head;        // gzip header and deflate blocks, not final
+    size_t headLength;
+    uint32_t headCrc;           // CRC-32 of the uncompressed head
+    uint32_t headRawLength;
+    const char* middle;         // Between the status and the channel list
+    const char* tail;           // Closes the page after the channel list
+};
+
+// /style.css: 16248 -> 3134 bytes (19% of raw)
+const uint8_t style_css_gz[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xc5, 0x5b, 0x6d, 0x8f, 0xdb, 0xb8,
+    0x11, 0xfe, 0xbe, 0xbf, 0x42, 0x40, 0x91, 0xc6, 0x4e, 0x2d, 0x47, 0xd6, 0xda, 0x5e, 0xc7, 0x46,
+    0x81, 0x66, 0x73, 0x97, 0x36, 0xc0, 0xb5, 0x17, 0x64, 0xd3, 0xf6, 0xfa, 0x91, 0x96, 0x68, 0x9b,
+    0x8d, 0x2c, 0x0a, 0x92, 0xbc, 0x2f, 0x59, 0xdc, 0x7f, 0xbf, 0x21, 0x45, 0x4a, 0x14, 0x49, 0xc9,
+    0x92, 0xbc, 0xed, 0x39, 0x97, 0xdc, 0x2e, 0x45, 0x0d, 0x87, 0xc3, 0x79, 0x79, 0x66, 0x86, 0xbe,
+    0x7a, 0xfb, 0xc6, 0xf9, 0x73, 0xf7, 0xcf, 0x95, 0xe3, 0x38, 0x77, 0x3f, 0xfe, 0xfd, 0x96, 0x3e,
+    0x3a, 0x9f, 0xe2, 0xf0, 0x94, 0xe5, 0x29, 0x41, 0x91, 0xf3, 0x03, 0xca, 0x0e, 0x5b, 0x8a, 0xd2,
+    0xd0, 0xf9, 0x70, 0x77, 0xc7, 0xa6, 0x7c, 0xfc, 0x74, 0xfb, 0xe5, 0x67, 0xe7, 0x03, 0x4d, 0x13,
+    0x9a, 0xa2, 0x1c, 0x3b, 0x5f, 0x0f, 0xf8, 0x88, 0x1d, 0xd7, 0xf9, 0x39, 0x45, 0xf1, 0x1e, 0xbf,
+    0xfd, 0xf7, 0x81, 0xe4, 0xf8, 0xed, 0x6d, 0x74, 0xc2, 0x6c, 0x72, 0x8f, 0xe5, 0x9d, 0x37, 0x6f,
+    0xaf, 0xae, 0x80, 0x63, 0x58, 0xc6, 0xf9, 0x17, 0x82, 0xb5, 0xb7, 0x11, 0xce, 0x80, 0xae, 0x5c,
+    0x2f, 0xa2, 0xa9, 0xf3, 0x19, 0x45, 0x38, 0x87, 0x35, 0x61, 0xea, 0x3a, 0xa5, 0x34, 0x77, 0x9e,
+    0xd9, 0x22, 0x0e, 0xbc, 0xf5, 0x39, 0x25, 0x47, 0x94, 0x3e, 0x15, 0xf3, 0x32, 0x36, 0x81, 0x3d,
+    0x70, 0xdd, 0xed, 0xde, 0x4d, 0x8a, 0x47, 0x6b, 0xe7, 0x0f, 0xbb, 0x05, 0xfb, 0xb3, 0xa9, 0x1e,
+    0x65, 0x38, 0xa0, 0x71, 0x28, 0x1e, 0xf2, 0x8f, 0xf2, 0x30, 0xc7, 0x69, 0x4e, 0x8a, 0x67, 0x78,
+    0xc5, 0xfe, 0x28, 0xcf, 0x02, 0x10, 0x88, 0xf6, 0x8e, 0xe4, 0xe4, 0x7d, 0x10, 0xe0, 0x38, 0x37,
+    0x18, 0x41, 0x7c, 0x58, 0x61, 0xe6, 0xe3, 0xc7, 0xe5, 0xd2, 0xf3, 0x36, 0xf5, 0xc7, 0x2a, 0x43,
+    0x9e, 0x37, 0xbf, 0xb9, 0x7d, 0xaf, 0x4d, 0x78, 0x40, 0x69, 0x4c, 0xe2, 0x3d, 0x5b, 0xdb, 0xdb,
+    0xce, 0xfd, 0x77, 0xda, 0xe3, 0x90, 0x9d, 0x41, 0x0a, 0x4f, 0xc3, 0xe0, 0x7a, 0x31, 0x5f, 0xe8,
+    0xd4, 0x4f, 0xf0, 0xff, 0x2c, 0x83, 0xc7, 0xfe, 0x0a, 0xdd, 0xc8, 0xc7, 0x92, 0xf1, 0xaf, 0xf8,
+    0xd1, 0x64, 0x3b, 0x87, 0x41, 0x85, 0xe9, 0x6b, 0xfe, 0xd9, 0xa8, 0x0f, 0x55, 0x96, 0x17, 0xfc,
+    0x53, 0x7b, 0x7c, 0x3c, 0xe5, 0x98, 0x89, 0x6a, 0xc5, 0x3f, 0xf5, 0x15, 0x6f, 0x69, 0x1a, 0xe2,
+    0xd4, 0x3c, 0x33, 0x3e, 0xec, 0x86, 0x78, 0x87, 0x4e, 0x51, 0xce, 0x36, 0xc3, 0x3f, 0x9b, 0xfa,
+    0x63, 0x49, 0x18, 0xf3, 0x4f, 0x9d, 0xf0, 0xdd, 0x01, 0x85, 0xf4, 0x41, 0x21, 0x99, 0xf1, 0x01,
+    0x37, 0x3b, 0xae, 0x1d, 0xcf, 0x99, 0x25, 0x8f, 0xce, 0x35, 0xfc, 0x4d, 0xf7, 0x5b, 0x34, 0xf2,
+    0x26, 0x8e, 0xf8, 0x6f, 0xea, 0xad, 0xc6, 0x9b, 0xfa, 0xfc, 0x63, 0xc8, 0xe6, 0xcf, 0x61, 0xee,
+    0xcc, 0xb7, 0xbc, 0x30, 0xd3, 0xe7, 0x47, 0x7b, 0x36, 0x7f, 0x05, 0x53, 0xfd, 0xb9, 0x6d, 0xbe,
+    0xaf, 0xbf, 0xb0, 0x8f, 0xe8, 0x03, 0x7b, 0xc5, 0x73, 0x7c, 0x4f, 0xbe, 0xe0, 0x2f, 0x16, 0x13,
+    0x67, 0xe6, 0xf9, 0xe2, 0x25, 0xf9, 0x4e, 0x79, 0x4c, 0x60, 0x67, 0x19, 0xc9, 0x09, 0x8d, 0xd5,
+    0x63, 0x2a, 0x07, 0xdd, 0x1d, 0xca, 0x40, 0x66, 0xb0, 0xd8, 0x22, 0x73, 0x30, 0xca, 0xf0, 0xc6,
+    0x9c, 0x12, 0xd3, 0xf4, 0x88, 0x22, 0x36, 0xc9, 0x6f, 0x9e, 0x94, 0x15, 0xac, 0x4d, 0xe7, 0xea,
+    0x0c, 0xed, 0xe4, 0xbe, 0xa0, 0x90, 0x9c, 0x14, 0x36, 0x52, 0xfe, 0x7b, 0x21, 0xe6, 0x4d, 0x7d,
+    0x8c, 0x8b, 0x52, 0x1b, 0xe3, 0xe2, 0xda, 0x5c, 0xfd, 0xca, 0xed, 0xfe, 0x0b, 0xce, 0x70, 0xee,
+    0xfc, 0xd1, 0xb9, 0x85, 0xc5, 0x9c, 0xbb, 0xfc, 0x89, 0x59, 0x3f, 0x10, 0x7e, 0x33, 0xb9, 0x7a,
+    0xb3, 0x5e, 0x6f, 0xf1, 0x8e, 0xa6, 0x98, 0xff, 0x88, 0x76, 0x60, 0x98, 0xc2, 0xf0, 0x41, 0x2b,
+    0xf7, 0x24, 0x2e, 0x09, 0x27, 0x28, 0x0c, 0xb9, 0x71, 0x88, 0xdf, 0xb7, 0xf4, 0xd1, 0xcd, 0xc8,
+    0x77, 0x3e, 0x24, 0xb4, 0x06, 0x86, 0xf8, 0x82, 0x87, 0xfc, 0x18, 0x09, 0x22, 0x3b, 0xca, 0x4c,
+    0x83, 0x7c, 0xc7, 0x6b, 0x67, 0xb6, 0x4c, 0x1e, 0x8b, 0x57, 0xb3, 0x20, 0xa5, 0x51, 0xe4, 0x6e,
+    0xf1, 0x01, 0xdd, 0x13, 0x0a, 0x16, 0x95, 0x1d, 0xc1, 0xdf, 0x1c, 0xf8, 0xbb, 0x5b, 0x1a, 0x3e,
+    0xa9, 0xef, 0xee, 0xd0, 0x91, 0x44, 0xa0, 0xfe, 0xaf, 0xef, 0xf0, 0x9e, 0x62, 0xe7, 0x9f, 0x9f,
+    0x5e, 0x4f, 0x1c, 0x17, 0x25, 0x49, 0x84, 0xdd, 0xec, 0x29, 0xcb, 0xf1, 0x71, 0xe2, 0x64, 0x20,
+    0x56, 0xb0, 0x94, 0x94, 0x08, 0x67, 0xb1, 0x45, 0xc1, 0xb7, 0x7d, 0x4a, 0x4f, 0x31, 0x48, 0xe5,
+    0x1e, 0xa5, 0x23, 0xd5, 0x51, 0x89, 0xf3, 0x0e, 0x98, 0x55, 0xc8, 0xa7, 0xaa, 0x19, 0x8a, 0xe7,
+    0x47, 0x12, 0xbb, 0x07, 0x4c, 0xf6, 0x07, 0x38, 0xed, 0x99, 0xe7, 0xdd, 0x1f, 0x8a, 0xe1, 0x88,
+    0xc4, 0xb8, 0x1a, 0x9f, 0x2e, 0xa5, 0x78, 0x6f, 0xcb, 0x15, 0xc1, 0x8b, 0x82, 0x0f, 0x4d, 0x63,
+    0x26, 0x5d, 0xb6, 0x15, 0x29, 0x5d, 0xb1, 0x25, 0xb0, 0xe6, 0x1c, 0x9c, 0x05, 0x6c, 0xe7, 0xb5,
+    0x90, 0x2a, 0x2d, 0x34, 0x62, 0xed, 0xec, 0xc8, 0x23, 0x16, 0x66, 0x98, 0xd3, 0xa4, 0x14, 0x73,
+    0x84, 0x77, 0x79, 0xf9, 0x4b, 0x5a, 0xac, 0x5c, 0x9e, 0x40, 0x9e, 0xd3, 0x4a, 0x1b, 0xd4, 0x6d,
+    0xf3, 0x01, 0xc9, 0x31, 0x4a, 0xdd, 0x3d, 0x53, 0x0a, 0x58, 0x78, 0xf4, 0xce, 0x0b, 0xf1, 0x7e,
+    0x22, 0xc5, 0xa2, 0x18, 0xfb, 0x98, 0x59, 0xee, 0xc4, 0xe1, 0x3a, 0x9a, 0xa0, 0x94, 0x79, 0x59,
+    0x18, 0x18, 0x73, 0xf3, 0x79, 0xeb, 0x2c, 0x99, 0x01, 0xb1, 0x7f, 0x26, 0x8d, 0x94, 0x07, 0x93,
+    0x2c, 0xb8, 0xa7, 0x09, 0x0a, 0x48, 0xfe, 0xc4, 0x8c, 0x62, 0x21, 0x45, 0x43, 0x40, 0x58, 0xa9,
+    0x8b, 0xef, 0xe1, 0x4d, 0xf0, 0xab, 0x31, 0x8d, 0x85, 0xa1, 0x7c, 0x77, 0x49, 0x1c, 0xe2, 0xc7,
+    0xb5, 0xe3, 0xce, 0xe4, 0x09, 0xf4, 0x0c, 0xc5, 0x1f, 0xe0, 0x1c, 0x10, 0x6c, 0x20, 0x1d, 0x10,
+    0x47, 0xa7, 0x81, 0x7c, 0xb9, 0x34, 0x94, 0x47, 0xf7, 0x81, 0x84, 0xf9, 0x01, 0x74, 0xc2, 0xf7,
+    0xca, 0x1d, 0x95, 0xf6, 0xe3, 0xa0, 0x53, 0x4e, 0x35, 0x23, 0xf2, 0xab, 0x69, 0x76, 0x55, 0x0b,
+    0x49, 0x96, 0x44, 0x08, 0xe4, 0xb1, 0x8b, 0xb0, 0x98, 0xc9, 0x7e, 0x72, 0x43, 0x92, 0xe2, 0xa0,
+    0xd0, 0x18, 0x50, 0xe2, 0xd3, 0x31, 0x1e, 0x28, 0x81, 0xbf, 0x61, 0xc4, 0x9c, 0x4c, 0xe1, 0x0b,
+    0x86, 0x48, 0xe1, 0x50, 0x10, 0x78, 0x6e, 0xe2, 0xf6, 0xbf, 0x00, 0x72, 0xc8, 0xee, 0xc9, 0x2d,
+    0x55, 0x1e, 0x74, 0x20, 0xc0, 0x60, 0xf4, 0xf9, 0x03, 0xc6, 0x71, 0x31, 0x07, 0x45, 0x64, 0x1f,
+    0xbb, 0x80, 0x69, 0x8e, 0x70, 0xbe, 0x2c, 0x8a, 0xe2, 0xd4, 0x22, 0x27, 0xee, 0xef, 0x5b, 0x4c,
+    0x9b, 0xe1, 0x85, 0xb1, 0x34, 0x09, 0xa6, 0x7e, 0x6b, 0x1e, 0x85, 0x32, 0x1a, 0x91, 0xb0, 0xae,
+    0xe9, 0x22, 0xea, 0xd5, 0x26, 0x0b, 0x7f, 0x29, 0xe9, 0x95, 0xde, 0x73, 0xac, 0x9e, 0xa2, 0x2b,
+    0x6d, 0x4d, 0x61, 0x85, 0xf9, 0x3f, 0x1e, 0x68, 0xe4, 0xab, 0x65, 0x5c, 0xab, 0xd3, 0xe7, 0xd6,
+    0x3c, 0xd7, 0x18, 0xaa, 0x23, 0x96, 0x31, 0x3f, 0xc4, 0x69, 0x44, 0xf7, 0xb4, 0x59, 0xa0, 0x8d,
+    0xc2, 0xda, 0xa3, 0x44, 0x7a, 0x57, 0x49, 0xc5, 0x25, 0x20, 0x76, 0x41, 0x4a, 0xa8, 0xe6, 0x7c,
+    0x25, 0x39, 0x97, 0xda, 0x56, 0x8d, 0x98, 0x62, 0x35, 0xf8, 0x3b, 0x27, 0xb0, 0x72, 0xd7, 0x7d,
+    0x38, 0x37, 0x74, 0x44, 0x7d, 0xd8, 0x28, 0x60, 0x16, 0xd7, 0xc7, 0xfa, 0x5e, 0xb3, 0xfb, 0x7d,
+    0x7d, 0xbf, 0xbe, 0xb1, 0xdf, 0x6a, 0x44, 0xb8, 0xff, 0x12, 0x62, 0x96, 0xa4, 0x58, 0x28, 0x70,
+    0x0e, 0x33, 0x4b, 0xf0, 0x9a, 0xde, 0x2c, 0x52, 0x7c, 0xdc, 0x54, 0xe3, 0x0f, 0x82, 0xea, 0x8d,
+    0xc4, 0x99, 0xb5, 0x98, 0xa2, 0x43, 0xce, 0xb1, 0x2d, 0x80, 0xe8, 0x0b, 0x4f, 0xb3, 0xd3, 0x36,
+    0x27, 0x79, 0x84, 0xcd, 0xf5, 0xbd, 0xe9, 0x4a, 0x61, 0xc0, 0x0c, 0x5f, 0xfa, 0x42, 0x7c, 0x90,
+    0x7b, 0x5e, 0x88, 0x3e, 0xa0, 0xb7, 0xa7, 0x24, 0xc1, 0x69, 0x50, 0x42, 0x0d, 0x8e, 0xf4, 0x53,
+    0x97, 0x99, 0x24, 0x37, 0xb3, 0x99, 0x50, 0x1e, 0x06, 0xef, 0x72, 0x94, 0x03, 0xec, 0x80, 0x2c,
+    0x85, 0x04, 0x28, 0x87, 0xbc, 0x80, 0x19, 0x7b, 0xc6, 0x07, 0x99, 0xdb, 0x15, 0x83, 0x43, 0xb5,
+    0xb4, 0x74, 0x7b, 0xa5, 0x85, 0x33, 0x40, 0x57, 0x41, 0x03, 0xab, 0x81, 0xcb, 0x64, 0xa1, 0x83,
+    0x1a, 0x66, 0xc7, 0xbe, 0x9e, 0x80, 0x1d, 0x81, 0xd8, 0x5e, 0x58, 0x26, 0x3d, 0xd2, 0x9d, 0x7b,
+    0xba, 0x0e, 0x55, 0x23, 0x1a, 0x17, 0x5e, 0x13, 0xff, 0x15, 0x50, 0x17, 0x9c, 0xa1, 0x18, 0x6c,
+    0xaa, 0xf0, 0xe0, 0xc9, 0x29, 0x02, 0x3c, 0xe6, 0x67, 0x0e, 0x89, 0x77, 0x24, 0x06, 0xa1, 0xe9,
+    0xec, 0x4c, 0x69, 0xcc, 0x54, 0x46, 0x70, 0xd5, 0x68, 0xa6, 0x22, 0xf7, 0x18, 0x9b, 0x86, 0xe3,
+    0x09, 0xc8, 0xdc, 0x30, 0x1d, 0x56, 0xfb, 0xcb, 0x37, 0xfc, 0xb4, 0x4b, 0xd1, 0x11, 0x10, 0x61,
+    0xc1, 0x4e, 0xb1, 0x96, 0xf7, 0x8a, 0xe1, 0x64, 0xef, 0x95, 0xf8, 0xb5, 0x16, 0xa2, 0x67, 0x9b,
+    0x72, 0x4c, 0x51, 0xb1, 0x2c, 0x80, 0x04, 0x72, 0x24, 0x61, 0xfb, 0xaf, 0xfc, 0xdf, 0x85, 0x9d,
+    0x80, 0x37, 0xbd, 0x69, 0x23, 0x31, 0xad, 0x88, 0x28, 0xe2, 0xe0, 0x26, 0x72, 0xb1, 0x61, 0xd4,
+    0x6c, 0x77, 0xe1, 0x79, 0x03, 0xc3, 0x67, 0x95, 0xb9, 0xff, 0x35, 0x25, 0xe1, 0x90, 0xf8, 0x19,
+    0x96, 0x14, 0x34, 0x5b, 0xda, 0x03, 0x41, 0x61, 0x32, 0xf0, 0x13, 0xec, 0xe2, 0x08, 0xe3, 0x39,
+    0x76, 0x8b, 0x70, 0x0f, 0xaa, 0x96, 0xe2, 0x04, 0xa3, 0x7c, 0xc4, 0x50, 0x85, 0xbb, 0x23, 0xf9,
+    0x84, 0x41, 0x08, 0xc0, 0x20, 0xa3, 0xeb, 0x05, 0x03, 0x68, 0xce, 0x6c, 0x97, 0x8e, 0xc7, 0x8a,
+    0xcd, 0x55, 0x21, 0x8b, 0x59, 0xa9, 0x74, 0x3b, 0x03, 0x30, 0x13, 0xe3, 0x75, 0x38, 0x5e, 0x08,
+    0xaa, 0xad, 0xfe, 0xff, 0xa3, 0x78, 0x85, 0x27, 0x7a, 0xc4, 0xef, 0x2a, 0x5f, 0x5b, 0x57, 0x4a,
+    0x2a, 0x75, 0x4b, 0x4f, 0xf8, 0xc6, 0x13, 0x85, 0x62, 0xe3, 0x24, 0xc3, 0x03, 0xec, 0x00, 0x44,
+    0x7d, 0x8a, 0x19, 0xe8, 0x2d, 0x32, 0x41, 0xd0, 0xcf, 0xf4, 0x01, 0x24, 0x91, 0x15, 0x9e, 0x80,
+    0x97, 0x42, 0x0e, 0xf4, 0xbe, 0x04, 0x5a, 0x8a, 0xb1, 0xf0, 0x1f, 0x99, 0x66, 0xfc, 0x67, 0xe4,
+    0x42, 0x02, 0x3d, 0x3e, 0xb3, 0x2d, 0x2e, 0x8b, 0x92, 0x66, 0x9c, 0x1f, 0xdc, 0xe0, 0x40, 0xa2,
+    0x10, 0x0c, 0xd6, 0x79, 0xae, 0x38, 0x02, 0xe1, 0x72, 0x25, 0x84, 0x14, 0x37, 0xdb, 0x80, 0xfd,
+    0xe9, 0xb3, 0xfd, 0x86, 0xd9, 0xbe, 0x75, 0xf6, 0x75, 0xc3, 0xec, 0x6b, 0x3e, 0xbb, 0x98, 0xee,
+    0xfe, 0x4f, 0x81, 0xa4, 0x0e, 0xdf, 0xf4, 0xf8, 0x53, 0x3e, 0x51, 0x42, 0x90, 0x4c, 0x66, 0xc5,
+    0x83, 0x2e, 0x01, 0x44, 0xdd, 0xc8, 0xc1, 0xb7, 0xc1, 0x87, 0x99, 0xdf, 0x80, 0x1f, 0x96, 0x56,
+    0xfc, 0xa0, 0xe5, 0xa4, 0x32, 0xcd, 0x0c, 0xf7, 0xbc, 0x3e, 0x37, 0xdd, 0xf2, 0x9f, 0x9e, 0xeb,
+    0xba, 0x2d, 0x4b, 0x29, 0x6d, 0xf1, 0xa9, 0xe6, 0x39, 0x6f, 0xce, 0xb1, 0xd4, 0x82, 0x22, 0xd8,
+    0xae, 0x39, 0x17, 0x53, 0x04, 0xe9, 0xc8, 0xbd, 0x2d, 0x44, 0xd9, 0x0a, 0x2e, 0xb3, 0xc5, 0xb8,
+    0x19, 0x2d, 0xd9, 0xd0, 0xa6, 0x7a, 0x00, 0x36, 0x82, 0xd7, 0xe3, 0x81, 0xee, 0x4c, 0xe0, 0x1c,
+    0xe6, 0xd5, 0x86, 0xb8, 0x33, 0x11, 0x94, 0x98, 0x8b, 0x1e, 0xea, 0xc0, 0xfd, 0xc2, 0x57, 0x5b,
+    0x41, 0xbc, 0x04, 0x5c, 0xf0, 0x72, 0x9b, 0xd3, 0xd4, 0x90, 0x51, 0xa9, 0x0a, 0x86, 0x36, 0xb7,
+    0x63, 0xf6, 0x33, 0x0e, 0x57, 0x45, 0x2f, 0xaa, 0x53, 0x14, 0x8f, 0xf9, 0x51, 0x9a, 0x2e, 0x8f,
+    0xd5, 0xca, 0xc6, 0xc6, 0x6e, 0x6a, 0xde, 0x4c, 0x25, 0xb0, 0x6e, 0xcb, 0x8c, 0x54, 0x71, 0x4c,
+    0x23, 0xb4, 0xc5, 0x91, 0x2e, 0xf4, 0x6d, 0x44, 0x83, 0x6f, 0xed, 0x3a, 0x6e, 0x1a, 0x58, 0x6d,
+    0x63, 0xed, 0x88, 0x59, 0x73, 0x24, 0x73, 0xdb, 0x41, 0x4d, 0xef, 0x51, 0x74, 0xc2, 0xdd, 0x38,
+    0x9b, 0x4d, 0xfb, 0x39, 0x04, 0xab, 0x89, 0xd4, 0x2b, 0x64, 0x1f, 0x68, 0x0c, 0x87, 0x87, 0xb2,
+    0xd7, 0x80, 0x08, 0x68, 0x4c, 0xb9, 0x9b, 0xb4, 0x30, 0x19, 0xe2, 0x1c, 0x91, 0x36, 0xf9, 0x89,
+    0xad, 0xca, 0xbc, 0xf5, 0x12, 0xa1, 0x76, 0x64, 0x70, 0x58, 0x01, 0x27, 0xa5, 0xd1, 0x70, 0xfb,
+    0x0d, 0x04, 0x01, 0xab, 0x05, 0x9f, 0xaf, 0xb9, 0x58, 0x4c, 0x56, 0x50, 0xec, 0x6b, 0xb3, 0x2f,
+    0x06, 0x76, 0x4a, 0x6b, 0xb6, 0x14, 0x99, 0x54, 0xab, 0x45, 0x51, 0x74, 0x06, 0x9f, 0x54, 0x45,
+    0xc9, 0x14, 0x22, 0x36, 0xf3, 0xee, 0xa2, 0x46, 0x07, 0x96, 0xbb, 0xe3, 0x95, 0xeb, 0x03, 0x09,
+    0x43, 0x1c, 0x9b, 0xfb, 0xee, 0x6a, 0xdd, 0x2a, 0x2a, 0xd7, 0x69, 0x68, 0x01, 0xa5, 0x8b, 0x8b,
+    0xb0, 0x65, 0x3d, 0x8d, 0x35, 0xff, 0x99, 0xbe, 0x66, 0xbc, 0xbb, 0xb0, 0xea, 0x62, 0xf1, 0x0f,
+    0x16, 0xb5, 0xb8, 0xb0, 0x22, 0xa3, 0x76, 0xd4, 0xfa, 0x24, 0xc2, 0x2f, 0x56, 0x8f, 0xe9, 0xae,
+    0x43, 0xc6, 0xb6, 0xcd, 0xe2, 0xcc, 0xdc, 0x28, 0xce, 0xcc, 0xb5, 0xe2, 0x4c, 0x5b, 0x71, 0x43,
+    0xe1, 0xa4, 0x21, 0xf8, 0xd8, 0x79, 0x51, 0xb4, 0xcb, 0x76, 0x2e, 0x1d, 0xca, 0x60, 0xdd, 0xc8,
+    0x55, 0xfb, 0xb5, 0x55, 0x9a, 0xe4, 0xd4, 0xc2, 0x11, 0x67, 0x12, 0x2d, 0x2a, 0xc9, 0x59, 0x39,
+    0x25, 0x86, 0xbc, 0xfc, 0x5c, 0x3c, 0x31, 0xe2, 0x86, 0x1a, 0x65, 0x5a, 0xfc, 0xb4, 0x7d, 0x53,
+    0x2c, 0x54, 0x18, 0x4b, 0x12, 0x5e, 0x85, 0x70, 0x3b, 0xc4, 0xd8, 0xde, 0x38, 0xb2, 0xee, 0xb0,
+    0xc0, 0x64, 0x57, 0xed, 0x00, 0xd6, 0x1a, 0x9c, 0x4c, 0xd4, 0x39, 0x5f, 0x4d, 0x9c, 0xd5, 0x6c,
+    0xe2, 0xdc, 0x5c, 0x9f, 0x45, 0x9d, 0x45, 0x5b, 0xb7, 0xcb, 0xd9, 0xaa, 0xb2, 0x79, 0x21, 0xa0,
+    0xab, 0xae, 0x89, 0x82, 0xa2, 0xf1, 0xd8, 0xe8, 0x8b, 0x94, 0x12, 0xda, 0xa0, 0xa0, 0x79, 0x7b,
+    0x02, 0xe7, 0x14, 0x5f, 0x90, 0xc3, 0x6f, 0xf3, 0x58, 0xd7, 0xd6, 0x3a, 0xec, 0x64, 0x07, 0xe8,
+    0x6b, 0x25, 0x32, 0xb5, 0x73, 0xd3, 0xc9, 0x63, 0x35, 0x56, 0x77, 0x1a, 0x60, 0xd2, 0x29, 0xcd,
+    0x98, 0x84, 0x45, 0xbf, 0xa8, 0xa3, 0xb3, 0x12, 0xe8, 0xf4, 0x65, 0x3d, 0xe4, 0x99, 0x74, 0x29,
+    0x67, 0x7a, 0xbb, 0xdf, 0x47, 0xb8, 0xbb, 0xbf, 0x51, 0x34, 0xe8, 0xe1, 0xc0, 0x0b, 0x84, 0x66,
+    0xac, 0x13, 0x56, 0xd3, 0x98, 0x1e, 0xd5, 0x0a, 0x9a, 0xde, 0x2b, 0x9d, 0x99, 0xe1, 0xf5, 0x05,
+    0xd1, 0xbd, 0x5f, 0x2a, 0xdd, 0xf8, 0x1b, 0xb0, 0xb9, 0xd9, 0x6a, 0xc9, 0x96, 0x9e, 0x8f, 0xcf,
+    0x34, 0x17, 0x34, 0x10, 0x50, 0xd5, 0x9e, 0x6f, 0x51, 0xad, 0xea, 0xbc, 0x45, 0x92, 0xbb, 0x32,
+    0x4e, 0x5e, 0x12, 0x26, 0x2d, 0x8e, 0xa4, 0x0a, 0xe3, 0x76, 0x88, 0x23, 0x18, 0xd9, 0x91, 0x28,
+    0xd2, 0x38, 0x29, 0x04, 0xaa, 0x48, 0xd8, 0xbb, 0xa4, 0xa3, 0xe2, 0x99, 0xca, 0xcb, 0xc9, 0x9a,
+    0xea, 0x9b, 0x55, 0x3d, 0x10, 0xab, 0xcb, 0x32, 0x39, 0xd6, 0x35, 0xa0, 0xbf, 0xfb, 0x78, 0x2f,
+    0xfc, 0xd3, 0x50, 0xc8, 0x2d, 0xfc, 0x9b, 0xab, 0x54, 0x02, 0x79, 0x82, 0x5c, 0x60, 0x6a, 0x5e,
+    0xd7, 0x89, 0x1d, 0xbf, 0xd8, 0x94, 0x9c, 0x7b, 0x49, 0x7e, 0x6d, 0x14, 0x48, 0x67, 0xf6, 0x02,
+    0x69, 0x85, 0xd5, 0x8a, 0x55, 0xdd, 0xca, 0xcd, 0xf5, 0xcc, 0x08, 0x86, 0xb9, 0x8d, 0x82, 0x09,
+    0xdf, 0xe8, 0x8c, 0xf0, 0x6b, 0x2e, 0x8a, 0x37, 0xfd, 0x5d, 0x92, 0x89, 0x61, 0xde, 0xb5, 0x96,
+    0x4e, 0xb4, 0x03, 0x3a, 0x4d, 0xee, 0x06, 0x54, 0xbc, 0xf6, 0x75, 0xa8, 0x58, 0x8d, 0xf4, 0x83,
+    0xa4, 0xea, 0x2a, 0x4c, 0xd5, 0x9e, 0x87, 0x44, 0x9b, 0x33, 0x3e, 0xbe, 0x5a, 0xa3, 0x9e, 0x0a,
+    0xf5, 0x72, 0x07, 0xe7, 0x93, 0x1d, 0x1d, 0x56, 0xb6, 0xb8, 0xee, 0xf9, 0xf9, 0xd2, 0x70, 0xd5,
+    0x50, 0xed, 0xef, 0x14, 0x3e, 0x52, 0x9a, 0x5f, 0x74, 0x8f, 0x60, 0x57, 0x10, 0x78, 0xae, 0xa4,
+    0xcb, 0xad, 0xa8, 0xe9, 0x3e, 0xc0, 0x5c, 0x4b, 0xb8, 0xb8, 0xff, 0x56, 0xab, 0xfa, 0x55, 0xcf,
+    0xbd, 0x93, 0x11, 0x34, 0xd7, 0x2f, 0xd8, 0x71, 0x0a, 0xe6, 0x92, 0x36, 0x5d, 0x51, 0xe6, 0x4d,
+    0xe1, 0xc4, 0x33, 0x42, 0xad, 0xaa, 0xa5, 0x68, 0x96, 0x81, 0x61, 0x07, 0x49, 0xfe, 0x2b, 0x05,
+    0x08, 0xe3, 0xfc, 0x83, 0x82, 0x63, 0x61, 0x4d, 0x59, 0x58, 0x76, 0x88, 0xf8, 0x73, 0x4e, 0xe5,
+    0xb9, 0xf9, 0x32, 0x92, 0x79, 0xf3, 0x21, 0xd5, 0x33, 0xb6, 0x5a, 0xd9, 0xf1, 0x05, 0x6e, 0x6b,
+    0x0c, 0xbf, 0x7c, 0xd0, 0xde, 0xfd, 0x68, 0xb2, 0x92, 0x5f, 0x46, 0x01, 0x8a, 0x82, 0x11, 0x6f,
+    0x77, 0xfe, 0x89, 0xf3, 0x3f, 0x1e, 0xd4, 0x02, 0xd2, 0x6e, 0x27, 0x01, 0xbd, 0xa2, 0xbd, 0x58,
+    0x08, 0x79, 0x9a, 0x1d, 0xe8, 0x43, 0x0b, 0xcc, 0xfa, 0x65, 0xe4, 0x8d, 0x95, 0xe9, 0xee, 0x11,
+    0x67, 0x19, 0xda, 0xe3, 0x7a, 0x22, 0xd9, 0x78, 0x63, 0xed, 0x85, 0xfa, 0x9a, 0x3f, 0x51, 0xc4,
+    0x8e, 0x92, 0x23, 0xb1, 0x21, 0x97, 0x8c, 0xa7, 0x91, 0x20, 0xf0, 0xdc, 0x5a, 0x49, 0xb2, 0xdf,
+    0xed, 0x2a, 0x6e, 0x43, 0xf0, 0xf7, 0xeb, 0x57, 0x11, 0x5b, 0xae, 0xcd, 0xa1, 0x2d, 0x68, 0xce,
+    0x49, 0x02, 0x63, 0x6e, 0x52, 0x0b, 0x09, 0xc9, 0x8a, 0xbb, 0x73, 0x0b, 0x0d, 0xa1, 0xf9, 0x46,
+    0x53, 0xdf, 0x37, 0xee, 0x6c, 0xb9, 0x2c, 0xcb, 0xe2, 0x65, 0x24, 0x77, 0x66, 0xa4, 0x33, 0x7e,
+    0xa9, 0xae, 0xca, 0xd5, 0x36, 0xdd, 0xfd, 0xb8, 0x5d, 0x1b, 0x1c, 0x3a, 0xf8, 0x53, 0x9a, 0x83,
+    0x59, 0x42, 0x58, 0x6b, 0x70, 0x95, 0x89, 0xcb, 0x76, 0xf5, 0x6b, 0x02, 0x4a, 0xe3, 0x9e, 0x4f,
+    0x14, 0x9a, 0x45, 0x95, 0x86, 0xbb, 0xa2, 0x66, 0x29, 0x65, 0x27, 0x3a, 0xba, 0x5e, 0xb2, 0x0b,
+    0x80, 0x6a, 0x7b, 0x7d, 0x00, 0x0e, 0x94, 0x1c, 0x0e, 0xf1, 0xf7, 0x0a, 0xd7, 0xa2, 0xf7, 0x29,
+    0x7c, 0x65, 0x4a, 0x8f, 0xd6, 0xab, 0x02, 0xd6, 0x8b, 0x02, 0x4a, 0x80, 0x63, 0xe7, 0x53, 0xbb,
+    0x73, 0x50, 0x93, 0xc0, 0x99, 0x3b, 0x0b, 0x0a, 0x1d, 0xef, 0x32, 0xa1, 0x7c, 0xc1, 0x59, 0x02,
+    0x12, 0x61, 0xe0, 0xfb, 0x07, 0x9c, 0x41, 0x00, 0x1b, 0x22, 0x9b, 0x23, 0x0e, 0x09, 0x72, 0x46,
+    0xca, 0x85, 0xc2, 0x9b, 0xe5, 0x8a, 0x5d, 0x99, 0x2c, 0x36, 0x64, 0xdc, 0x3c, 0x34, 0x92, 0x6f,
+    0x55, 0x0e, 0xc5, 0x2b, 0xb5, 0xee, 0xea, 0x39, 0xfc, 0x6a, 0xa9, 0x6b, 0xb6, 0x45, 0x65, 0x75,
+    0x1d, 0xe5, 0xee, 0xda, 0xb9, 0x55, 0xd4, 0xd7, 0xf4, 0x5b, 0x10, 0x2d, 0xa8, 0x1e, 0x60, 0xbb,
+    0xf9, 0xbe, 0x25, 0xa7, 0xb0, 0xe7, 0x15, 0x33, 0xf3, 0x5d, 0xb3, 0x85, 0xd7, 0x77, 0x75, 0x7b,
+    0xe5, 0xa6, 0xcf, 0xfe, 0x2d, 0x79, 0xce, 0xf9, 0xc4, 0xe6, 0x5a, 0x6d, 0x1c, 0x72, 0x7d, 0xb5,
+    0x68, 0xce, 0x7c, 0xe5, 0x29, 0x9a, 0x63, 0xb9, 0xdd, 0x66, 0x34, 0xa4, 0x2a, 0x80, 0x52, 0xdb,
+    0x63, 0x5d, 0xb2, 0x96, 0x16, 0xa3, 0x4d, 0x22, 0x4a, 0x13, 0xa4, 0xc3, 0x5b, 0xfd, 0xa4, 0xd0,
+    0xa2, 0x08, 0x4a, 0xea, 0x66, 0x3b, 0x85, 0x94, 0x3e, 0x6c, 0xfa, 0xf1, 0xa4, 0xe5, 0x24, 0xd6,
+    0x12, 0xb6, 0xbd, 0x8c, 0x3d, 0xd0, 0x8f, 0x7c, 0x46, 0xcc, 0x39, 0xb2, 0xd0, 0x77, 0xe1, 0x7d,
+    0x9b, 0x44, 0x12, 0x72, 0x39, 0x66, 0x19, 0xde, 0xe1, 0xf2, 0x65, 0xc1, 0xb1, 0x20, 0xe9, 0x32,
+    0x44, 0x97, 0x5c, 0x40, 0x6f, 0x59, 0x27, 0xa7, 0x76, 0x73, 0xfb, 0x56, 0xfe, 0xce, 0x60, 0xa2,
+    0x33, 0xb9, 0x5a, 0xb1, 0x3e, 0x89, 0x93, 0x53, 0xae, 0x5f, 0xa5, 0xe0, 0x85, 0x4c, 0xbd, 0x89,
+    0xae, 0x46, 0xfe, 0xee, 0x69, 0xb5, 0x37, 0xa4, 0xf5, 0xdb, 0xa5, 0x6f, 0xda, 0xf1, 0x16, 0x45,
+    0x87, 0xaa, 0x41, 0x9f, 0x62, 0xa9, 0x51, 0x48, 0x54, 0xa4, 0xb8, 0xde, 0xd1, 0xe0, 0x24, 0xbd,
+    0x20, 0x3d, 0xe5, 0x0c, 0xb5, 0x58, 0xaa, 0xbf, 0x03, 0x99, 0xd6, 0x8b, 0x06, 0xea, 0xc2, 0x6b,
+    0x10, 0xe1, 0xf6, 0x1b, 0xc9, 0xe1, 0xd7, 0x98, 0xdf, 0x6b, 0x65, 0xad, 0x38, 0x5e, 0xed, 0x9e,
+    0x34, 0x4c, 0x04, 0xf6, 0xea, 0x13, 0x25, 0xdb, 0x1a, 0x60, 0x28, 0x8b, 0x0e, 0x9a, 0x15, 0x1c,
+    0x00, 0xc0, 0x9e, 0x49, 0xf3, 0xda, 0x53, 0xcb, 0x82, 0x4c, 0xc7, 0x9a, 0xbf, 0x6f, 0xcb, 0x7a,
+    0x57, 0x92, 0x23, 0x56, 0xcb, 0xcd, 0xd0, 0x3d, 0x9e, 0x14, 0x3f, 0x32, 0x08, 0x6d, 0x2b, 0xd3,
+    0xbf, 0x58, 0x9d, 0x9b, 0xf3, 0xb4, 0x32, 0xb3, 0xbf, 0x9e, 0xd5, 0x7f, 0xef, 0xf7, 0x29, 0xf7,
+    0x77, 0xa8, 0xd2, 0x33, 0x61, 0x5e, 0x52, 0xa3, 0x57, 0xe9, 0x74, 0xab, 0x03, 0x59, 0x5b, 0x9c,
+    0x4d, 0x75, 0x78, 0x49, 0x5e, 0x39, 0xe8, 0x2e, 0x66, 0x7e, 0xbe, 0xb1, 0xda, 0xeb, 0xd2, 0xb4,
+    0xe4, 0x60, 0xd8, 0x06, 0x6d, 0x4d, 0x8d, 0x4e, 0xd7, 0x05, 0xba, 0x48, 0xe7, 0x82, 0xbc, 0x37,
+    0x48, 0x31, 0x8e, 0x2f, 0x48, 0x7c, 0xdd, 0x8c, 0x53, 0x68, 0xab, 0xa8, 0x34, 0x7e, 0xbd, 0xab,
+    0xe6, 0x5b, 0xed, 0x5d, 0x86, 0x0e, 0xdf, 0x6d, 0x7b, 0x31, 0x33, 0x2f, 0x0b, 0x19, 0xef, 0xe0,
+    0x63, 0xda, 0x99, 0xf0, 0x94, 0xfc, 0x3a, 0x27, 0xbf, 0xbb, 0x3a, 0x71, 0xee, 0x49, 0x46, 0xb6,
+    0x24, 0xaa, 0x8d, 0xd6, 0xd2, 0x7a, 0x21, 0x9d, 0x69, 0xd1, 0x5c, 0xd1, 0x5d, 0xae, 0x10, 0x43,
+    0x45, 0xa5, 0xde, 0x85, 0x91, 0x34, 0x04, 0xb3, 0x2d, 0x25, 0xc3, 0xda, 0x8a, 0x09, 0x8f, 0x09,
+    0xf5, 0xa2, 0xf2, 0xd2, 0xa8, 0x01, 0x2c, 0x0d, 0xbf, 0x35, 0xef, 0x11, 0xec, 0xbb, 0x7d, 0xc7,
+    0xc7, 0xfc, 0x56, 0x58, 0x71, 0x4b, 0xa5, 0xfa, 0x7e, 0x98, 0x9e, 0xfc, 0xcf, 0xec, 0xa9, 0x7f,
+    0xb9, 0x39, 0xfb, 0x9d, 0xf8, 0x17, 0xb9, 0x5b, 0xd6, 0xf3, 0x1b, 0x24, 0xbe, 0x08, 0x46, 0xf6,
+    0xaa, 0x04, 0xfb, 0x1a, 0x80, 0xa5, 0x1a, 0x51, 0xd4, 0x22, 0x04, 0xec, 0x2e, 0xbe, 0x6d, 0xd0,
+    0x52, 0xb3, 0xe0, 0x90, 0xfa, 0x37, 0xca, 0x8a, 0xf2, 0x7d, 0x78, 0x3f, 0x00, 0x00,
+};
+
+// /script.js: 13194 -> 3419 bytes (26% of raw)
+const uint8_t script_js_gz[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xcd, 0x5b, 0x5f, 0x73, 0xdb, 0xb8,
+    0x11, 0x7f, 0xf7, 0xa7, 0x40, 0xe6, 0xe6, 0x42, 0x32, 0xb1, 0x65, 0x39, 0x77, 0xb9, 0xa9, 0xed,
+    0x3a, 0x37, 0x49, 0x6c, 0xf7, 0x7c, 0x8d, 0xe3, 0x34, 0x72, 0xda, 0x87, 0x4c, 0x1e, 0x20, 0x11,
+    0xb4, 0x98, 0x50, 0x24, 0x4b, 0x52, 0x56, 0x74, 0x89, 0x3f, 0x57, 0xdf, 0xfb, 0xc9, 0xba, 0xbb,
+    0xf8, 0x43, 0x00, 0x22, 0x65, 0x5b, 0xf5, 0x74, 0x9a, 0x99, 0x1b, 0x99, 0xc0, 0x0f, 0x8b, 0xc5,
+    0x62, 0xb1, 0xff, 0x80, 0xdb, 0xda, 0x7d, 0xf2, 0x64, 0x8b, 0x3d, 0x61, 0xa3, 0x93, 0xf3, 0x57,
+    0xc5, 0x57, 0x76, 0x96, 0xc7, 0xf3, 0xba, 0xa9, 0x52, 0x9e, 0xb1, 0x63, 0x5e, 0x4f, 0xc7, 0x05,
+    0xaf, 0x62, 0xf6, 0xba, 0xc8, 0x9b, 0xaa, 0xc8, 0x32, 0x51, 0x21, 0xf2, 0x77, 0x7e, 0xcd, 0x47,
+    0x93, 0x2a, 0x2d, 0x1b, 0x96, 0x14, 0x15, 0x3b, 0x19, 0xbd, 0xfb, 0xe9, 0x19, 0xfb, 0x87, 0x18,
+    0xc3, 0xd8, 0x46, 0x54, 0x09, 0x9f, 0x08, 0x40, 0xed, 0x6e, 0x6d, 0xed, 0xee, 0xe2, 0xc0, 0x24,
+    0xbd, 0x9a, 0x57, 0xbc, 0x49, 0x8b, 0x7c, 0x6b, 0x52, 0xe4, 0x75, 0xc3, 0x5e, 0x5f, 0xbc, 0x3d,
+    0x3d, 0xfb, 0x0b, 0x3b, 0x62, 0xdf, 0xb6, 0x18, 0xfc, 0xab, 0x44, 0x52, 0x89, 0x7a, 0x4a, 0x63,
+    0xaf, 0x79, 0x76, 0xc0, 0x9e, 0x0f, 0x87, 0xc3, 0x6d, 0xea, 0x6a, 0x0a, 0x5e, 0x37, 0xc7, 0x6a,
+    0xf4, 0x01, 0xfb, 0xc9, 0x74, 0x54, 0xe2, 0x9f, 0x73, 0x51, 0x37, 0x97, 0xe9, 0x4c, 0x14, 0xf3,
+    0x46, 0x0e, 0xd9, 0xba, 0x39, 0xa4, 0x29, 0x47, 0x0d, 0x6f, 0x04, 0x3b, 0xe7, 0x39, 0xbf, 0x12,
+    0x33, 0x91, 0x37, 0x5b, 0x99, 0x68, 0x58, 0x4d, 0x8d, 0x7a, 0xca, 0x4c, 0xc4, 0x07, 0x2c, 0xe1,
+    0x59, 0x2d, 0x24, 0xb9, 0x79, 0xd9, 0x00, 0xa5, 0x03, 0xa6, 0xa8, 0x4f, 0xb2, 0x14, 0xc6, 0xd5,
+    0xe6, 0x1b, 0xf8, 0x13, 0xbf, 0x09, 0x5e, 0x9a, 0x86, 0xa6, 0x68, 0x78, 0xe6, 0xb4, 0x4c, 0xe1,
+    0xe3, 0x3c, 0xcd, 0x4f, 0x01, 0xe9, 0xb4, 0xbd, 0xe1, 0xd5, 0x15, 0x30, 0xea, 0xb4, 0x9d, 0x56,
+    0xfc, 0xaa, 0xa5, 0x9d, 0x81, 0x90, 0x47, 0xe9, 0x1f, 0xed, 0xb0, 0xfa, 0x8b, 0x68, 0x26, 0x6e,
+    0x53, 0x9a, 0x97, 0x73, 0x8b, 0x9f, 0xc9, 0x94, 0xe7, 0xb9, 0xc8, 0xa0, 0xe1, 0xe3, 0x27, 0xd9,
+    0x12, 0xa7, 0xd7, 0x69, 0x2d, 0x65, 0xf4, 0x8b, 0x16, 0x11, 0x0a, 0xed, 0x80, 0xed, 0x4b, 0xb9,
+    0xa0, 0x0c, 0xe4, 0x2a, 0xb5, 0x9c, 0x41, 0x18, 0xf9, 0x3c, 0xcb, 0x0e, 0xa9, 0xab, 0x84, 0xbd,
+    0xed, 0xec, 0x10, 0xd7, 0x20, 0x89, 0x51, 0x31, 0xaf, 0x26, 0xc2, 0xb4, 0xa3, 0x90, 0x8f, 0x2f,
+    0xce, 0xd9, 0x49, 0x46, 0xf2, 0xad, 0xd5, 0xb6, 0x0a, 0xf5, 0xd9, 0x4a, 0xb9, 0xe0, 0x71, 0x9a,
+    0x5f, 0x81, 0xa6, 0x08, 0x01, 0x9c, 0xc5, 0xc5, 0x64, 0x8e, 0x80, 0xc1, 0x95, 0x68, 0xd4, 0xd0,
+    0x57, 0xcb, 0xb3, 0x38, 0x0c, 0x14, 0x6e, 0xa7, 0x26, 0x60, 0x10, 0x49, 0xfe, 0x67, 0x3c, 0xcd,
+    0x51, 0xed, 0xe0, 0x47, 0x54, 0x6b, 0x46, 0x23, 0x6e, 0x67, 0xa2, 0x81, 0x7a, 0x34, 0xed, 0xb0,
+    0x64, 0x83, 0x24, 0x26, 0xf5, 0x77, 0x1d, 0x13, 0x22, 0xde, 0x51, 0x28, 0x4d, 0x83, 0x36, 0x03,
+    0xf5, 0xe6, 0x96, 0x61, 0x84, 0xb1, 0x07, 0x8d, 0x79, 0x75, 0xcb, 0x10, 0x40, 0x04, 0x11, 0xe1,
+    0x6f, 0x5c, 0x0d, 0xec, 0x1d, 0x25, 0x01, 0x7a, 0x16, 0xa3, 0xa1, 0xbd, 0x78, 0x85, 0x30, 0xd2,
+    0x14, 0xb3, 0xa2, 0x5a, 0xae, 0x13, 0x23, 0x01, 0x5c, 0xf8, 0xb1, 0x00, 0xa1, 0x66, 0xb7, 0x0e,
+    0xda, 0x89, 0x09, 0xa7, 0xc7, 0x92, 0x46, 0xaf, 0x19, 0x44, 0xfd, 0x1a, 0xac, 0x35, 0xbb, 0x17,
+    0x2d, 0x01, 0x1a, 0xde, 0xea, 0x79, 0xef, 0x00, 0x0d, 0xd1, 0x43, 0xd4, 0x39, 0xe8, 0xc5, 0x53,
+    0xbf, 0x06, 0x97, 0xbc, 0xe2, 0x33, 0x34, 0x20, 0xf3, 0x75, 0x3c, 0x11, 0x8a, 0xb6, 0x7d, 0x6e,
+    0x38, 0x23, 0x53, 0xb5, 0x66, 0x0c, 0xf5, 0x3b, 0xe0, 0x73, 0x51, 0xd7, 0x60, 0xa2, 0x6e, 0x1b,
+    0xb3, 0x33, 0x93, 0x38, 0xd0, 0x17, 0x65, 0xe0, 0x8e, 0xee, 0xfe, 0x0f, 0xe1, 0x6f, 0x4e, 0x8e,
+    0xb5, 0xfd, 0x66, 0xa7, 0xf3, 0x7c, 0x82, 0xb6, 0xb4, 0xbe, 0x2f, 0x9d, 0xad, 0x44, 0x8d, 0x04,
+    0xde, 0xaf, 0xae, 0x32, 0x01, 0x44, 0xc3, 0x48, 0x1d, 0x30, 0x79, 0xfc, 0x27, 0xf3, 0xaa, 0x42,
+    0x5b, 0xa1, 0x0c, 0x2d, 0x1d, 0x8a, 0x01, 0xe8, 0xfa, 0xa1, 0x85, 0xe1, 0x92, 0xc4, 0x91, 0x0b,
+    0xfe, 0x95, 0x05, 0x45, 0x92, 0x04, 0xec, 0x00, 0x7e, 0xf3, 0xc0, 0xc6, 0xcf, 0x2b, 0xb4, 0x46,
+    0xc1, 0x2e, 0xcc, 0xb6, 0x1b, 0xb0, 0xa7, 0x6a, 0xbc, 0x44, 0x68, 0x73, 0x83, 0x73, 0x0c, 0xd4,
+    0xc9, 0x1d, 0x4c, 0x40, 0xb7, 0xea, 0x37, 0x69, 0xdd, 0x0c, 0x78, 0xdc, 0x5a, 0x96, 0x20, 0x92,
+    0x43, 0xa4, 0x79, 0x15, 0x79, 0xfc, 0x5e, 0xba, 0x8f, 0x10, 0xe8, 0x47, 0x83, 0x66, 0x2a, 0xf2,
+    0x10, 0x16, 0x73, 0xf4, 0xc2, 0x32, 0x18, 0x86, 0x7d, 0x98, 0xff, 0x91, 0xcd, 0xed, 0xa1, 0x81,
+    0xcc, 0xcb, 0x18, 0xbe, 0x95, 0x64, 0x3f, 0x9c, 0xd1, 0xc1, 0x0e, 0xb6, 0x5d, 0x74, 0xd4, 0xc2,
+    0xeb, 0x69, 0xb1, 0xb8, 0xc4, 0x0d, 0x0d, 0x03, 0xdc, 0x91, 0x66, 0x5e, 0xe5, 0x40, 0xbd, 0x5d,
+    0xd5, 0xa0, 0x29, 0x3e, 0x94, 0xa5, 0xa8, 0x5e, 0xf3, 0x5a, 0x84, 0xd1, 0x36, 0x0b, 0xea, 0xf9,
+    0x64, 0x02, 0x5b, 0xaf, 0x99, 0xbf, 0x89, 0x06, 0x13, 0x0e, 0x8e, 0x21, 0x14, 0x55, 0x05, 0x4e,
+    0xd7, 0xe5, 0xb6, 0xa5, 0x7d, 0x0a, 0x27, 0x11, 0xe8, 0x36, 0x85, 0xda, 0x28, 0xdc, 0xfe, 0x03,
+    0x9a, 0x86, 0xc6, 0x01, 0x5d, 0xfa, 0xb5, 0xa8, 0x26, 0x69, 0xce, 0xb3, 0x6c, 0xb9, 0x22, 0x82,
+    0x5b, 0x04, 0x5c, 0xc1, 0xd9, 0xbf, 0x16, 0x2b, 0x32, 0xbe, 0x81, 0xdf, 0x9b, 0x4d, 0xd4, 0xf4,
+    0x6f, 0xf3, 0x74, 0xf2, 0x85, 0xbd, 0x94, 0x1a, 0xf2, 0x00, 0x7a, 0x0a, 0x6b, 0xba, 0xc8, 0x8d,
+    0x8e, 0x5a, 0x12, 0xba, 0x04, 0xc9, 0x03, 0xc3, 0x08, 0x60, 0x10, 0x3c, 0xa0, 0x79, 0x61, 0x17,
+    0x6f, 0x07, 0x83, 0x01, 0x6c, 0x1e, 0x98, 0x9b, 0xa4, 0xd0, 0x4b, 0x41, 0x4d, 0x79, 0x45, 0x22,
+    0xff, 0xf8, 0x8d, 0x15, 0x25, 0xaa, 0xa7, 0x84, 0x03, 0xb0, 0x16, 0x70, 0xd8, 0x03, 0x20, 0x11,
+    0xb0, 0x9b, 0x4f, 0x77, 0xd0, 0xa1, 0xa6, 0x9a, 0xaf, 0xa8, 0xce, 0xcb, 0x0c, 0xd5, 0xa6, 0x5b,
+    0x45, 0x5e, 0x3a, 0xcc, 0x05, 0x1b, 0xab, 0xc3, 0x09, 0xf6, 0xae, 0xdd, 0x7f, 0xda, 0x2e, 0x47,
+    0x6a, 0x49, 0x72, 0x67, 0xb1, 0x9d, 0x9e, 0xde, 0x53, 0x6e, 0x93, 0x4c, 0xa0, 0x73, 0xbc, 0x87,
+    0xe4, 0x28, 0x4c, 0xdb, 0x58, 0x74, 0xa7, 0xa7, 0xff, 0x3b, 0xd9, 0xa9, 0x40, 0x56, 0xba, 0x8f,
+    0x2e, 0x11, 0xbe, 0x97, 0x00, 0x94, 0xa2, 0x74, 0x1e, 0x3d, 0xc2, 0xd3, 0xe6, 0x29, 0xd8, 0xd5,
+    0x3e, 0x46, 0x8a, 0x09, 0x06, 0x97, 0x70, 0x26, 0x04, 0x72, 0xac, 0xff, 0x1e, 0x7c, 0xae, 0x0b,
+    0x50, 0x73, 0x85, 0x00, 0xd9, 0x70, 0x77, 0x3d, 0xbc, 0x2c, 0xb3, 0xa5, 0x62, 0x09, 0x7b, 0xa3,
+    0xfb, 0x88, 0x52, 0x8e, 0xd3, 0x0b, 0x23, 0xf3, 0xb6, 0xa1, 0x2c, 0x5d, 0x4a, 0x60, 0xde, 0x67,
+    0x25, 0x84, 0x97, 0x3d, 0x14, 0x37, 0xb4, 0x20, 0x6f, 0xd2, 0x6b, 0xc1, 0xd4, 0x44, 0x0f, 0x61,
+    0x40, 0x7c, 0xc9, 0xe9, 0x0d, 0xb5, 0x94, 0x13, 0xdb, 0xe5, 0x9f, 0x47, 0x47, 0x96, 0xf7, 0x92,
+    0x10, 0x19, 0xb2, 0x69, 0x94, 0xfa, 0xfa, 0xfe, 0x9d, 0x0d, 0x6d, 0x90, 0x8a, 0xd3, 0x34, 0x4a,
+    0x7f, 0xfa, 0x30, 0x9d, 0x82, 0x68, 0x9c, 0xf9, 0xf6, 0x81, 0x26, 0x35, 0xd1, 0xc8, 0xb6, 0xc1,
+    0x87, 0x5a, 0x39, 0x8b, 0x06, 0xdb, 0x4d, 0x5d, 0x70, 0x95, 0xce, 0xd8, 0x70, 0xdd, 0xd4, 0x05,
+    0xc7, 0x4c, 0xc7, 0xc6, 0xd2, 0xf7, 0xca, 0xd2, 0x74, 0x06, 0x64, 0xd6, 0x66, 0x1a, 0x7c, 0x68,
+    0x9b, 0x1a, 0x69, 0xac, 0xd5, 0xe2, 0x83, 0x65, 0xe4, 0xa8, 0x81, 0xea, 0xcb, 0x07, 0xe9, 0x68,
+    0x51, 0xc3, 0xcc, 0x37, 0x00, 0x21, 0x95, 0xb2, 0xa1, 0x14, 0x28, 0x6a, 0x9c, 0xfc, 0x00, 0xd0,
+    0xfe, 0xd0, 0x35, 0x02, 0xe0, 0x28, 0x73, 0x31, 0x69, 0x4e, 0x30, 0x6f, 0x6a, 0x8d, 0x40, 0x9a,
+    0xb0, 0xf0, 0xd1, 0x22, 0xcd, 0xe3, 0x62, 0x31, 0x38, 0x69, 0x53, 0xaa, 0xc8, 0xb5, 0x79, 0x55,
+    0xf3, 0x0e, 0xf2, 0x30, 0x30, 0x0f, 0xf6, 0x71, 0xac, 0x04, 0x86, 0x0a, 0xea, 0x68, 0xb4, 0x61,
+    0x8c, 0x97, 0x98, 0x89, 0x05, 0xb3, 0xe8, 0x82, 0xe5, 0xa0, 0x7e, 0x73, 0xa6, 0x2c, 0x34, 0x46,
+    0x46, 0x04, 0x45, 0x2f, 0x2e, 0x20, 0x65, 0x0a, 0x03, 0x65, 0x65, 0xb6, 0x25, 0xcc, 0x37, 0xc5,
+    0x45, 0xd9, 0xc1, 0x95, 0x7d, 0x38, 0x7e, 0x1f, 0x81, 0xfb, 0x84, 0x98, 0x18, 0xe2, 0x16, 0x22,
+    0x30, 0xa0, 0xd3, 0xb2, 0xde, 0xd0, 0xdc, 0xa8, 0x5f, 0x38, 0x9d, 0x16, 0xdf, 0xb0, 0x58, 0x25,
+    0xbf, 0x9a, 0x8d, 0x97, 0x2c, 0x6d, 0x6a, 0x91, 0x25, 0x87, 0x94, 0x9d, 0x42, 0x4a, 0xc2, 0xf3,
+    0xc5, 0x14, 0x82, 0x1b, 0x56, 0x43, 0x6c, 0x33, 0x15, 0xec, 0xc3, 0x19, 0xca, 0x6c, 0x59, 0xb3,
+    0x0c, 0xce, 0xfd, 0xca, 0x2a, 0x8b, 0x5c, 0x19, 0x24, 0xd6, 0xe1, 0x5c, 0x56, 0x04, 0x7d, 0xe3,
+    0x6e, 0xa2, 0x0b, 0xb1, 0xf6, 0xd0, 0xce, 0x93, 0x23, 0x67, 0x6b, 0xbc, 0x0c, 0x1a, 0xe2, 0x03,
+    0xfd, 0xb5, 0xea, 0xdd, 0x1e, 0xd8, 0xc4, 0xdf, 0x62, 0xe6, 0xd7, 0x98, 0x7a, 0x63, 0xbc, 0x15,
+    0x8b, 0x7a, 0x57, 0x6e, 0xb6, 0x55, 0x91, 0x66, 0xe0, 0x15, 0x67, 0x22, 0x5f, 0x4e, 0x96, 0x72,
+    0xf4, 0x8a, 0xc9, 0x4a, 0xc3, 0xd1, 0xfb, 0x1b, 0xb9, 0x38, 0xa8, 0x96, 0xa9, 0xce, 0x5a, 0x84,
+    0xd4, 0xfe, 0x8d, 0xdc, 0xc2, 0x3b, 0xcc, 0xd6, 0xc0, 0xd7, 0x54, 0x0f, 0xe1, 0x14, 0x6a, 0x7e,
+    0x2d, 0x0c, 0xc1, 0xda, 0x4b, 0x81, 0x2c, 0x63, 0x42, 0xc7, 0x01, 0x56, 0x11, 0x9a, 0x28, 0x5a,
+    0x77, 0x0e, 0x60, 0x59, 0x73, 0x38, 0xf9, 0xb6, 0x81, 0x91, 0xc3, 0xb5, 0x81, 0xa1, 0xb1, 0xa7,
+    0x10, 0x57, 0x5b, 0xa3, 0xa9, 0xcf, 0x1a, 0xba, 0x3f, 0xb4, 0x52, 0x1a, 0x14, 0xb9, 0x99, 0xfb,
+    0xcf, 0x6c, 0x0f, 0x01, 0xe6, 0xfb, 0x05, 0xdb, 0x87, 0x7f, 0x51, 0xb7, 0x5b, 0x3e, 0xd6, 0xa8,
+    0xd9, 0x1c, 0x18, 0x18, 0x0b, 0xb6, 0xb7, 0x83, 0xe8, 0xc0, 0x0f, 0x75, 0xba, 0x0d, 0x11, 0xce,
+    0x2b, 0x99, 0x56, 0x93, 0xca, 0x8f, 0xb5, 0x33, 0xbe, 0x27, 0xc8, 0x46, 0xd3, 0xf9, 0xe1, 0xd4,
+    0x88, 0x5f, 0x63, 0x28, 0x55, 0x9a, 0xed, 0xc0, 0xac, 0xe7, 0xed, 0xdf, 0x47, 0xb7, 0x46, 0x55,
+    0x34, 0xa2, 0xde, 0xc5, 0xbd, 0xfc, 0x55, 0xcb, 0xe9, 0x08, 0xc3, 0x3c, 0x23, 0xb4, 0xa7, 0x2c,
+    0x78, 0x4c, 0x8b, 0xa1, 0x66, 0xfa, 0x2b, 0x32, 0x9c, 0xdd, 0x7e, 0x52, 0x3d, 0x68, 0xf7, 0x91,
+    0xa5, 0x5d, 0x23, 0x1f, 0x26, 0xe3, 0x9f, 0xc8, 0xeb, 0xef, 0x76, 0x52, 0xea, 0xcf, 0xc3, 0x1e,
+    0xa8, 0xd6, 0x21, 0xfa, 0xed, 0x00, 0xb5, 0xd2, 0x6b, 0xb5, 0x98, 0x94, 0x9a, 0x52, 0x46, 0xf2,
+    0xbc, 0x8f, 0x3a, 0x62, 0x32, 0x9f, 0x6f, 0xa3, 0x97, 0x56, 0xc1, 0xa4, 0x8b, 0x7f, 0x27, 0x8f,
+    0xb4, 0xb0, 0x83, 0x46, 0x7c, 0x6d, 0x30, 0x75, 0x26, 0x7f, 0xc3, 0x70, 0x2b, 0x21, 0x16, 0x3c,
+    0xbc, 0xfb, 0x78, 0x2f, 0xd1, 0xc7, 0x14, 0xfa, 0x5a, 0x74, 0x71, 0x7b, 0xe3, 0xb4, 0xdc, 0x00,
+    0x35, 0xd8, 0xb2, 0x6f, 0xeb, 0x04, 0xd3, 0x66, 0xd0, 0x28, 0x17, 0x19, 0xff, 0xd3, 0x3e, 0x75,
+    0x26, 0x01, 0xab, 0xf3, 0xac, 0x8b, 0x88, 0xbb, 0x32, 0x0c, 0x9c, 0x06, 0xf4, 0x78, 0x4d, 0xa2,
+    0xd1, 0x95, 0x6c, 0x60, 0xda, 0xdd, 0x61, 0x88, 0xec, 0x2a, 0x83, 0x4c, 0xcc, 0xed, 0xf3, 0x91,
+    0x54, 0xc5, 0xec, 0x3e, 0x27, 0x04, 0x27, 0x09, 0x1e, 0x5c, 0xf1, 0xef, 0x11, 0x79, 0x75, 0x2b,
+    0xf7, 0x6a, 0x04, 0xd6, 0xab, 0x9f, 0x9a, 0x6a, 0xc4, 0x7a, 0x0c, 0xb1, 0x29, 0x55, 0x75, 0x9f,
+    0x2c, 0x87, 0x98, 0xb4, 0x03, 0xac, 0xcb, 0x28, 0x1b, 0x32, 0x1d, 0x07, 0xaf, 0xfb, 0xd0, 0xa1,
+    0x6c, 0xb1, 0x48, 0x7d, 0x6c, 0x1b, 0x20, 0x4f, 0x34, 0x60, 0x86, 0xb6, 0x19, 0x59, 0xcc, 0xa3,
+    0xbd, 0x83, 0xb6, 0x9f, 0xe6, 0xe8, 0x3e, 0xa4, 0xf7, 0x56, 0x3e, 0x55, 0xbe, 0xb9, 0x9b, 0xf6,
+    0xdd, 0xdf, 0xf9, 0x42, 0x90, 0xf6, 0x81, 0x62, 0x8f, 0x87, 0x70, 0xbe, 0x7e, 0xc5, 0x4d, 0x15,
+    0xa5, 0xce, 0xe2, 0x6d, 0x96, 0xd6, 0x17, 0xb9, 0x57, 0x8f, 0x54, 0x25, 0xcf, 0x23, 0xb3, 0x5f,
+    0x1f, 0x0d, 0xfe, 0xd3, 0x61, 0x1b, 0x95, 0xab, 0x46, 0x37, 0x9a, 0x33, 0xdd, 0x36, 0x5d, 0xeb,
+    0x22, 0xa1, 0xaf, 0xe0, 0xe8, 0xda, 0xa1, 0x15, 0x6b, 0xd3, 0x3f, 0x5a, 0x57, 0xd3, 0x3c, 0x02,
+    0x5b, 0xf6, 0x28, 0x95, 0xe0, 0x39, 0x96, 0x13, 0xf9, 0xc3, 0x02, 0xea, 0xc5, 0x5b, 0xaa, 0x9f,
+    0x62, 0xbd, 0xc3, 0xb5, 0x13, 0x4e, 0xe4, 0xa7, 0x58, 0xe9, 0xa9, 0x5c, 0x9a, 0xc4, 0x36, 0xf2,
+    0x84, 0x60, 0x14, 0x5e, 0xe6, 0xb0, 0x51, 0x57, 0x91, 0x50, 0x76, 0x79, 0xdc, 0x25, 0x45, 0x35,
+    0xe3, 0xcd, 0x07, 0xea, 0x0a, 0xed, 0xa4, 0x38, 0xf2, 0xc3, 0x08, 0x43, 0x47, 0x25, 0xc0, 0x9d,
+    0x73, 0xa8, 0x3e, 0x6f, 0x12, 0x27, 0x8f, 0xee, 0xa5, 0x2b, 0xaf, 0x2a, 0xbc, 0xad, 0xc4, 0x12,
+    0x73, 0x4d, 0x89, 0xfc, 0x39, 0x6f, 0xa6, 0x83, 0xaa, 0x98, 0xe7, 0x71, 0x18, 0xfa, 0x89, 0xf4,
+    0x8e, 0x97, 0x83, 0x47, 0x6c, 0x97, 0xed, 0x0d, 0x9f, 0xfd, 0x6c, 0x9d, 0x0f, 0x49, 0x8b, 0x86,
+    0xb8, 0xc4, 0x7c, 0x5a, 0x2b, 0x23, 0x3d, 0x06, 0xbd, 0xb5, 0x11, 0x77, 0x60, 0x05, 0xa8, 0xfa,
+    0x2d, 0xc9, 0xc3, 0x17, 0xfb, 0xeb, 0xab, 0xe0, 0x96, 0x85, 0xca, 0xab, 0x1b, 0x7b, 0xb9, 0x70,
+    0xea, 0x30, 0xfd, 0x46, 0x10, 0x97, 0x85, 0xfc, 0x0a, 0x4c, 0xfe, 0x01, 0x18, 0x80, 0xc5, 0xce,
+    0x82, 0x63, 0x78, 0x3c, 0xe3, 0xd5, 0x97, 0x6d, 0x96, 0xa9, 0x7c, 0x7e, 0x9c, 0x15, 0x13, 0xf8,
+    0xac, 0xa7, 0xbc, 0x12, 0x2c, 0x2f, 0x1a, 0x96, 0xe6, 0x90, 0x90, 0xf5, 0xf1, 0x2d, 0xe7, 0xf3,
+    0xdd, 0xfa, 0x0c, 0xc6, 0x20, 0xe7, 0x2b, 0x02, 0xb1, 0xeb, 0x0c, 0x4a, 0x24, 0x7a, 0x61, 0xec,
+    0xa9, 0x63, 0xb0, 0x02, 0xf6, 0xef, 0x7f, 0x01, 0x2f, 0x5f, 0xfa, 0xe9, 0xe8, 0x02, 0xc4, 0x1d,
+    0xe8, 0x24, 0x58, 0x7f, 0xe8, 0x25, 0x44, 0xd5, 0x89, 0x27, 0x40, 0x65, 0x48, 0x44, 0x7e, 0xec,
+    0x97, 0x31, 0xc5, 0x49, 0xdd, 0xba, 0x74, 0xfe, 0x0a, 0x53, 0xce, 0x95, 0x72, 0x85, 0x64, 0x4e,
+    0xf3, 0x08, 0x0a, 0x71, 0x9a, 0x7e, 0x15, 0x71, 0xf8, 0xac, 0x5b, 0x87, 0x6c, 0x22, 0x6d, 0x35,
+    0xa4, 0x87, 0xc6, 0x5e, 0x97, 0x36, 0xd1, 0xa8, 0x0e, 0x65, 0x02, 0xca, 0x8e, 0x3a, 0xc9, 0x6f,
+    0x76, 0xbe, 0x46, 0xa1, 0x54, 0xe5, 0xe4, 0xf1, 0x63, 0x7d, 0xd2, 0xd4, 0xed, 0x33, 0x58, 0x8a,
+    0xfc, 0xaa, 0x99, 0x7a, 0x3a, 0xf6, 0x16, 0xfc, 0x5b, 0xcd, 0x8a, 0x84, 0x52, 0x74, 0x69, 0xcd,
+    0xd4, 0x25, 0xdf, 0x21, 0x1b, 0xa7, 0xa0, 0x45, 0xba, 0x6f, 0xc6, 0xeb, 0x2f, 0x60, 0xbe, 0xf4,
+    0x65, 0x36, 0x4b, 0x3d, 0x41, 0xa8, 0xb1, 0x47, 0xfe, 0xac, 0x49, 0x9a, 0x81, 0xb2, 0x86, 0xa1,
+    0x6a, 0x00, 0xd3, 0x8f, 0xb9, 0xab, 0xb3, 0xd7, 0xaa, 0x0b, 0xfc, 0x68, 0x25, 0xd4, 0x8d, 0x13,
+    0x96, 0xe7, 0x88, 0x8d, 0x00, 0x17, 0x12, 0x3a, 0x15, 0xa2, 0x17, 0x2f, 0x90, 0xc6, 0x63, 0xb6,
+    0x17, 0x0d, 0x66, 0xbc, 0xd4, 0x84, 0xd1, 0x77, 0x6a, 0x42, 0x39, 0x9f, 0x89, 0x2e, 0x29, 0x4b,
+    0x02, 0x9e, 0x98, 0x25, 0xe3, 0x4a, 0x3a, 0x60, 0x9b, 0xd5, 0xf7, 0xe7, 0x22, 0xcd, 0x43, 0xd2,
+    0xc2, 0x20, 0x42, 0x53, 0x9d, 0x17, 0xb9, 0x70, 0x84, 0x8e, 0xb7, 0xea, 0x05, 0x9d, 0x34, 0xf0,
+    0x04, 0xd5, 0xa2, 0x4a, 0xc1, 0x69, 0x72, 0x26, 0xa3, 0x0b, 0x14, 0x58, 0x51, 0x0a, 0x70, 0xfc,
+    0xe0, 0xb2, 0x51, 0x68, 0xf2, 0x8e, 0x29, 0x5b, 0x32, 0x11, 0xa7, 0x0d, 0xf8, 0xef, 0xad, 0xde,
+    0xc8, 0x07, 0xd7, 0x6b, 0x6e, 0x18, 0x25, 0x2f, 0xea, 0x92, 0x91, 0x3d, 0x3a, 0x3a, 0x62, 0x1d,
+    0x91, 0x52, 0x87, 0xe5, 0xbd, 0x53, 0xcc, 0xd4, 0xa1, 0x3b, 0x32, 0x48, 0xbb, 0x23, 0x07, 0x2a,
+    0xbc, 0xea, 0x98, 0xfe, 0x96, 0x40, 0x6b, 0xc3, 0xc2, 0xc0, 0x6f, 0x22, 0x2b, 0x1f, 0xa8, 0x2a,
+    0xe0, 0xde, 0x29, 0x6e, 0xc3, 0x5e, 0x11, 0xc5, 0xc8, 0x3c, 0x71, 0xc1, 0xd0, 0x82, 0xaa, 0x74,
+    0xef, 0x20, 0x04, 0x4f, 0x6b, 0x11, 0x62, 0x18, 0x5d, 0x64, 0xd7, 0x62, 0x1b, 0x3a, 0x3f, 0x83,
+    0x96, 0x7a, 0x35, 0x22, 0x27, 0x86, 0xc9, 0x44, 0xa5, 0x6a, 0x7c, 0x2f, 0xc7, 0x45, 0xd5, 0xb4,
+    0x8f, 0x71, 0xc2, 0x55, 0xf3, 0x21, 0x5f, 0xc4, 0x9c, 0xc5, 0xb2, 0x06, 0xa5, 0x1e, 0xc8, 0xa8,
+    0xfa, 0x4e, 0x4b, 0x6e, 0xc0, 0x91, 0x10, 0x5e, 0x33, 0x9a, 0x3a, 0x8f, 0xfd, 0xa0, 0xc6, 0x22,
+    0x6b, 0xfe, 0x48, 0xd0, 0x96, 0xc9, 0xd5, 0x5d, 0x8c, 0x91, 0xe3, 0x01, 0xc4, 0x2e, 0xe9, 0x55,
+    0x1e, 0x7e, 0x63, 0xf8, 0x83, 0x0f, 0x77, 0x2c, 0xfa, 0xb2, 0x09, 0x0b, 0x49, 0x5a, 0x14, 0x1d,
+    0x05, 0x2e, 0x37, 0x34, 0xa5, 0xe2, 0x90, 0x66, 0xd8, 0xac, 0x23, 0x5a, 0x8d, 0xc7, 0x4d, 0xd2,
+    0x51, 0x7c, 0xe9, 0xca, 0x39, 0x95, 0x60, 0x0d, 0xcc, 0x4f, 0xd4, 0xfa, 0x52, 0x40, 0xb9, 0x0f,
+    0x61, 0xf0, 0xdb, 0xe5, 0xe5, 0x3b, 0x72, 0x12, 0x66, 0x1e, 0x59, 0xa2, 0xdb, 0x38, 0xe1, 0xbb,
+    0xf3, 0xc2, 0x68, 0x3c, 0x19, 0x1b, 0x69, 0xb0, 0x68, 0xb7, 0x4f, 0x64, 0x2c, 0xbe, 0x86, 0x61,
+    0xa5, 0x79, 0x7a, 0xef, 0x83, 0x7b, 0x2e, 0x58, 0xce, 0xaa, 0x5e, 0x19, 0xac, 0x59, 0xa4, 0x7f,
+    0x3b, 0x33, 0x12, 0x60, 0xa6, 0x60, 0x8f, 0xa5, 0x5d, 0xc2, 0x3d, 0xc6, 0x10, 0x01, 0xac, 0x1a,
+    0x23, 0xc7, 0x0a, 0xf1, 0x45, 0x5a, 0x1e, 0xaa, 0x49, 0x6a, 0x36, 0xcf, 0x33, 0x98, 0x81, 0x0c,
+    0xd9, 0x62, 0x5a, 0x64, 0x82, 0x8d, 0x51, 0x64, 0x6c, 0xc1, 0x6b, 0x30, 0x90, 0x13, 0x51, 0x36,
+    0x22, 0x76, 0xcf, 0x93, 0xbc, 0x41, 0x2c, 0x4a, 0xff, 0x10, 0xb9, 0x89, 0x2a, 0x51, 0x81, 0xd8,
+    0xb5, 0x5d, 0x1d, 0xa4, 0x57, 0xd3, 0x02, 0xe2, 0x9a, 0xe0, 0xdd, 0xc5, 0xe8, 0x32, 0x68, 0x1f,
+    0xe5, 0x80, 0x87, 0x8f, 0x21, 0xef, 0x3a, 0x60, 0xdf, 0x58, 0xa0, 0x8c, 0xf5, 0xce, 0xe5, 0xb2,
+    0x14, 0x01, 0xde, 0x46, 0x96, 0x65, 0x96, 0x4e, 0x68, 0x11, 0xbb, 0x98, 0xc9, 0x06, 0xfa, 0x59,
+    0x0e, 0xbd, 0xe6, 0x29, 0xe2, 0xe5, 0x01, 0xa3, 0x22, 0x37, 0xbe, 0x8b, 0xcb, 0xaf, 0xd2, 0x64,
+    0x49, 0x7c, 0xe9, 0xfb, 0xaf, 0x8d, 0x0b, 0xb7, 0x94, 0x7f, 0xac, 0x2b, 0x01, 0x35, 0xd3, 0xaa,
+    0x58, 0x58, 0xc5, 0x07, 0x2b, 0x21, 0xf3, 0xea, 0x64, 0x04, 0xea, 0xbe, 0x96, 0x74, 0x83, 0x70,
+    0x2c, 0xb0, 0xc7, 0xb5, 0x9b, 0x2a, 0x4d, 0xab, 0x5a, 0x47, 0xad, 0x49, 0x56, 0x14, 0x95, 0x46,
+    0x41, 0xa8, 0x01, 0x99, 0xf8, 0x30, 0xb2, 0x8b, 0x94, 0x10, 0xd2, 0x79, 0x60, 0x83, 0xfe, 0x51,
+    0xa2, 0x61, 0xd4, 0x2f, 0xee, 0x18, 0x00, 0xd4, 0x64, 0x8f, 0x34, 0x4e, 0xa7, 0xf7, 0x8a, 0x77,
+    0x98, 0x1f, 0xa2, 0x99, 0x11, 0x09, 0x37, 0x8c, 0x06, 0x25, 0x8f, 0x47, 0x58, 0x80, 0x0f, 0x9f,
+    0x41, 0x2a, 0x3a, 0x0c, 0x28, 0x18, 0xa3, 0xec, 0xd7, 0x96, 0x0d, 0xf2, 0x71, 0xef, 0x41, 0xc8,
+    0xc8, 0xba, 0x41, 0x5e, 0x75, 0xdb, 0xe4, 0xca, 0xea, 0x70, 0x6c, 0xb3, 0x06, 0x14, 0x46, 0xcb,
+    0x0e, 0xff, 0xc6, 0x9b, 0x7d, 0xfc, 0xf9, 0xfe, 0x5d, 0x55, 0x53, 0xec, 0x65, 0xd3, 0xf3, 0x1d,
+    0x2b, 0xff, 0x1c, 0x50, 0xc3, 0x0a, 0x42, 0xbd, 0x03, 0x5a, 0x01, 0xaa, 0x76, 0x2f, 0x17, 0x7b,
+    0x24, 0xa9, 0xc2, 0x84, 0x8f, 0x6c, 0x54, 0x47, 0xfa, 0x6a, 0x77, 0x7b, 0x21, 0xca, 0xcc, 0x26,
+    0xad, 0x5d, 0x4d, 0x56, 0x54, 0xed, 0xdb, 0x3d, 0x92, 0x96, 0x54, 0x4a, 0x38, 0x1f, 0x3f, 0xfc,
+    0x94, 0x8c, 0xf7, 0x9f, 0x0f, 0xad, 0xd3, 0x24, 0xd4, 0xdd, 0xf8, 0x0f, 0xc9, 0x9f, 0x9e, 0xef,
+    0xfd, 0xbc, 0x6f, 0xf5, 0xa0, 0x18, 0xb0, 0x63, 0x38, 0xdc, 0xdf, 0x4f, 0x92, 0x40, 0x5f, 0xaf,
+    0x18, 0x8e, 0xe0, 0x10, 0x2d, 0x33, 0x31, 0x00, 0xd3, 0x06, 0xc7, 0xf1, 0x35, 0xce, 0x8a, 0xef,
+    0x81, 0x68, 0xf6, 0x8f, 0x28, 0xcb, 0x4f, 0xb8, 0x36, 0xf9, 0x3d, 0x40, 0x5a, 0xf6, 0x50, 0x2f,
+    0xdb, 0xc6, 0x0d, 0xf2, 0xde, 0xf6, 0x78, 0x1e, 0xaf, 0x5d, 0x8c, 0x4f, 0x40, 0x27, 0xdc, 0x36,
+    0x8d, 0xf6, 0xda, 0xc3, 0x79, 0x78, 0x1a, 0x75, 0x5c, 0x0e, 0xc9, 0xe3, 0xf4, 0x1a, 0x0c, 0x1d,
+    0x06, 0xa3, 0xf6, 0xdd, 0x87, 0xfb, 0xca, 0xb2, 0xff, 0xf6, 0xc3, 0xc3, 0xd9, 0x21, 0xd4, 0xca,
+    0x43, 0xcd, 0xb5, 0xb7, 0x49, 0x56, 0x5a, 0xfd, 0xf4, 0xe9, 0xe1, 0x56, 0x67, 0xe5, 0x6a, 0x35,
+    0x71, 0xff, 0xef, 0x93, 0xf7, 0x96, 0x5f, 0x90, 0x1b, 0x24, 0x4d, 0xc3, 0x4d, 0x6b, 0x44, 0x67,
+    0x39, 0x84, 0xb0, 0x3c, 0x4b, 0xff, 0x90, 0x8f, 0x84, 0x37, 0x8e, 0xc2, 0xa6, 0x69, 0x2c, 0xde,
+    0xd8, 0x6f, 0x4e, 0x9d, 0x7d, 0x69, 0x9f, 0x33, 0xd9, 0x90, 0xce, 0x70, 0xd3, 0x41, 0xf8, 0x4a,
+    0x07, 0xb3, 0xc4, 0xf8, 0x4a, 0xb5, 0x3f, 0x01, 0xb7, 0x1f, 0xae, 0x76, 0xd2, 0x77, 0x10, 0xea,
+    0x3c, 0xc4, 0x69, 0x5d, 0x66, 0x7c, 0x89, 0x59, 0x73, 0x92, 0x89, 0xaf, 0x81, 0x1b, 0xd9, 0xbe,
+    0x56, 0x39, 0x49, 0x06, 0x6c, 0xc8, 0x2a, 0xee, 0x2e, 0x56, 0x00, 0xf1, 0xf5, 0x35, 0x7a, 0xd4,
+    0x12, 0xed, 0xc7, 0x22, 0x05, 0xc7, 0x37, 0x6f, 0x98, 0x98, 0x8d, 0x05, 0xb0, 0x18, 0x4b, 0xcd,
+    0x70, 0x2b, 0xc6, 0x8a, 0x8e, 0x55, 0x2f, 0x76, 0xbc, 0x29, 0x3e, 0x84, 0xdc, 0xdc, 0x9d, 0xb9,
+    0x89, 0x9a, 0x79, 0xd1, 0xa0, 0xbf, 0xe1, 0x58, 0x7f, 0xfc, 0x74, 0xcb, 0xa5, 0x70, 0x7f, 0x20,
+    0x85, 0x56, 0x0a, 0xc2, 0x06, 0xe9, 0x07, 0xed, 0x22, 0x3d, 0x2e, 0x8b, 0x9d, 0x5d, 0xb4, 0x8f,
+    0xa2, 0xf1, 0x1e, 0x1b, 0x41, 0x2b, 0x01, 0x0b, 0xba, 0x70, 0x12, 0x57, 0x92, 0x56, 0xb3, 0x05,
+    0x96, 0x35, 0x8c, 0xa8, 0x20, 0x70, 0xc1, 0x8e, 0x71, 0x51, 0x34, 0xe0, 0xe3, 0x79, 0x29, 0x25,
+    0x0a, 0x9e, 0xad, 0xc2, 0x9b, 0x11, 0xde, 0xb0, 0x5d, 0x08, 0x95, 0x81, 0x25, 0xbc, 0x8c, 0x6c,
+    0x25, 0x9a, 0x4a, 0xc5, 0x3d, 0x86, 0x65, 0x86, 0x69, 0xec, 0xfa, 0x54, 0xb5, 0xd9, 0x28, 0x85,
+    0x9e, 0xe7, 0x9d, 0xa9, 0x0e, 0x01, 0xc9, 0xac, 0x2b, 0x7c, 0x64, 0x72, 0x05, 0x73, 0xed, 0xd9,
+    0x54, 0x4b, 0x4b, 0x0e, 0xaa, 0xdb, 0xbe, 0x73, 0x97, 0x23, 0xed, 0xd3, 0x6b, 0xea, 0x8f, 0x24,
+    0x4e, 0x15, 0x58, 0x46, 0xab, 0x54, 0xbc, 0xbb, 0x55, 0xd7, 0xc4, 0xbd, 0x2c, 0x4b, 0xa3, 0x26,
+    0x1d, 0x47, 0xcb, 0x3c, 0x8d, 0x58, 0x31, 0x86, 0xc6, 0xad, 0xd8, 0x0f, 0x21, 0x5a, 0x5f, 0x83,
+    0xbb, 0x98, 0x15, 0x57, 0x61, 0xa0, 0xfe, 0x87, 0x83, 0xf6, 0xff, 0x32, 0x48, 0xb5, 0x21, 0x10,
+    0xb1, 0xef, 0x8b, 0xdb, 0x2e, 0x9b, 0x2d, 0xe5, 0xba, 0x5a, 0x8d, 0xb3, 0x77, 0x24, 0x50, 0x1f,
+    0x3b, 0xba, 0x3f, 0xb0, 0xe4, 0xad, 0xdb, 0xa2, 0x75, 0xfa, 0xab, 0xff, 0xec, 0xa9, 0xe6, 0xba,
+    0x07, 0xca, 0xab, 0xd8, 0xd6, 0x8d, 0x7a, 0xe3, 0xd5, 0xc7, 0x95, 0xbe, 0xf7, 0x6f, 0x79, 0xaa,
+    0x57, 0xae, 0xd1, 0xec, 0x5b, 0xfd, 0x95, 0x24, 0xa4, 0xef, 0xf9, 0x96, 0xd9, 0xbb, 0x75, 0x77,
+    0xa9, 0xff, 0x07, 0xcf, 0xcc, 0x3c, 0x3e, 0xd7, 0x1d, 0x7e, 0xcc, 0x36, 0xc0, 0x4f, 0xeb, 0x67,
+    0x1f, 0x68, 0xe9, 0x58, 0x2c, 0x12, 0x3e, 0xcf, 0xb0, 0xac, 0x84, 0xad, 0xf2, 0xe5, 0x0a, 0x9c,
+    0x5d, 0xc1, 0x67, 0x70, 0xbe, 0x33, 0xd8, 0x3f, 0x2c, 0x36, 0xe5, 0x77, 0xb4, 0x1f, 0x6a, 0x53,
+    0xc8, 0x62, 0xf9, 0x06, 0xa4, 0x9b, 0x59, 0x52, 0xcf, 0xb6, 0xaa, 0xb1, 0xf2, 0xa6, 0xe6, 0xf8,
+    0xe2, 0x5c, 0x1d, 0xc6, 0x37, 0x74, 0xd1, 0x03, 0x44, 0x6d, 0xcf, 0xed, 0xe9, 0x33, 0x50, 0x83,
+    0xff, 0xfe, 0x03, 0x32, 0x3a, 0xb5, 0x88, 0x8a, 0x33, 0x00, 0x00,
+};
+
+// /index.html: 8626 -> 1807 bytes (21% of raw)
+const uint8_t index_html_gz[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xd5, 0x1a, 0xd9, 0x72, 0xdb, 0x36,
+    0xf0, 0x3d, 0x5f, 0xb1, 0xe5, 0x43, 0xa7, 0x99, 0x29, 0x68, 0x82, 0x3a, 0x6c, 0xa5, 0x92, 0x66,
+    0x14, 0x1f, 0x69, 0x66, 0xec, 0x3a, 0xb5, 0x93, 0x4c, 0xfb, 0x08, 0x91, 0x90, 0x88, 0x06, 0x22,
+    0x59, 0x12, 0x62, 0xad, 0x7e, 0x7d, 0x17, 0x00, 0x69, 0x51, 0xb6, 0x44, 0x31, 0x8a, 0xd2, 0xb4,
+    0x8e, 0x22, 0x12, 0xc0, 0xee, 0x62, 0xef, 0x5d, 0x90, 0x7a, 0x31, 0xfc, 0xee, 0xe2, 0xf6, 0xfc,
+    0xfd, 0xef, 0xef, 0x2e, 0x21, 0x52, 0x0b, 0x39, 0x7e, 0x31, 0xd4, 0x17, 0x90, 0x2c, 0x9e, 0x8f,
+    0x1c, 0x1e, 0x3b, 0x7a, 0x82, 0xb3, 0x70, 0xfc, 0x02, 0xf0, 0x6f, 0xb8, 0xe0, 0x8a, 0x41, 0x10,
+    0xb1, 0x2c, 0xe7, 0x6a, 0xe4, 0x7c, 0x78, 0x7f, 0x45, 0xce, 0x9c, 0xfa, 0x52, 0xcc, 0x16, 0x7c,
+    0xe4, 0x14, 0x82, 0xff, 0x95, 0x26, 0x99, 0x72, 0x20, 0x48, 0x62, 0xc5, 0x63, 0x04, 0xfd, 0x4b,
+    0x84, 0x2a, 0x1a, 0x85, 0xbc, 0x10, 0x01, 0x27, 0x66, 0xf0, 0x23, 0x88, 0x58, 0x28, 0xc1, 0x24,
+    0xc9, 0x03, 0x26, 0xf9, 0x88, 0xba, 0xde, 0x06, 0xa9, 0x48, 0xa9, 0x94, 0xf0, 0x3f, 0x97, 0xa2,
+    0x18, 0x39, 0xbf, 0x91, 0x0f, 0x13, 0x72, 0x9e, 0x2c, 0x52, 0xa6, 0xc4, 0x54, 0xf2, 0x1a, 0xdd,
+    0xb7, 0x97, 0x23, 0x1e, 0xce, 0x79, 0x85, 0xa9, 0x84, 0x92, 0x7c, 0x7c, 0xf5, 0xf6, 0xf5, 0xdd,
+    0x2d, 0xdc, 0x5f, 0xde, 0xbc, 0x4e, 0x1e, 0xe0, 0x1c, 0x41, 0xb3, 0x44, 0xc2, 0x3b, 0x16, 0x73,
+    0x39, 0x3c, 0xb1, 0x10, 0x16, 0x5a, 0x8a, 0xf8, 0x13, 0x64, 0x5c, 0x8e, 0x9c, 0x5c, 0xad, 0x24,
+    0xcf, 0x23, 0xce, 0x91, 0xe7, 0x28, 0xe3, 0xb3, 0x72, 0xc6, 0xed, 0x4f, 0x3b, 0xa1, 0x37, 0x0d,
+    0x66, 0x6e, 0x90, 0xe7, 0xce, 0x33, 0x2c, 0x81, 0x6c, 0x54, 0xf0, 0x21, 0x53, 0xec, 0xd5, 0x8f,
+    0x5a, 0x5d, 0x27, 0x56, 0x5f, 0xc3, 0x69, 0x12, 0xae, 0x4a, 0x94, 0xef, 0x08, 0x81, 0xeb, 0x84,
+    0x85, 0x22, 0x9e, 0xc3, 0x7d, 0x90, 0x71, 0x1e, 0x03, 0x21, 0xe5, 0x5a, 0x28, 0x0a, 0x08, 0x24,
+    0xcb, 0xf3, 0x91, 0x23, 0x2d, 0x08, 0x2a, 0x44, 0x83, 0x38, 0x20, 0xc2, 0x67, 0x73, 0x16, 0x69,
+    0x17, 0x62, 0xa9, 0x96, 0x1a, 0xd4, 0xce, 0x2d, 0x52, 0x11, 0xc7, 0x3c, 0x73, 0xc6, 0xc3, 0x13,
+    0x5c, 0xdd, 0x0f, 0xaf, 0xf8, 0x03, 0x92, 0xad, 0x64, 0xa8, 0x2b, 0xd8, 0x75, 0xdd, 0x27, 0x34,
+    0x6a, 0xc3, 0xf2, 0xf6, 0x99, 0xa4, 0x9a, 0x51, 0x26, 0x34, 0x03, 0x46, 0xc8, 0x05, 0xde, 0x93,
+    0xda, 0x9c, 0x51, 0x3e, 0xea, 0x54, 0xe4, 0xa9, 0x64, 0xab, 0x57, 0x10, 0x27, 0x31, 0xff, 0xa9,
+    0x2e, 0xbb, 0x56, 0x31, 0xcf, 0x2a, 0x6a, 0x76, 0xd4, 0x28, 0xf5, 0x3c, 0x79, 0xb2, 0xbc, 0x0d,
+    0x84, 0x18, 0x83, 0x3e, 0x87, 0x33, 0xb0, 0x79, 0x31, 0x07, 0xed, 0xd8, 0x28, 0xf2, 0xc8, 0xf1,
+    0xc0, 0x03, 0xbf, 0x8b, 0x1f, 0x07, 0x66, 0x42, 0xa2, 0x2b, 0x68, 0x0e, 0x35, 0xdf, 0x59, 0xf2,
+    0x09, 0x19, 0x0f, 0x96, 0x59, 0x86, 0x76, 0x38, 0x4f, 0x64, 0x92, 0x55, 0xb3, 0xd6, 0xeb, 0x47,
+    0x8e, 0xbf, 0x63, 0x03, 0xb3, 0x09, 0x3a, 0x78, 0x04, 0xa8, 0x90, 0x1b, 0xea, 0x83, 0x7f, 0xed,
+    0xc3, 0xa9, 0xa4, 0x1e, 0xf4, 0x80, 0x7a, 0xa4, 0x47, 0xf4, 0xd7, 0xdf, 0x37, 0x3e, 0xd0, 0xda,
+    0xa4, 0x1e, 0xfa, 0xeb, 0xa1, 0x73, 0xb2, 0x83, 0xf9, 0x13, 0xe4, 0x7e, 0x8b, 0xfc, 0xcf, 0x6d,
+    0xbf, 0x55, 0x2d, 0xd6, 0xf8, 0xdb, 0x29, 0x47, 0xd4, 0x86, 0x1b, 0xba, 0x3d, 0xdd, 0xa5, 0xb9,
+    0x94, 0xc5, 0x15, 0xbd, 0x7c, 0x39, 0x35, 0x11, 0xe8, 0x8c, 0xd1, 0x7b, 0x40, 0xc7, 0xe7, 0x05,
+    0xcb, 0xa3, 0x69, 0xc2, 0xb2, 0x10, 0x99, 0x44, 0xc0, 0x56, 0x5c, 0xee, 0x71, 0xda, 0x5c, 0x31,
+    0xb5, 0xcc, 0x89, 0x88, 0x43, 0x11, 0x30, 0x95, 0x64, 0xdb, 0x4c, 0xbf, 0xc1, 0x94, 0x85, 0x0f,
+    0x13, 0x05, 0x49, 0x8c, 0xe1, 0xcd, 0x75, 0x58, 0xec, 0x60, 0x66, 0x0b, 0x9e, 0x55, 0xcf, 0xfd,
+    0x2a, 0x57, 0x7c, 0x01, 0xb7, 0x86, 0xc0, 0x36, 0xf4, 0x67, 0x51, 0x62, 0xdd, 0xb6, 0x8c, 0x0e,
+    0x9b, 0xf8, 0xd0, 0xff, 0x2b, 0xe2, 0x61, 0xa5, 0x97, 0xa7, 0x7e, 0x9d, 0xf3, 0x40, 0x89, 0xe4,
+    0x11, 0x2e, 0x40, 0x10, 0x28, 0x39, 0x09, 0x9e, 0x83, 0x3f, 0x8b, 0x3c, 0x04, 0x21, 0x5b, 0x03,
+    0x66, 0x6d, 0x52, 0xbf, 0x12, 0xe6, 0xde, 0x90, 0x45, 0x4e, 0xfd, 0x16, 0xa6, 0x9d, 0x32, 0x4c,
+    0xc4, 0xc0, 0x90, 0xb9, 0x02, 0x15, 0x38, 0x31, 0xd7, 0xcf, 0xb0, 0xe9, 0x0e, 0x23, 0xce, 0x33,
+    0x11, 0xee, 0x62, 0x74, 0x8b, 0xc9, 0x91, 0xeb, 0xa6, 0xf8, 0xaa, 0xf3, 0x2b, 0xd9, 0x94, 0x4b,
+    0x67, 0xfc, 0x21, 0x55, 0x62, 0xb1, 0x93, 0xd1, 0xad, 0x98, 0x05, 0x93, 0x4b, 0x6e, 0x33, 0xd7,
+    0xd2, 0x60, 0x3b, 0x63, 0x42, 0x5e, 0x99, 0x4f, 0x13, 0x9d, 0x1d, 0x42, 0x1f, 0x4f, 0x94, 0xb7,
+    0xef, 0x60, 0x12, 0x86, 0x19, 0xcf, 0xf3, 0x43, 0xc5, 0x11, 0x29, 0x61, 0x96, 0x82, 0x33, 0xa6,
+    0x03, 0xdf, 0xa5, 0xfd, 0x33, 0xb7, 0xeb, 0xd2, 0x6f, 0x2a, 0xd5, 0xb9, 0x14, 0x98, 0x4b, 0x0f,
+    0x16, 0x29, 0xb0, 0xe8, 0xce, 0xd8, 0xfb, 0xa6, 0x52, 0xdc, 0x4d, 0x6e, 0x0e, 0x95, 0x60, 0xc1,
+    0x17, 0x49, 0xb6, 0xd2, 0x3e, 0xf6, 0x59, 0x14, 0x42, 0xec, 0xa2, 0x84, 0xac, 0x93, 0x20, 0xe5,
+    0xd4, 0xf8, 0x9b, 0x6a, 0xe2, 0x0a, 0x47, 0xd1, 0xa1, 0xba, 0x98, 0x69, 0xe4, 0x7d, 0xaa, 0xf8,
+    0xfa, 0x81, 0x16, 0xa7, 0xcb, 0xc3, 0x3d, 0x52, 0x18, 0xec, 0x03, 0x85, 0xd8, 0x5a, 0x0d, 0xcb,
+    0x92, 0x50, 0x2b, 0x25, 0x3b, 0x2b, 0x45, 0x60, 0xdb, 0xe1, 0x23, 0xd6, 0x8a, 0xeb, 0xcb, 0x8b,
+    0xaa, 0xc9, 0xde, 0x5e, 0x29, 0x5a, 0x24, 0xfb, 0x47, 0xae, 0x5a, 0xa6, 0xfb, 0x12, 0xde, 0xda,
+    0xce, 0xf6, 0xc9, 0x3c, 0x24, 0xe5, 0x6c, 0x93, 0x31, 0xb7, 0xd1, 0x88, 0x67, 0x49, 0x03, 0xca,
+    0x4e, 0x34, 0xbc, 0x01, 0xbd, 0x6b, 0x43, 0xd3, 0xf8, 0xaf, 0x37, 0x90, 0xdb, 0x9b, 0xc9, 0x01,
+    0xd0, 0xb3, 0xa8, 0x7f, 0x83, 0x6d, 0xa2, 0xef, 0x47, 0x5d, 0xd3, 0x5b, 0x16, 0xf4, 0xa6, 0xeb,
+    0x0e, 0x3a, 0xa0, 0xbf, 0xa4, 0x7b, 0x4a, 0xf1, 0x63, 0x7a, 0xc9, 0xa8, 0x9c, 0xa7, 0x03, 0xd7,
+    0x3b, 0xd5, 0x0b, 0x44, 0xaf, 0x98, 0x91, 0x85, 0x25, 0x15, 0xb0, 0x81, 0x26, 0xd5, 0x9a, 0x85,
+    0x27, 0x25, 0xc2, 0xae, 0x3e, 0xb4, 0x91, 0xc5, 0x2e, 0xeb, 0x61, 0x1b, 0xeb, 0x01, 0xc5, 0x7f,
+    0x7d, 0xf0, 0x0a, 0xff, 0xe7, 0x41, 0x41, 0xfc, 0xbf, 0xdb, 0xd0, 0xda, 0xd1, 0xdf, 0xb6, 0xcc,
+    0x09, 0x4d, 0x56, 0xb6, 0x19, 0x33, 0x6f, 0x65, 0xdf, 0x5a, 0xb4, 0x57, 0xe8, 0xfa, 0x3c, 0xec,
+    0x8c, 0x5f, 0x2f, 0x85, 0x54, 0xe8, 0x67, 0x80, 0xa1, 0xb2, 0x2f, 0x69, 0x34, 0x92, 0xd3, 0x19,
+    0x8b, 0xaf, 0xfd, 0xdd, 0x0e, 0xc7, 0xb7, 0x57, 0x57, 0x6d, 0xa8, 0xee, 0xd1, 0xc0, 0xbe, 0xe5,
+    0x2d, 0xca, 0x61, 0x26, 0xbd, 0xec, 0x53, 0xce, 0x70, 0xba, 0x54, 0x6a, 0x9d, 0x85, 0xa6, 0x2a,
+    0x06, 0xfc, 0x4f, 0x54, 0x32, 0x9f, 0xeb, 0xa3, 0x7c, 0x12, 0x63, 0x85, 0x0e, 0x3e, 0x8d, 0x1c,
+    0x3b, 0x81, 0x2a, 0xfa, 0xe1, 0xe5, 0x5a, 0x44, 0x84, 0x6c, 0xab, 0xfb, 0xf1, 0xfb, 0xdb, 0x37,
+    0x6f, 0xae, 0x2f, 0xdb, 0xa9, 0xc2, 0xf2, 0x74, 0x14, 0x6d, 0x94, 0x65, 0x64, 0xca, 0xb2, 0xcf,
+    0xc8, 0x22, 0x25, 0x92, 0x8e, 0xfd, 0x9a, 0xb0, 0x6c, 0xfb, 0x81, 0xbc, 0x6d, 0x6d, 0xfb, 0x3a,
+    0x15, 0x23, 0x65, 0x19, 0x7a, 0xb1, 0xe2, 0xd9, 0xf1, 0x4a, 0xc6, 0x5d, 0xa2, 0x58, 0xb6, 0x82,
+    0xf7, 0x6c, 0x2a, 0x39, 0xbc, 0xab, 0xe8, 0x1f, 0x5c, 0x3d, 0xd6, 0x1c, 0xce, 0x92, 0x6c, 0xd1,
+    0xa2, 0x7c, 0x18, 0x04, 0xac, 0x35, 0xc9, 0x32, 0x6d, 0x2a, 0x16, 0xa6, 0xda, 0x6f, 0xe2, 0xd8,
+    0x06, 0x00, 0x70, 0x1f, 0xfd, 0x78, 0xa2, 0x10, 0xb9, 0xd0, 0xc9, 0xff, 0xa2, 0xbc, 0x1b, 0x9e,
+    0x98, 0xf5, 0x06, 0x92, 0xa6, 0xf6, 0x83, 0x5a, 0xa5, 0x98, 0xe4, 0xe3, 0xe5, 0x62, 0x5a, 0x3d,
+    0x01, 0x79, 0xa4, 0xb5, 0xb9, 0x9d, 0x01, 0x77, 0x60, 0x21, 0xe2, 0x91, 0x43, 0xf1, 0xca, 0xb0,
+    0x74, 0x0c, 0xf0, 0xcf, 0x01, 0xd3, 0x4f, 0x8c, 0x9c, 0x4e, 0xdf, 0x73, 0x20, 0x95, 0x2c, 0xe0,
+    0x51, 0x22, 0x51, 0xe9, 0x76, 0xa6, 0x65, 0x4f, 0x62, 0xf7, 0x88, 0x84, 0x7e, 0x62, 0xf4, 0x8b,
+    0x61, 0x06, 0x92, 0x19, 0x54, 0xac, 0xe4, 0xf0, 0x03, 0x25, 0x7a, 0xb3, 0x97, 0x47, 0xe8, 0xb5,
+    0x8e, 0xa3, 0xf1, 0x8c, 0xa1, 0x77, 0x3a, 0xe3, 0x37, 0x9c, 0x65, 0x70, 0xa7, 0xef, 0x91, 0xc5,
+    0x57, 0xbf, 0xbd, 0x3c, 0x5c, 0xed, 0x96, 0x60, 0x5b, 0x9d, 0xe3, 0x99, 0x38, 0xc5, 0xd2, 0xed,
+    0x7a, 0x1e, 0x7d, 0x34, 0xc0, 0xe0, 0xa9, 0xfe, 0x07, 0x07, 0xa9, 0xdf, 0x86, 0x82, 0x4a, 0x60,
+    0xae, 0x65, 0x33, 0x6c, 0x1d, 0x4d, 0xeb, 0xfb, 0xd3, 0xf4, 0x8e, 0x14, 0x9d, 0xb3, 0xa2, 0x9e,
+    0xa0, 0xf5, 0xf0, 0x31, 0x58, 0x73, 0xcc, 0xd2, 0x7b, 0xd2, 0xdd, 0xf1, 0x1a, 0x1e, 0x28, 0xef,
+    0x68, 0xdf, 0x81, 0x88, 0x8b, 0x79, 0xa4, 0xcc, 0x7d, 0x8b, 0xc2, 0xb0, 0x7e, 0xa0, 0x36, 0x00,
+    0x9f, 0xfe, 0xdc, 0x63, 0xd8, 0xfb, 0x80, 0xe6, 0x85, 0x12, 0x9f, 0xf8, 0x1f, 0x6b, 0x63, 0xc0,
+    0x71, 0x44, 0xa9, 0xc4, 0x26, 0xa4, 0xa0, 0xb4, 0x0e, 0x07, 0x2d, 0x9b, 0x90, 0x34, 0x91, 0x2b,
+    0xfd, 0xf0, 0x07, 0xd2, 0x04, 0x6d, 0x8a, 0x7a, 0xa4, 0xa7, 0xb8, 0x27, 0xe0, 0x37, 0xed, 0x40,
+    0xf9, 0xe5, 0xd3, 0xc3, 0x48, 0x9d, 0x82, 0xc6, 0x3e, 0x03, 0xda, 0x83, 0xb3, 0x7d, 0x14, 0xda,
+    0x74, 0x43, 0xc6, 0xb5, 0xee, 0x27, 0x1f, 0xf7, 0x96, 0xcb, 0x16, 0xa5, 0x72, 0xbb, 0xf3, 0xe8,
+    0x27, 0xc7, 0x35, 0xe7, 0xd1, 0xc3, 0xff, 0xad, 0xf3, 0x68, 0x2b, 0xf6, 0x8a, 0xee, 0xa6, 0x53,
+    0x3c, 0x75, 0xa6, 0x82, 0x74, 0x0f, 0xb5, 0x2d, 0x76, 0xe6, 0xd8, 0x94, 0xa3, 0x6d, 0xb5, 0xaf,
+    0x78, 0xad, 0xa8, 0x18, 0x0a, 0x0f, 0x14, 0x45, 0x41, 0x09, 0x57, 0xfa, 0xda, 0x73, 0xe0, 0xc1,
+    0x2f, 0xc7, 0x78, 0xed, 0x1c, 0xcd, 0x4d, 0xae, 0x6f, 0x27, 0x17, 0x5f, 0xe6, 0x26, 0x5f, 0xa9,
+    0x33, 0x29, 0x13, 0xdb, 0xf1, 0xfa, 0x92, 0x5f, 0x97, 0xe8, 0xab, 0x30, 0xb1, 0x64, 0x0f, 0x6e,
+    0x47, 0x2a, 0xb6, 0x9a, 0xce, 0xb2, 0x9b, 0x31, 0x63, 0x31, 0x4c, 0xb3, 0xbb, 0x8e, 0x18, 0x26,
+    0xe5, 0x6d, 0xdc, 0x18, 0x28, 0xff, 0xda, 0x91, 0xb2, 0x96, 0x46, 0xcf, 0xdc, 0x4e, 0x1f, 0xfa,
+    0x6e, 0xbf, 0xcb, 0x06, 0x30, 0xb0, 0xa7, 0x35, 0x42, 0x7d, 0xf7, 0xb4, 0x03, 0x5e, 0x79, 0xb0,
+    0x6c, 0xf4, 0xdf, 0x3d, 0x4e, 0x67, 0x1d, 0x6e, 0x22, 0x25, 0xdc, 0xfe, 0xd2, 0x5c, 0xff, 0x1a,
+    0xdd, 0xad, 0xa5, 0x76, 0x67, 0xb3, 0xff, 0x88, 0x7a, 0x03, 0x91, 0x05, 0x58, 0xfe, 0x83, 0x07,
+    0x1b, 0xbe, 0xc1, 0xca, 0x5e, 0xb1, 0x9b, 0xd8, 0x9f, 0x0d, 0xd6, 0xb6, 0x59, 0x1f, 0xe8, 0x69,
+    0xd7, 0xa5, 0x5d, 0x30, 0xdf, 0xc7, 0x31, 0x46, 0xf3, 0x09, 0xf3, 0xcb, 0xad, 0x91, 0xf1, 0x59,
+    0xc6, 0xf3, 0xc8, 0xbe, 0x6f, 0xf8, 0xaf, 0xf9, 0xbc, 0x8f, 0x5a, 0x2d, 0xfa, 0x11, 0xe9, 0xdf,
+    0x60, 0x93, 0xe0, 0x15, 0xa4, 0x1f, 0xf5, 0xdb, 0x1b, 0xa5, 0xe3, 0xf6, 0x28, 0x0c, 0xca, 0x60,
+    0x31, 0xe1, 0xd2, 0x75, 0xcf, 0x7a, 0xa4, 0x83, 0x61, 0x74, 0x8d, 0x84, 0x29, 0x46, 0x0d, 0x4e,
+    0xc9, 0x2e, 0x46, 0x14, 0xda, 0xae, 0xd3, 0x9f, 0x54, 0x90, 0x28, 0x98, 0xe7, 0x76, 0x07, 0x58,
+    0x15, 0xbe, 0xd8, 0x84, 0x77, 0x56, 0xbb, 0x87, 0x99, 0xb0, 0x39, 0x49, 0xaf, 0xa7, 0xf4, 0xbb,
+    0xab, 0xfa, 0xbb, 0xac, 0x59, 0x92, 0xa8, 0xf5, 0x2b, 0x5a, 0x3b, 0x7a, 0xfa, 0x2a, 0x2b, 0x1d,
+    0x7f, 0x1f, 0x24, 0xe9, 0xea, 0x27, 0x14, 0x15, 0xad, 0xb8, 0xf1, 0xda, 0xfe, 0x6d, 0x1c, 0x2e,
+    0xd1, 0x60, 0x82, 0xc9, 0xc7, 0x37, 0xf8, 0xf6, 0xa5, 0xd4, 0xf0, 0x24, 0x7d, 0x4a, 0xe5, 0xf1,
+    0x19, 0x2b, 0x76, 0x16, 0xe6, 0x3c, 0xf6, 0xd1, 0xde, 0x00, 0x75, 0xb1, 0x59, 0xdf, 0x40, 0x18,
+    0x9e, 0x58, 0x4e, 0x9a, 0x5f, 0x4f, 0xab, 0x84, 0xe5, 0xca, 0x9e, 0x10, 0xec, 0x6d, 0x8d, 0x40,
+    0xbd, 0x83, 0x37, 0x8b, 0x64, 0xc1, 0xf3, 0x9c, 0xcd, 0x79, 0x0d, 0xfe, 0x71, 0x6a, 0xe3, 0x49,
+    0xfb, 0xc6, 0x6e, 0x79, 0x90, 0x89, 0x54, 0x41, 0x9e, 0x05, 0xd8, 0x58, 0x9b, 0x7b, 0x97, 0x4f,
+    0x3b, 0xa8, 0x06, 0x3e, 0x75, 0xff, 0xc8, 0x0d, 0xa2, 0x99, 0xd5, 0x3f, 0x28, 0xb0, 0xbf, 0x24,
+    0xc0, 0x7a, 0x64, 0x7e, 0xa0, 0xf1, 0x0f, 0xec, 0x65, 0xdf, 0x36, 0xb2, 0x21, 0x00, 0x00,
+};
+
+constexpr WebAsset asset_style_css = {
+    "/style.css", "/style.6b3d0bcf.css", "text/css", "\"6b3d0bcf72bee8e5\"",
+    style_css_gz, sizeof(style_css_gz), 16248
+};
+
+constexpr WebAsset asset_script_js = {
+    "/script.js", "/script.eb3024eb.js", "application/javascript", "\"eb3024eb24adff9d\"",
+    script_js_gz, sizeof(script_js_gz), 13194
+};
+
+constexpr WebAsset asset_index_html = {
+    "/index.html", nullptr, "text/html", "\"8a99c7ca49107f41\"",
+    index_html_gz, sizeof(index_html_gz), 8626
+};
+
+// / (bootstrap): 38058 -> 8081 bytes, plus status and channels
+const uint8_t bootstrap_gz[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xd4, 0x3d, 0x5d, 0x77, 0xdb, 0xb6,
+    0x92, 0xef, 0xf9, 0x15, 0x88, 0xee, 0x69, 0x25, 0xa5, 0x22, 0x2d, 0xca, 0xf2, 0x77, 0xec, 0xbb,
+    0x76, 0x12, 0xb7, 0xb9, 0x1b, 0xc7, 0xd9, 0x38, 0xe9, 0xed, 0x9e, 0x9e, 0x3e, 0x50, 0x12, 0x24,
+    0xb1, 0xa1, 0x48, 0x5d, 0x92, 0xb2, 0xe3, 0xa6, 0xf9, 0x5d, 0xfb, 0xbe, 0xbf, 0x6c, 0x67, 0xf0,
+    0x41, 0x02, 0x20, 0x48, 0x51, 0xb2, 0xdb, 0xde, 0x75, 0x53, 0x4b, 0x24, 0x07, 0x83, 0xc1, 0x60,
+    0x66, 0x30, 0x33, 0x18, 0xd0, 0x4f, 0x9e, 0x3f, 0x7d, 0x79, 0xfd, 0xe2, 0xc3, 0x7f, 0xbf, 0x7b,
+    0x45, 0xe6, 0xd9, 0x22, 0x3c, 0x7b, 0xf2, 0x1c, 0x3f, 0x48, 0xe8, 0x47, 0xb3, 0xd3, 0x16, 0x8d,
+    0x5a, 0x78, 0x83, 0xfa, 0x93, 0xb3, 0x27, 0x04, 0x7e, 0x9e, 0x2f, 0x68, 0xe6, 0x93, 0xf1, 0xdc,
+    0x4f, 0x52, 0x9a, 0x9d, 0xb6, 0x3e, 0x7e, 0xb8, 0x74, 0x0e, 0x5b, 0xea, 0xa3, 0xc8, 0x5f, 0xd0,
+    0xd3, 0xd6, 0x6d, 0x40, 0xef, 0x96, 0x71, 0x92, 0xb5, 0xc8, 0x38, 0x8e, 0x32, 0x1a, 0x01, 0xe8,
+    0x5d, 0x30, 0xc9, 0xe6, 0xa7, 0x13, 0x7a, 0x1b, 0x8c, 0xa9, 0xc3, 0x2e, 0x7a, 0x24, 0x88, 0x82,
+    0x2c, 0xf0, 0x43, 0x27, 0x1d, 0xfb, 0x21, 0x3d, 0xf5, 0xdc, 0xbe, 0x86, 0x6a, 0x9e, 0x65, 0x4b,
+    0x87, 0xfe, 0x6b, 0x15, 0xdc, 0x9e, 0xb6, 0x7e, 0x72, 0x3e, 0x9e, 0x3b, 0x2f, 0xe2, 0xc5, 0xd2,
+    0xcf, 0x82, 0x51, 0x48, 0x15, 0xbc, 0xaf, 0x5f, 0x9d, 0xd2, 0xc9, 0x8c, 0xca, 0x96, 0x59, 0x90,
+    0x85, 0xf4, 0xec, 0xf2, 0xf5, 0xc5, 0xfb, 0x6b, 0x72, 0xf3, 0xea, 0xea, 0x22, 0xfe, 0x4c, 0x5e,
+    0x00, 0x68, 0x12, 0x87, 0xe4, 0x9d, 0x1f, 0xd1, 0xf0, 0xf9, 0x0e, 0x87, 0xe0, 0xd0, 0x69, 0x76,
+    0x8f, 0xdf, 0x9f, 0xec, 0x3c, 0x23, 0xa7, 0xcd, 0x7f, 0xb0, 0xad, 0xc0, 0xfd, 0x3a, 0x9a, 0xac,
+    0xd2, 0x2c, 0x81, 0x41, 0x90, 0x97, 0x7e, 0x3a, 0x1f, 0xc5, 0x7e, 0x32, 0x21, 0x2f, 0x6e, 0x6e,
+    0x10, 0x84, 0x13, 0xf1, 0x22, 0x4e, 0x80, 0x13, 0x7e, 0x46, 0xc9, 0x87, 0x39, 0x5d, 0x50, 0xe2,
+    0x90, 0xeb, 0x04, 0x58, 0x4b, 0x77, 0xfe, 0x39, 0x0f, 0x32, 0xba, 0x73, 0x11, 0xae, 0x28, 0x02,
+    0x6f, 0xd0, 0x3d, 0x79, 0xb6, 0xc3, 0x28, 0x86, 0x6e, 0xc8, 0x8f, 0x3e, 0xf4, 0x0d, 0x0c, 0x49,
+    0x01, 0xaf, 0xec, 0x2f, 0x8c, 0x13, 0x18, 0x6b, 0x48, 0x33, 0xe8, 0x13, 0x40, 0x8f, 0x93, 0x38,
+    0xce, 0xc8, 0x17, 0x36, 0x60, 0x68, 0xf5, 0x2e, 0x09, 0x16, 0x7e, 0x72, 0xcf, 0xe1, 0x52, 0x04,
+    0xc0, 0x07, 0x8e, 0x33, 0x9a, 0x39, 0x4b, 0xfe, 0xe8, 0x98, 0xfc, 0x6d, 0xba, 0x87, 0xff, 0x9d,
+    0x14, 0x8f, 0x52, 0x0a, 0x0c, 0x9f, 0x88, 0x87, 0xec, 0x47, 0x79, 0x98, 0xd1, 0x04, 0xa6, 0x91,
+    0x3d, 0xa3, 0x87, 0xf8, 0x9f, 0xf2, 0x6c, 0x0c, 0x0c, 0x31, 0xda, 0x48, 0x4a, 0xce, 0xc7, 0x63,
+    0x98, 0xc1, 0x12, 0x21, 0x3e, 0xbb, 0xad, 0x10, 0x73, 0x79, 0xb9, 0xbf, 0xdf, 0xef, 0x9f, 0xe8,
+    0x8f, 0x55, 0x82, 0xfa, 0xfd, 0xe1, 0xc1, 0xc5, 0xb9, 0x01, 0x70, 0xe7, 0x27, 0x51, 0x10, 0xcd,
+    0xb0, 0xef, 0xfe, 0x68, 0x38, 0x38, 0x32, 0x1e, 0x4f, 0x70, 0x0e, 0x12, 0x78, 0x3a, 0x19, 0xef,
+    0xee, 0x0d, 0xf7, 0x4c, 0xec, 0x2b, 0xf8, 0x4c, 0x53, 0x78, 0x3c, 0x38, 0xf4, 0x0f, 0xe4, 0x63,
+    0x49, 0xf8, 0x07, 0xfa, 0xb9, 0x4c, 0x76, 0x06, 0x37, 0x15, 0xa2, 0x77, 0xd9, 0xcf, 0x89, 0xfa,
+    0x50, 0x25, 0x79, 0x8f, 0xfd, 0x68, 0x8f, 0x17, 0xab, 0x8c, 0x22, 0xab, 0x0e, 0xd9, 0x8f, 0xde,
+    0xe3, 0x45, 0x9c, 0x4c, 0x68, 0x52, 0x9e, 0x33, 0x76, 0xdb, 0x99, 0xd0, 0xa9, 0xbf, 0x0a, 0x33,
+    0x1c, 0x0c, 0xfb, 0x39, 0xd1, 0x1f, 0x4b, 0xc4, 0x94, 0xfd, 0xe8, 0x88, 0x6f, 0xe6, 0xfe, 0x24,
+    0xbe, 0x53, 0x50, 0xa6, 0xec, 0x86, 0x93, 0x2e, 0x8e, 0x49, 0x9f, 0x78, 0xcb, 0xcf, 0x64, 0x17,
+    0xfe, 0x4f, 0x66, 0x23, 0xbf, 0xd3, 0xef, 0x11, 0xf1, 0xcf, 0xed, 0x1f, 0x76, 0x4f, 0x74, 0xf8,
+    0xc5, 0x04, 0xe1, 0x87, 0x00, 0xeb, 0x0d, 0x2c, 0x0d, 0x3c, 0x13, 0x3e, 0x9c, 0x21, 0xfc, 0x21,
+    0x80, 0x0e, 0x86, 0x36, 0xf8, 0x81, 0xd9, 0x60, 0x16, 0xc6, 0x77, 0xd8, 0xa4, 0x4f, 0x06, 0x7d,
+    0xd9, 0x60, 0xb0, 0xb7, 0xd7, 0x23, 0x5e, 0x7f, 0x20, 0x1a, 0xc9, 0x36, 0xf9, 0x34, 0x81, 0x9e,
+    0xa5, 0x60, 0x60, 0xe2, 0x48, 0x9d, 0xa6, 0xfc, 0xa6, 0x33, 0xf5, 0x53, 0xe0, 0x19, 0x74, 0xb6,
+    0x97, 0x12, 0xea, 0xa7, 0xf4, 0xa4, 0x0c, 0x12, 0xc5, 0xc9, 0xc2, 0x0f, 0x11, 0x68, 0x50, 0x0d,
+    0x94, 0x72, 0xd2, 0xdc, 0xa1, 0x0a, 0x61, 0xcc, 0xdc, 0x7b, 0x7f, 0x12, 0xac, 0x14, 0x32, 0x12,
+    0x76, 0xcd, 0xd9, 0x7c, 0xa2, 0xdf, 0x63, 0xac, 0x34, 0xee, 0x31, 0x76, 0x9d, 0x3c, 0xf9, 0xca,
+    0xf4, 0xfe, 0x3d, 0x05, 0xdb, 0x4b, 0xbe, 0x25, 0x17, 0xd0, 0x19, 0xb9, 0x41, 0x0b, 0xc6, 0x10,
+    0x3f, 0xeb, 0x3d, 0x79, 0x76, 0x7c, 0x3c, 0xa2, 0xd3, 0x38, 0xa1, 0xec, 0xab, 0x3f, 0x05, 0xc5,
+    0x14, 0x8a, 0x0f, 0x52, 0x39, 0x0b, 0xa2, 0x1c, 0xf1, 0xd2, 0x9f, 0x4c, 0x98, 0x72, 0x88, 0xeb,
+    0x51, 0xfc, 0xd9, 0x49, 0x83, 0xdf, 0xd8, 0x2d, 0x21, 0x35, 0x70, 0x8b, 0x75, 0xc8, 0x16, 0x03,
+    0x8e, 0x64, 0x1a, 0xa3, 0x6a, 0x04, 0xbf, 0xd1, 0x63, 0xe2, 0xed, 0x2f, 0x3f, 0xf3, 0xa6, 0xe9,
+    0x18, 0x6c, 0x6b, 0xe8, 0x8c, 0xe8, 0xdc, 0xbf, 0x0d, 0x62, 0xd0, 0xa8, 0x74, 0x01, 0xf6, 0x66,
+    0xce, 0xda, 0x8e, 0xe2, 0xc9, 0xbd, 0xda, 0x76, 0xea, 0x2f, 0x82, 0x10, 0xc4, 0xbf, 0x7d, 0x43,
+    0x67, 0x31, 0x25, 0x1f, 0x5f, 0xb7, 0x7b, 0xc4, 0xf1, 0x97, 0xcb, 0x90, 0x3a, 0xe9, 0x7d, 0x9a,
+    0xd1, 0x45, 0x8f, 0xa4, 0xc0, 0x56, 0xd0, 0x94, 0x24, 0x10, 0xc6, 0x62, 0xe4, 0x8f, 0x3f, 0xcd,
+    0x92, 0x78, 0x15, 0x01, 0x57, 0x6e, 0xfd, 0xa4, 0xa3, 0x1a, 0x2a, 0x31, 0xdf, 0x63, 0xd4, 0x0a,
+    0xf9, 0x54, 0x55, 0x43, 0xf1, 0x7c, 0x11, 0x44, 0xce, 0x9c, 0x06, 0xb3, 0x39, 0xcc, 0xb6, 0xd7,
+    0xef, 0xdf, 0xce, 0xf9, 0xed, 0x30, 0x88, 0x68, 0x71, 0xdf, 0xdd, 0x97, 0xec, 0xbd, 0xc8, 0x7b,
+    0x04, 0x2b, 0x0a, 0x36, 0x34, 0x89, 0x90, 0xbb, 0x38, 0x14, 0xc9, 0x5d, 0x31, 0x24, 0xb1, 0x04,
+    0xc1, 0x70, 0xda, 0x82, 0xab, 0x31, 0x97, 0x88, 0x63, 0x32, 0x0d, 0x3e, 0x53, 0xa1, 0x86, 0x59,
+    0xbc, 0xcc, 0xd9, 0x1c, 0xd2, 0x69, 0x96, 0x5f, 0x24, 0xbc, 0xe7, 0x7c, 0x06, 0xb2, 0x2c, 0x2e,
+    0xa4, 0x41, 0x1d, 0x36, 0xbb, 0x21, 0x29, 0xf6, 0x13, 0x67, 0x86, 0x42, 0x01, 0x1d, 0x77, 0x8e,
+    0xfa, 0x13, 0x3a, 0xeb, 0x49, 0xb6, 0x28, 0xca, 0xde, 0x45, 0xcd, 0xed, 0x11, 0x26, 0xa3, 0x4b,
+    0x3f, 0x41, 0x2b, 0x0b, 0x37, 0xba, 0x4c, 0x7d, 0x76, 0xc8, 0x3e, 0x2a, 0x10, 0xfe, 0xea, 0x55,
+    0x62, 0xde, 0x1a, 0x25, 0xa7, 0x3e, 0x5e, 0xfa, 0xe3, 0x20, 0xbb, 0x47, 0xa5, 0xd8, 0x93, 0xac,
+    0x09, 0x80, 0x59, 0x89, 0x43, 0x6f, 0xa1, 0x25, 0xd8, 0xd5, 0x28, 0x8e, 0x84, 0xa2, 0xfc, 0xe6,
+    0x04, 0xd1, 0x84, 0x7e, 0x3e, 0x26, 0x8e, 0x27, 0x67, 0x60, 0xc3, 0xa5, 0x18, 0xd7, 0x77, 0x1f,
+    0x06, 0x90, 0x6c, 0xb1, 0x8e, 0xba, 0x63, 0xd9, 0x38, 0x57, 0x94, 0xcf, 0xdc, 0x3b, 0x01, 0x99,
+    0x18, 0xf4, 0xf3, 0x11, 0xe5, 0xfa, 0x43, 0xfc, 0x55, 0x16, 0x1b, 0x4a, 0x34, 0x28, 0xc0, 0xec,
+    0xa2, 0x36, 0x09, 0xd2, 0x65, 0xe8, 0x03, 0x3f, 0xa6, 0x21, 0x15, 0x90, 0xf8, 0xcd, 0x99, 0x04,
+    0x09, 0x1d, 0x73, 0x89, 0x01, 0x21, 0x5e, 0x2d, 0xa2, 0x2d, 0x39, 0xf0, 0x03, 0xf8, 0x67, 0x30,
+    0x02, 0x6e, 0x0b, 0xb6, 0xe1, 0xc2, 0x9c, 0x23, 0xf8, 0x52, 0x45, 0xed, 0xaf, 0xe0, 0xe4, 0x04,
+    0xd3, 0x7b, 0x27, 0x17, 0x79, 0x90, 0x01, 0x70, 0xe3, 0x46, 0x34, 0xbb, 0xa3, 0x34, 0xe2, 0x30,
+    0x7e, 0x18, 0xcc, 0x22, 0x07, 0x7c, 0x9a, 0x05, 0xcc, 0x2f, 0xae, 0xa2, 0x34, 0xb1, 0xf0, 0x89,
+    0xd9, 0xfb, 0x1a, 0xd5, 0x46, 0x7f, 0xa1, 0x2b, 0x55, 0x02, 0xc5, 0xef, 0x98, 0xad, 0x42, 0x69,
+    0x1c, 0x06, 0x13, 0x5d, 0xd2, 0xc5, 0xaa, 0xa7, 0x01, 0x0b, 0x7b, 0x29, 0xf1, 0xe5, 0xd6, 0xb3,
+    0xab, 0xce, 0xa2, 0x23, 0x75, 0x4d, 0x21, 0x05, 0xed, 0x1f, 0x5b, 0x68, 0x64, 0xd3, 0x7c, 0x5d,
+    0xd3, 0xf1, 0x33, 0x6d, 0x1e, 0x1a, 0x04, 0xe9, 0x1e, 0x4b, 0x97, 0x4d, 0xa2, 0x1b, 0xc6, 0xb3,
+    0xb8, 0x9a, 0xa1, 0x95, 0xcc, 0x9a, 0xf9, 0x4b, 0x69, 0x5d, 0x25, 0x16, 0x27, 0x00, 0xb6, 0x0b,
+    0x54, 0x42, 0x34, 0x87, 0x87, 0x92, 0x72, 0x29, 0x6d, 0xc5, 0x9d, 0x32, 0x5b, 0x4b, 0xf4, 0xad,
+    0x63, 0x58, 0x3e, 0xea, 0x4d, 0x28, 0x2f, 0xc9, 0x88, 0xfa, 0xb0, 0x92, 0xc1, 0xb8, 0xae, 0x77,
+    0xcd, 0xb1, 0xa6, 0xb7, 0x33, 0x7d, 0xbc, 0x83, 0xd2, 0x78, 0x8b, 0x3b, 0xc2, 0xfc, 0xe7, 0x2e,
+    0x66, 0x8e, 0x0a, 0x97, 0x02, 0x32, 0xf7, 0x2c, 0x8b, 0x97, 0x7b, 0xb0, 0x97, 0xd0, 0xc5, 0x49,
+    0x71, 0xff, 0x4e, 0x60, 0x3d, 0x90, 0x7e, 0xa6, 0xb6, 0xa6, 0x98, 0x2e, 0x67, 0xd7, 0xb6, 0x80,
+    0x98, 0x1d, 0xbb, 0xe9, 0x6a, 0xc4, 0x42, 0x8d, 0x72, 0xff, 0x7d, 0xf7, 0x50, 0x21, 0xa0, 0xbc,
+    0x7c, 0x99, 0x1d, 0xb1, 0x9b, 0xcc, 0xf2, 0xc2, 0xea, 0x03, 0x72, 0xbb, 0x5a, 0x2e, 0x69, 0x32,
+    0xce, 0x5d, 0x0d, 0xe6, 0xe9, 0x27, 0x0e, 0xaa, 0x24, 0x53, 0x33, 0x4f, 0x08, 0x0f, 0xba, 0x77,
+    0x99, 0x9f, 0x81, 0xdb, 0x01, 0x51, 0x4a, 0x30, 0xf6, 0x33, 0x88, 0x0b, 0x50, 0xd9, 0x53, 0x76,
+    0x13, 0xcd, 0xae, 0xb8, 0xb9, 0xad, 0x94, 0xe6, 0x66, 0x2f, 0xd7, 0x70, 0x74, 0xe8, 0x0a, 0xd7,
+    0xc0, 0xaa, 0xe0, 0x32, 0x58, 0x68, 0x20, 0x86, 0xe9, 0x62, 0x53, 0x4b, 0x80, 0x53, 0x20, 0x86,
+    0x37, 0xc9, 0x83, 0x1e, 0x69, 0xce, 0xfb, 0xa6, 0x0c, 0x15, 0x77, 0x0c, 0x2a, 0xfa, 0x55, 0xf4,
+    0x17, 0x8e, 0xba, 0xa0, 0xcc, 0x8f, 0x40, 0xa7, 0xb8, 0x05, 0x5f, 0xae, 0x42, 0xf0, 0xc7, 0x06,
+    0x29, 0x44, 0xb5, 0x53, 0x0c, 0x6c, 0xa9, 0x49, 0x8e, 0x1b, 0x47, 0x28, 0x32, 0x82, 0xaa, 0x4a,
+    0x35, 0x15, 0xb1, 0x47, 0xb7, 0xac, 0x38, 0x7d, 0xe1, 0x32, 0x57, 0x80, 0x43, 0x6f, 0xff, 0xf1,
+    0x89, 0xde, 0x4f, 0x13, 0x08, 0xc1, 0x53, 0x41, 0x0e, 0xef, 0xab, 0xff, 0x0d, 0xfa, 0xc9, 0xfd,
+    0x6f, 0xc4, 0xa5, 0xb6, 0x44, 0x7b, 0x27, 0xf9, 0x3d, 0x45, 0xc4, 0x58, 0x44, 0xde, 0x91, 0x6e,
+    0xfb, 0x57, 0xf6, 0x7b, 0xcf, 0x8e, 0xa0, 0xef, 0x1e, 0xd4, 0xa1, 0x70, 0x0b, 0x24, 0x0a, 0x3b,
+    0x98, 0x8a, 0x3c, 0x58, 0x31, 0x34, 0xdd, 0xdd, 0xeb, 0xf7, 0xb7, 0x5c, 0x3e, 0x8b, 0xc8, 0xfd,
+    0xfb, 0x24, 0x98, 0x6c, 0xb3, 0x7e, 0x4e, 0x72, 0x0c, 0x86, 0x2e, 0xcd, 0x00, 0xa1, 0x50, 0x19,
+    0xf8, 0x06, 0xa3, 0x58, 0xc0, 0xfd, 0x8c, 0x3a, 0x7c, 0xb9, 0x07, 0x51, 0x4b, 0xe8, 0x92, 0xfa,
+    0x59, 0x07, 0xbd, 0x0a, 0x67, 0x1a, 0x64, 0x3d, 0x74, 0x21, 0xc0, 0x07, 0xe9, 0xec, 0xee, 0xa1,
+    0x83, 0x46, 0xbc, 0x69, 0xd2, 0xed, 0x2a, 0x3a, 0x57, 0x2c, 0x59, 0xa8, 0xa5, 0xd2, 0xec, 0x6c,
+    0xe1, 0x33, 0x21, 0xad, 0xdb, 0xfb, 0x0b, 0xe3, 0x62, 0xa8, 0x7f, 0xfe, 0x2a, 0x5e, 0xf8, 0x13,
+    0x1b, 0xac, 0xdf, 0x45, 0xbc, 0x76, 0x5c, 0x08, 0xa9, 0x94, 0x2d, 0x33, 0xe0, 0xeb, 0xf6, 0x14,
+    0x8c, 0x95, 0x40, 0x25, 0x0b, 0x30, 0x05, 0x27, 0xea, 0x75, 0x84, 0x4e, 0x2f, 0x8f, 0x04, 0x41,
+    0x3e, 0x93, 0x3b, 0xe0, 0x44, 0xca, 0x2d, 0x01, 0x4b, 0x85, 0xcc, 0xe3, 0xdb, 0xdc, 0xd1, 0x52,
+    0x94, 0x85, 0x7d, 0x45, 0xc9, 0xf8, 0xef, 0x8e, 0x03, 0x01, 0x74, 0x77, 0xcd, 0xb0, 0x18, 0x2f,
+    0x72, 0x9c, 0x51, 0x36, 0x77, 0xc6, 0xf3, 0x20, 0x9c, 0x80, 0xc2, 0x92, 0x2f, 0x05, 0x45, 0xc0,
+    0x5c, 0x26, 0x84, 0x10, 0xe2, 0xa6, 0x27, 0xa0, 0x7f, 0x26, 0xf4, 0xa0, 0x02, 0x7a, 0x60, 0x85,
+    0xde, 0xad, 0x80, 0xde, 0x65, 0xd0, 0x1c, 0xdc, 0xf9, 0x43, 0x1d, 0x49, 0xd3, 0x7d, 0x33, 0xd7,
+    0x9f, 0xfc, 0x89, 0xb2, 0x04, 0xc9, 0x60, 0x56, 0x3c, 0x68, 0xb2, 0x80, 0xa8, 0x03, 0x99, 0x0f,
+    0x6c, 0xee, 0x83, 0x37, 0xa8, 0xf0, 0x1f, 0xf6, 0xad, 0xfe, 0x83, 0x11, 0x93, 0xca, 0x30, 0x73,
+    0x32, 0x63, 0xf9, 0x39, 0x77, 0xc4, 0xbe, 0x7d, 0xd1, 0x65, 0x5b, 0xa6, 0x52, 0xea, 0xd6, 0x27,
+    0xcd, 0x72, 0x1e, 0xac, 0x23, 0xa9, 0xc6, 0x8b, 0xc0, 0x51, 0x33, 0x2a, 0x5c, 0x1f, 0xc2, 0x91,
+    0x5b, 0xdb, 0x12, 0x65, 0x4b, 0xb8, 0x78, 0x7b, 0xdd, 0x6a, 0x6f, 0xc9, 0xe6, 0x6d, 0xaa, 0x13,
+    0x60, 0x43, 0xb8, 0xdb, 0xdd, 0xd2, 0x9c, 0x09, 0x3f, 0x07, 0xad, 0xda, 0x36, 0xe6, 0x4c, 0x2c,
+    0x4a, 0x68, 0xa2, 0xb7, 0x35, 0xe0, 0x03, 0x6e, 0xab, 0xad, 0x4e, 0xbc, 0x74, 0xb8, 0xa0, 0x71,
+    0x9d, 0xd1, 0x34, 0x3c, 0xa3, 0x5c, 0x14, 0x4a, 0xd2, 0x5c, 0xef, 0xb3, 0xaf, 0x31, 0xb8, 0xaa,
+    0xf7, 0xa2, 0x1a, 0x45, 0xf1, 0x98, 0x4d, 0x65, 0xd9, 0xe4, 0x61, 0xae, 0xac, 0x5b, 0x1a, 0x8d,
+    0x66, 0xcd, 0x54, 0x04, 0xc7, 0x75, 0x91, 0x91, 0xca, 0x0e, 0x37, 0xf4, 0x47, 0x34, 0x34, 0x99,
+    0x3e, 0x0a, 0xe3, 0xf1, 0xa7, 0x7a, 0x19, 0x2f, 0x2b, 0x98, 0x36, 0xb0, 0x7a, 0x8f, 0xd9, 0x30,
+    0x24, 0x43, 0xdb, 0x44, 0xb9, 0xb7, 0x7e, 0xb8, 0xa2, 0xcd, 0x28, 0xf3, 0xdc, 0xcd, 0x0c, 0x82,
+    0x55, 0x45, 0xf4, 0x0c, 0xd9, 0x8b, 0x38, 0x82, 0xc9, 0xf3, 0xd3, 0x36, 0x78, 0x04, 0x71, 0x14,
+    0x33, 0x33, 0x69, 0x21, 0x72, 0x42, 0x33, 0x3f, 0xa8, 0xe3, 0x9f, 0x18, 0xaa, 0x8c, 0x5b, 0x1f,
+    0xc2, 0xd4, 0x86, 0x04, 0x6e, 0x97, 0xc0, 0x49, 0xe2, 0x70, 0x7b, 0xfd, 0x1d, 0x0b, 0x04, 0x56,
+    0x0d, 0x5e, 0x9f, 0x73, 0xb1, 0xa8, 0xac, 0xc0, 0xb8, 0xa9, 0xce, 0x3e, 0x9a, 0xb3, 0x93, 0x6b,
+    0xb3, 0x25, 0xc9, 0xa4, 0x6a, 0xad, 0x1f, 0x86, 0x6b, 0xfc, 0x93, 0x22, 0x29, 0x99, 0xc0, 0x8a,
+    0x8d, 0xd6, 0x5d, 0xe4, 0xe8, 0x40, 0x73, 0xa7, 0x2c, 0x73, 0x3d, 0x0f, 0x26, 0x13, 0x1a, 0x95,
+    0xc7, 0xdd, 0x54, 0xbb, 0x55, 0xaf, 0xdc, 0xc4, 0x61, 0x2c, 0x28, 0x4d, 0x4c, 0x84, 0x2d, 0xea,
+    0xa9, 0xcc, 0xf9, 0x7b, 0x66, 0x9f, 0xd1, 0xf4, 0x81, 0x59, 0x17, 0x8b, 0x7d, 0xb0, 0x88, 0xc5,
+    0x03, 0x33, 0x32, 0xea, 0x8e, 0xda, 0x26, 0x81, 0xf0, 0xa3, 0xe5, 0x63, 0x9a, 0xcb, 0x50, 0x69,
+    0xd8, 0xe5, 0xe4, 0xcc, 0xb0, 0x94, 0x9c, 0x19, 0x1a, 0xc9, 0x99, 0xba, 0xe4, 0x86, 0x42, 0x49,
+    0xc5, 0xe2, 0x63, 0xa7, 0x45, 0x91, 0x2e, 0xdb, 0xbc, 0x34, 0x48, 0x83, 0x35, 0x43, 0x57, 0x8c,
+    0xd7, 0x96, 0x69, 0x92, 0xa0, 0xdc, 0x10, 0xa7, 0xd2, 0x5b, 0x54, 0x82, 0xb3, 0x1c, 0x04, 0xb7,
+    0xc6, 0xd7, 0xad, 0x27, 0xa5, 0x75, 0x43, 0x5d, 0x65, 0x6a, 0xec, 0xb4, 0x7d, 0x50, 0xb8, 0x54,
+    0x94, 0xba, 0x0c, 0x58, 0x16, 0xc2, 0x69, 0xb0, 0xc6, 0x6e, 0xec, 0x47, 0xea, 0x06, 0x0b, 0x54,
+    0xf6, 0xb0, 0xde, 0x81, 0xb5, 0x2e, 0x4e, 0x65, 0xaf, 0x73, 0x78, 0xd8, 0x23, 0x87, 0x5e, 0x8f,
+    0x1c, 0xec, 0xae, 0xf5, 0x3a, 0xf9, 0xb6, 0x6e, 0x93, 0xb9, 0x55, 0x79, 0xf3, 0x48, 0x8e, 0xae,
+    0xda, 0xa7, 0x3f, 0xe6, 0x1b, 0x8f, 0x95, 0xb6, 0x48, 0x49, 0xa1, 0x6d, 0xb5, 0x68, 0x5e, 0xac,
+    0xc0, 0x38, 0x45, 0x0f, 0x88, 0xe1, 0x47, 0x59, 0x64, 0x4a, 0xab, 0xee, 0x76, 0xe2, 0x04, 0x0e,
+    0x8c, 0x14, 0x99, 0xba, 0x73, 0xd3, 0xc8, 0x62, 0x55, 0x66, 0x77, 0x2a, 0xdc, 0xa4, 0x55, 0x92,
+    0x22, 0x87, 0xc5, 0x7e, 0x51, 0x43, 0x63, 0x25, 0xbc, 0xd3, 0xc7, 0xb5, 0x90, 0x6b, 0xc2, 0xa5,
+    0x0c, 0xe5, 0x76, 0x36, 0x0b, 0x69, 0x73, 0x7b, 0xa3, 0x48, 0xd0, 0xdd, 0x9c, 0x25, 0x08, 0xcb,
+    0x6b, 0x9d, 0xd0, 0x9a, 0xca, 0xf0, 0x48, 0x4b, 0x68, 0xf6, 0xbf, 0x31, 0x89, 0xd9, 0x3e, 0xbf,
+    0x20, 0x76, 0xef, 0xf7, 0x95, 0xdd, 0xf8, 0x03, 0xd0, 0x39, 0xef, 0x70, 0x1f, 0xbb, 0x1e, 0x76,
+    0xd7, 0x6c, 0x2e, 0x18, 0x4e, 0x40, 0x91, 0x7b, 0xbe, 0xf0, 0xb5, 0xac, 0xf3, 0xc8, 0x97, 0xd4,
+    0xe5, 0xeb, 0xe4, 0x43, 0x96, 0x49, 0x8b, 0x21, 0x29, 0x96, 0x71, 0xbb, 0x8b, 0x23, 0x08, 0x99,
+    0x06, 0x61, 0x68, 0x50, 0xc2, 0x19, 0xaa, 0x70, 0xb8, 0xff, 0x90, 0x1d, 0x95, 0x7e, 0x59, 0x78,
+    0x19, 0xda, 0xb2, 0xf8, 0xa6, 0xc5, 0x1e, 0x88, 0xd5, 0x64, 0x95, 0x29, 0x36, 0x25, 0x60, 0x73,
+    0xf3, 0x71, 0x2e, 0xec, 0xd3, 0xb6, 0x2e, 0xb7, 0xb0, 0x6f, 0x8e, 0x92, 0x09, 0x64, 0x01, 0x32,
+    0xf7, 0xa9, 0x59, 0x5e, 0x27, 0x22, 0x03, 0x3e, 0x28, 0x09, 0xfb, 0x90, 0xf8, 0xba, 0x94, 0x20,
+    0xf5, 0xec, 0x09, 0xd2, 0xc2, 0x57, 0xe3, 0xbd, 0x3a, 0x85, 0x99, 0xdb, 0x30, 0x22, 0xd8, 0xce,
+    0x6c, 0x70, 0x22, 0x06, 0xa5, 0x9d, 0x11, 0x56, 0xe6, 0xa2, 0x58, 0xd3, 0xbf, 0x24, 0x98, 0xd8,
+    0xce, 0xba, 0x6a, 0xe1, 0x44, 0xbd, 0x43, 0x67, 0xf0, 0xbd, 0xe4, 0x2a, 0xee, 0x0e, 0x4c, 0x57,
+    0xb1, 0xb8, 0xb3, 0x99, 0x4b, 0xaa, 0xf6, 0x82, 0xa2, 0xf6, 0x65, 0x9b, 0xd5, 0x66, 0x8d, 0x8d,
+    0x2f, 0xfa, 0xd0, 0x43, 0xa1, 0x8d, 0xcc, 0xc1, 0xfa, 0x60, 0xc7, 0x74, 0x2b, 0x6b, 0x4c, 0xf7,
+    0x70, 0x7d, 0x6a, 0xb8, 0xd8, 0x50, 0xdd, 0xdc, 0x28, 0x5c, 0xc6, 0x71, 0xf6, 0xa0, 0x3a, 0x82,
+    0x29, 0x47, 0xf0, 0xa5, 0xe0, 0x2e, 0xd3, 0xa2, 0xaa, 0x7a, 0x80, 0xa1, 0x11, 0x70, 0x31, 0xfb,
+    0xad, 0x66, 0xf5, 0x8b, 0x3d, 0xf7, 0x46, 0x4a, 0x50, 0x9d, 0xbf, 0xc0, 0xe9, 0x14, 0xc4, 0x2d,
+    0xeb, 0x64, 0x45, 0x81, 0x73, 0x61, 0xc6, 0xd3, 0x20, 0xb6, 0x8a, 0x96, 0x22, 0x59, 0x25, 0x1f,
+    0x76, 0x2b, 0xce, 0x7f, 0x88, 0xc1, 0x85, 0x21, 0x6f, 0x63, 0x30, 0x2c, 0xb8, 0x29, 0x0b, 0xdd,
+    0x6e, 0xc3, 0xfe, 0x8c, 0x61, 0xf9, 0x52, 0x5d, 0x8c, 0x54, 0xae, 0x7c, 0x48, 0xcc, 0x88, 0x4d,
+    0x4b, 0x3b, 0x3e, 0x42, 0xb5, 0xc6, 0xf6, 0xc5, 0x07, 0xf5, 0xbb, 0x1f, 0x55, 0x5a, 0xf2, 0x53,
+    0x67, 0xec, 0x87, 0xe3, 0x0e, 0xdb, 0xee, 0xfc, 0x8e, 0xd1, 0xdf, 0xdd, 0x6a, 0x0b, 0xc8, 0xa8,
+    0x4e, 0x02, 0x7c, 0x7c, 0x7b, 0x91, 0x33, 0xd9, 0x4d, 0xe7, 0xf1, 0x5d, 0x8d, 0x9b, 0xf5, 0x53,
+    0xa7, 0xdf, 0x55, 0xc0, 0x9d, 0x05, 0x4d, 0x53, 0x7f, 0x46, 0xf5, 0x40, 0xb2, 0xb2, 0x62, 0xed,
+    0x91, 0xf6, 0x35, 0xdf, 0xc4, 0x3e, 0x4e, 0x25, 0xf3, 0xc4, 0xb6, 0x29, 0x32, 0x76, 0x43, 0x81,
+    0xe0, 0x4b, 0x6d, 0x26, 0xc9, 0x5e, 0xdb, 0xc5, 0xab, 0x21, 0x58, 0x7b, 0xbd, 0x14, 0xb1, 0xa6,
+    0x6c, 0xce, 0x1f, 0x81, 0xe4, 0xac, 0xa4, 0x63, 0xcc, 0x54, 0x6a, 0x4f, 0xba, 0x64, 0xbc, 0x76,
+    0x6e, 0xcf, 0xf0, 0xd0, 0x06, 0xa5, 0x4d, 0xfd, 0x41, 0xa9, 0x66, 0xcb, 0xc1, 0x28, 0x8b, 0xa5,
+    0x91, 0x1c, 0xaf, 0x14, 0xce, 0x0c, 0x72, 0x71, 0x55, 0x4a, 0xdb, 0x4c, 0xf3, 0xe3, 0x34, 0xdd,
+    0xe0, 0x30, 0x9d, 0x3f, 0x65, 0x73, 0x30, 0x5d, 0x06, 0xb8, 0x35, 0x78, 0x98, 0x8a, 0x62, 0x3b,
+    0xbd, 0x4c, 0x40, 0xd9, 0xb8, 0x67, 0x80, 0x42, 0xb2, 0x62, 0x65, 0xc3, 0x5d, 0x11, 0xb3, 0x24,
+    0xc6, 0x19, 0xed, 0xec, 0xee, 0x63, 0x01, 0xa0, 0xba, 0xbd, 0xbe, 0x85, 0x1f, 0x28, 0x29, 0xdc,
+    0xc6, 0xde, 0x2b, 0x54, 0x8b, 0xbd, 0x4f, 0x61, 0x2b, 0x93, 0x78, 0x61, 0x2d, 0x15, 0xb0, 0x16,
+    0x0a, 0x28, 0x0b, 0x1c, 0xce, 0x8f, 0x56, 0x73, 0xa0, 0x71, 0x60, 0x4d, 0xcd, 0x82, 0x82, 0xa7,
+    0xff, 0x30, 0xa6, 0xbc, 0xa7, 0xe9, 0x12, 0x38, 0x82, 0xce, 0xf7, 0x4b, 0x9a, 0xc2, 0x02, 0xb6,
+    0x0d, 0x6f, 0x16, 0x74, 0x12, 0xf8, 0xa4, 0xa3, 0x14, 0x14, 0x1e, 0xec, 0x1f, 0x62, 0xc9, 0x24,
+    0x1f, 0x50, 0xa9, 0xf2, 0xb0, 0x14, 0x7c, 0xab, 0x7c, 0xe0, 0x4d, 0xb4, 0xdd, 0xd5, 0x75, 0xfe,
+    0xab, 0x25, 0xaf, 0x59, 0xb7, 0x2a, 0xab, 0xfd, 0x28, 0xb5, 0x6b, 0xeb, 0x7a, 0x51, 0x9b, 0x99,
+    0x55, 0x10, 0x35, 0x5e, 0x3d, 0xb8, 0xed, 0xe5, 0xf6, 0x96, 0x98, 0xc2, 0x1e, 0x57, 0x78, 0xe5,
+    0xb6, 0xe5, 0x2d, 0xbc, 0x4d, 0x7b, 0xb7, 0x67, 0x6e, 0x36, 0x19, 0xbf, 0x25, 0xce, 0x59, 0x1f,
+    0xd8, 0xec, 0xaa, 0x1b, 0x87, 0x4c, 0x5e, 0x2d, 0x92, 0x33, 0x3c, 0xec, 0x2b, 0x92, 0x63, 0xa9,
+    0x6e, 0x2b, 0x6d, 0x48, 0x15, 0x0e, 0x8a, 0x36, 0x46, 0x9d, 0xb3, 0x96, 0x2d, 0x46, 0x1b, 0x47,
+    0x94, 0x4d, 0x90, 0x06, 0xad, 0x36, 0xe3, 0x42, 0x8d, 0x20, 0x28, 0xa1, 0x9b, 0x6d, 0x16, 0x92,
+    0xf8, 0xee, 0x64, 0x33, 0x9a, 0x8c, 0x98, 0xc4, 0x9a, 0xc2, 0xb6, 0xa7, 0xb1, 0xb7, 0xb4, 0x23,
+    0xef, 0x7c, 0x34, 0x8e, 0xb8, 0xf4, 0x3d, 0xb0, 0xde, 0x66, 0x29, 0x11, 0x39, 0xcc, 0x67, 0xd9,
+    0x7e, 0x87, 0x6b, 0x20, 0x13, 0x8e, 0x1c, 0xa5, 0x83, 0x1e, 0xdd, 0xf2, 0x01, 0xf8, 0xf6, 0x75,
+    0x74, 0xea, 0x6e, 0xee, 0xa6, 0x99, 0xbf, 0x35, 0x3e, 0xd1, 0x9a, 0x58, 0x8d, 0xf7, 0x1f, 0x44,
+    0xcb, 0x55, 0x66, 0x96, 0x52, 0xb0, 0x44, 0xa6, 0xb9, 0x89, 0xae, 0xae, 0xfc, 0xcd, 0xc3, 0xea,
+    0xfe, 0x36, 0x5b, 0xbf, 0x4d, 0xf6, 0x4d, 0x1b, 0x56, 0x51, 0x34, 0xc8, 0x1a, 0x6c, 0x92, 0x2c,
+    0x2d, 0x25, 0x12, 0x15, 0x2e, 0x1e, 0x4f, 0xe3, 0xf1, 0x4a, 0x5a, 0xc1, 0x78, 0x95, 0xa1, 0xd7,
+    0x62, 0xc9, 0xfe, 0x6e, 0x49, 0xb4, 0x99, 0x34, 0x50, 0x3b, 0x3e, 0x06, 0x16, 0x8e, 0x3e, 0x05,
+    0x19, 0x5c, 0x46, 0xac, 0xae, 0x15, 0xb7, 0xe2, 0x58, 0xb6, 0xbb, 0x57, 0x01, 0x08, 0xe4, 0xe9,
+    0x80, 0x92, 0x6c, 0xc3, 0x61, 0xc8, 0x93, 0x0e, 0x86, 0x16, 0xcc, 0xc1, 0x81, 0x5d, 0x13, 0xe6,
+    0xd5, 0x87, 0x96, 0x1c, 0x4d, 0xc3, 0x9c, 0xff, 0xc0, 0x16, 0xf5, 0x1e, 0x4a, 0x8a, 0x30, 0x97,
+    0x9b, 0xfa, 0xb7, 0xb4, 0xc7, 0xbf, 0xa2, 0x0b, 0x6d, 0x4b, 0xd3, 0x3f, 0x5a, 0x9e, 0x9b, 0xd1,
+    0x74, 0x58, 0x8e, 0xfe, 0x36, 0xcc, 0xfe, 0xf7, 0xff, 0x9a, 0x74, 0x7f, 0x83, 0x2c, 0x3d, 0x32,
+    0xf3, 0x21, 0x39, 0x7a, 0x15, 0x4f, 0xb3, 0x3c, 0x90, 0x75, 0x8b, 0xb3, 0x2a, 0x0f, 0x2f, 0xd1,
+    0x2b, 0x13, 0xdd, 0x44, 0xcd, 0xd7, 0x6f, 0xac, 0x6e, 0x54, 0x34, 0x2d, 0x29, 0xd8, 0x6e, 0x80,
+    0xb6, 0x4d, 0x8d, 0x46, 0xe5, 0x02, 0x4d, 0xb8, 0xf3, 0x80, 0xb8, 0x77, 0x9c, 0x50, 0x1a, 0x3d,
+    0x20, 0xf0, 0x75, 0x52, 0x86, 0xa1, 0x2e, 0xa3, 0x52, 0x79, 0xbc, 0x4b, 0xb3, 0xad, 0xf6, 0x5d,
+    0x86, 0x06, 0x67, 0xdb, 0x1e, 0x4d, 0xcd, 0xf3, 0x44, 0xc6, 0x11, 0xfc, 0x94, 0xf5, 0x4c, 0x58,
+    0x4a, 0x56, 0xce, 0xc9, 0x6a, 0x57, 0x7b, 0xe4, 0x36, 0x48, 0x83, 0x51, 0x10, 0x6a, 0x77, 0xb5,
+    0xb0, 0x5e, 0x70, 0xc7, 0xe5, 0x9b, 0x2b, 0xa6, 0xc9, 0x15, 0x6c, 0x28, 0xb0, 0xe8, 0xbb, 0x30,
+    0x12, 0x87, 0x20, 0xb6, 0x26, 0x65, 0xa8, 0xf5, 0xb8, 0x64, 0x6b, 0x82, 0x9e, 0x54, 0xde, 0x2f,
+    0xe5, 0x00, 0xf6, 0x4b, 0x76, 0x6b, 0xb8, 0xc1, 0x62, 0xdf, 0xec, 0x8c, 0x4f, 0xf9, 0x54, 0x18,
+    0xaf, 0x52, 0x29, 0xce, 0x87, 0x99, 0xc1, 0xbf, 0x67, 0x0f, 0xfd, 0xf3, 0xc1, 0xd9, 0x6b, 0xe2,
+    0x1f, 0xa5, 0xb6, 0x6c, 0xc3, 0x13, 0x24, 0x03, 0xb1, 0x18, 0xd9, 0xb3, 0x12, 0x78, 0x0c, 0xc0,
+    0x92, 0x8d, 0xe0, 0xb9, 0x08, 0xe1, 0x76, 0xf3, 0xd3, 0x06, 0x35, 0x39, 0x0b, 0xe6, 0x52, 0x3f,
+    0xdf, 0x11, 0x07, 0xf0, 0xd9, 0x61, 0x7c, 0x60, 0xce, 0x27, 0x4c, 0x2d, 0x9d, 0xb6, 0xb0, 0xee,
+    0xa2, 0x45, 0xe6, 0x09, 0x9d, 0x9e, 0xb6, 0x26, 0x7e, 0xe6, 0x1f, 0xf7, 0xf0, 0x2d, 0x04, 0x3b,
+    0xfc, 0x35, 0x04, 0xcf, 0xf1, 0x28, 0xa6, 0x68, 0xf2, 0xd4, 0x71, 0x0c, 0x6d, 0x27, 0x8e, 0x23,
+    0x9e, 0x4d, 0x82, 0x5b, 0x32, 0x06, 0x47, 0x2b, 0x3d, 0x6d, 0x19, 0xea, 0xcc, 0xe5, 0xb0, 0x45,
+    0x82, 0x89, 0xf9, 0x48, 0xbc, 0x45, 0xa0, 0xaa, 0xbd, 0x10, 0x56, 0x05, 0xaa, 0xb2, 0x27, 0x2e,
+    0xa8, 0xad, 0xb3, 0xe7, 0x3b, 0xf0, 0x74, 0x3d, 0x3c, 0x4e, 0x50, 0xeb, 0x4c, 0x0e, 0x45, 0x7d,
+    0x7d, 0x81, 0xeb, 0xba, 0x06, 0x0e, 0xe5, 0x52, 0x7c, 0x2d, 0x0d, 0x38, 0xcf, 0x2d, 0xf0, 0x41,
+    0x2e, 0xe0, 0xbb, 0xa3, 0xdc, 0x63, 0x5c, 0x07, 0xd6, 0x6a, 0xc6, 0x45, 0x1d, 0xbb, 0x48, 0x34,
+    0x08, 0x6c, 0xfc, 0xaa, 0x76, 0xd4, 0xb3, 0xd8, 0x78, 0x6c, 0x03, 0x61, 0xf5, 0x34, 0x16, 0x38,
+    0xfe, 0x2a, 0x06, 0x88, 0xcb, 0xf0, 0xb5, 0x11, 0x30, 0xe4, 0xd3, 0x16, 0xab, 0xf9, 0x1a, 0xc2,
+    0xbf, 0x16, 0xc1, 0x5d, 0xcf, 0xd3, 0x16, 0xfa, 0x1d, 0x48, 0x77, 0x12, 0x7f, 0x02, 0xc2, 0xc1,
+    0x6d, 0xc0, 0x34, 0x1d, 0x3b, 0x0e, 0x2f, 0xef, 0xf2, 0x50, 0xf9, 0xb4, 0x35, 0xa8, 0xe8, 0x80,
+    0x75, 0xb2, 0xf4, 0xb3, 0x39, 0x01, 0x86, 0x5c, 0x79, 0x03, 0x32, 0x78, 0x33, 0x20, 0x07, 0xa1,
+    0xd7, 0x27, 0x7b, 0x20, 0xad, 0xce, 0x9e, 0x83, 0xbf, 0x7e, 0xbb, 0x1a, 0x10, 0x4f, 0xb9, 0x89,
+    0x97, 0x83, 0xe2, 0xb2, 0xb5, 0x53, 0x41, 0xfc, 0x0e, 0x50, 0x6f, 0x19, 0x7f, 0x79, 0xee, 0xad,
+    0x6c, 0xe1, 0x93, 0x6f, 0xc7, 0x3c, 0xf7, 0xf8, 0xcb, 0x2c, 0x40, 0xfa, 0xbd, 0x2a, 0xce, 0x61,
+    0x4a, 0x44, 0xe0, 0x93, 0x87, 0xce, 0x5a, 0x67, 0x20, 0x3d, 0x04, 0xdf, 0x50, 0x91, 0x1f, 0x6e,
+    0x01, 0x22, 0x01, 0xb0, 0x11, 0x95, 0x6b, 0x84, 0xd6, 0x3c, 0x40, 0x66, 0x9b, 0x7a, 0x8d, 0xa8,
+    0xe2, 0x44, 0x16, 0x3f, 0x02, 0x85, 0x6a, 0x51, 0x41, 0x8c, 0xa5, 0x1d, 0x67, 0xcf, 0x0d, 0x3b,
+    0x20, 0x4e, 0xae, 0x19, 0x02, 0x5b, 0xf3, 0x92, 0x96, 0x70, 0xb1, 0x15, 0xda, 0xc1, 0x5f, 0x2b,
+    0x02, 0xf2, 0x2f, 0x91, 0xe7, 0xc9, 0x2a, 0x53, 0xae, 0x53, 0x1e, 0xec, 0xe6, 0xaa, 0x84, 0x91,
+    0xbb, 0xa0, 0x64, 0x5c, 0x06, 0x2f, 0x69, 0x5e, 0x71, 0x78, 0xa0, 0x72, 0x4a, 0x07, 0x72, 0x30,
+    0xbc, 0x44, 0x02, 0x28, 0x1d, 0x34, 0x98, 0x5a, 0x7e, 0x4c, 0x80, 0xd7, 0x04, 0xb4, 0xce, 0xce,
+    0xd9, 0xe7, 0x06, 0x73, 0x5a, 0x31, 0x89, 0x98, 0x96, 0xa9, 0x22, 0xd4, 0x32, 0xe5, 0x40, 0x75,
+    0x9d, 0x7e, 0xa9, 0xf4, 0xb2, 0x5c, 0x40, 0xeb, 0xec, 0xe3, 0x32, 0x0b, 0x16, 0x95, 0x84, 0x5a,
+    0x5b, 0xb2, 0xca, 0x6b, 0x6e, 0xb9, 0x56, 0xac, 0x75, 0xeb, 0xcc, 0x71, 0x8e, 0xd9, 0xbf, 0x3a,
+    0x3c, 0x15, 0x83, 0x7e, 0xbc, 0xa1, 0xbc, 0x7e, 0x47, 0xce, 0x27, 0x93, 0x84, 0xa6, 0xe9, 0xb6,
+    0xc3, 0x09, 0x96, 0x8e, 0xcf, 0x31, 0xb4, 0xce, 0xbc, 0xa3, 0x81, 0xeb, 0xed, 0x1f, 0xba, 0x43,
+    0xd7, 0xfb, 0x4b, 0x47, 0xf5, 0x22, 0xc4, 0x23, 0xff, 0x5b, 0x0f, 0x69, 0xcc, 0x9b, 0xb7, 0xce,
+    0xfa, 0x7f, 0xe9, 0x28, 0xde, 0x9f, 0x5f, 0x6d, 0x3b, 0x82, 0x05, 0x5d, 0xc4, 0xc9, 0x3d, 0xca,
+    0xd8, 0x46, 0x18, 0x78, 0xc5, 0xa7, 0x8a, 0x42, 0x14, 0x81, 0x56, 0x5b, 0xb7, 0x3f, 0x85, 0x13,
+    0x97, 0x70, 0x35, 0xdf, 0x96, 0x17, 0x53, 0x6c, 0xbc, 0x8e, 0x15, 0x7f, 0xbc, 0xa2, 0x61, 0x7a,
+    0x67, 0x7b, 0x25, 0x63, 0xad, 0xb7, 0x1c, 0x84, 0x75, 0x35, 0x14, 0x4b, 0x82, 0xb2, 0x94, 0x54,
+    0xae, 0x14, 0xf9, 0x51, 0x84, 0x47, 0x5b, 0x2b, 0xde, 0xbc, 0x7a, 0x29, 0x4f, 0x48, 0xd8, 0x57,
+    0x8a, 0x06, 0xc6, 0x5e, 0x3b, 0x20, 0xd1, 0xc0, 0xdc, 0xab, 0x99, 0x7f, 0xe1, 0x27, 0xd3, 0x89,
+    0x23, 0xee, 0xd6, 0x4d, 0xa6, 0x0d, 0x47, 0x34, 0x8d, 0x6b, 0x9a, 0x54, 0x36, 0xc3, 0xda, 0x6b,
+    0xec, 0xb5, 0xc6, 0x69, 0xfc, 0xd3, 0x1d, 0x48, 0xbb, 0x33, 0x79, 0x44, 0xbc, 0xc3, 0xf9, 0xfe,
+    0x15, 0xb8, 0x89, 0x83, 0xc1, 0x7c, 0xc8, 0x7c, 0xcb, 0x5b, 0xef, 0x6a, 0xe8, 0x1e, 0xed, 0x12,
+    0xfc, 0x15, 0xba, 0x07, 0x1e, 0xfc, 0x63, 0xbe, 0xe4, 0x5c, 0xdc, 0xf7, 0x8e, 0xdc, 0xfe, 0x01,
+    0x3e, 0x70, 0xf0, 0x09, 0xbb, 0xe2, 0xb0, 0x8e, 0x04, 0x66, 0xd0, 0x8e, 0x7c, 0xc6, 0xe1, 0x1d,
+    0xd1, 0xa0, 0xca, 0x0f, 0xad, 0x25, 0x71, 0xe8, 0xef, 0x81, 0x1b, 0xdb, 0x27, 0x1e, 0xfc, 0xb7,
+    0x4f, 0xfa, 0xb7, 0x83, 0x1f, 0x8e, 0x6e, 0x9d, 0xc1, 0x6f, 0x4d, 0x70, 0x55, 0xf8, 0xb7, 0x0d,
+    0x6d, 0x42, 0xdd, 0x2c, 0x8b, 0xb2, 0xf9, 0x46, 0xf3, 0xab, 0x68, 0xbb, 0x5a, 0x52, 0xdf, 0x3a,
+    0xbb, 0x58, 0x05, 0x21, 0x66, 0x8b, 0x09, 0xa8, 0xca, 0x3a, 0xa3, 0x51, 0x8b, 0x8e, 0xd5, 0x84,
+    0x17, 0xf2, 0xce, 0x2f, 0xcf, 0xae, 0x2f, 0x2f, 0x9b, 0x60, 0x5d, 0xc3, 0x81, 0x75, 0x8f, 0x2d,
+    0xcc, 0x11, 0xf9, 0xe4, 0x75, 0xca, 0x23, 0x52, 0xde, 0xd2, 0x4d, 0xcc, 0x22, 0x52, 0xd4, 0x03,
+    0xb7, 0xc0, 0xe3, 0x86, 0x15, 0x7a, 0xfc, 0xe9, 0xb4, 0xc5, 0x6f, 0x00, 0x8b, 0x3a, 0xdd, 0x62,
+    0x88, 0x00, 0xd9, 0x94, 0xf7, 0x67, 0x1f, 0xae, 0xbf, 0xff, 0xfe, 0xcd, 0xab, 0x66, 0xac, 0xe0,
+    0x34, 0x3d, 0x0a, 0x37, 0x8a, 0xc2, 0xe1, 0x0d, 0xac, 0x88, 0x52, 0x32, 0xab, 0x0c, 0xd6, 0xb7,
+    0x07, 0xe4, 0x4d, 0xd7, 0xb6, 0x3f, 0x66, 0xc5, 0x28, 0xf6, 0xf6, 0x1e, 0x6d, 0xc9, 0x78, 0x1f,
+    0x67, 0xf8, 0x8a, 0xbf, 0x0f, 0xf8, 0x66, 0xc0, 0x62, 0x13, 0x72, 0xeb, 0xd5, 0x43, 0xdf, 0x7d,
+    0x6c, 0xb0, 0x7c, 0x28, 0x7b, 0x8b, 0x75, 0x8b, 0x05, 0xdf, 0x2d, 0xd4, 0xda, 0x70, 0x07, 0x00,
+    0x0f, 0xce, 0x63, 0x7a, 0x02, 0x93, 0x87, 0x68, 0xfc, 0x5f, 0x8a, 0x6f, 0xcf, 0x77, 0xd8, 0xf3,
+    0x1a, 0x94, 0x7c, 0x03, 0x30, 0xbb, 0x5f, 0x82, 0x91, 0x8f, 0x56, 0x8b, 0x91, 0xcc, 0x80, 0xe4,
+    0xb8, 0xf4, 0xee, 0x18, 0x78, 0x0b, 0x4b, 0x8a, 0x4f, 0x5b, 0x5e, 0x0b, 0x5f, 0xfe, 0x74, 0xda,
+    0xc2, 0x04, 0x69, 0x8b, 0x30, 0x7f, 0xe2, 0xb4, 0xb5, 0xbb, 0xdf, 0x6f, 0x91, 0x65, 0xe8, 0x8f,
+    0xe9, 0x3c, 0x0e, 0x81, 0xe9, 0xfc, 0x4e, 0x43, 0x9f, 0xa4, 0xd8, 0x5c, 0x6a, 0x9d, 0xbd, 0x65,
+    0xc4, 0x90, 0x78, 0x4a, 0x24, 0x29, 0x29, 0xe9, 0x78, 0x0e, 0x76, 0xd6, 0x7d, 0x04, 0x5f, 0xeb,
+    0x71, 0x38, 0x9e, 0x60, 0xba, 0xb2, 0x75, 0xf6, 0x3d, 0xe6, 0x28, 0xdf, 0xe3, 0x77, 0x20, 0xf1,
+    0xf8, 0xa7, 0xee, 0xf6, 0x6c, 0xe7, 0x08, 0x9b, 0xf2, 0x1c, 0x62, 0xe2, 0x25, 0x2c, 0xdd, 0x6e,
+    0xbf, 0xef, 0xe5, 0x13, 0x70, 0x64, 0xf2, 0xff, 0x68, 0x2b, 0xf6, 0x73, 0x55, 0xc8, 0x62, 0x32,
+    0xc3, 0xb1, 0x31, 0xb2, 0x1e, 0x8d, 0xeb, 0xeb, 0xcd, 0x74, 0x85, 0x89, 0xc6, 0x1d, 0x25, 0xc5,
+    0x40, 0xe3, 0x65, 0xae, 0xac, 0x29, 0x58, 0xe9, 0x35, 0xe6, 0xee, 0xf1, 0x1c, 0x1e, 0x22, 0xbe,
+    0x79, 0xfb, 0x2d, 0x91, 0x43, 0x67, 0xdf, 0x1b, 0x2c, 0x0c, 0x45, 0x42, 0xed, 0x88, 0x0c, 0xbc,
+    0x1f, 0xf6, 0x7c, 0xf0, 0x7d, 0x58, 0xa9, 0x9d, 0xe7, 0x0c, 0x9c, 0xc1, 0x8f, 0xca, 0x35, 0x81,
+    0xeb, 0xb9, 0xe7, 0x85, 0xe0, 0x84, 0xdc, 0x7a, 0x9e, 0x0a, 0x47, 0x1a, 0x3a, 0x21, 0xcb, 0x38,
+    0xbc, 0x67, 0x2f, 0xd0, 0x61, 0xbb, 0x85, 0xc0, 0x47, 0xef, 0x00, 0xfa, 0x24, 0xf0, 0xdb, 0xdb,
+    0x25, 0xe2, 0xd7, 0xc0, 0xdb, 0x0e, 0xd5, 0x01, 0xc1, 0xd6, 0x87, 0xc4, 0xdb, 0x23, 0x87, 0xeb,
+    0x30, 0x34, 0xf1, 0x86, 0x98, 0x68, 0xdd, 0x9c, 0xff, 0xb8, 0x76, 0xb9, 0x6c, 0xb0, 0x54, 0xda,
+    0x85, 0x07, 0x33, 0xc7, 0x8a, 0xf0, 0xe0, 0xe5, 0xff, 0x5b, 0xe1, 0xc1, 0x59, 0xdc, 0xbb, 0x1d,
+    0xea, 0x42, 0x61, 0x0a, 0xd3, 0xad, 0x33, 0xdc, 0x76, 0x6e, 0xc1, 0x33, 0x07, 0xa7, 0x1c, 0xe6,
+    0x16, 0x65, 0xa5, 0xdf, 0x08, 0x0b, 0xc3, 0xf0, 0xd9, 0x83, 0xa1, 0xc0, 0x08, 0xef, 0xf1, 0x73,
+    0xaf, 0x45, 0x3e, 0x0f, 0xc4, 0x35, 0x7c, 0xee, 0x3e, 0x9a, 0x98, 0xbc, 0xb9, 0x3e, 0x7f, 0xf9,
+    0x30, 0x31, 0xf9, 0x83, 0x3c, 0x13, 0xb5, 0x1e, 0xef, 0x51, 0xfc, 0x92, 0xff, 0x5a, 0x81, 0xac,
+    0xca, 0xa3, 0x47, 0x5b, 0xbb, 0x23, 0x6a, 0x81, 0x59, 0x55, 0x67, 0xba, 0xce, 0x14, 0xe5, 0x5f,
+    0x8a, 0xc6, 0xf8, 0x61, 0x78, 0x1d, 0xd5, 0x2a, 0xca, 0x9f, 0x16, 0x52, 0x2a, 0x66, 0xf4, 0xd0,
+    0xdd, 0xdd, 0x27, 0xfb, 0xee, 0xfe, 0xd0, 0x3f, 0x22, 0x47, 0x3c, 0x5a, 0x73, 0xbc, 0x81, 0x7b,
+    0xb0, 0x4b, 0xfa, 0x22, 0xb0, 0xac, 0x95, 0xdf, 0x35, 0x42, 0xc7, 0x05, 0xee, 0x3c, 0x0c, 0xc9,
+    0xf5, 0xdb, 0xfa, 0xf5, 0xaf, 0x56, 0xdc, 0x1a, 0x72, 0x77, 0x3a, 0xfd, 0x37, 0x61, 0xef, 0x38,
+    0x48, 0xc6, 0xb0, 0xfc, 0x8f, 0x3f, 0x73, 0xf5, 0x1d, 0xdf, 0xf3, 0x4f, 0xf0, 0x26, 0xd6, 0x5b,
+    0x83, 0x62, 0x6e, 0x8a, 0x80, 0xde, 0x1b, 0xba, 0xde, 0x90, 0xb0, 0xdf, 0x8f, 0x33, 0x19, 0xf5,
+    0x11, 0xe6, 0xc3, 0x67, 0x23, 0xa1, 0xd3, 0x84, 0xa6, 0x73, 0xbe, 0xdf, 0xf0, 0xef, 0x26, 0xf3,
+    0x03, 0xe0, 0xea, 0xed, 0xfe, 0xdc, 0xd9, 0xbf, 0x02, 0x27, 0xa1, 0x7f, 0xeb, 0xec, 0xcf, 0xf7,
+    0x9b, 0x4f, 0xca, 0xae, 0xbb, 0xe7, 0x91, 0x23, 0xa1, 0x2c, 0x4c, 0x5d, 0x86, 0xee, 0xe1, 0x9e,
+    0xb3, 0x0b, 0x6a, 0xf4, 0x06, 0x10, 0x7b, 0xa0, 0x35, 0x70, 0x2b, 0x1c, 0x82, 0x46, 0xc1, 0xdc,
+    0xed, 0xee, 0x9f, 0x4b, 0x48, 0x7c, 0xa9, 0x84, 0x3b, 0x3c, 0x82, 0x55, 0xe1, 0xc1, 0x53, 0xf8,
+    0x9e, 0x73, 0x77, 0xbb, 0x29, 0xac, 0x37, 0xd2, 0xc5, 0x2d, 0xdc, 0xbb, 0x52, 0xf7, 0xb2, 0xc4,
+    0x29, 0x25, 0x31, 0xeb, 0xfc, 0xca, 0xdc, 0xca, 0x5a, 0x9e, 0x7d, 0x3b, 0x8e, 0x97, 0xf7, 0x27,
+    0x30, 0x54, 0x98, 0x45, 0xed, 0xa5, 0xf8, 0xca, 0x8b, 0xeb, 0xe5, 0xfb, 0xf1, 0xf9, 0xa6, 0xd4,
+    0xf3, 0x9d, 0xa5, 0x89, 0x25, 0xcf, 0xb1, 0xf2, 0x03, 0x51, 0xad, 0xb3, 0x1f, 0xc5, 0xc9, 0x28,
+    0xcf, 0x05, 0x67, 0x5d, 0x6b, 0xf0, 0x7c, 0x87, 0x53, 0x52, 0xbf, 0x3d, 0xcd, 0xce, 0xc4, 0xf0,
+    0x08, 0x81, 0x7f, 0x55, 0x10, 0xa8, 0x1e, 0xbc, 0x76, 0x76, 0x46, 0x81, 0xcf, 0x6f, 0x69, 0x99,
+    0x76, 0xad, 0xb7, 0x74, 0x9c, 0x04, 0xcb, 0x8c, 0xbd, 0xda, 0xff, 0xd9, 0x13, 0xf2, 0xac, 0xfe,
+    0x7d, 0xfd, 0x9c, 0x01, 0x21, 0xbe, 0x41, 0xf8, 0x19, 0xf9, 0x87, 0x7f, 0xeb, 0xdf, 0xb0, 0xd6,
+    0x18, 0x14, 0x91, 0x57, 0x37, 0xef, 0x76, 0x07, 0xe4, 0x9f, 0x74, 0x04, 0x6d, 0x61, 0x60, 0x53,
+    0x08, 0x45, 0x9e, 0xf0, 0x37, 0xf0, 0xef, 0x60, 0xc3, 0x69, 0x30, 0x5b, 0x25, 0xfc, 0xc0, 0xd6,
+    0x18, 0x16, 0xa5, 0x8c, 0xbc, 0xb8, 0x7e, 0x7b, 0xf9, 0xfa, 0x7b, 0x72, 0x2a, 0x8a, 0x25, 0x84,
+    0xe6, 0xb1, 0xb6, 0xb7, 0xf8, 0x2a, 0xf1, 0xbd, 0x7e, 0xbf, 0xdf, 0x13, 0xa5, 0x43, 0x30, 0x94,
+    0x97, 0xa2, 0x35, 0x16, 0x25, 0xca, 0x07, 0x09, 0xfd, 0xd7, 0x8a, 0xa6, 0xd9, 0x87, 0x60, 0x41,
+    0xe3, 0x15, 0x3f, 0x01, 0xd4, 0x7f, 0xf2, 0xf5, 0x84, 0x75, 0xc9, 0xce, 0xf2, 0x90, 0x2b, 0x3f,
+    0x82, 0xe1, 0x2f, 0x40, 0xf7, 0x9e, 0x84, 0x34, 0x23, 0xfc, 0x5d, 0x06, 0xb2, 0xcb, 0x10, 0xdf,
+    0xf6, 0x3e, 0xf5, 0xc3, 0x94, 0x72, 0x74, 0x7c, 0x0f, 0xed, 0x98, 0x08, 0xec, 0x62, 0xc3, 0x26,
+    0xbf, 0x06, 0xfa, 0xe8, 0x0f, 0x14, 0xab, 0x00, 0x73, 0xba, 0x32, 0x3f, 0xd4, 0xee, 0xc0, 0xc2,
+    0xbe, 0xbc, 0x0a, 0xa2, 0x4b, 0x80, 0xd4, 0xee, 0xbd, 0xf1, 0x93, 0x19, 0x65, 0x2f, 0x51, 0x2f,
+    0xee, 0x5d, 0x26, 0xfe, 0xac, 0xc0, 0x8d, 0xdb, 0x09, 0x37, 0xbc, 0x1c, 0x90, 0xdf, 0x49, 0x3f,
+    0xd1, 0x6c, 0xac, 0xdf, 0xe2, 0xf9, 0xfa, 0x82, 0xbe, 0xb9, 0x1f, 0x45, 0x34, 0x84, 0x1b, 0x3f,
+    0xff, 0xd2, 0x13, 0x45, 0x50, 0x3c, 0x62, 0x06, 0x1e, 0xed, 0x4b, 0x16, 0x21, 0xd3, 0x8e, 0xc9,
+    0x11, 0xe7, 0x0b, 0xf2, 0x80, 0x8f, 0x52, 0xf2, 0x19, 0x98, 0x11, 0xad, 0xc2, 0xf0, 0x84, 0x3d,
+    0x02, 0x8f, 0x30, 0xb4, 0x3e, 0x60, 0x27, 0x96, 0x6e, 0xe2, 0x55, 0x32, 0xa6, 0xf9, 0x7d, 0x64,
+    0xf2, 0xcb, 0xeb, 0x2b, 0xf2, 0x2a, 0x64, 0xfc, 0x4d, 0xc5, 0xb4, 0x52, 0x71, 0x59, 0x70, 0x99,
+    0xd7, 0x6a, 0xf0, 0xaa, 0x93, 0x63, 0x32, 0x89, 0xc7, 0x2b, 0x04, 0x70, 0x67, 0x34, 0x13, 0x4d,
+    0x2f, 0xee, 0x5f, 0x4f, 0x3a, 0x6d, 0xbd, 0xc0, 0xa4, 0xdd, 0xed, 0x89, 0xca, 0xa1, 0x20, 0xca,
+    0xdf, 0x5b, 0x5d, 0xd3, 0x5a, 0xaf, 0xdc, 0x90, 0xad, 0xd9, 0x0c, 0x17, 0x45, 0xec, 0x22, 0x5f,
+    0x58, 0x47, 0x44, 0x91, 0xbd, 0x97, 0x38, 0xd8, 0x64, 0xa0, 0xdc, 0xac, 0x69, 0xc6, 0x60, 0xd4,
+    0x46, 0x23, 0x3f, 0x59, 0xd3, 0x04, 0x20, 0xda, 0x5d, 0x5e, 0x37, 0xaf, 0x4b, 0x60, 0x65, 0x2b,
+    0x0e, 0x20, 0x7b, 0xc9, 0x25, 0xb4, 0x12, 0x5e, 0x40, 0xe4, 0xdc, 0x64, 0xdb, 0x6f, 0x75, 0x6c,
+    0x64, 0x00, 0x3a, 0xf8, 0x4b, 0x96, 0x7a, 0x5e, 0xdb, 0x48, 0xa4, 0xa8, 0x65, 0x5b, 0x26, 0xd1,
+    0x35, 0x8d, 0xd8, 0x73, 0x09, 0x2c, 0x25, 0xbb, 0x12, 0x9a, 0x03, 0x48, 0xf0, 0x42, 0xce, 0x2b,
+    0x1b, 0x48, 0x10, 0xd9, 0x44, 0xe8, 0x41, 0x25, 0x3c, 0x7b, 0x2e, 0x81, 0x59, 0xba, 0x82, 0xfb,
+    0x00, 0x35, 0x4d, 0x78, 0x52, 0x83, 0x27, 0x50, 0x65, 0x4b, 0x66, 0xaa, 0x6a, 0xda, 0xb0, 0xe7,
+    0x1a, 0xf0, 0x15, 0xb7, 0xd0, 0xeb, 0xda, 0x48, 0x4b, 0x0e, 0xf2, 0x22, 0x0c, 0xdc, 0x26, 0xb5,
+    0x9e, 0x00, 0xae, 0xec, 0x8e, 0x91, 0xcb, 0x55, 0xc4, 0x43, 0x83, 0x4d, 0xf1, 0x3c, 0x99, 0x8a,
+    0x96, 0x44, 0x49, 0x92, 0x17, 0xc7, 0x15, 0x41, 0xfd, 0x85, 0xa7, 0x73, 0x23, 0x0c, 0x2d, 0x53,
+    0x0a, 0x37, 0x94, 0x45, 0xa0, 0x1c, 0x86, 0x7b, 0x5e, 0xf0, 0x54, 0x03, 0xfe, 0x3b, 0x69, 0xc7,
+    0xd3, 0x69, 0x9b, 0x1c, 0xc3, 0x67, 0xd4, 0x56, 0xe1, 0x57, 0x09, 0x5a, 0xa3, 0xf6, 0x0e, 0xf4,
+    0xb6, 0xd3, 0x26, 0xdf, 0x89, 0xf6, 0x1c, 0x42, 0x9a, 0x1b, 0xec, 0x43, 0x9e, 0xc3, 0x71, 0xd9,
+    0xaa, 0xf8, 0x26, 0x48, 0x33, 0xd7, 0x9f, 0x14, 0x96, 0xa5, 0xad, 0xfe, 0xd9, 0x8b, 0x94, 0x46,
+    0x93, 0xf7, 0x7c, 0xf9, 0xe8, 0x00, 0xfe, 0xae, 0x9b, 0xcd, 0x69, 0xd4, 0x81, 0xc1, 0x9c, 0x9e,
+    0x29, 0x06, 0x23, 0x27, 0x1f, 0xfa, 0x7f, 0xaa, 0x52, 0x5b, 0x9c, 0x81, 0x59, 0x2d, 0x27, 0x70,
+    0x2d, 0x38, 0xfb, 0xf1, 0x35, 0x53, 0xec, 0x76, 0x4f, 0x87, 0xee, 0x16, 0xe0, 0x78, 0x1c, 0x96,
+    0x9d, 0x61, 0xee, 0xb4, 0x71, 0x46, 0xb2, 0x55, 0x12, 0x01, 0xf6, 0x62, 0x54, 0x6e, 0x16, 0x7f,
+    0xc4, 0x9a, 0xc3, 0x17, 0x7e, 0x4a, 0x3b, 0xdd, 0x1e, 0x69, 0x8b, 0xd7, 0x16, 0x4b, 0xe2, 0xbf,
+    0x76, 0xdd, 0xb1, 0x0f, 0x0b, 0x43, 0x87, 0x26, 0x09, 0x2c, 0xba, 0x3a, 0xb5, 0x05, 0xee, 0x4b,
+    0xd0, 0x44, 0xc0, 0x9b, 0xc5, 0x62, 0xa2, 0x70, 0xfa, 0x8f, 0x59, 0x37, 0xac, 0x1d, 0xe0, 0x65,
+    0x9f, 0x0a, 0xd6, 0x69, 0x10, 0x41, 0x28, 0x72, 0x5f, 0x62, 0xc1, 0x1a, 0x06, 0x27, 0xa0, 0xfb,
+    0xb7, 0xb4, 0xc4, 0xe3, 0xaf, 0xa2, 0x24, 0x79, 0x63, 0x31, 0x55, 0x23, 0xdf, 0xc7, 0x90, 0x53,
+    0x11, 0xbc, 0x8a, 0x01, 0x29, 0x1c, 0xfa, 0xb0, 0x62, 0x7f, 0xf6, 0x86, 0x15, 0xce, 0x83, 0xf3,
+    0x80, 0xe6, 0x05, 0x62, 0x3d, 0xd7, 0x75, 0x61, 0xf2, 0xda, 0xb8, 0x15, 0x2b, 0x87, 0x82, 0x92,
+    0x72, 0xc1, 0x58, 0xfe, 0xf3, 0x17, 0x82, 0x15, 0xaf, 0x6d, 0x01, 0x0e, 0x80, 0x29, 0xc5, 0xe3,
+    0xb9, 0x80, 0xa2, 0x4d, 0xbe, 0xfe, 0xd2, 0x40, 0x86, 0xb2, 0x64, 0x55, 0x12, 0x1d, 0x88, 0x6b,
+    0x40, 0x6c, 0xec, 0x22, 0x72, 0xae, 0x11, 0xd7, 0xde, 0x5a, 0x1c, 0x5e, 0xe1, 0xd3, 0xda, 0xf9,
+    0x67, 0xd3, 0xa5, 0x71, 0x0d, 0x83, 0xd2, 0x86, 0x6c, 0xbb, 0xbc, 0xdc, 0x90, 0x6f, 0x10, 0x64,
+    0xe2, 0xe2, 0xb8, 0x01, 0xe7, 0x98, 0x9b, 0xb6, 0x35, 0xeb, 0x2e, 0x2f, 0xff, 0x3c, 0xde, 0x19,
+    0x21, 0x64, 0x99, 0x85, 0x22, 0x0a, 0x42, 0x2e, 0xf2, 0xc5, 0xa3, 0x82, 0x79, 0xd2, 0x3c, 0xb5,
+    0x77, 0xe4, 0x1a, 0xc3, 0xd9, 0x94, 0xf0, 0x43, 0xb7, 0x14, 0x29, 0x96, 0xdf, 0xdd, 0x5f, 0xd3,
+    0x18, 0xc4, 0x5c, 0x40, 0x60, 0x29, 0xb0, 0x3e, 0x1e, 0xfc, 0xdb, 0x31, 0xf7, 0x82, 0x24, 0x7c,
+    0xda, 0xdd, 0x84, 0x95, 0xe2, 0x05, 0x45, 0x62, 0x60, 0xcc, 0xbc, 0x6d, 0xc9, 0x4b, 0x1d, 0x13,
+    0x98, 0xf7, 0xc5, 0x12, 0xdc, 0xcb, 0x0a, 0x8c, 0x5b, 0x5a, 0x90, 0x37, 0x78, 0x1a, 0x59, 0x74,
+    0xf4, 0x18, 0x06, 0xc4, 0xe4, 0x9c, 0x9c, 0x50, 0x45, 0x38, 0xf1, 0x3e, 0xff, 0x7a, 0x7a, 0xaa,
+    0xac, 0x5e, 0x1c, 0x84, 0xbb, 0x6c, 0x12, 0x4a, 0x5c, 0xfd, 0xfe, 0xbb, 0xac, 0xfb, 0xe7, 0x40,
+    0xc2, 0x4f, 0x93, 0x50, 0xf2, 0xd2, 0x04, 0x93, 0x21, 0x88, 0x84, 0xcb, 0xaf, 0x4d, 0xc0, 0x3c,
+    0x34, 0x91, 0x90, 0xc5, 0x0d, 0x13, 0x54, 0x89, 0x59, 0x24, 0xb0, 0x7a, 0xcb, 0x06, 0x2e, 0xc2,
+    0x19, 0x15, 0x5c, 0xde, 0xb2, 0x81, 0x63, 0xa4, 0xa3, 0xc2, 0xb2, 0xeb, 0xd2, 0xd0, 0x64, 0x04,
+    0x94, 0x8f, 0x2d, 0xbf, 0x61, 0x82, 0x16, 0xa1, 0x91, 0x84, 0x55, 0xee, 0x98, 0xc0, 0xdc, 0x73,
+    0x94, 0x80, 0xe2, 0xca, 0x04, 0x92, 0xde, 0xa2, 0x04, 0xcb, 0xaf, 0x01, 0x10, 0x42, 0x29, 0x15,
+    0x94, 0x39, 0x8a, 0x12, 0x8e, 0x5f, 0x00, 0xd0, 0x51, 0x5f, 0x37, 0x02, 0xb0, 0x50, 0x46, 0x74,
+    0x9c, 0xbd, 0x62, 0x6f, 0x7a, 0xc8, 0x8d, 0x40, 0x30, 0x25, 0x9d, 0xa7, 0x77, 0x41, 0x34, 0x89,
+    0xef, 0xdc, 0x57, 0x45, 0x48, 0xd5, 0xd5, 0x6d, 0x5e, 0x92, 0xbd, 0x83, 0x38, 0x0c, 0xcc, 0x83,
+    0xaa, 0x8e, 0x09, 0x45, 0x57, 0xa1, 0x74, 0x60, 0xd7, 0x08, 0xcc, 0xe8, 0x1d, 0x51, 0xf0, 0x82,
+    0xe5, 0xe0, 0xaf, 0x9a, 0x90, 0x3a, 0xa5, 0x40, 0xa3, 0x67, 0xc4, 0x40, 0x71, 0x15, 0xa7, 0x10,
+    0x32, 0x75, 0xda, 0xc2, 0xca, 0xf4, 0x38, 0x98, 0x69, 0x8a, 0xe3, 0xa5, 0x85, 0x2a, 0x55, 0x39,
+    0xfe, 0x71, 0x03, 0xcb, 0xe7, 0x12, 0xff, 0xde, 0x61, 0x87, 0x21, 0x70, 0x99, 0xb6, 0xd4, 0x1b,
+    0x9a, 0xaf, 0xe2, 0x13, 0xb4, 0x53, 0xa1, 0x1b, 0x06, 0x2b, 0xf8, 0x97, 0x92, 0xd1, 0x3d, 0x09,
+    0xb2, 0x94, 0x86, 0xd3, 0x13, 0x16, 0x9d, 0x42, 0x48, 0xe2, 0x47, 0x77, 0x73, 0x70, 0x6e, 0x48,
+    0x0a, 0xbe, 0xcd, 0x1c, 0xff, 0x36, 0x16, 0xf2, 0xec, 0x1e, 0x8f, 0x8c, 0xdc, 0xd2, 0xd2, 0x28,
+    0xe3, 0x48, 0x18, 0x24, 0x62, 0x59, 0x5c, 0x4a, 0x8c, 0xfe, 0xaa, 0x4f, 0xa2, 0x0e, 0xa2, 0xcc,
+    0xa1, 0x1a, 0x27, 0x77, 0xb5, 0xa9, 0x31, 0x22, 0x68, 0xf0, 0x0f, 0xe4, 0x55, 0x79, 0x75, 0x7b,
+    0x64, 0x13, 0xbf, 0xc6, 0xcc, 0xd7, 0x98, 0xfa, 0xdc, 0x78, 0x0b, 0x12, 0xe5, 0xac, 0x7c, 0xed,
+    0x89, 0x24, 0x8d, 0x6b, 0x24, 0x67, 0xba, 0x26, 0x9f, 0x14, 0xe1, 0xa8, 0x64, 0x93, 0x12, 0x86,
+    0xe3, 0xea, 0x9f, 0xf3, 0x45, 0x83, 0x52, 0x0e, 0xaa, 0xdb, 0x72, 0x11, 0xc5, 0x11, 0xf3, 0x8d,
+    0x97, 0x85, 0xe2, 0x88, 0xf9, 0x23, 0x2c, 0x0a, 0xe6, 0x0e, 0xb4, 0x16, 0x02, 0x29, 0xc6, 0x84,
+    0xa9, 0x03, 0x8c, 0xa2, 0x93, 0x7b, 0xd1, 0xf2, 0x21, 0x7f, 0x6b, 0x76, 0x57, 0x33, 0x30, 0xbc,
+    0xb9, 0x34, 0x30, 0xac, 0xed, 0x25, 0xf8, 0xd5, 0x4a, 0x6b, 0xf6, 0x4c, 0x69, 0x7a, 0xd4, 0x57,
+    0x42, 0x1a, 0x64, 0x79, 0xde, 0xf7, 0x73, 0xe2, 0x21, 0x40, 0x7e, 0x7d, 0xc6, 0xce, 0xb3, 0x75,
+    0xed, 0xcb, 0xb2, 0x2c, 0x1b, 0x21, 0x8b, 0x15, 0x10, 0x30, 0xa2, 0x84, 0xd7, 0x5b, 0xb4, 0x4d,
+    0x57, 0xc7, 0x6e, 0x88, 0xb0, 0x5f, 0x4e, 0xb4, 0xe8, 0x94, 0x5f, 0xd4, 0xf6, 0xc8, 0x8b, 0x26,
+    0xb6, 0xea, 0xce, 0x74, 0xa7, 0x6e, 0xfc, 0x5b, 0x74, 0xa5, 0xf2, 0xda, 0x9b, 0x14, 0xa3, 0x9e,
+    0xb7, 0x3f, 0xde, 0xac, 0xf5, 0xaa, 0x58, 0x8b, 0x74, 0x07, 0xe7, 0xf2, 0xef, 0x92, 0x4f, 0xa7,
+    0xe8, 0xe6, 0xe5, 0x4c, 0xfb, 0x8e, 0xb4, 0xbf, 0x65, 0x83, 0x61, 0xb7, 0xd9, 0xb7, 0x6e, 0x4e,
+    0xd9, 0x7a, 0x4d, 0x35, 0x40, 0xed, 0x2a, 0xcb, 0x66, 0x8d, 0xad, 0x61, 0xe2, 0xef, 0xd3, 0x18,
+    0xcf, 0xed, 0x8b, 0x94, 0xf8, 0x7a, 0x52, 0x01, 0x2a, 0x65, 0x88, 0x7d, 0x5a, 0x80, 0x0a, 0xee,
+    0x15, 0x52, 0xcc, 0x84, 0x9a, 0x85, 0x8c, 0x6c, 0xe5, 0x7d, 0x6a, 0xf1, 0xc9, 0x4c, 0xba, 0x73,
+    0xb9, 0x54, 0x12, 0x26, 0x36, 0xfa, 0xb5, 0x38, 0x52, 0x81, 0x75, 0xf1, 0xc4, 0xca, 0x0b, 0x71,
+    0xb0, 0x11, 0x3c, 0xa7, 0x1b, 0xa4, 0xa0, 0x7d, 0xd2, 0xbc, 0xbd, 0x11, 0xe8, 0xf3, 0x33, 0x1f,
+    0x36, 0x6a, 0xbf, 0x6a, 0x77, 0xbe, 0x02, 0xb6, 0xfc, 0x6f, 0xfe, 0x54, 0x30, 0xa6, 0x88, 0xa0,
+    0xd9, 0x79, 0x66, 0xe6, 0xff, 0xb3, 0x79, 0xb2, 0x06, 0x01, 0xe5, 0x7e, 0xea, 0x3c, 0x62, 0x5b,
+    0x84, 0x81, 0xdd, 0xb0, 0x33, 0x85, 0x95, 0x81, 0x86, 0x2d, 0xd8, 0x30, 0xab, 0x19, 0xca, 0xd1,
+    0x86, 0x3c, 0x2a, 0xa7, 0xe8, 0x07, 0x7b, 0xeb, 0xd0, 0x06, 0x1a, 0x82, 0x9d, 0xb4, 0x1f, 0x5d,
+    0xf0, 0x37, 0xf0, 0xbc, 0xec, 0xc2, 0x5d, 0xf6, 0xc0, 0x2a, 0xe5, 0x53, 0x62, 0xed, 0x92, 0x0a,
+    0x43, 0x9c, 0xa7, 0xaa, 0xec, 0x9a, 0xa5, 0x21, 0xe3, 0x76, 0x80, 0xd8, 0x8c, 0x72, 0x8e, 0xc6,
+    0xa2, 0x78, 0x76, 0xa5, 0x43, 0xde, 0x62, 0x92, 0xfa, 0xa5, 0x6a, 0x80, 0x0c, 0xd6, 0x80, 0x19,
+    0xea, 0xf1, 0x32, 0xb3, 0x53, 0xef, 0xb8, 0x78, 0xce, 0xfa, 0xb0, 0x2b, 0xe9, 0xc6, 0xc2, 0x27,
+    0x5f, 0x40, 0xd6, 0x48, 0xfa, 0x36, 0x5f, 0x7c, 0xc1, 0x49, 0xfb, 0xc8, 0x7c, 0x8f, 0xc7, 0x58,
+    0x7c, 0xcd, 0x8c, 0x9b, 0x48, 0x4a, 0xbd, 0x9e, 0xf4, 0x48, 0x90, 0x5e, 0x47, 0x46, 0x3e, 0x52,
+    0xa4, 0x3c, 0x4f, 0xf3, 0xf9, 0xfa, 0x39, 0x87, 0xff, 0xe5, 0xa4, 0xf0, 0xca, 0xc5, 0x4d, 0xdd,
+    0x9b, 0xcb, 0x1f, 0xab, 0x78, 0x95, 0x8d, 0x84, 0xaa, 0x84, 0xa3, 0x6e, 0x87, 0x4a, 0xd6, 0xa6,
+    0xba, 0xb5, 0xcc, 0xa6, 0x19, 0x08, 0x9e, 0xa8, 0xad, 0x44, 0x80, 0xa7, 0x59, 0x4e, 0xa4, 0x0f,
+    0x13, 0xa8, 0xd7, 0x6f, 0x59, 0xfe, 0x14, 0xf3, 0x1d, 0xba, 0x9d, 0xd0, 0x3c, 0x3f, 0x41, 0x4a,
+    0x45, 0xe6, 0x32, 0x0f, 0x6c, 0xbb, 0x06, 0x13, 0x72, 0x81, 0xe7, 0x31, 0x6c, 0xd7, 0x96, 0x24,
+    0xe4, 0x8f, 0x0c, 0xea, 0xb0, 0x18, 0xd6, 0xcf, 0xf8, 0xf9, 0xb6, 0x8e, 0x1a, 0x14, 0x77, 0x4d,
+    0x37, 0x22, 0xc7, 0x23, 0x02, 0x60, 0x6b, 0x1f, 0xe2, 0x99, 0xd1, 0x89, 0x16, 0x47, 0x57, 0xe2,
+    0xe5, 0x5b, 0x15, 0xc6, 0x54, 0x62, 0x8a, 0x39, 0x65, 0x81, 0xfc, 0x95, 0x9f, 0xcd, 0x5d, 0xf6,
+    0xa2, 0x81, 0x4e, 0xc7, 0x0c, 0xa4, 0x1d, 0x23, 0x06, 0xef, 0x92, 0x1d, 0x7c, 0xe5, 0xf4, 0x50,
+    0xd1, 0x0f, 0x8e, 0x8b, 0x35, 0xd1, 0x91, 0x99, 0xb8, 0x4a, 0x2d, 0x0d, 0x02, 0x8d, 0xb1, 0x31,
+    0xea, 0xc0, 0x0a, 0xb0, 0xec, 0x37, 0x47, 0x0f, 0x57, 0xe4, 0x3f, 0x2f, 0xda, 0x6b, 0x06, 0xca,
+    0xb7, 0x6e, 0xd4, 0xe1, 0x82, 0xd6, 0x61, 0xf8, 0x8d, 0x40, 0x3e, 0x4f, 0xe4, 0x27, 0x14, 0x5f,
+    0xab, 0x10, 0xc6, 0x77, 0xce, 0x9d, 0x8f, 0xee, 0xf1, 0xc2, 0x4f, 0x3e, 0xf5, 0x48, 0x28, 0xe2,
+    0x79, 0xf6, 0xf6, 0x7b, 0x10, 0x8a, 0xb9, 0x9f, 0x50, 0x12, 0xc5, 0x19, 0x09, 0x22, 0x08, 0xc8,
+    0xaa, 0xe8, 0xe6, 0xfd, 0x99, 0xcb, 0xfa, 0x02, 0xda, 0x20, 0xe5, 0x25, 0x86, 0xa8, 0x79, 0x06,
+    0xc1, 0x12, 0x39, 0x30, 0xf2, 0x9d, 0x66, 0xb0, 0xda, 0xe4, 0x7f, 0xff, 0x07, 0x68, 0xf9, 0x54,
+    0x8d, 0x47, 0x26, 0x20, 0x1a, 0xe0, 0x99, 0x62, 0xfe, 0xa1, 0x12, 0x11, 0xcb, 0x4e, 0x3c, 0xc3,
+    0x83, 0xf9, 0x0c, 0xc9, 0x37, 0xd5, 0x3c, 0x66, 0x7e, 0x92, 0x5d, 0x96, 0xae, 0x2e, 0x30, 0xe4,
+    0x2c, 0xa5, 0x2b, 0x38, 0x71, 0x92, 0x46, 0x10, 0x88, 0x4b, 0x7c, 0x41, 0x46, 0x67, 0x60, 0x97,
+    0x21, 0x15, 0x49, 0x91, 0x0d, 0xa9, 0xc0, 0xe1, 0xd9, 0xa4, 0x89, 0xb5, 0xb2, 0x08, 0x13, 0x60,
+    0xd6, 0xc4, 0x89, 0x5f, 0x93, 0xab, 0x1a, 0x81, 0x12, 0x99, 0x93, 0x6f, 0xbf, 0x95, 0x9a, 0x26,
+    0x76, 0x9f, 0xc1, 0x52, 0x44, 0xb3, 0x6c, 0x6e, 0xc8, 0xd8, 0x5b, 0xf6, 0x2e, 0x84, 0x78, 0xca,
+    0x42, 0x74, 0xf1, 0x7a, 0x6e, 0x8e, 0xe1, 0x84, 0x8c, 0x02, 0x90, 0x22, 0xf9, 0x6c, 0xe1, 0xa7,
+    0x9f, 0xc0, 0x7c, 0xc9, 0xcd, 0x6c, 0x12, 0x18, 0x8c, 0x10, 0x6d, 0x4f, 0xcd, 0x5e, 0xa7, 0x41,
+    0x08, 0xc2, 0xda, 0xe9, 0x88, 0x1b, 0x60, 0xfa, 0x31, 0x76, 0xd5, 0xe6, 0x5a, 0x3c, 0x72, 0xf3,
+    0xd7, 0x72, 0xf1, 0xf4, 0x1c, 0x23, 0xa3, 0x8d, 0x03, 0xe9, 0x68, 0x19, 0xa2, 0xb3, 0x33, 0xc4,
+    0xf1, 0x2d, 0xf1, 0xba, 0xee, 0xc2, 0x5f, 0x4a, 0xc4, 0xb8, 0x76, 0x4a, 0x44, 0x78, 0x88, 0xc6,
+    0xc6, 0x65, 0x8e, 0xc0, 0x60, 0x33, 0x27, 0x5c, 0x70, 0x07, 0x6c, 0xb3, 0xb8, 0xfe, 0x35, 0x0e,
+    0xa2, 0x0e, 0x93, 0xc2, 0x76, 0x17, 0x4d, 0x35, 0xd6, 0x09, 0x69, 0x4c, 0xc7, 0x5d, 0xf5, 0x98,
+    0x69, 0x1a, 0xbe, 0x60, 0xe6, 0x2e, 0x09, 0x60, 0xd1, 0xf4, 0x79, 0x91, 0x37, 0x63, 0x58, 0xbc,
+    0xa4, 0x09, 0xfb, 0x63, 0xa4, 0xc8, 0x34, 0xbe, 0xc7, 0x14, 0xde, 0x13, 0x3a, 0x09, 0x32, 0x58,
+    0xbf, 0x9f, 0x54, 0x7a, 0x3e, 0x38, 0xde, 0x7c, 0x87, 0x91, 0xd3, 0x22, 0x36, 0x19, 0xc9, 0xd3,
+    0xd3, 0x53, 0x62, 0xf1, 0x94, 0x2c, 0x96, 0xb7, 0x91, 0xcf, 0x64, 0x91, 0x1d, 0xee, 0xa4, 0x35,
+    0xa4, 0x40, 0xb8, 0x57, 0x96, 0xee, 0xd7, 0x38, 0x5a, 0x5b, 0x26, 0x06, 0x7e, 0xa0, 0xe1, 0xf2,
+    0x91, 0xb2, 0x02, 0xfa, 0x9e, 0x62, 0x0f, 0xe6, 0x8a, 0x61, 0xec, 0xe6, 0x25, 0x2e, 0xe8, 0x5a,
+    0xb0, 0x2c, 0xdd, 0x3b, 0x70, 0xc1, 0x83, 0x94, 0x76, 0xd0, 0x8d, 0x8e, 0xc3, 0x5b, 0xda, 0x83,
+    0x87, 0xbf, 0x82, 0x94, 0x1a, 0x39, 0x22, 0xcd, 0x87, 0x09, 0x69, 0x22, 0x72, 0x7c, 0xe7, 0xa3,
+    0x38, 0xc9, 0x8a, 0x62, 0x9c, 0x4e, 0xd9, 0x7c, 0xf0, 0x8a, 0x98, 0xd7, 0x13, 0x9e, 0x83, 0x12,
+    0x05, 0x32, 0x22, 0xbf, 0x53, 0xa0, 0x73, 0x7d, 0x44, 0x84, 0xdb, 0x8c, 0x79, 0x9e, 0x47, 0x2d,
+    0xa8, 0x51, 0xd0, 0x16, 0x2f, 0x17, 0x44, 0x5b, 0xc6, 0x47, 0x77, 0x3d, 0x42, 0x8a, 0x5d, 0xf0,
+    0x5d, 0x82, 0x59, 0xd4, 0xf9, 0x42, 0xf0, 0x03, 0x0b, 0x77, 0x14, 0xfc, 0xfc, 0x16, 0x26, 0x92,
+    0x24, 0x2b, 0x2c, 0x09, 0x2e, 0xdd, 0x35, 0x65, 0xc9, 0x21, 0x49, 0x70, 0x3e, 0x8e, 0x6e, 0xd9,
+    0x1f, 0xcf, 0x83, 0x8e, 0xf8, 0x93, 0x2d, 0xe6, 0x14, 0x8c, 0xcd, 0xc1, 0xcc, 0x40, 0xad, 0x2a,
+    0x04, 0xe4, 0xf3, 0xd0, 0x69, 0xff, 0xf0, 0xe1, 0xc3, 0x3b, 0xb6, 0x48, 0xe4, 0xfd, 0xf0, 0x14,
+    0xdd, 0xd6, 0x01, 0x5f, 0xe3, 0x81, 0xb1, 0xf6, 0xcc, 0xd8, 0x70, 0x83, 0xc5, 0x66, 0xfb, 0x15,
+    0xf7, 0xc5, 0x6b, 0x08, 0x16, 0x92, 0x27, 0xe7, 0xbe, 0xbd, 0xe1, 0x80, 0x79, 0xaf, 0xa2, 0xca,
+    0xa0, 0x66, 0x90, 0xe6, 0xee, 0xcc, 0x0d, 0x05, 0x33, 0x05, 0x73, 0xcc, 0xed, 0x12, 0x3b, 0xae,
+    0x03, 0xcb, 0x3d, 0x58, 0x35, 0xc2, 0x16, 0x56, 0xf0, 0x2f, 0x82, 0xe5, 0x89, 0xe8, 0x24, 0x25,
+    0xab, 0x28, 0x84, 0x1e, 0x98, 0x21, 0xbb, 0x9b, 0xc7, 0x21, 0x25, 0x23, 0x64, 0x19, 0xb9, 0xf3,
+    0x53, 0x82, 0xef, 0xe3, 0x59, 0x66, 0x74, 0xa2, 0xeb, 0x13, 0xdf, 0x41, 0x8c, 0x97, 0xa6, 0x12,
+    0xe9, 0x81, 0x2a, 0xc3, 0x02, 0xbe, 0x6b, 0x31, 0x3a, 0x08, 0xaf, 0xe6, 0x31, 0xf8, 0x35, 0xed,
+    0x77, 0xd7, 0x37, 0x1f, 0xda, 0x3d, 0xe5, 0x95, 0x95, 0x58, 0x7a, 0x9d, 0x1e, 0x93, 0x2f, 0xec,
+    0x0d, 0x83, 0x68, 0xac, 0x9d, 0x0f, 0xf7, 0x4b, 0xda, 0xc6, 0xdd, 0xc8, 0xe5, 0x32, 0x14, 0x2f,
+    0x15, 0xdf, 0xc1, 0x48, 0xb6, 0x2d, 0xcb, 0x72, 0xf8, 0x3b, 0x8f, 0x26, 0xf7, 0xc7, 0x84, 0x25,
+    0xb9, 0xb1, 0x2e, 0x2e, 0x9a, 0x05, 0xd3, 0x7b, 0x46, 0x97, 0xdc, 0xff, 0xda, 0x3a, 0x71, 0xcb,
+    0xe2, 0x8f, 0xba, 0x14, 0x50, 0x36, 0x4f, 0xe2, 0x3b, 0x25, 0xf9, 0xa0, 0x04, 0x64, 0x46, 0x9e,
+    0x8c, 0x01, 0xd9, 0xb7, 0x25, 0x75, 0x27, 0x9c, 0xbd, 0x5a, 0x2c, 0xd5, 0x43, 0xa5, 0x79, 0x92,
+    0x4a, 0xaf, 0x75, 0x1a, 0xc6, 0x71, 0x22, 0xa1, 0xc0, 0xd5, 0x80, 0x48, 0xbc, 0xdf, 0x55, 0x93,
+    0x94, 0xe0, 0xd2, 0x19, 0xc0, 0x39, 0xf4, 0x37, 0x1c, 0x1a, 0x5a, 0xed, 0xeb, 0x6d, 0x00, 0x20,
+    0x65, 0xf6, 0x48, 0xc2, 0xc9, 0xf0, 0x5e, 0xd0, 0x0e, 0xfd, 0x83, 0x37, 0x73, 0xc3, 0x98, 0xdb,
+    0xe9, 0xba, 0x4b, 0x7f, 0x72, 0x83, 0x09, 0x78, 0xfc, 0x8b, 0x91, 0xed, 0x7e, 0x9b, 0x39, 0x63,
+    0x2c, 0xfa, 0x55, 0x79, 0x83, 0x74, 0x6c, 0xdc, 0x08, 0x09, 0xa9, 0x6b, 0x64, 0x64, 0xb7, 0xf3,
+    0x58, 0x59, 0x28, 0x47, 0x8f, 0x9d, 0xdf, 0x92, 0xbc, 0xc3, 0xef, 0xb8, 0xb3, 0x8f, 0x1f, 0xbf,
+    0xff, 0x2e, 0xb2, 0x29, 0xea, 0xb0, 0xf9, 0xbb, 0xe6, 0x95, 0x05, 0x8e, 0xdd, 0x28, 0x41, 0x88,
+    0x3a, 0xa0, 0x12, 0xa0, 0xb8, 0x6f, 0xc4, 0x62, 0x4f, 0x39, 0x56, 0xe8, 0xf0, 0xa9, 0x0a, 0x65,
+    0x09, 0x5f, 0xd5, 0xc7, 0x86, 0x8b, 0xb2, 0x50, 0x51, 0xcb, 0xa5, 0x26, 0x8c, 0x93, 0xa2, 0x76,
+    0x8f, 0x71, 0x8b, 0x0b, 0x25, 0xe8, 0xc7, 0xdf, 0x76, 0xa7, 0xa3, 0xa3, 0xbd, 0xbe, 0xa2, 0x4d,
+    0x54, 0xec, 0x8d, 0xff, 0x6d, 0x7a, 0xb8, 0xe7, 0x0d, 0x8f, 0x94, 0x27, 0xc8, 0x06, 0x7c, 0xd0,
+    0xef, 0x1f, 0x1d, 0x4d, 0xa7, 0x6d, 0xb9, 0xbd, 0x92, 0x53, 0xe4, 0xb2, 0x57, 0x2b, 0xb9, 0xfc,
+    0x4d, 0x62, 0xac, 0x2e, 0x1a, 0xeb, 0x81, 0x58, 0xef, 0x3f, 0x23, 0x2f, 0x7f, 0xc1, 0xb1, 0xf1,
+    0x6b, 0x17, 0x71, 0xa9, 0x4d, 0x8d, 0x68, 0x1b, 0x27, 0xc8, 0xa8, 0xed, 0x31, 0x56, 0x3c, 0xe5,
+    0xdd, 0xe0, 0x06, 0x02, 0x19, 0x70, 0xab, 0x38, 0x8a, 0x6d, 0x0f, 0xad, 0xf0, 0xb4, 0x6b, 0xd9,
+    0x1c, 0xe2, 0xea, 0xf4, 0x02, 0x0c, 0x1d, 0x3a, 0xa3, 0xea, 0xde, 0x87, 0x5e, 0x65, 0x59, 0xbd,
+    0xfb, 0x61, 0xc0, 0xa9, 0x2e, 0x54, 0xa9, 0x50, 0xb3, 0x76, 0x37, 0x49, 0x09, 0xab, 0xbf, 0xfb,
+    0xee, 0xe4, 0x89, 0x35, 0x73, 0x55, 0x0e, 0xdc, 0x1f, 0x1e, 0xbc, 0x17, 0xf4, 0x7e, 0x65, 0x7f,
+    0x3b, 0xbd, 0xbf, 0x6d, 0x8e, 0xe8, 0x75, 0x04, 0x2e, 0xac, 0x1f, 0x06, 0xbf, 0xf1, 0x22, 0xe1,
+    0xad, 0xbd, 0xb0, 0x79, 0x30, 0xa1, 0x6f, 0xd4, 0x9a, 0x53, 0x6d, 0x5e, 0x8a, 0x72, 0x26, 0x15,
+    0xc4, 0xea, 0x6e, 0x6a, 0x10, 0xa6, 0xd0, 0xf1, 0x57, 0xa3, 0xb5, 0xab, 0x33, 0x18, 0x5a, 0xe1,
+    0xaa, 0x15, 0xbf, 0x06, 0x21, 0xf4, 0x41, 0xbc, 0x69, 0x0c, 0xa3, 0x66, 0x7c, 0xd7, 0x58, 0x5b,
+    0xf7, 0x6c, 0x5f, 0x88, 0x98, 0x24, 0x04, 0x32, 0x78, 0x16, 0x77, 0x07, 0x33, 0x80, 0x58, 0x7d,
+    0x8d, 0x2b, 0xea, 0x12, 0xed, 0xc7, 0x5d, 0x00, 0x0b, 0xdf, 0x2a, 0x23, 0x74, 0x31, 0xa2, 0x40,
+    0x22, 0x7f, 0x25, 0x13, 0xd5, 0x33, 0xc6, 0x02, 0x8f, 0x92, 0x2f, 0xd6, 0x56, 0x53, 0x2c, 0x84,
+    0xdc, 0x7e, 0x39, 0xd3, 0x03, 0xb5, 0xbc, 0xa2, 0x41, 0x5e, 0x83, 0x5a, 0xff, 0xfc, 0xcb, 0x9a,
+    0x4d, 0xe1, 0x6a, 0x47, 0x6a, 0xcc, 0x5e, 0x0a, 0x4c, 0xf9, 0x3a, 0xa8, 0x26, 0xe9, 0xd9, 0x5b,
+    0x41, 0x5f, 0x5f, 0x17, 0x45, 0xd1, 0xb8, 0x8f, 0x8d, 0x40, 0x25, 0x87, 0x05, 0x97, 0x70, 0xc6,
+    0xae, 0x69, 0x90, 0x2c, 0xee, 0x30, 0xad, 0x91, 0xb3, 0x0a, 0x1c, 0x17, 0x7c, 0x30, 0x8a, 0xe3,
+    0x0c, 0xd6, 0x78, 0x7f, 0xc9, 0x39, 0x0a, 0x2b, 0x5b, 0x82, 0x3b, 0x23, 0x7e, 0x46, 0x76, 0xc0,
+    0x55, 0x06, 0x92, 0x70, 0x33, 0xb2, 0xe0, 0x68, 0xc0, 0x05, 0xf7, 0x25, 0x0c, 0xb3, 0x13, 0x4c,
+    0xf4, 0x35, 0x55, 0x4c, 0x36, 0x72, 0xa1, 0xa2, 0xbc, 0x33, 0x90, 0x2e, 0x20, 0x33, 0xeb, 0x02,
+    0xbe, 0x9b, 0xc7, 0x0a, 0xf9, 0xb6, 0x67, 0x96, 0xdc, 0x2b, 0x7c, 0x10, 0x8f, 0xd5, 0x3d, 0x77,
+    0xde, 0x52, 0xd5, 0xde, 0x3c, 0xff, 0xc8, 0xd8, 0x29, 0x1c, 0xcb, 0x6e, 0x19, 0x8b, 0xb1, 0xb7,
+    0xaa, 0x9b, 0xb8, 0xf3, 0xe5, 0x32, 0x17, 0x13, 0x8b, 0x6a, 0xe5, 0xa5, 0x11, 0x25, 0x63, 0x98,
+    0x2f, 0x2b, 0x6a, 0x21, 0x44, 0xb1, 0xd6, 0xe0, 0x2c, 0x86, 0xf1, 0xac, 0xd3, 0x16, 0x07, 0x0e,
+    0x8a, 0x53, 0x06, 0x81, 0x34, 0x04, 0x74, 0x62, 0xae, 0xc5, 0xc5, 0x23, 0x95, 0x2c, 0xb1, 0x74,
+    0x15, 0x12, 0xa7, 0xce, 0x48, 0x5b, 0x5c, 0x38, 0xf2, 0x79, 0x5b, 0xe1, 0xb7, 0xbc, 0xd7, 0xad,
+    0x93, 0x5f, 0xf9, 0xb5, 0x22, 0x9b, 0xab, 0x2b, 0x94, 0x91, 0xb1, 0x4d, 0x33, 0x51, 0xe3, 0x55,
+    0x45, 0x95, 0xdc, 0xf7, 0x2f, 0x68, 0x4a, 0x4b, 0xdb, 0x68, 0xea, 0xae, 0x7e, 0x29, 0x08, 0xa9,
+    0x2a, 0xdf, 0xca, 0xe7, 0xae, 0x6e, 0x2f, 0xf5, 0xdf, 0xa0, 0xcc, 0xcc, 0xa0, 0xb3, 0x4e, 0xf9,
+    0x31, 0xda, 0xc0, 0xbf, 0x26, 0x23, 0xca, 0x3e, 0xd0, 0xd2, 0x11, 0xf1, 0x62, 0xd2, 0xf4, 0x84,
+    0xdd, 0xe5, 0x95, 0x2b, 0xa0, 0xbb, 0xd4, 0x5f, 0xb0, 0x83, 0x58, 0x10, 0x8c, 0x60, 0xca, 0xb2,
+    0xa1, 0xfd, 0x10, 0x93, 0xc2, 0x2c, 0x96, 0x69, 0x40, 0xec, 0xc4, 0x32, 0xf1, 0x2c, 0xb2, 0x1a,
+    0xa5, 0x9a, 0x9a, 0x97, 0xd7, 0x57, 0x42, 0x19, 0xdf, 0xb0, 0x8d, 0x1e, 0x40, 0xaa, 0xae, 0xdc,
+    0x86, 0x3c, 0x03, 0x36, 0xf8, 0xff, 0xf9, 0x8e, 0x3c, 0x93, 0xa3, 0x1c, 0xd0, 0x11, 0x2f, 0x6c,
+    0x52, 0x85, 0xa6, 0x25, 0xde, 0x23, 0x60, 0x86, 0x2d, 0xad, 0xb3, 0xff, 0x03, 0x00, 0x00, 0xff,
+    0xff,
+};
+
+constexpr WebBootstrap asset_bootstrap = {
+    "/", "text/html", bootstrap_gz, sizeof(bootstrap_gz), 0x8c67eaecu, 38058,
+    "</script>\n    <script id=\"initial-channels\" type=\"application/json\">",
+    "</script>\n</body>\n</html>\n"
+};
+
+#endif // WEB_ASSETS_H
@@ -2,8 +2,9 @@
   SEMBox ESP32 - Web Content Header
   Contains all embedded HTML, CSS, and JavaScript
   
-  This file is auto-included by SEMBox.ino
-  Edit this file to customize the web dashboard
+  Edit this file to customize the web dashboard, then run
+  tools/build_web_assets.py to regenerate web_assets.h
+  (the gzip-compressed copy that SEMBox.ino actually serves)
 *********/
 
 #ifndef WEB_CONTENT_H
@@ -76,11 +77,16 @@ const char index_html[] PROGMEM = R"rawliteral(
                     <div class="status-item">
                         <span class="label">RAM</span>
                         <span class="value" id="memory">--</span>
+                        <span class="detail" id="memory-detail"></span>
                     </div>
                     <div class="status-item">
                         <span class="label">Flash</span>
                         <span class="value" id="flash">--</span>
                     </div>
+                    <div class="status-item">
+                        <span class="label">Inputs</span>
+                        <span class="value" id="inputs">--</span>
+                    </div>
                 </div>
             </section>
 
@@ -489,6 +495,14 @@ body::before {
     font-family: 'Consolas', monospace;
 }
 
+.status-item .detail {
+    display: block;
+    margin-top: 4px;
+    font-size: 0.75rem;
+    color: var(--text-muted);
+    font-family: 'Consolas', monospace;
+}
+
 /* ===========================================
    Controls Card
    =========================================== */
@@ -1010,13 +1024,20 @@ let state = {
     clients: 0,
     freeHeap: 0,
     totalHeap: 0,
+    heapMinFree: 0,
+    heapLargest: 0,
+    heapFrag: 0,
     flashSize: 0,
     sketchSize: 0,
+    inputs: 0,
+    channels: [],
     division: 360,
     ratio: 90
 };
 
 let uptimeInterval = null;
+let pollInterval = null;
+let eventSource = null;
 
 // DOM Elements
 const elements = {
@@ -1030,7 +1051,9 @@ const elements = {
     uptime: document.getElementById('uptime'),
     clients: document.getElementById('clients'),
     memory: document.getElementById('memory'),
+    memoryDetail: document.getElementById('memory-detail'),
     flash: document.getElementById('flash'),
+    inputs: document.getElementById('inputs'),
     division: document.getElementById('division'),
     ratio: document.getElementById('ratio'),
     paramStatus: document.getElementById('param-status'),
@@ -1064,22 +1087,22 @@ function toggleLED() {
 // ===========================================
 
 function allOn() {
-    showToast('Turning LED ON...', 'info');
-    sendRequest('/LED/on').then(() => {
+    showToast('Turning all outputs ON...', 'info');
+    sendBatch([{ op: 'outputs', set: 'all' }]).then(() => {
         state.led = true;
         updateAllUI();
-        showToast('LED turned ON', 'success');
+        showToast('All outputs ON', 'success');
     }).catch(error => {
         showToast('Error: ' + error, 'error');
     });
 }
 
 function allOff() {
-    showToast('Turning LED OFF...', 'info');
-    sendRequest('/LED/off').then(() => {
+    showToast('Turning all outputs OFF...', 'info');
+    sendBatch([{ op: 'outputs', clear: 'all' }]).then(() => {
         state.led = false;
         updateAllUI();
-        showToast('LED turned OFF', 'success');
+        showToast('All outputs OFF', 'success');
     }).catch(error => {
         showToast('Error: ' + error, 'error');
     });
@@ -1088,15 +1111,7 @@ function allOff() {
 function refreshStatus() {
     showToast('Refreshing status...', 'info');
     sendRequest('/status').then(response => response.json()).then(data => {
-        state.led = data.led === 'on';
-        state.uptime = data.uptime || 0;
-        state.clients = data.clients || 0;
-        state.freeHeap = data.freeHeap || 0;
-        state.totalHeap = data.totalHeap || 0;
-        state.flashSize = data.flashSize || 0;
-        state.sketchSize = data.sketchSize || 0;
-        state.division = data.division || 360;
-        state.ratio = data.ratio || 90;
+        applyStatus(data);
         updateAllUI();
         showToast('Status refreshed', 'success');
     }).catch(error => {
@@ -1104,6 +1119,61 @@ function refreshStatus() {
     });
 }
 
+// ===========================================
+// Live Status Functions
+// ===========================================
+
+function applyStatus(data) {
+    state.led = data.led === 'on';
+    state.uptime = data.uptime || 0;
+    state.clients = data.clients || 0;
+    state.freeHeap = data.freeHeap || 0;
+    state.totalHeap = data.totalHeap || 0;
+    state.heapMinFree = data.heapMinFree || 0;
+    state.heapLargest = data.heapLargest || 0;
+    state.heapFrag = data.heapFrag || 0;
+    state.flashSize = data.flashSize || 0;
+    state.sketchSize = data.sketchSize || 0;
+    state.inputs = data.inputs || 0;
+    state.division = data.division || 360;
+    state.ratio = data.ratio || 90;
+}
+
+function connectEvents() {
+    if (!window.EventSource) {
+        startPolling();
+        return;
+    }
+    
+    eventSource = new EventSource('/events');
+    eventSource.addEventListener('status', event => {
+        stopPolling();
+        applyStatus(JSON.parse(event.data));
+        updateAllUI();
+    });
+    // EventSource reconnects by itself; poll meanwhile so the UI stays live
+    eventSource.onerror = () => {
+        startPolling();
+    };
+}
+
+function startPolling() {
+    if (pollInterval) return;
+    pollInterval = setInterval(() => {
+        sendRequest('/status').then(response => response.json()).then(data => {
+            applyStatus(data);
+            updateAllUI();
+        }).catch(() => {});
+    }, CONFIG.refreshInterval);
+}
+
+function stopPolling() {
+    if (pollInterval) {
+        clearInterval(pollInterval);
+        pollInterval = null;
+    }
+}
+
 // ===========================================
 // Parameter Functions
 // ===========================================
@@ -1186,15 +1256,28 @@ function updateAllUI() {
         const total = Math.round(state.totalHeap / 1024);
         elements.memory.textContent = used + '/' + total + ' KB';
     }
+    if (elements.memoryDetail) {
+        // Fragmentation trend: low-water mark, largest block, share not in it
+        elements.memoryDetail.textContent = 'min ' + Math.round(state.heapMinFree / 1024) + ' KB' +
+            ' · blk ' + Math.round(state.heapLargest / 1024) + ' KB' +
+            ' · frag ' + Math.round(state.heapFrag * 100) + '%';
+    }
     if (elements.flash) {
         const usedMB = (state.sketchSize / 1024 / 1024).toFixed(2);
         const totalMB = (state.flashSize / 1024 / 1024).toFixed(1);
         elements.flash.textContent = usedMB + '/' + totalMB + ' MB';
     }
-    if (elements.division) {
+    if (elements.inputs && state.channels.length) {
+        // Names of the active inputs; bit i of the mask is channel i
+        const active = state.channels.filter((channel, i) =>
+            channel.direction === 'input' && (state.inputs >> i) & 1).map(channel => channel.name);
+        elements.inputs.textContent = active.length ? active.join(' · ') : 'none';
+    }
+    // Do not overwrite a value the operator is currently editing
+    if (elements.division && document.activeElement !== elements.division) {
         elements.division.value = state.division;
     }
-    if (elements.ratio) {
+    if (elements.ratio && document.activeElement !== elements.ratio) {
         elements.ratio.value = state.ratio;
     }
 }
@@ -1203,12 +1286,12 @@ function updateAllUI() {
 // Helper Functions
 // ===========================================
 
-function sendRequest(url) {
+function sendRequest(url, options) {
     return new Promise((resolve, reject) => {
         const controller = new AbortController();
         const timeoutId = setTimeout(() => controller.abort(), CONFIG.requestTimeout);
         
-        fetch(url, { signal: controller.signal }).then(response => {
+        fetch(url, Object.assign({ signal: controller.signal }, options)).then(response => {
             clearTimeout(timeoutId);
             if (response.ok) {
                 resolve(response);
@@ -1226,6 +1309,20 @@ function sendRequest(url) {
     });
 }
 
+// Several operations in one round trip; rejects unless the whole batch was accepted
+function sendBatch(ops) {
+    return sendRequest('/batch', {
+        method: 'POST',
+        headers: { 'Content-Type': 'application/json' },
+        body: JSON.stringify(ops)
+    }).then(response => response.json()).then(data => {
+        if (!data.success) {
+            throw data.error;
+        }
+        return data;
+    });
+}
+
 function formatUptime(seconds) {
     const hrs = Math.floor(seconds / 3600);
     const mins = Math.floor((seconds % 3600) / 60);
@@ -1281,28 +1378,56 @@ function hideLoadingScreen() {
     }
 }
 
+// Channel list from /io, for the page without embedded state
+function loadChannels() {
+    sendRequest('/io').then(response => response.json()).then(data => {
+        state.channels = data.channels || [];
+        updateAllUI();
+    }).catch(error => {
+        console.error('Failed to load IO channels:', error);
+    });
+}
+
+// JSON the firmware embedded in the bootstrap page (served at /), or null
+function initialData(id) {
+    const element = document.getElementById(id);
+    if (!element) return null;
+    try {
+        return JSON.parse(element.textContent);
+    } catch (error) {
+        return null;
+    }
+}
+
+function startApp() {
+    hideLoadingScreen();
+    startUptimeCounter();
+    connectEvents();
+    console.log('SEMBox Dashboard initialized');
+}
+
 function initializeApp() {
+    const channels = initialData('initial-channels');
+    if (channels) {
+        state.channels = channels;
+    } else {
+        loadChannels();
+    }
+    const status = initialData('initial-status');
+    if (status) {
+        applyStatus(status);
+        updateAllUI();
+        startApp();
+        return;
+    }
     sendRequest('/status').then(response => response.json()).then(data => {
-        state.led = data.led === 'on';
-        state.uptime = data.uptime || 0;
-        state.clients = data.clients || 0;
-        state.freeHeap = data.freeHeap || 0;
-        state.totalHeap = data.totalHeap || 0;
-        state.flashSize = data.flashSize || 0;
-        state.sketchSize = data.sketchSize || 0;
-        state.division = data.division || 360;
-        state.ratio = data.ratio || 90;
+        applyStatus(data);
         updateAllUI();
-        hideLoadingScreen();
-        startUptimeCounter();
-        console.log('SEMBox Dashboard initialized');
+        startApp();
     }).catch(error => {
+        // Show the UI with defaults; the event stream fills it in
         console.error('Failed to load initial data:', error);
-        // Still show UI after error with defaults
-        setTimeout(() => {
-            hideLoadingScreen();
-            startUptimeCounter();
-        }, 2000);
+        startApp();
     });
 }
 
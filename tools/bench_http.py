@@ -0,0 +1,440 @@
+#!/usr/bin/env python3
+"""
+SEMBox - HTTP Load and Latency Benchmark
+
+Replays a mix of the dashboard and API routes against a SEMBox (or the
+host emulator, see tools/build_host.py) with a number of simulated
+clients, and reports latency percentiles, error rate and throughput:
+
+    python3 tools/bench_http.py --target 192.168.4.1 --panels 1,2,4,8 --report bench.json
+    python3 tools/bench_http.py --target 127.0.0.1:8080 --baseline bench.json
+
+Client classes (see DEFAULT_MIX, or pass your own with --mix FILE.json):
+  - panel: a dashboard. Loads the page like the browser does (the
+    bootstrap page at /, which carries stylesheet, script and status),
+    holds the /events stream and switches the LED now and then. For the
+    separate-resource page use the boot stages
+    [["/index.html"], ["/style.css", "/script.js"], ["/status"]].
+  - plc: a PLC poller. Reads /status at 10 Hz, reads the parameters and
+    saves them back unchanged every few seconds.
+
+Requests run on a fixed schedule per client. Latency is measured from
+the time a request was due, not from when it could be sent, so a slow
+server is not hidden by clients that wait for it (coordinated omission).
+Requests due in the warmup are not counted, page loads always are.
+
+With --baseline the run is compared with an earlier report and the exit
+status is 1 when a route's p99 or the error rate got worse than allowed.
+Uses only the Python standard library.
+"""
+
+import argparse
+import asyncio
+import copy
+import datetime
+import json
+import random
+import sys
+
+DEFAULT_TARGET = "192.168.4.1"
+REPORT_VERSION = 1
+
+# "{params}" is replaced by the division and ratio read from /params/load
+# at start, so saves write back what is stored (the settings store skips
+# unchanged values, so no flash is written)
+DEFAULT_MIX = {
+    "clients": [
+        {
+            "name": "panel",
+            "count": 2,
+            "boot": [["/"]],
+            "events": True,
+            "requests": [
+                {"path": "/LED/on", "every": 10.0},
+                {"path": "/LED/off", "every": 10.0, "offset": 5.0},
+            ],
+        },
+        {
+            "name": "plc",
+            "count": 1,
+            "requests": [
+                {"path": "/status", "every": 0.1},
+                {"path": "/params/load", "every": 1.0},
+                {"path": "/params/save?{params}", "every": 5.0},
+            ],
+        },
+    ]
+}
+
+# Allowed slack when comparing with a baseline
+P99_TOLERANCE = 0.20        # relative
+P99_SLACK_MS = 2.0          # absolute, for routes in the low milliseconds
+ERROR_RATE_SLACK = 0.01
+
+
+class RequestError(Exception):
+    def __init__(self, kind):
+        super().__init__(kind)
+        self.kind = kind
+
+
+async def fetch(host, port, path, timeout):
+    """GET path on a new connection (the device closes every one); returns (status, bytes)"""
+    async def exchange():
+        try:
+            reader, writer = await asyncio.open_connection(host, port)
+        except OSError:
+            raise RequestError("connect")
+        try:
+            writer.write(("GET %s HTTP/1.1\r\nHost: %s\r\nConnection: close\r\n\r\n" % (path, host)).encode())
+            await writer.drain()
+            data = await reader.read(-1)
+        except OSError:
+            raise RequestError("reset")
+        finally:
+            writer.close()
+        line = data.split(b"\r\n", 1)[0].split()
+        if len(line) < 2 or not line[1].isdigit():
+            raise RequestError("malformed")
+        return int(line[1]), len(data)
+
+    try:
+        return await asyncio.wait_for(exchange(), timeout)
+    except asyncio.TimeoutError:
+        raise RequestError("timeout")
+
+
+def route_of(path):
+    return path.split("?", 1)[0]
+
+
+def percentile(sorted_values, fraction):
+    """Nearest-rank percentile of a sorted list, None if empty"""
+    if not sorted_values:
+        return None
+    rank = max(0, min(len(sorted_values) - 1, int(fraction * len(sorted_values) + 0.5) - 1))
+    return sorted_values[rank]
+
+
+def latency_summary(samples):
+    values = sorted(samples)
+    summary = {name: percentile(values, fraction)
+               for name, fraction in (("p50", 0.50), ("p90", 0.90), ("p99", 0.99), ("p999", 0.999))}
+    summary["max"] = values[-1] if values else None
+    summary = {name: None if value is None else round(value * 1000.0, 3) for name, value in summary.items()}
+    summary["samples"] = len(values)
+    return summary
+
+
+class Stats:
+    def __init__(self):
+        self.routes = {}
+        self.boots = {}
+        self.events = {"streams": 0, "received": 0, "reconnects": 0, "firstEventMs": []}
+
+    def record(self, route, latency, status=None, size=0, error=None):
+        entry = self.routes.setdefault(route, {"latencies": [], "requests": 0, "errors": {}, "bytes": 0})
+        entry["requests"] += 1
+        entry["bytes"] += size
+        if error is None and status >= 400:
+            error = "http_%d" % status
+        if error:
+            entry["errors"][error] = entry["errors"].get(error, 0) + 1
+        else:
+            entry["latencies"].append(latency)
+
+    def summary(self, seconds):
+        routes = {}
+        all_latencies = []
+        requests = errors = size = 0
+        for route in sorted(self.routes):
+            entry = self.routes[route]
+            failed = sum(entry["errors"].values())
+            routes[route] = {
+                "requests": entry["requests"],
+                "errors": entry["errors"],
+                "errorRate": round(failed / entry["requests"], 5) if entry["requests"] else 0.0,
+                "latencyMs": latency_summary(entry["latencies"]),
+            }
+            all_latencies += entry["latencies"]
+            requests += entry["requests"]
+            errors += failed
+            size += entry["bytes"]
+        events = dict(self.events)
+        events["firstEventMs"] = latency_summary(self.events["firstEventMs"])
+        return {
+            "requests": requests,
+            "errors": errors,
+            "errorRate": round(errors / requests, 5) if requests else 0.0,
+            "throughput": round(requests / seconds, 2),
+            "bytesPerSecond": round(size / seconds, 1),
+            "latencyMs": latency_summary(all_latencies),
+            "routes": routes,
+            "boot": {name: latency_summary(times) for name, times in sorted(self.boots.items())},
+            "events": events,
+        }
+
+
+class Phase:
+    def __init__(self, args, params):
+        self.host, self.port = args.host, args.port
+        self.timeout = args.timeout
+        self.params = params
+        self.stats = Stats()
+        loop = asyncio.get_running_loop()
+        self.start = loop.time()
+        self.measured = self.start + args.warmup
+        self.end = self.measured + args.duration
+
+    def expand(self, path):
+        return path.replace("{params}", self.params)
+
+    async def request(self, path, due, counted=None):
+        loop = asyncio.get_running_loop()
+        counted = due >= self.measured if counted is None else counted
+        try:
+            status, size = await fetch(self.host, self.port, self.expand(path), self.timeout)
+            if counted:
+                self.stats.record(route_of(path), loop.time() - due, status, size)
+            return status < 400
+        except RequestError as error:
+            if counted:
+                self.stats.record(route_of(path), loop.time() - due, error=error.kind)
+            return False
+
+    async def boot(self, name, stages, delay):
+        """Page load: stages one after another, the paths of a stage together"""
+        loop = asyncio.get_running_loop()
+        await asyncio.sleep(delay)
+        due = loop.time()
+        for stage in stages:
+            results = await asyncio.gather(*(self.request(path, loop.time(), counted=True) for path in stage))
+            if not all(results):
+                return
+        self.stats.boots.setdefault(name, []).append(loop.time() - due)
+
+    async def schedule(self, spec, offset):
+        loop = asyncio.get_running_loop()
+        due = self.start + offset
+        while due < self.end:
+            if due > loop.time():
+                await asyncio.sleep(due - loop.time())
+            await self.request(spec["path"], due)
+            # Stay on the schedule; a late client catches up back to back
+            due += spec["every"]
+
+    async def events(self):
+        """Hold an /events stream until the end of the phase, reconnecting when it closes"""
+        loop = asyncio.get_running_loop()
+        events = self.stats.events
+        while loop.time() < self.end:
+            opened = loop.time()
+            writer = None
+            try:
+                reader, writer = await asyncio.wait_for(asyncio.open_connection(self.host, self.port), self.timeout)
+                writer.write(("GET /events HTTP/1.1\r\nHost: %s\r\nAccept: text/event-stream\r\n\r\n"
+                              % self.host).encode())
+                await writer.drain()
+                events["streams"] += 1
+                first = True
+                while loop.time() < self.end:
+                    line = await asyncio.wait_for(reader.readline(), max(0.01, self.end - loop.time()))
+                    if not line:
+                        break
+                    if line.startswith(b"event:"):
+                        events["received"] += 1
+                        if first:
+                            events["firstEventMs"].append(loop.time() - opened)
+                            first = False
+            except (OSError, asyncio.TimeoutError):
+                pass
+            finally:
+                if writer:
+                    writer.close()
+            if loop.time() < self.end:
+                events["reconnects"] += 1
+                await asyncio.sleep(1.0)    # EventSource retry
+
+
+def scaled_mix(mix, counts):
+    mix = copy.deepcopy(mix)
+    for client in mix["clients"]:
+        if client["name"] in counts:
+            client["count"] = counts[client["name"]]
+    return mix
+
+
+async def run_phase(args, mix, params, rng):
+    phase = Phase(args, params)
+    tasks = []
+    for client in mix["clients"]:
+        for _ in range(client.get("count", 1)):
+            if client.get("boot"):
+                tasks.append(phase.boot(client["name"], client["boot"], rng.uniform(0, args.warmup)))
+            if client.get("events"):
+                tasks.append(phase.events())
+            for spec in client.get("requests", []):
+                # Random phase within the period, so clients do not fire in step
+                offset = spec.get("offset", 0.0) + rng.uniform(0, spec["every"])
+                tasks.append(phase.schedule(spec, offset))
+    await asyncio.gather(*tasks)
+    result = phase.stats.summary(args.duration)
+    result["device"] = await device_status(args)
+    return result
+
+
+async def get_json(args, path):
+    """Body of a JSON route, None if it cannot be read"""
+    try:
+        reader, writer = await asyncio.wait_for(asyncio.open_connection(args.host, args.port), args.timeout)
+        writer.write(("GET %s HTTP/1.1\r\nHost: %s\r\nConnection: close\r\n\r\n" % (path, args.host)).encode())
+        data = await asyncio.wait_for(reader.read(-1), args.timeout)
+        writer.close()
+        return json.loads(data.split(b"\r\n\r\n", 1)[1])
+    except (OSError, asyncio.TimeoutError, ValueError, IndexError):
+        return None
+
+
+async def device_status(args):
+    """Server-side figures after a phase, from /status"""
+    status = await get_json(args, "/status")
+    if status is None:
+        return None
+    keys = ("freeHeap", "heapMinFree", "heapLargest", "heapFrag", "allocFailed", "tickMissed", "stepJitterUs")
+    return {key: status[key] for key in keys if key in status}
+
+
+async def stored_params(args):
+    """Query string that saves the stored division and ratio unchanged"""
+    params = await get_json(args, "/params/load")
+    if not params or "division" not in params or "ratio" not in params:
+        sys.exit("bench_http: cannot read /params/load from %s:%d" % (args.host, args.port))
+    return "division=%d&ratio=%.3f" % (params["division"], params["ratio"])
+
+
+def print_phase(number, phase):
+    print("\nPhase %d: %s, %.1f s" % (number, ", ".join("%d %s" % (count, name) for name, count in phase["clients"].items()),
+                                      phase["duration"]))
+    print("  %-16s %9s %7s %9s %9s %9s %9s" % ("route", "requests", "errors", "p50 ms", "p99 ms", "p999 ms", "max ms"))
+
+    def row(name, entry):
+        latency = entry["latencyMs"]
+        cells = ["%9.2f" % latency[key] if latency[key] is not None else "%9s" % "-"
+                 for key in ("p50", "p99", "p999", "max")]
+        print("  %-16s %9d %7d %s" % (name, entry["requests"], sum(entry["errors"].values())
+                                      if isinstance(entry["errors"], dict) else entry["errors"], " ".join(cells)))
+
+    for route, entry in phase["routes"].items():
+        row(route, entry)
+    row("total", phase)
+    print("  %.1f requests/s, %.1f kB/s, error rate %.2f%%"
+          % (phase["throughput"], phase["bytesPerSecond"] / 1000.0, phase["errorRate"] * 100.0))
+    for name, boot in phase["boot"].items():
+        print("  %s page load: p50 %s ms, p99 %s ms (%d loads)" % (name, boot["p50"], boot["p99"], boot["samples"]))
+    events = phase["events"]
+    if events["streams"]:
+        print("  events: %d streams, %d received, %d reconnects" % (events["streams"], events["received"],
+                                                                    events["reconnects"]))
+    if phase["device"]:
+        print("  device: " + ", ".join("%s %s" % item for item in phase["device"].items()))
+
+
+def compare(report, baseline):
+    """Regressions of report against baseline, as a list of messages"""
+    regressions = []
+    for phase in report["phases"]:
+        base = next((b for b in baseline.get("phases", []) if b.get("clients") == phase["clients"]), None)
+        if base is None:
+            continue
+        label = ", ".join("%d %s" % (count, name) for name, count in phase["clients"].items())
+        if phase["errorRate"] > base["errorRate"] + ERROR_RATE_SLACK:
+            regressions.append("%s: error rate %.2f%% (baseline %.2f%%)"
+                               % (label, phase["errorRate"] * 100.0, base["errorRate"] * 100.0))
+        for route, entry in phase["routes"].items():
+            old = base["routes"].get(route, {}).get("latencyMs", {}).get("p99")
+            new = entry["latencyMs"]["p99"]
+            if old is not None and new is not None and new > old * (1.0 + P99_TOLERANCE) + P99_SLACK_MS:
+                regressions.append("%s: %s p99 %.2f ms (baseline %.2f ms)" % (label, route, new, old))
+    return regressions
+
+
+def parse_target(target):
+    host, _, port = target.partition(":")
+    return host, int(port) if port else 80
+
+
+def parse_counts(text):
+    return [int(value) for value in text.split(",")] if text else None
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Load and latency benchmark for the SEMBox HTTP API")
+    parser.add_argument("--target", default=DEFAULT_TARGET, help="HOST[:PORT] (default: %(default)s)")
+    parser.add_argument("--mix", help="client mix JSON file (default: built-in panel and plc mix)")
+    parser.add_argument("--panels", help="panel counts, one phase each, e.g. 1,2,4,8")
+    parser.add_argument("--pollers", help="plc poller counts, one phase each (or one for all phases)")
+    parser.add_argument("--duration", type=float, default=30.0, help="measured seconds per phase")
+    parser.add_argument("--warmup", type=float, default=3.0, help="seconds per phase before measuring")
+    parser.add_argument("--timeout", type=float, default=5.0, help="request timeout in s (as the dashboard)")
+    parser.add_argument("--seed", type=int, default=1)
+    parser.add_argument("--report", help="write the JSON report to this file")
+    parser.add_argument("--baseline", help="compare with this earlier report; exit 1 on regression")
+    args = parser.parse_args()
+    args.host, args.port = parse_target(args.target)
+
+    mix = DEFAULT_MIX
+    if args.mix:
+        with open(args.mix) as file:
+            mix = json.load(file)
+
+    panels = parse_counts(args.panels)
+    pollers = parse_counts(args.pollers)
+    phases = max(len(panels or []), len(pollers or []), 1)
+    for counts in (panels, pollers):
+        if counts and len(counts) not in (1, phases):
+            sys.exit("bench_http: --panels and --pollers need the same number of phases")
+
+    async def run():
+        params = await stored_params(args)
+        rng = random.Random(args.seed)
+        results = []
+        for index in range(phases):
+            counts = {}
+            if panels:
+                counts["panel"] = panels[min(index, len(panels) - 1)]
+            if pollers:
+                counts["plc"] = pollers[min(index, len(pollers) - 1)]
+            phase_mix = scaled_mix(mix, counts)
+            result = await run_phase(args, phase_mix, params, rng)
+            result = dict({"clients": {c["name"]: c.get("count", 1) for c in phase_mix["clients"]},
+                           "duration": args.duration}, **result)
+            print_phase(index + 1, result)
+            results.append(result)
+        return results
+
+    report = {
+        "tool": "bench_http",
+        "version": REPORT_VERSION,
+        "target": "%s:%d" % (args.host, args.port),
+        "started": datetime.datetime.now(datetime.timezone.utc).isoformat(timespec="seconds"),
+        "mix": mix,
+        "phases": asyncio.run(run()),
+    }
+
+    if args.report:
+        with open(args.report, "w") as file:
+            json.dump(report, file, indent=2)
+        print("\nbench_http: wrote %s" % args.report)
+
+    if args.baseline:
+        with open(args.baseline) as file:
+            regressions = compare(report, json.load(file))
+        for message in regressions:
+            print("REGRESSION " + message)
+        if regressions:
+            sys.exit(1)
+        print("bench_http: no regression against %s" % args.baseline)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,129 @@
+#!/usr/bin/env python3
+"""
+SEMBox - Host Emulator Build
+
+Compiles the firmware (src/SEMBox) unchanged against the stand-in
+headers in host/ into a Linux executable, for load, latency and
+sanitizer testing:
+
+    python3 tools/build_host.py [--sanitize address|thread|undefined]
+    build/host/sembox-host --port 8080 --data /tmp/sembox
+
+--test instead builds the module tests in host/tests, each linked with
+only the sketch modules it exercises (TESTS below), and runs them. Tests
+in JSON_TESTS also need ArduinoJson.
+
+ArduinoJson is taken from the installed Arduino library (the same
+version the firmware is built with); pass --arduinojson if it lives
+elsewhere. Requires g++ with C++17.
+"""
+
+import argparse
+import os
+import pathlib
+import shlex
+import subprocess
+import sys
+
+ROOT = pathlib.Path(__file__).resolve().parent.parent
+SKETCH_DIR = ROOT / "src" / "SEMBox"
+HOST_DIR = ROOT / "host"
+DEFAULT_ARDUINOJSON = pathlib.Path.home() / "Arduino" / "libraries" / "ArduinoJson" / "src"
+
+DEFINES = [
+    'HOST_PARTITION_TABLE="%s"' % (SKETCH_DIR / "partitions.csv"),
+    # ArduinoJson with the host String, without Arduino streams
+    "ARDUINOJSON_ENABLE_ARDUINO_STRING=1",
+    "ARDUINOJSON_ENABLE_ARDUINO_STREAM=0",
+    "ARDUINOJSON_ENABLE_ARDUINO_PRINT=0",
+    "ARDUINOJSON_ENABLE_PROGMEM=0",
+]
+
+# Module tests in host/tests and the sketch sources each one links
+TESTS = {
+    "index_math_test": ["index_math.cpp", "command_check.cpp", "motion_profile.cpp"],
+    "command_queue_test": ["motion_profile.cpp"],
+    "step_engine_test": ["step_engine.cpp", "step_planner.cpp", "motion_profile.cpp"],
+    "status_snapshot_test": ["protocol.cpp", "motion_profile.cpp"],
+    "protocol_test": ["protocol.cpp", "motion_profile.cpp"],
+    "command_check_test": ["command_check.cpp", "index_math.cpp", "motion_profile.cpp"],
+    "program_engine_test": ["program_engine.cpp", "motion_profile.cpp"],
+    "route_table_test": ["route_table.cpp"],
+    "query_fields_test": ["query_fields.cpp", "index_math.cpp"],
+    "response_pool_test": ["response_pool.cpp"],
+}
+JSON_TESTS = {"status_snapshot_test"}
+
+
+def sources():
+    # The sketch is C++ once Arduino.h is included ahead of it, as the
+    # Arduino builder does
+    yield ["-include", "Arduino.h", "-x", "c++", str(SKETCH_DIR / "SEMBox.ino"), "-x", "none"]
+    for path in sorted(SKETCH_DIR.glob("*.cpp")) + sorted(HOST_DIR.glob("*.cpp")):
+        yield [str(path)]
+
+
+def compiler(args):
+    command = [args.cxx, "-std=gnu++17", "-O2", "-g", "-pthread", "-Wall", "-Wno-unused-function",
+               "-I" + str(HOST_DIR), "-I" + str(SKETCH_DIR)]
+    if args.sanitize:
+        command += ["-fsanitize=" + args.sanitize, "-fno-omit-frame-pointer"]
+    return command
+
+
+def json_options(args):
+    if not (args.arduinojson / "ArduinoJson.h").is_file():
+        sys.exit("build_host: ArduinoJson.h not found in %s (use --arduinojson)" % args.arduinojson)
+    return ["-I" + str(args.arduinojson)] + ["-D" + define for define in DEFINES]
+
+
+def run_tests(args):
+    """Build and run every module test; exits non-zero if one fails."""
+    output_dir = args.output.parent / "tests"
+    output_dir.mkdir(parents=True, exist_ok=True)
+    failed = []
+    for name, modules in TESTS.items():
+        executable = output_dir / name
+        command = compiler(args) + ["-I" + str(HOST_DIR / "tests")]
+        if name in JSON_TESTS:
+            command += json_options(args)
+        command += [str(HOST_DIR / "tests" / (name + ".cpp"))]
+        command += [str(SKETCH_DIR / module) for module in modules]
+        command += ["-o", str(executable)]
+        print(" ".join(shlex.quote(part) for part in command))
+        if subprocess.run(command).returncode != 0 or subprocess.run([str(executable)]).returncode != 0:
+            failed.append(name)
+    if failed:
+        sys.exit("build_host: failed: %s" % ", ".join(failed))
+    print("build_host: %d tests passed" % len(TESTS))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Build the SEMBox host emulator")
+    parser.add_argument("--sanitize", choices=["address", "thread", "undefined"])
+    parser.add_argument("--arduinojson", type=pathlib.Path, default=DEFAULT_ARDUINOJSON,
+                        help="ArduinoJson src directory (default: %(default)s)")
+    parser.add_argument("--output", type=pathlib.Path, default=ROOT / "build" / "host" / "sembox-host")
+    parser.add_argument("--cxx", default=os.environ.get("CXX", "g++"))
+    parser.add_argument("--test", action="store_true", help="build and run the module tests instead")
+    args = parser.parse_args()
+
+    if args.test:
+        run_tests(args)
+        return
+
+    command = compiler(args) + json_options(args)
+    for source in sources():
+        command += source
+    args.output.parent.mkdir(parents=True, exist_ok=True)
+    command += ["-o", str(args.output)]
+
+    print(" ".join(shlex.quote(part) for part in command))
+    result = subprocess.run(command)
+    if result.returncode != 0:
+        sys.exit(result.returncode)
+    print("build_host: wrote %s" % args.output)
+
+
+if __name__ == "__main__":
+    main()
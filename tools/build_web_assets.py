@@ -0,0 +1,270 @@
+#!/usr/bin/env python3
+"""
+SEMBox - Web Asset Build Stage
+
+Reads the dashboard sources embedded in src/SEMBox/web_content.h and
+generates src/SEMBox/web_assets.h with:
+  - gzip-compressed byte arrays (served with Content-Encoding: gzip)
+  - a strong ETag per asset, derived from the content hash
+  - content-hashed URLs for the stylesheet and script, so they can be
+    cached as immutable by the browser
+  - the bootstrap page served at /: index.html with the stylesheet and
+    script inlined, compressed up to a slot where the firmware appends
+    the current status, the IO channel list and the markup between and
+    after them as a stored (uncompressed) deflate block, so one response
+    paints a live dashboard
+
+Run after every edit to web_content.h:
+
+    python3 tools/build_web_assets.py
+"""
+
+import gzip
+import hashlib
+import pathlib
+import re
+import struct
+import sys
+import zlib
+
+ROOT = pathlib.Path(__file__).resolve().parent.parent
+SKETCH_DIR = ROOT / "src" / "SEMBox"
+SOURCE = SKETCH_DIR / "web_content.h"
+OUTPUT = SKETCH_DIR / "web_assets.h"
+
+RAW_LITERAL = re.compile(
+    r'const char (\w+)\[\] PROGMEM = R"rawliteral\((.*?)\)rawliteral";',
+    re.DOTALL,
+)
+
+# symbol in web_content.h -> (canonical URL, content type, hashed URL pattern)
+# Documents have no hashed URL: they are revalidated on every load instead.
+ASSETS = {
+    "style_css": ("/style.css", "text/css", "/style.{hash}.css"),
+    "script_js": ("/script.js", "application/javascript", "/script.{hash}.js"),
+    "index_html": ("/index.html", "text/html", None),
+}
+
+# References inside index.html that are rewritten to the hashed URLs
+REFERENCES = {
+    "style_css": 'href="style.css"',
+    "script_js": 'src="script.js"',
+}
+
+# Bootstrap page: replacements in index.html ({css} and {js} are the
+# sources). Everything from {state} on is appended by the firmware, with
+# the status at {state} and the channel list at {channels}.
+BOOTSTRAP_PATH = "/"
+BOOTSTRAP_EDITS = [
+    ('<link rel="stylesheet" href="style.css">', '<style>\n{css}</style>'),
+    ('<script src="script.js"></script>',
+     '<script>\n{js}</script>\n    <script id="initial-status" type="application/json">{state}</script>'
+     '\n    <script id="initial-channels" type="application/json">{channels}</script>'),
+    # Painted live: no loading screen in front of the dashboard
+    ('class="loading-screen" id="loading-screen"', 'class="loading-screen hidden" id="loading-screen"'),
+    ('id="main-container" style="display: none;"', 'id="main-container" style="display: flex;"'),
+]
+
+
+def content_hash(data):
+    return hashlib.sha256(data).hexdigest()
+
+
+def compress(data):
+    # mtime=0 keeps the output byte-identical between builds
+    return gzip.compress(data, compresslevel=9, mtime=0)
+
+
+def c_bytes(data, indent="    ", per_line=16):
+    lines = []
+    for i in range(0, len(data), per_line):
+        chunk = data[i:i + per_line]
+        lines.append(indent + ", ".join("0x%02x" % b for b in chunk) + ",")
+    return "\n".join(lines)
+
+
+def load_sources():
+    text = SOURCE.read_text(encoding="utf-8")
+    sources = {name: body for name, body in RAW_LITERAL.findall(text)}
+    missing = [name for name in ASSETS if name not in sources]
+    if missing:
+        sys.exit("build_web_assets: missing in %s: %s" % (SOURCE.name, ", ".join(missing)))
+    return sources
+
+
+def build(sources):
+    assets = {}
+    hashed_urls = {}
+
+    # Hash sub-resources first so index.html can reference them
+    for name, (path, mime, hashed_pattern) in ASSETS.items():
+        body = sources[name]
+        if name == "index_html":
+            for ref_name, ref in REFERENCES.items():
+                if ref not in body:
+                    sys.exit("build_web_assets: index.html does not contain %s" % ref)
+                attr = ref.split("=")[0]
+                body = body.replace(ref, '%s="%s"' % (attr, hashed_urls[ref_name].lstrip("/")))
+
+        raw = body.encode("utf-8")
+        digest = content_hash(raw)
+        hashed_path = hashed_pattern.format(hash=digest[:8]) if hashed_pattern else None
+        if hashed_path:
+            hashed_urls[name] = hashed_path
+
+        assets[name] = {
+            "path": path,
+            "hashed_path": hashed_path,
+            "mime": mime,
+            "etag": '"%s"' % digest[:16],
+            "raw_size": len(raw),
+            "gz": compress(raw),
+        }
+    return assets
+
+
+def build_bootstrap(sources):
+    page = sources["index_html"]
+    if "</style" in sources["style_css"] or "</script" in sources["script_js"]:
+        sys.exit("build_web_assets: stylesheet or script cannot be inlined (closing tag inside)")
+    for old, new in BOOTSTRAP_EDITS:
+        if old not in page:
+            sys.exit("build_web_assets: index.html does not contain %s" % old)
+        page = page.replace(old, new.replace("{css}", sources["style_css"]).replace("{js}", sources["script_js"]))
+    parts = re.split(r"\{state\}|\{channels\}", page)
+    if len(parts) != 3 or page.find("{state}") > page.find("{channels}"):
+        sys.exit("build_web_assets: bootstrap page needs one {state}, then one {channels}")
+    head, middle, tail = parts
+    head = head.encode("utf-8")
+
+    # gzip header, then deflate blocks ending on a byte boundary (sync
+    # flush) and not final, so that a stored block can follow
+    compressor = zlib.compressobj(9, zlib.DEFLATED, -15)
+    deflated = compressor.compress(head) + compressor.flush(zlib.Z_SYNC_FLUSH)
+    header = b"\x1f\x8b\x08\x00\x00\x00\x00\x00\x02\xff"
+    return {
+        "path": BOOTSTRAP_PATH,
+        "mime": "text/html",
+        "gz": header + deflated,
+        "crc": zlib.crc32(head),
+        "raw_size": len(head),
+        "middle": middle,
+        "tail": tail,
+    }
+
+
+def splice(bootstrap, state, channels):
+    """The response the firmware sends for a given status (for checking)"""
+    rest = (state + bootstrap["middle"] + channels + bootstrap["tail"]).encode("utf-8")
+    crc = zlib.crc32(rest, bootstrap["crc"])
+    block = struct.pack("<BHH", 1, len(rest), len(rest) ^ 0xFFFF) + rest
+    trailer = struct.pack("<II", crc, (bootstrap["raw_size"] + len(rest)) & 0xFFFFFFFF)
+    return bootstrap["gz"] + block + trailer
+
+
+def c_string(text):
+    return '"%s"' % text.replace("\\", "\\\\").replace('"', '\\"').replace("\n", "\\n")
+
+
+def render(assets, bootstrap):
+    out = []
+    out.append("""/*********
+  SEMBox ESP32 - Compressed Web Assets
+  GENERATED by tools/build_web_assets.py from web_content.h - DO NOT EDIT
+
+  Each asset is stored gzip-compressed together with a strong ETag.
+  Stylesheet and script are also reachable under a content-hashed URL
+  which may be cached as immutable. The assets are constexpr, so their
+  URLs can appear in the route table.
+*********/
+
+#ifndef WEB_ASSETS_H
+#define WEB_ASSETS_H
+
+#include <Arduino.h>
+
+struct WebAsset {
+    const char* path;           // Canonical URL (revalidated with ETag)
+    const char* hashedPath;     // Content-hashed URL (immutable), or nullptr
+    const char* contentType;
+    const char* etag;           // Strong ETag, including quotes
+    const uint8_t* data;        // gzip-compressed body
+    size_t length;              // Compressed length
+    size_t rawLength;           // Uncompressed length (informational)
+};
+
+// The page at / with stylesheet and script inlined: a gzip stream cut
+// after its last full deflate block. The firmware appends the status,
+// middle, channel list and tail as a final stored block, then CRC-32
+// (continued from headCrc) and length of the whole page (see GzipSplice).
+struct WebBootstrap {
+    const char* path;
+    const char* contentType;
+    const uint8_t* head;        // gzip header and deflate blocks, not final
+    size_t headLength;
+    uint32_t headCrc;           // CRC-32 of the uncompressed head
+    uint32_t headRawLength;
+    const char* middle;         // Between the status and the channel list
+    const char* tail;           // Closes the page after the channel list
+};
+""")
+
+    for name, a in assets.items():
+        out.append("// %s: %d -> %d bytes (%.0f%% of raw)" % (
+            a["path"], a["raw_size"], len(a["gz"]),
+            100.0 * len(a["gz"]) / a["raw_size"]))
+        out.append("const uint8_t %s_gz[] PROGMEM = {" % name)
+        out.append(c_bytes(a["gz"]))
+        out.append("};\n")
+
+    for name, a in assets.items():
+        hashed = '"%s"' % a["hashed_path"] if a["hashed_path"] else "nullptr"
+        out.append("constexpr WebAsset asset_%s = {" % name)
+        out.append('    "%s", %s, "%s", "%s",' % (
+            a["path"], hashed, a["mime"], a["etag"].replace('"', '\\"')))
+        out.append("    %s_gz, sizeof(%s_gz), %d" % (name, name, a["raw_size"]))
+        out.append("};\n")
+
+    out.append("// %s (bootstrap): %d -> %d bytes, plus status and channels" % (
+        bootstrap["path"], bootstrap["raw_size"], len(bootstrap["gz"])))
+    out.append("const uint8_t bootstrap_gz[] PROGMEM = {")
+    out.append(c_bytes(bootstrap["gz"]))
+    out.append("};\n")
+    out.append("constexpr WebBootstrap asset_bootstrap = {")
+    out.append('    "%s", "%s", bootstrap_gz, sizeof(bootstrap_gz), 0x%08xu, %d,' % (
+        bootstrap["path"], bootstrap["mime"], bootstrap["crc"], bootstrap["raw_size"]))
+    out.append("    %s," % c_string(bootstrap["middle"]))
+    out.append("    %s" % c_string(bootstrap["tail"]))
+    out.append("};\n")
+
+    out.append("#endif // WEB_ASSETS_H")
+    return "\n".join(out) + "\n"
+
+
+def main():
+    sources = load_sources()
+    assets = build(sources)
+    bootstrap = build_bootstrap(sources)
+
+    # The spliced page must decompress to the page with a status in it
+    sample = '{"led":"off"}'
+    channels = '[{"name":"led"}]'
+    page = gzip.decompress(splice(bootstrap, sample, channels)).decode("utf-8")
+    if sample not in page or channels not in page or not page.rstrip().endswith("</html>"):
+        sys.exit("build_web_assets: bootstrap page does not splice")
+
+    OUTPUT.write_text(render(assets, bootstrap), encoding="utf-8")
+
+    total_raw = sum(a["raw_size"] for a in assets.values())
+    total_gz = sum(len(a["gz"]) for a in assets.values())
+    for a in assets.values():
+        print("%-22s %6d -> %6d bytes  etag %s" % (
+            a["hashed_path"] or a["path"], a["raw_size"], len(a["gz"]), a["etag"]))
+    print("total                  %6d -> %6d bytes (%.0f%% saved)" % (
+        total_raw, total_gz, 100.0 * (1 - total_gz / total_raw)))
+    print("%-22s %6d -> %6d bytes  (bootstrap, plus status and channels)" % (
+        bootstrap["path"], bootstrap["raw_size"], len(bootstrap["gz"])))
+
+
+if __name__ == "__main__":
+    main()